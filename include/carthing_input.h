@@ -49,6 +49,7 @@ void CTInputClose(void);
 bool CTInputPollEvent(CTInputEvent *event);
 bool CTInputIsButtonDown(CTButton button);
 bool CTInputGetTouchPosition(int *x, int *y);
+bool CTInputWait(int timeoutMs);
 
 #ifdef __cplusplus
 }
@@ -49,6 +49,13 @@ typedef struct LlzPluginAPI {
     // when plugin closes. Used by plugins that modify visibility or sort order.
     // Default behavior (NULL): no refresh
     bool (*wants_refresh)(void);
+
+    // Optional: If provided, called after update. Return true while the plugin
+    // is animating and needs every frame; return false when nothing moves and
+    // the host may drop to its idle rate (see llz_sdk_governor.h). One-off
+    // changes can still be shown with LlzGovernorRequestRedraw.
+    // Default behavior (NULL): drawn every frame
+    bool (*wants_redraw)(void);
 } LlzPluginAPI;
 
 typedef const LlzPluginAPI *(*LlzGetPluginFunc)(void);
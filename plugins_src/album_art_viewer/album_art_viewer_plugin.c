@@ -32,13 +32,13 @@
 #include <string.h>
 #include <dirent.h>
 #include <sys/stat.h>
-#include <webp/decode.h>
 
 // Album art cache directory (matches golang_ble_client)
 #define AAV_CACHE_DIR "/var/mediadash/album_art_cache"
 #define AAV_MAX_CACHE_ENTRIES 256
 #define AAV_HASH_LEN 16
 #define AAV_PATH_LEN 256
+#define AAV_DECODE_BYTES_PER_FRAME (32 * 1024)   // WebP data decoded per frame
 
 // Colors
 #define AAV_BG_COLOR       (Color){12, 12, 18, 255}
@@ -73,6 +73,11 @@ typedef struct {
     bool textureLoaded;
     char loadedPath[AAV_PATH_LEN];
 
+    // Art being decoded, a slice per frame
+    LlzImageDecoder *decoder;
+    char decodePath[AAV_PATH_LEN];
+    int decodeDirection;
+
     // Carousel state
     Texture2D prevTexture;
     bool prevTextureLoaded;
@@ -107,74 +112,24 @@ typedef struct {
 
 static AavState g_state;
 
-// Custom font for international character support
+// Shared SDK font (glyphs beyond Latin-1 are added on demand by the SDK)
 static Font g_customFont;
-static bool g_fontLoaded = false;
-
-// Build Unicode codepoints for international character support
-static int *BuildUnicodeCodepoints(int *outCount) {
-    static const int ranges[][2] = {
-        {0x0020, 0x007E},   // ASCII
-        {0x00A0, 0x00FF},   // Latin-1 Supplement
-        {0x0100, 0x017F},   // Latin Extended-A
-        {0x0180, 0x024F},   // Latin Extended-B
-        {0x0400, 0x04FF},   // Cyrillic
-        {0x0500, 0x052F},   // Cyrillic Supplement
-    };
-
-    const int numRanges = sizeof(ranges) / sizeof(ranges[0]);
-    int total = 0;
-    for (int i = 0; i < numRanges; i++) {
-        total += (ranges[i][1] - ranges[i][0] + 1);
-    }
-
-    int *codepoints = (int *)malloc(total * sizeof(int));
-    if (!codepoints) {
-        *outCount = 0;
-        return NULL;
-    }
-
-    int idx = 0;
-    for (int i = 0; i < numRanges; i++) {
-        for (int cp = ranges[i][0]; cp <= ranges[i][1]; cp++) {
-            codepoints[idx++] = cp;
-        }
-    }
-
-    *outCount = total;
-    return codepoints;
-}
 
 static void LoadCustomFont(void) {
-    int codepointCount = 0;
-    int *codepoints = BuildUnicodeCodepoints(&codepointCount);
-
-    // Use SDK font loading with custom codepoints for international character support
-    g_customFont = LlzFontLoadCustom(LLZ_FONT_UI, 48, codepoints, codepointCount);
-    if (g_customFont.texture.id != 0) {
-        g_fontLoaded = true;
-        SetTextureFilter(g_customFont.texture, TEXTURE_FILTER_BILINEAR);
-        printf("[AAV] Loaded font via SDK with %d Unicode codepoints\n", codepointCount);
-    } else {
-        g_customFont = GetFontDefault();
-        printf("[AAV] Using default font (SDK font load failed)\n");
-    }
-
-    if (codepoints) free(codepoints);
+    g_customFont = LlzFontGet(LLZ_FONT_UI, 48);
+    printf("[AAV] Loaded font via SDK\n");
 }
 
 static void UnloadCustomFont(void) {
-    Font defaultFont = GetFontDefault();
-    if (g_fontLoaded && g_customFont.texture.id != 0 && g_customFont.texture.id != defaultFont.texture.id) {
-        UnloadFont(g_customFont);
-    }
-    g_fontLoaded = false;
+    // The SDK font is shared with other plugins; nothing to unload
+    g_customFont = GetFontDefault();
 }
 
 // Forward declarations
 static void AavLoadCacheDirectory(void);
 static void AavLoadTextureFromPath(const char *path);
 static void AavLoadTextureWithTransition(const char *path, int direction);
+static void AavPumpDecode(void);
 static void AavUnloadPrevTexture(void);
 static void AavUnloadTexture(void);
 static void AavDrawImage(void);
@@ -183,82 +138,6 @@ static void AavDrawControls(void);
 static void AavRequestCurrentArt(void);
 static void AavDrawRequestIndicator(void);
 
-// Load WebP image file and convert to raylib Image format
-// (raylib doesn't support WebP natively, so we use libwebp)
-static Image LoadImageWebP(const char *path)
-{
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        printf("[AAV] LoadImageWebP: failed to open file '%s'\n", path);
-        return image;
-    }
-
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Read file data
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        printf("[AAV] LoadImageWebP: failed to allocate %ld bytes\n", fileSize);
-        fclose(file);
-        return image;
-    }
-
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        printf("[AAV] LoadImageWebP: read %zu bytes, expected %ld\n", bytesRead, fileSize);
-        free(fileData);
-        return image;
-    }
-
-    // Decode WebP
-    int width, height;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
-
-    if (!rgbaData) {
-        printf("[AAV] LoadImageWebP: WebPDecodeRGBA failed\n");
-        return image;
-    }
-
-    // Create raylib Image from RGBA data
-    // We need to copy the data because WebP uses its own allocator
-    size_t dataSize = width * height * 4;
-    void *imageCopy = RL_MALLOC(dataSize);
-    if (!imageCopy) {
-        printf("[AAV] LoadImageWebP: failed to allocate image data\n");
-        WebPFree(rgbaData);
-        return image;
-    }
-
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
-
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    printf("[AAV] LoadImageWebP: decoded %dx%d image\n", width, height);
-    return image;
-}
-
-// Check if a file path has a .webp extension
-static bool IsWebPFile(const char *path)
-{
-    if (!path) return false;
-    size_t len = strlen(path);
-    if (len < 5) return false;
-    const char *ext = path + len - 5;
-    return (strcmp(ext, ".webp") == 0 || strcmp(ext, ".WEBP") == 0);
-}
-
 static void PluginInit(int width, int height)
 {
     g_state.screenWidth = width;
@@ -321,6 +200,7 @@ static void PluginInit(int width, int height)
 
 static void PluginShutdown(void)
 {
+    LlzImageDecoderClose(g_state.decoder);
     AavUnloadTexture();
 
     // Cleanup blur textures
@@ -398,11 +278,16 @@ static void AavLoadCacheDirectory(void)
     closedir(dir);
 }
 
-// Load texture with optional carousel transition
+// Start decoding art; it is shown with an optional carousel transition once
+// AavPumpDecode finishes it
 static void AavLoadTextureWithTransition(const char *path, int direction)
 {
     if (!path || path[0] == '\0') return;
     if (strcmp(path, g_state.loadedPath) == 0 && g_state.textureLoaded) return;
+    if (g_state.decoder && strcmp(path, g_state.decodePath) == 0) {
+        g_state.decodeDirection = direction;
+        return;
+    }
 
     // Check if file exists
     struct stat st;
@@ -410,23 +295,41 @@ static void AavLoadTextureWithTransition(const char *path, int direction)
         return;
     }
 
-    // Use WebP decoder for .webp files, raylib's LoadImage for others
-    Image img;
-    if (IsWebPFile(path)) {
-        img = LoadImageWebP(path);
-    } else {
-        img = LoadImage(path);
+    // WebP and anything raylib can load. Browsing quickly drops the
+    // half-decoded art instead of paying for every cover passed over.
+    LlzImageDecoderClose(g_state.decoder);
+    g_state.decoder = LlzImageDecoderOpen(path, 0);
+    if (!g_state.decoder) return;
+    strncpy(g_state.decodePath, path, sizeof(g_state.decodePath) - 1);
+    g_state.decodePath[sizeof(g_state.decodePath) - 1] = '\0';
+    g_state.decodeDirection = direction;
+
+    // Small covers finish in the first slice and show this frame
+    AavPumpDecode();
+}
+
+// Feed the pending decode one slice; upload it when complete
+static void AavPumpDecode(void)
+{
+    if (!g_state.decoder) return;
+    if (LlzImageDecoderStep(g_state.decoder, AAV_DECODE_BYTES_PER_FRAME) == LLZ_IMAGE_DECODE_MORE) {
+        return;
     }
 
+    Image img = LlzImageDecoderFinish(g_state.decoder);
+    g_state.decoder = NULL;
     if (img.data == NULL) {
         return;
     }
 
+    const char *path = g_state.decodePath;
+    int direction = g_state.decodeDirection;
     Texture2D newTexture = LoadTextureFromImage(img);
 
     // Create blurred background texture (blur and darken)
-    Image blurredImg = LlzImageBlur(img, 12, 0.4f);
+    Image blurredImg = LlzImageBlurReduced(img, 12, 0.4f);
     Texture2D newBlurTexture = LoadTextureFromImage(blurredImg);
+    SetTextureFilter(newBlurTexture, TEXTURE_FILTER_BILINEAR);
     UnloadImage(blurredImg);
     UnloadImage(img);
 
@@ -503,6 +406,8 @@ static void PluginUpdate(const LlzInputState *input, float deltaTime)
     // Update background system
     LlzBackgroundUpdate(deltaTime);
 
+    AavPumpDecode();
+
     // Update blur textures for SDK background
     float currentBlurAlpha = g_state.blurTextureLoaded ? (1.0f - fabsf(g_state.carouselOffset) * 0.5f) : 0.0f;
     float prevBlurAlpha = g_state.prevBlurTextureLoaded ? fabsf(g_state.carouselOffset) * 0.5f : 0.0f;
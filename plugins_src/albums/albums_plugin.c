@@ -20,8 +20,6 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
-#include <sys/stat.h>
-#include <webp/decode.h>
 
 // ============================================================================
 // Display Constants
@@ -47,10 +45,8 @@
 #define INFO_FONT_SIZE 17
 #define HINT_FONT_SIZE 18
 
-// Album art cache paths - separate preview and full art folders
+// Thumbnails held at once; the textures live in the SDK art cache
 #define MAX_ALBUM_ART_CACHE 50
-#define ALBUM_ART_PREVIEW_DIR "/var/mediadash/album_art_previews"
-#define ALBUM_ART_CACHE_DIR "/var/mediadash/album_art_cache"
 
 // Smooth scrolling physics - optimized for buttery smooth feel
 #define SCROLL_LERP_SPEED 8.0f          // Lower = smoother deceleration
@@ -79,8 +75,7 @@ static const Color SPOTIFY_SUBTLE = {179, 179, 179, 255};
 
 typedef struct {
     char hash[64];           // Art hash (artist|album CRC32)
-    Texture2D texture;       // Loaded texture
-    bool loaded;             // True if texture is valid
+    float lastUse;           // g_animTimer when last drawn or checked (LRU)
     bool requested;          // True if art has been requested via BLE
     float requestTime;       // Time when art was requested (for retry logic)
 } AlbumArtCacheEntry;
@@ -113,6 +108,7 @@ static int g_dataVersion = 0;  // Incremented when data changes, for cache inval
 // Album art cache
 static AlbumArtCacheEntry g_artCache[MAX_ALBUM_ART_CACHE];
 static int g_artCacheCount = 0;
+static LlzPrefetch *g_artPrefetch = NULL;   // THUMB handles for the cards on and near screen
 
 // Carousel state - smooth scrolling
 static int g_selectedIndex = 0;
@@ -162,6 +158,7 @@ static void CleanupAlbumArtCache(void);
 static AlbumArtCacheEntry* GetOrCreateArtCacheEntry(const char *artist, const char *album);
 static void CheckAndLoadAlbumArt(int albumIndex);
 static void UpdateAlbumArtLoading(float dt);
+static void UpdateAlbumArtPrefetch(float motion, float dt);
 
 // ============================================================================
 // Utility Functions
@@ -180,115 +177,33 @@ static float Clamp(float value, float min, float max) {
 static void DrawTruncatedText(const char *text, float x, float y, float maxWidth, int fontSize, Color color) {
     if (!text || text[0] == '\0') return;
 
-    int textWidth = LlzMeasureText(text, fontSize);
-    if (textWidth <= (int)maxWidth) {
+    int keep = LlzFitText(text, fontSize, (int)maxWidth, "..");
+    if (text[keep] == '\0') {
         LlzDrawText(text, (int)x, (int)y, fontSize, color);
         return;
     }
 
     char truncated[128];
-    int len = strlen(text);
-    if (len > 120) len = 120;
-
-    for (int i = len; i > 0; i--) {
-        strncpy(truncated, text, i);
-        truncated[i] = '\0';
-        strcat(truncated, "..");
-        if (LlzMeasureText(truncated, fontSize) <= (int)maxWidth) {
-            LlzDrawText(truncated, (int)x, (int)y, fontSize, color);
-            return;
-        }
-    }
-    LlzDrawText("..", (int)x, (int)y, fontSize, color);
+    if (keep > 120) keep = 120;
+    snprintf(truncated, sizeof(truncated), "%.*s..", keep, text);
+    LlzDrawText(truncated, (int)x, (int)y, fontSize, color);
 }
 
 static void DrawCenteredTruncatedText(const char *text, float centerX, float y, float maxWidth, int fontSize, Color color) {
     if (!text || text[0] == '\0') return;
 
     char truncated[128];
-    int textWidth = LlzMeasureText(text, fontSize);
-
-    if (textWidth <= (int)maxWidth) {
+    int keep = LlzFitText(text, fontSize, (int)maxWidth, "..");
+    if (text[keep] == '\0') {
+        int textWidth = LlzMeasureText(text, fontSize);
         LlzDrawText(text, (int)(centerX - textWidth / 2), (int)y, fontSize, color);
         return;
     }
 
-    int len = strlen(text);
-    if (len > 120) len = 120;
-
-    for (int i = len; i > 0; i--) {
-        strncpy(truncated, text, i);
-        truncated[i] = '\0';
-        strcat(truncated, "..");
-        textWidth = LlzMeasureText(truncated, fontSize);
-        if (textWidth <= (int)maxWidth) {
-            LlzDrawText(truncated, (int)(centerX - textWidth / 2), (int)y, fontSize, color);
-            return;
-        }
-    }
-    textWidth = LlzMeasureText("..", fontSize);
-    LlzDrawText("..", (int)(centerX - textWidth / 2), (int)y, fontSize, color);
-}
-
-// Check if a file is WebP format
-static bool IsWebPFile(const char *path) {
-    if (!path) return false;
-    size_t len = strlen(path);
-    if (len < 5) return false;
-    return (strcmp(path + len - 5, ".webp") == 0);
-}
-
-// Load WebP image file and convert to raylib Image format
-static Image LoadImageWebP(const char *path) {
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        return image;
-    }
-
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        fclose(file);
-        return image;
-    }
-
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        free(fileData);
-        return image;
-    }
-
-    int width, height;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
-
-    if (!rgbaData) {
-        return image;
-    }
-
-    int dataSize = width * height * 4;
-    void *imageCopy = malloc(dataSize);
-    if (!imageCopy) {
-        WebPFree(rgbaData);
-        return image;
-    }
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
-
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    return image;
+    if (keep > 120) keep = 120;
+    snprintf(truncated, sizeof(truncated), "%.*s..", keep, text);
+    int textWidth = LlzMeasureText(truncated, fontSize);
+    LlzDrawText(truncated, (int)(centerX - textWidth / 2), (int)y, fontSize, color);
 }
 
 // ============================================================================
@@ -298,14 +213,12 @@ static Image LoadImageWebP(const char *path) {
 static void InitAlbumArtCache(void) {
     memset(g_artCache, 0, sizeof(g_artCache));
     g_artCacheCount = 0;
+    g_artPrefetch = LlzPrefetchCreate(LLZ_ART_VARIANT_THUMB);
 }
 
 static void CleanupAlbumArtCache(void) {
-    for (int i = 0; i < g_artCacheCount; i++) {
-        if (g_artCache[i].loaded && g_artCache[i].texture.id != 0) {
-            UnloadTexture(g_artCache[i].texture);
-        }
-    }
+    LlzPrefetchDestroy(g_artPrefetch);
+    g_artPrefetch = NULL;
     memset(g_artCache, 0, sizeof(g_artCache));
     g_artCacheCount = 0;
 }
@@ -324,64 +237,28 @@ static AlbumArtCacheEntry* GetOrCreateArtCacheEntry(const char *artist, const ch
     if (!hash || hash[0] == '\0') return NULL;
 
     AlbumArtCacheEntry *entry = FindArtCacheEntry(hash);
-    if (entry) return entry;
+    if (entry) {
+        entry->lastUse = g_animTimer;
+        return entry;
+    }
 
-    if (g_artCacheCount >= MAX_ALBUM_ART_CACHE) {
-        if (g_artCache[0].loaded && g_artCache[0].texture.id != 0) {
-            UnloadTexture(g_artCache[0].texture);
+    if (g_artCacheCount < MAX_ALBUM_ART_CACHE) {
+        entry = &g_artCache[g_artCacheCount++];
+    } else {
+        // Reuse the least recently used slot
+        entry = &g_artCache[0];
+        for (int i = 1; i < g_artCacheCount; i++) {
+            if (g_artCache[i].lastUse < entry->lastUse) entry = &g_artCache[i];
         }
-        memmove(&g_artCache[0], &g_artCache[1], sizeof(AlbumArtCacheEntry) * (MAX_ALBUM_ART_CACHE - 1));
-        g_artCacheCount = MAX_ALBUM_ART_CACHE - 1;
     }
 
-    entry = &g_artCache[g_artCacheCount];
     memset(entry, 0, sizeof(*entry));
     strncpy(entry->hash, hash, sizeof(entry->hash) - 1);
-    g_artCacheCount++;
+    entry->lastUse = g_animTimer;
 
     return entry;
 }
 
-// Try to load album art from either preview or full cache folder
-static bool TryLoadAlbumArt(AlbumArtCacheEntry *entry, const char *albumName) {
-    char artPath[512];
-    struct stat st;
-
-    // First try the preview folder (smaller 150x150 images for library browsing)
-    snprintf(artPath, sizeof(artPath), "%s/%s.webp", ALBUM_ART_PREVIEW_DIR, entry->hash);
-    if (stat(artPath, &st) == 0 && st.st_size > 0) {
-        printf("[ALBUMS] Loading preview art for '%s' from %s\n", albumName, artPath);
-        Image img = LoadImageWebP(artPath);
-        if (img.data != NULL) {
-            entry->texture = LoadTextureFromImage(img);
-            UnloadImage(img);
-            if (entry->texture.id != 0) {
-                entry->loaded = true;
-                printf("[ALBUMS] Preview art loaded: %s (%dx%d)\n", albumName, entry->texture.width, entry->texture.height);
-                return true;
-            }
-        }
-    }
-
-    // Fallback to full album art cache (larger 250x250 images)
-    snprintf(artPath, sizeof(artPath), "%s/%s.webp", ALBUM_ART_CACHE_DIR, entry->hash);
-    if (stat(artPath, &st) == 0 && st.st_size > 0) {
-        printf("[ALBUMS] Loading full art for '%s' from %s\n", albumName, artPath);
-        Image img = LoadImageWebP(artPath);
-        if (img.data != NULL) {
-            entry->texture = LoadTextureFromImage(img);
-            UnloadImage(img);
-            if (entry->texture.id != 0) {
-                entry->loaded = true;
-                printf("[ALBUMS] Full art loaded: %s (%dx%d)\n", albumName, entry->texture.width, entry->texture.height);
-                return true;
-            }
-        }
-    }
-
-    return false;
-}
-
 static void CheckAndLoadAlbumArt(int albumIndex) {
     // Defensive bounds check with safe accessor
     int count = SafeItemCount();
@@ -395,12 +272,9 @@ static void CheckAndLoadAlbumArt(int albumIndex) {
     AlbumArtCacheEntry *entry = GetOrCreateArtCacheEntry(album->artist, album->name);
     if (!entry) return;
 
-    if (entry->loaded) return;
-
-    // Try to load from disk (preview or full cache)
-    if (TryLoadAlbumArt(entry, album->name)) {
-        return;
-    }
+    // The SDK art cache loads the preview (or full) art in the background;
+    // only art that is not on disk at all needs requesting from the phone
+    if (!LlzArtCacheIsMissing(LlzPrefetchGet(g_artPrefetch, albumIndex))) return;
 
     // File doesn't exist in either location, request it if not already requested (or retry after timeout)
     float timeSinceRequest = g_animTimer - entry->requestTime;
@@ -429,14 +303,33 @@ static void UpdateAlbumArtLoading(float dt) {
     ClampSelectedIndex();
     int count = SafeItemCount();
 
-    // Check art for visible albums (selected +/- 3), staggered to prevent burst loading
-    static int loadOffset = -3;
-    int idx = g_selectedIndex + loadOffset;
-    if (idx >= 0 && idx < count) {
-        CheckAndLoadAlbumArt(idx);
+    // Ask the phone for any visible album art that is not on disk yet
+    for (int idx = g_selectedIndex - 3; idx <= g_selectedIndex + 3; idx++) {
+        if (idx >= 0 && idx < count) CheckAndLoadAlbumArt(idx);
     }
-    loadOffset++;
-    if (loadOffset > 3) loadOffset = -3;
+}
+
+static const char *AlbumArtKey(int index, void *user) {
+    (void)user;
+    if (index < 0 || index >= SafeItemCount()) return NULL;
+
+    const LlzSpotifyAlbumItem *album = &g_albums.items[index];
+    if (!album->artist[0] || !album->name[0]) return NULL;
+    return LlzMediaGenerateArtHash(album->artist, album->name);
+}
+
+// Keep the art for the cards on screen and the ones the scroll is heading
+// towards loading, nearest first
+static void UpdateAlbumArtPrefetch(float motion, float dt) {
+    if (!HasValidData()) return;
+
+    LlzPrefetchView view = {
+        .count = SafeItemCount(),
+        .position = g_visualOffset,
+        .velocity = dt > 0.0f ? motion / dt : 0.0f,
+        .visibleRadius = 3
+    };
+    LlzPrefetchUpdate(g_artPrefetch, view, AlbumArtKey, NULL);
 }
 
 // ============================================================================
@@ -540,12 +433,14 @@ static void DrawAlbumCard(int index, float centerX, float y, float scale, float
 
     // Try to get album art
     AlbumArtCacheEntry *artEntry = GetOrCreateArtCacheEntry(album->artist, album->name);
-    bool hasArt = artEntry && artEntry->loaded && artEntry->texture.id != 0;
+    Texture2D artTexture = {0};
+    Rectangle artSource = {0};
+    bool hasArt = LlzArtCacheGetRegion(LlzPrefetchGet(g_artPrefetch, index), &artTexture, &artSource);
 
     if (hasArt) {
         Rectangle artBounds = {artX, artY, artSize, artSize};
         Color tint = {255, 255, 255, (unsigned char)(255 * alpha)};
-        LlzDrawTextureRounded(artEntry->texture, artBounds, 0.08f, 8, tint);
+        LlzDrawTextureRegionRounded(artTexture, artSource, artBounds, 0.08f, 8, tint);
     } else {
         // Gradient placeholder
         Color gradTop = {(unsigned char)(60 + (index * 17) % 60), (unsigned char)(60 + (index * 23) % 60), (unsigned char)(80 + (index * 31) % 60), (unsigned char)(255 * alpha)};
@@ -562,7 +457,7 @@ static void DrawAlbumCard(int index, float centerX, float y, float scale, float
         LlzDrawTextCentered(initial, (int)(artX + artSize/2), (int)(artY + artSize/2 - initSize/3), initSize, initColor);
 
         // Loading dots
-        if (artEntry && artEntry->requested && !artEntry->loaded) {
+        if (artEntry && artEntry->requested) {
             int dotCount = ((int)(g_animTimer * 4)) % 4;
             char dots[5] = "";
             for (int i = 0; i < dotCount; i++) strcat(dots, ".");
@@ -807,6 +702,7 @@ static void PollAlbums(float dt) {
         if (LlzMediaGetLibraryAlbums(&temp) && temp.valid) {
             int oldCount = g_albums.itemCount;
             memcpy(&g_albums, &temp, sizeof(temp));
+            LlzPrefetchReset(g_artPrefetch);   // Indices may now be other albums
 
             if (g_albums.itemCount > 0) {
                 g_loadState = LOAD_STATE_LOADED;
@@ -861,7 +757,9 @@ static void plugin_update(const LlzInputState *input, float deltaTime) {
         return;
     }
 
+    float previousOffset = g_visualOffset;
     UpdateCarousel(input, deltaTime);
+    UpdateAlbumArtPrefetch(g_visualOffset - previousOffset, deltaTime);
 }
 
 static void plugin_draw(void) {
@@ -20,8 +20,6 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
-#include <sys/stat.h>
-#include <webp/decode.h>
 
 // ============================================================================
 // Display Constants
@@ -49,8 +47,6 @@
 
 // Artist art cache paths
 #define MAX_ARTIST_ART_CACHE 50
-#define ALBUM_ART_PREVIEW_DIR "/var/mediadash/album_art_previews"
-#define ALBUM_ART_CACHE_DIR "/var/mediadash/album_art_cache"
 
 // Smooth scrolling physics
 #define SCROLL_LERP_SPEED 8.0f
@@ -79,8 +75,7 @@ static const Color SPOTIFY_SUBTLE = {179, 179, 179, 255};
 
 typedef struct {
     char hash[64];           // Art hash (artist name CRC32)
-    Texture2D texture;       // Loaded texture
-    bool loaded;             // True if texture is valid
+    float lastUse;           // g_animTimer when last drawn or checked (LRU)
     bool requested;          // True if art has been requested via BLE
     float requestTime;       // Time when art was requested (for retry logic)
 } ArtistArtCacheEntry;
@@ -113,6 +108,7 @@ static int g_dataVersion = 0;  // Incremented when data changes
 // Artist art cache
 static ArtistArtCacheEntry g_artCache[MAX_ARTIST_ART_CACHE];
 static int g_artCacheCount = 0;
+static LlzPrefetch *g_artPrefetch = NULL;   // THUMB handles for the cards on and near screen
 
 // Carousel state - smooth scrolling
 static int g_selectedIndex = 0;
@@ -162,6 +158,7 @@ static void CleanupArtistArtCache(void);
 static ArtistArtCacheEntry* GetOrCreateArtCacheEntry(const char *artistName);
 static void CheckAndLoadArtistArt(int artistIndex);
 static void UpdateArtistArtLoading(float dt);
+static void UpdateArtistArtPrefetch(float motion, float dt);
 
 // ============================================================================
 // Utility Functions
@@ -181,28 +178,17 @@ static void DrawCenteredTruncatedText(const char *text, float centerX, float y,
     if (!text || text[0] == '\0') return;
 
     char truncated[128];
-    int textWidth = LlzMeasureText(text, fontSize);
-
-    if (textWidth <= (int)maxWidth) {
+    int keep = LlzFitText(text, fontSize, (int)maxWidth, "..");
+    if (text[keep] == '\0') {
+        int textWidth = LlzMeasureText(text, fontSize);
         LlzDrawText(text, (int)(centerX - textWidth / 2), (int)y, fontSize, color);
         return;
     }
 
-    int len = strlen(text);
-    if (len > 120) len = 120;
-
-    for (int i = len; i > 0; i--) {
-        strncpy(truncated, text, i);
-        truncated[i] = '\0';
-        strcat(truncated, "..");
-        textWidth = LlzMeasureText(truncated, fontSize);
-        if (textWidth <= (int)maxWidth) {
-            LlzDrawText(truncated, (int)(centerX - textWidth / 2), (int)y, fontSize, color);
-            return;
-        }
-    }
-    textWidth = LlzMeasureText("..", fontSize);
-    LlzDrawText("..", (int)(centerX - textWidth / 2), (int)y, fontSize, color);
+    if (keep > 120) keep = 120;
+    snprintf(truncated, sizeof(truncated), "%.*s..", keep, text);
+    int textWidth = LlzMeasureText(truncated, fontSize);
+    LlzDrawText(truncated, (int)(centerX - textWidth / 2), (int)y, fontSize, color);
 }
 
 // Format follower count nicely (e.g., 1.2M, 45K)
@@ -216,59 +202,6 @@ static void FormatFollowers(int followers, char *out, size_t outSize) {
     }
 }
 
-// Load WebP image file and convert to raylib Image format
-static Image LoadImageWebP(const char *path) {
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        return image;
-    }
-
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        fclose(file);
-        return image;
-    }
-
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        free(fileData);
-        return image;
-    }
-
-    int width, height;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
-
-    if (!rgbaData) {
-        return image;
-    }
-
-    int dataSize = width * height * 4;
-    void *imageCopy = malloc(dataSize);
-    if (!imageCopy) {
-        WebPFree(rgbaData);
-        return image;
-    }
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
-
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    return image;
-}
-
 // ============================================================================
 // Artist Art Cache Management
 // ============================================================================
@@ -276,14 +209,12 @@ static Image LoadImageWebP(const char *path) {
 static void InitArtistArtCache(void) {
     memset(g_artCache, 0, sizeof(g_artCache));
     g_artCacheCount = 0;
+    g_artPrefetch = LlzPrefetchCreate(LLZ_ART_VARIANT_THUMB);
 }
 
 static void CleanupArtistArtCache(void) {
-    for (int i = 0; i < g_artCacheCount; i++) {
-        if (g_artCache[i].loaded && g_artCache[i].texture.id != 0) {
-            UnloadTexture(g_artCache[i].texture);
-        }
-    }
+    LlzPrefetchDestroy(g_artPrefetch);
+    g_artPrefetch = NULL;
     memset(g_artCache, 0, sizeof(g_artCache));
     g_artCacheCount = 0;
 }
@@ -307,64 +238,28 @@ static ArtistArtCacheEntry* GetOrCreateArtCacheEntry(const char *artistName) {
     if (!hash || hash[0] == '\0') return NULL;
 
     ArtistArtCacheEntry *entry = FindArtCacheEntry(hash);
-    if (entry) return entry;
+    if (entry) {
+        entry->lastUse = g_animTimer;
+        return entry;
+    }
 
-    if (g_artCacheCount >= MAX_ARTIST_ART_CACHE) {
-        if (g_artCache[0].loaded && g_artCache[0].texture.id != 0) {
-            UnloadTexture(g_artCache[0].texture);
+    if (g_artCacheCount < MAX_ARTIST_ART_CACHE) {
+        entry = &g_artCache[g_artCacheCount++];
+    } else {
+        // Reuse the least recently used slot
+        entry = &g_artCache[0];
+        for (int i = 1; i < g_artCacheCount; i++) {
+            if (g_artCache[i].lastUse < entry->lastUse) entry = &g_artCache[i];
         }
-        memmove(&g_artCache[0], &g_artCache[1], sizeof(ArtistArtCacheEntry) * (MAX_ARTIST_ART_CACHE - 1));
-        g_artCacheCount = MAX_ARTIST_ART_CACHE - 1;
     }
 
-    entry = &g_artCache[g_artCacheCount];
     memset(entry, 0, sizeof(*entry));
     strncpy(entry->hash, hash, sizeof(entry->hash) - 1);
-    g_artCacheCount++;
+    entry->lastUse = g_animTimer;
 
     return entry;
 }
 
-// Try to load artist art from cache folders
-static bool TryLoadArtistArt(ArtistArtCacheEntry *entry, const char *artistName) {
-    char artPath[512];
-    struct stat st;
-
-    // First try the preview folder
-    snprintf(artPath, sizeof(artPath), "%s/%s.webp", ALBUM_ART_PREVIEW_DIR, entry->hash);
-    if (stat(artPath, &st) == 0 && st.st_size > 0) {
-        printf("[ARTISTS] Loading preview art for '%s' from %s\n", artistName, artPath);
-        Image img = LoadImageWebP(artPath);
-        if (img.data != NULL) {
-            entry->texture = LoadTextureFromImage(img);
-            UnloadImage(img);
-            if (entry->texture.id != 0) {
-                entry->loaded = true;
-                printf("[ARTISTS] Preview art loaded: %s (%dx%d)\n", artistName, entry->texture.width, entry->texture.height);
-                return true;
-            }
-        }
-    }
-
-    // Fallback to full art cache
-    snprintf(artPath, sizeof(artPath), "%s/%s.webp", ALBUM_ART_CACHE_DIR, entry->hash);
-    if (stat(artPath, &st) == 0 && st.st_size > 0) {
-        printf("[ARTISTS] Loading full art for '%s' from %s\n", artistName, artPath);
-        Image img = LoadImageWebP(artPath);
-        if (img.data != NULL) {
-            entry->texture = LoadTextureFromImage(img);
-            UnloadImage(img);
-            if (entry->texture.id != 0) {
-                entry->loaded = true;
-                printf("[ARTISTS] Full art loaded: %s (%dx%d)\n", artistName, entry->texture.width, entry->texture.height);
-                return true;
-            }
-        }
-    }
-
-    return false;
-}
-
 static void CheckAndLoadArtistArt(int artistIndex) {
     // Defensive bounds check with safe accessor
     int count = SafeItemCount();
@@ -378,12 +273,9 @@ static void CheckAndLoadArtistArt(int artistIndex) {
     ArtistArtCacheEntry *entry = GetOrCreateArtCacheEntry(artist->name);
     if (!entry) return;
 
-    if (entry->loaded) return;
-
-    // Try to load from disk
-    if (TryLoadArtistArt(entry, artist->name)) {
-        return;
-    }
+    // The SDK art cache loads the preview (or full) art in the background;
+    // only art that is not on disk at all needs requesting from the phone
+    if (!LlzArtCacheIsMissing(LlzPrefetchGet(g_artPrefetch, artistIndex))) return;
 
     // Request art if not available
     float timeSinceRequest = g_animTimer - entry->requestTime;
@@ -412,14 +304,33 @@ static void UpdateArtistArtLoading(float dt) {
     ClampSelectedIndex();
     int count = SafeItemCount();
 
-    // Check art for visible artists (selected +/- 3), staggered to prevent burst loading
-    static int loadOffset = -3;
-    int idx = g_selectedIndex + loadOffset;
-    if (idx >= 0 && idx < count) {
-        CheckAndLoadArtistArt(idx);
+    // Ask the phone for any visible artist art that is not on disk yet
+    for (int idx = g_selectedIndex - 3; idx <= g_selectedIndex + 3; idx++) {
+        if (idx >= 0 && idx < count) CheckAndLoadArtistArt(idx);
     }
-    loadOffset++;
-    if (loadOffset > 3) loadOffset = -3;
+}
+
+static const char *ArtistArtKey(int index, void *user) {
+    (void)user;
+    if (index < 0 || index >= SafeItemCount()) return NULL;
+
+    const LlzSpotifyArtistItem *artist = &g_artists.items[index];
+    if (!artist->name[0]) return NULL;
+    return LlzMediaGenerateArtHash(artist->name, "");
+}
+
+// Keep the art for the cards on screen and the ones the scroll is heading
+// towards loading, nearest first
+static void UpdateArtistArtPrefetch(float motion, float dt) {
+    if (!HasValidData()) return;
+
+    LlzPrefetchView view = {
+        .count = SafeItemCount(),
+        .position = g_visualOffset,
+        .velocity = dt > 0.0f ? motion / dt : 0.0f,
+        .visibleRadius = 3
+    };
+    LlzPrefetchUpdate(g_artPrefetch, view, ArtistArtKey, NULL);
 }
 
 // ============================================================================
@@ -521,7 +432,9 @@ static void DrawArtistCard(int index, float centerX, float y, float scale, float
 
     // Try to get artist art
     ArtistArtCacheEntry *artEntry = GetOrCreateArtCacheEntry(artist->name);
-    bool hasArt = artEntry && artEntry->loaded && artEntry->texture.id != 0;
+    Texture2D artTexture = {0};
+    Rectangle artSource = {0};
+    bool hasArt = LlzArtCacheGetRegion(LlzPrefetchGet(g_artPrefetch, index), &artTexture, &artSource);
 
     if (hasArt) {
         // Draw circular artist image
@@ -529,7 +442,7 @@ static void DrawArtistCard(int index, float centerX, float y, float scale, float
         Rectangle artBounds = {centerX - artRadius, artCenterY - artRadius, artSize, artSize};
         Color tint = {255, 255, 255, (unsigned char)(255 * alpha)};
         // Use very high roundness for circular effect
-        LlzDrawTextureRounded(artEntry->texture, artBounds, 0.5f, 32, tint);
+        LlzDrawTextureRegionRounded(artTexture, artSource, artBounds, 0.5f, 32, tint);
     } else {
         // Gradient placeholder circle
         Color gradTop = {(unsigned char)(80 + (index * 17) % 80), (unsigned char)(60 + (index * 23) % 60), (unsigned char)(100 + (index * 31) % 80), (unsigned char)(255 * alpha)};
@@ -543,7 +456,7 @@ static void DrawArtistCard(int index, float centerX, float y, float scale, float
         LlzDrawTextCentered(initial, (int)centerX, (int)(artCenterY - initSize/3), initSize, initColor);
 
         // Loading dots
-        if (artEntry && artEntry->requested && !artEntry->loaded) {
+        if (artEntry && artEntry->requested) {
             int dotCount = ((int)(g_animTimer * 4)) % 4;
             char dots[5] = "";
             for (int i = 0; i < dotCount; i++) strcat(dots, ".");
@@ -759,6 +672,7 @@ static void PollArtists(float dt) {
         if (LlzMediaGetLibraryArtists(&temp) && temp.valid) {
             int oldCount = g_artists.itemCount;
             memcpy(&g_artists, &temp, sizeof(temp));
+            LlzPrefetchReset(g_artPrefetch);   // Indices may now be other artists
 
             if (g_artists.itemCount > 0) {
                 g_loadState = LOAD_STATE_LOADED;
@@ -813,7 +727,9 @@ static void plugin_update(const LlzInputState *input, float deltaTime) {
         return;
     }
 
+    float previousOffset = g_visualOffset;
     UpdateCarousel(input, deltaTime);
+    UpdateArtistArtPrefetch(g_visualOffset - previousOffset, deltaTime);
 }
 
 static void plugin_draw(void) {
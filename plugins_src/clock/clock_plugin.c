@@ -29,8 +29,6 @@
 #include <math.h>
 #include <time.h>
 #include <sys/time.h>
-#include <sys/stat.h>
-#include <webp/decode.h>
 
 // ============================================================================
 // Mode Definitions
@@ -150,6 +148,7 @@ static const ClockColorScheme COLOR_SCHEMES[] = {
 #define PULSE_SPEED 2.0f
 #define SWIPE_THRESHOLD 80.0f
 #define DOUBLE_TAP_THRESHOLD 0.4f
+#define CLOCK_ART_TINT (Color){213, 213, 213, 255}  // Shared blur (0.4 darken) down to ~0.5
 
 // Size multipliers for clock display
 static const float SIZE_MULTIPLIERS[] = {0.5f, 0.75f, 1.0f, 1.3f};
@@ -159,8 +158,8 @@ static const float SIZE_MULTIPLIERS[] = {0.5f, 0.75f, 1.0f, 1.3f};
 // ============================================================================
 
 typedef struct {
-    Texture2D texture;
-    Texture2D blurred;
+    LlzArtHandle art;       // Blurred art in the SDK art cache
+    Texture2D blurred;      // Valid while art is held
     bool loaded;
     char loadedPath[256];
     float alpha;
@@ -212,6 +211,8 @@ static bool g_waitingForDoubleTap = false;
 static AlbumArtState g_albumArt = {0};
 static AlbumArtState g_prevAlbumArt = {0};
 static bool g_inTransition = false;
+static LlzArtHandle g_pendingArt = 0;  // Requested art, installed once loaded
+static char g_pendingArtPath[256] = {0};
 static char g_trackAlbumArtPath[256] = {0};  // Track current album art path for change detection
 
 // Flip clock digit animation
@@ -313,82 +314,14 @@ static void LoadConfig(void) {
 // ============================================================================
 
 static void UnloadArt(AlbumArtState *art) {
-    if (art->texture.id != 0) UnloadTexture(art->texture);
-    if (art->blurred.id != 0) UnloadTexture(art->blurred);
+    LlzArtCacheRelease(art->art);
     memset(art, 0, sizeof(AlbumArtState));
 }
 
-// Check if file path has WebP extension
-static bool IsWebPFile(const char *path) {
-    if (!path) return false;
-    size_t len = strlen(path);
-    if (len < 5) return false;
-    const char *ext = path + len - 5;
-    return (strcmp(ext, ".webp") == 0 || strcmp(ext, ".WEBP") == 0);
-}
-
-// Load WebP image file and convert to raylib Image format
-static Image LoadImageWebP(const char *path) {
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        printf("[CLOCK] LoadImageWebP: failed to open file '%s'\n", path);
-        return image;
-    }
-
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Read file data
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        printf("[CLOCK] LoadImageWebP: failed to allocate %ld bytes\n", fileSize);
-        fclose(file);
-        return image;
-    }
-
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        printf("[CLOCK] LoadImageWebP: read %zu bytes, expected %ld\n", bytesRead, fileSize);
-        free(fileData);
-        return image;
-    }
-
-    // Decode WebP
-    int width = 0, height = 0;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
-
-    if (!rgbaData) {
-        printf("[CLOCK] LoadImageWebP: WebPDecodeRGBA failed\n");
-        return image;
-    }
-
-    // Create raylib Image from RGBA data
-    // We need to copy the data because WebP uses its own allocator
-    size_t dataSize = width * height * 4;
-    void *imageCopy = RL_MALLOC(dataSize);
-    if (!imageCopy) {
-        printf("[CLOCK] LoadImageWebP: failed to allocate image data\n");
-        WebPFree(rgbaData);
-        return image;
-    }
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
-
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    printf("[CLOCK] LoadImageWebP: decoded %dx%d image\n", width, height);
-    return image;
+static void ReleasePendingArt(void) {
+    LlzArtCacheRelease(g_pendingArt);
+    g_pendingArt = 0;
+    g_pendingArtPath[0] = '\0';
 }
 
 static void LoadAlbumArt(const char *path) {
@@ -402,66 +335,49 @@ static void LoadAlbumArt(const char *path) {
         return;
     }
 
-    printf("[CLOCK] LoadAlbumArt: attempting to load '%s'\n", path);
-
-    // Check file exists
-    struct stat st;
-    if (stat(path, &st) != 0) {
-        printf("[CLOCK] LoadAlbumArt: FILE NOT FOUND '%s'\n", path);
+    // Already waiting for this exact path
+    if (g_pendingArt != 0 && strcmp(path, g_pendingArtPath) == 0) {
         return;
     }
-    printf("[CLOCK] LoadAlbumArt: file exists, size=%ld bytes\n", (long)st.st_size);
 
-    // Load image - use WebP decoder for WebP files
-    Image img;
-    if (IsWebPFile(path)) {
-        printf("[CLOCK] LoadAlbumArt: using WebP decoder\n");
-        img = LoadImageWebP(path);
-    } else {
-        img = LoadImage(path);
-    }
+    ReleasePendingArt();
 
-    if (img.data == NULL) {
-        printf("[CLOCK] LoadAlbumArt: LoadImage FAILED for '%s'\n", path);
-        return;
-    }
-    printf("[CLOCK] LoadAlbumArt: image loaded %dx%d\n", img.width, img.height);
+    // The shared blurred variant is also used by nowplaying, lyrics and the
+    // menu background; it is lighter than the clock's old 20/0.5 blur, which
+    // CLOCK_ART_TINT makes up for when drawing
+    g_pendingArt = LlzArtCacheAcquirePath(path, LLZ_ART_VARIANT_BLUR);
+    if (g_pendingArt == 0) return;
 
-    // Create texture
-    Texture2D tex = LoadTextureFromImage(img);
-    if (tex.id == 0) {
-        UnloadImage(img);
-        printf("[CLOCK] LoadAlbumArt: LoadTextureFromImage FAILED\n");
-        return;
-    }
-
-    // Create blurred version for background
-    Texture2D blur = LlzTextureBlur(tex, 20, 0.5f);
-    if (blur.id != 0) {
-        printf("[CLOCK] LoadAlbumArt: Blurred texture generated, id=%u\n", blur.id);
-    } else {
-        printf("[CLOCK] LoadAlbumArt: Warning - failed to generate blurred texture\n");
-    }
+    strncpy(g_pendingArtPath, path, sizeof(g_pendingArtPath) - 1);
+    g_pendingArtPath[sizeof(g_pendingArtPath) - 1] = '\0';
+    printf("[CLOCK] LoadAlbumArt: requested '%s'\n", path);
+}
 
-    UnloadImage(img);
+// Install album art once the cache has it loaded (call each frame)
+static void PollAlbumArt(void) {
+    if (g_pendingArt == 0 || !LlzArtCacheIsReady(g_pendingArt)) return;
 
     // Setup crossfade transition
     UnloadArt(&g_prevAlbumArt);
-    if (g_albumArt.loaded && g_albumArt.texture.id != 0) {
+    if (g_albumArt.loaded && g_albumArt.blurred.id != 0) {
         g_prevAlbumArt = g_albumArt;
         g_prevAlbumArt.alpha = 1.0f;
     } else {
+        UnloadArt(&g_albumArt);
         g_prevAlbumArt.alpha = 0.0f;
     }
 
-    g_albumArt.texture = tex;
-    g_albumArt.blurred = blur;
+    g_albumArt.art = g_pendingArt;
+    g_albumArt.blurred = LlzArtCacheGetTexture(g_pendingArt);
     g_albumArt.loaded = true;
     g_albumArt.alpha = 0.0f;
-    strncpy(g_albumArt.loadedPath, path, sizeof(g_albumArt.loadedPath) - 1);
+    strncpy(g_albumArt.loadedPath, g_pendingArtPath, sizeof(g_albumArt.loadedPath) - 1);
+    g_albumArt.loadedPath[sizeof(g_albumArt.loadedPath) - 1] = '\0';
+    g_pendingArt = 0;
+    g_pendingArtPath[0] = '\0';
     g_inTransition = true;
 
-    printf("[CLOCK] LoadAlbumArt: SUCCESS texture_id=%u loaded='%s'\n", tex.id, path);
+    printf("[CLOCK] LoadAlbumArt: SUCCESS texture_id=%u loaded='%s'\n", g_albumArt.blurred.id, g_albumArt.loadedPath);
 }
 
 static void UpdateAlbumArtTransition(float dt) {
@@ -601,13 +517,13 @@ static void DrawBackground(void) {
             ClearBackground(BLACK);
 
             if (hasPrev && g_prevAlbumArt.blurred.id != 0) {
-                Color tint = ColorAlpha(WHITE, g_prevAlbumArt.alpha);
+                Color tint = ColorAlpha(CLOCK_ART_TINT, g_prevAlbumArt.alpha);
                 Rectangle dest = {0, 0, (float)g_screenWidth, (float)g_screenHeight};
                 LlzDrawTextureCover(g_prevAlbumArt.blurred, dest, tint);
             }
 
             if (hasCurrent && g_albumArt.alpha > 0.01f) {
-                Color tint = ColorAlpha(WHITE, g_albumArt.alpha);
+                Color tint = ColorAlpha(CLOCK_ART_TINT, g_albumArt.alpha);
                 Rectangle dest = {0, 0, (float)g_screenWidth, (float)g_screenHeight};
                 LlzDrawTextureCover(g_albumArt.blurred, dest, tint);
             }
@@ -927,7 +843,7 @@ static void DrawFlipHalf(int digit, float x, float y, float width, float height,
     float fullTextY = y + (height - measure.y) / 2.0f;
 
     // Apply scissor to clip text to this half
-    BeginScissorMode((int)x, (int)actualY, (int)width, (int)scaledHalfHeight);
+    LlzDisplayBeginScissor((int)x, (int)actualY, (int)width, (int)scaledHalfHeight);
 
     // Scale text position to match the card scaling
     float scaledTextY;
@@ -943,7 +859,7 @@ static void DrawFlipHalf(int digit, float x, float y, float width, float height,
 
     DrawTextEx(g_font, digitStr, (Vector2){textX, scaledTextY}, fontSize, 1.0f, scheme->textPrimary);
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Top half gets a subtle highlight
     if (isTopHalf && scaleY > 0.5f) {
@@ -1274,7 +1190,7 @@ static void PluginInit(int width, int height) {
             if (hash && hash[0] != '\0') {
                 char generatedPath[512];
                 snprintf(generatedPath, sizeof(generatedPath),
-                         "/var/mediadash/album_art_cache/%s.webp", hash);
+                         "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
                 LoadAlbumArt(generatedPath);
             }
         }
@@ -1343,6 +1259,7 @@ static void PluginUpdate(const LlzInputState *input, float dt) {
     }
 
     // Album art transitions
+    PollAlbumArt();
     UpdateAlbumArtTransition(dt);
 
     // Check for album art updates (matches lyrics plugin logic)
@@ -1361,7 +1278,7 @@ static void PluginUpdate(const LlzInputState *input, float dt) {
             if (hash && hash[0] != '\0') {
                 char generatedPath[512];
                 snprintf(generatedPath, sizeof(generatedPath),
-                         "/var/mediadash/album_art_cache/%s.webp", hash);
+                         "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
                 LoadAlbumArt(generatedPath);
             }
         }
@@ -1544,6 +1461,7 @@ static void PluginDraw(void) {
 }
 
 static void PluginShutdown(void) {
+    ReleasePendingArt();
     UnloadArt(&g_albumArt);
     UnloadArt(&g_prevAlbumArt);
 
@@ -192,61 +192,19 @@ static void UpdateStatsForCurrentQuiz(void);
 // Font Loading (uses SDK font functions)
 // ============================================================================
 
-static int *BuildUnicodeCodepoints(int *outCount) {
-    static const int ranges[][2] = {
-        {0x0020, 0x007E},   // ASCII
-        {0x00A0, 0x00FF},   // Latin-1 Supplement
-        {0x0100, 0x017F},   // Latin Extended-A
-    };
-
-    const int numRanges = sizeof(ranges) / sizeof(ranges[0]);
-    int total = 0;
-    for (int i = 0; i < numRanges; i++) {
-        total += (ranges[i][1] - ranges[i][0] + 1);
-    }
-
-    int *codepoints = (int *)malloc(total * sizeof(int));
-    if (!codepoints) {
-        *outCount = 0;
-        return NULL;
-    }
-
-    int idx = 0;
-    for (int i = 0; i < numRanges; i++) {
-        for (int cp = ranges[i][0]; cp <= ranges[i][1]; cp++) {
-            codepoints[idx++] = cp;
-        }
-    }
-
-    *outCount = total;
-    return codepoints;
-}
-
 static void LoadPluginFont(void) {
-    // Use SDK font loading with custom codepoints for extended Unicode support
-    int codepointCount = 0;
-    int *codepoints = BuildUnicodeCodepoints(&codepointCount);
-
-    g_font = LlzFontLoadCustom(LLZ_FONT_UI, 48, codepoints, codepointCount);
-    if (g_font.texture.id != 0) {
-        g_fontLoaded = true;
-        SetTextureFilter(g_font.texture, TEXTURE_FILTER_BILINEAR);
+    // Shared SDK font: glyphs beyond Latin-1 are added as question sets load
+    g_font = LlzFontGet(LLZ_FONT_UI, 48);
+    g_fontLoaded = g_font.texture.id != GetFontDefault().texture.id;
+    if (g_fontLoaded) {
         printf("Flashcards: Loaded font via SDK\n");
     } else {
-        g_font = GetFontDefault();
-        g_fontLoaded = false;
         printf("Flashcards: Using default font\n");
     }
-
-    if (codepoints) free(codepoints);
 }
 
 static void UnloadPluginFont(void) {
-    // Font loaded via LlzFontLoadCustom must be unloaded by caller
-    Font defaultFont = GetFontDefault();
-    if (g_fontLoaded && g_font.texture.id != 0 && g_font.texture.id != defaultFont.texture.id) {
-        UnloadFont(g_font);
-    }
+    // The SDK font is shared with other plugins; nothing to unload
     g_fontLoaded = false;
 }
 
@@ -502,6 +460,7 @@ static void LoadCategories(void) {
         FolderEntry *cat = &g_categories[g_categoryCount];
         strncpy(cat->name, entry->d_name, MAX_NAME_LEN - 1);
         cat->name[MAX_NAME_LEN - 1] = '\0';
+        LlzFontRequireText(g_font, cat->name);
         strncpy(cat->path, fullPath, MAX_PATH_LEN - 1);
         cat->path[MAX_PATH_LEN - 1] = '\0';
         cat->isDirectory = IsDirectory(fullPath);
@@ -545,6 +504,7 @@ static void LoadFolderContents(const char *path) {
         FolderEntry *item = &g_currentFolderItems[g_currentFolderItemCount];
         strncpy(item->name, entry->d_name, MAX_NAME_LEN - 1);
         item->name[MAX_NAME_LEN - 1] = '\0';
+        LlzFontRequireText(g_font, item->name);
         strncpy(item->path, fullPath, MAX_PATH_LEN - 1);
         item->path[MAX_PATH_LEN - 1] = '\0';
         item->isDirectory = IsDirectory(fullPath);
@@ -719,6 +679,16 @@ static bool LoadQuestionsFromFile(const char *filepath) {
     char *ext = strstr(g_quiz.setName, ".json");
     if (ext) *ext = '\0';
 
+    // Add any glyphs the set needs before it is drawn
+    for (int i = 0; i < g_quiz.questionCount; i++) {
+        Question *q = &g_quiz.questions[i];
+        LlzFontRequireText(g_font, q->question);
+        for (int j = 0; j < q->optionCount; j++) {
+            LlzFontRequireText(g_font, q->options[j]);
+        }
+    }
+    LlzFontRequireText(g_font, g_quiz.setName);
+
     printf("Flashcards: Loaded %d questions from %s\n", g_quiz.questionCount, filepath);
     return g_quiz.questionCount > 0;
 }
@@ -1017,7 +987,7 @@ static void DrawCategorySelectScreen(void) {
     bool canScrollUp = g_smoothScrollOffset > 1.0f;
     bool canScrollDown = g_smoothScrollOffset < maxScroll - 1.0f;
 
-    BeginScissorMode(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
+    LlzDisplayBeginScissor(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
 
     for (int i = 0; i < g_categoryCount; i++) {
         float itemY = LIST_TOP + i * itemTotalHeight - g_smoothScrollOffset;
@@ -1038,7 +1008,7 @@ static void DrawCategorySelectScreen(void) {
         DrawListItem(bounds, cat->name, subtitle, isHighlighted, cat->isDirectory);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     DrawScrollFades(canScrollUp, canScrollDown);
     DrawScrollIndicator(g_listScrollOffset, g_categoryCount, ITEMS_PER_PAGE);
@@ -1120,7 +1090,7 @@ static void DrawSubfolderListScreen(void) {
     bool canScrollUp = g_smoothScrollOffset > 1.0f;
     bool canScrollDown = g_smoothScrollOffset < maxScroll - 1.0f;
 
-    BeginScissorMode(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
+    LlzDisplayBeginScissor(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
 
     for (int i = 0; i < g_currentFolderItemCount; i++) {
         float itemY = LIST_TOP + i * itemTotalHeight - g_smoothScrollOffset;
@@ -1141,7 +1111,7 @@ static void DrawSubfolderListScreen(void) {
         DrawListItem(bounds, item->name, subtitle, isHighlighted, item->isDirectory);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     DrawScrollFades(canScrollUp, canScrollDown);
     DrawScrollIndicator(g_listScrollOffset, g_currentFolderItemCount, ITEMS_PER_PAGE);
@@ -23,8 +23,6 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
-#include <sys/stat.h>
-#include <webp/decode.h>
 
 // ============================================================================
 // Display Style Definitions
@@ -128,19 +126,16 @@ static const Color COLOR_ACCENT_DEFAULT = {255, 45, 85, 255};  // Apple Music pi
 #define MAX_WRAP_LINE_LEN 256
 #define MAX_WRAP_LINES 4
 
-typedef struct {
-    char lines[MAX_WRAP_LINES][MAX_WRAP_LINE_LEN];
-    int lineCount;
-    float totalHeight;
-} WrappedText;
-
 // ============================================================================
 // Album Art & Color State
 // ============================================================================
 
+// Textures belong to the SDK art cache and stay valid while the handles are held
 typedef struct {
     Texture2D texture;
     Texture2D blurred;
+    LlzArtHandle art;
+    LlzArtHandle blurArt;
     bool loaded;
     char loadedPath[256];
 } AlbumArtState;
@@ -148,6 +143,8 @@ typedef struct {
 typedef struct {
     Texture2D texture;
     Texture2D blurred;
+    LlzArtHandle art;
+    LlzArtHandle blurArt;
     float alpha;
 } AlbumArtTransition;
 
@@ -157,6 +154,7 @@ typedef struct {
     Color textPrimary;
     Color textSecondary;
     Color glow;
+    LlzPalette palette;
     bool hasColors;
 } DynamicColors;
 
@@ -182,6 +180,9 @@ static AlbumArtState g_albumArt = {0};
 static AlbumArtTransition g_prevAlbumArt = {0};
 static float g_currentAlbumArtAlpha = 1.0f;
 static bool g_inAlbumArtTransition = false;
+static LlzArtHandle g_pendingArt = 0;     // Requested art, installed once loaded
+static LlzArtHandle g_pendingBlurArt = 0;
+static char g_pendingArtPath[256] = {0};
 
 // Dynamic colors from album art
 static DynamicColors g_colors = {0};
@@ -339,7 +340,7 @@ static void LoadPluginSettings(void) {
         LlzBackgroundSetEnabled(true);
         LlzBackgroundSetStyle((LlzBackgroundStyle)g_animatedBgIndex, false);
         if (g_colors.hasColors) {
-            LlzBackgroundSetColors(g_colors.primary, g_colors.accent);
+            LlzBackgroundSetPalette(&g_colors.palette);
         }
     } else {
         LlzBackgroundSetEnabled(false);
@@ -357,165 +358,42 @@ static float GetMaxTextWidth(void) {
     return (float)g_screenWidth - (LYRICS_HORIZONTAL_PADDING * 2.0f);
 }
 
-static void WrapText(const char *text, float fontSize, float spacing, WrappedText *out) {
-    memset(out, 0, sizeof(WrappedText));
-
-    if (!text || text[0] == '\0') {
-        out->lineCount = 0;
-        out->totalHeight = 0;
-        return;
-    }
-
-    float maxWidth = GetMaxTextWidth();
-    float lineHeight = fontSize * 1.3f;  // Line height for wrapped text
-
-    // Check if text fits on one line
-    Vector2 fullMeasure = MeasureTextEx(g_font, text, fontSize, spacing);
-    if (fullMeasure.x <= maxWidth) {
-        strncpy(out->lines[0], text, MAX_WRAP_LINE_LEN - 1);
-        out->lineCount = 1;
-        out->totalHeight = lineHeight;
-        return;
-    }
-
-    // Need to wrap - split by words
-    char tempLine[MAX_WRAP_LINE_LEN] = {0};
-    char testLine[MAX_WRAP_LINE_LEN] = {0};
-    const char *ptr = text;
-    int currentLine = 0;
-
-    while (*ptr && currentLine < MAX_WRAP_LINES) {
-        // Skip leading spaces
-        while (*ptr == ' ') ptr++;
-        if (*ptr == '\0') break;
-
-        tempLine[0] = '\0';
-
-        while (*ptr && currentLine < MAX_WRAP_LINES) {
-            // Find next word
-            const char *wordStart = ptr;
-            while (*ptr && *ptr != ' ') ptr++;
-            int wordLen = (int)(ptr - wordStart);
-
-            if (wordLen == 0) break;
-
-            // Test if adding this word fits
-            if (tempLine[0] != '\0') {
-                snprintf(testLine, sizeof(testLine), "%s %.*s", tempLine, wordLen, wordStart);
-            } else {
-                snprintf(testLine, sizeof(testLine), "%.*s", wordLen, wordStart);
-            }
-
-            Vector2 testMeasure = MeasureTextEx(g_font, testLine, fontSize, spacing);
-
-            if (testMeasure.x <= maxWidth) {
-                // Word fits, add it
-                strcpy(tempLine, testLine);
-            } else {
-                // Word doesn't fit
-                if (tempLine[0] != '\0') {
-                    // Save current line and start new one with this word
-                    strncpy(out->lines[currentLine], tempLine, MAX_WRAP_LINE_LEN - 1);
-                    currentLine++;
-
-                    if (currentLine < MAX_WRAP_LINES) {
-                        snprintf(tempLine, sizeof(tempLine), "%.*s", wordLen, wordStart);
-                    }
-                } else {
-                    // Single word too long - force it and truncate if needed
-                    snprintf(out->lines[currentLine], MAX_WRAP_LINE_LEN - 1, "%.*s", wordLen, wordStart);
-                    currentLine++;
-                    tempLine[0] = '\0';
-                }
-            }
-
-            // Skip spaces after word
-            while (*ptr == ' ') ptr++;
-        }
-
-        // Save any remaining text in tempLine
-        if (tempLine[0] != '\0' && currentLine < MAX_WRAP_LINES) {
-            strncpy(out->lines[currentLine], tempLine, MAX_WRAP_LINE_LEN - 1);
-            currentLine++;
-        }
-
-        break;  // Only process once
-    }
-
-    out->lineCount = currentLine;
-    out->totalHeight = currentLine * lineHeight;
+// Line breaks come from the SDK text layout cache, so each lyric is only
+// measured once per font and laid out once per size
+static int WrapText(const char *text, float fontSize, float spacing, LlzTextLayout *out) {
+    LlzTextWrap(g_font, text, fontSize, spacing, GetMaxTextWidth(), MAX_WRAP_LINES, out);
+    return out->lineCount;
 }
 
 // Calculate the height a lyrics line will take at a given font size
 static float CalculateLineHeight(const char *text, float fontSize, float spacing) {
     if (!text || text[0] == '\0') return LYRICS_BASE_LINE_HEIGHT;
 
-    float maxWidth = GetMaxTextWidth();
-    Vector2 measure = MeasureTextEx(g_font, text, fontSize, spacing);
-
-    if (measure.x <= maxWidth) {
+    if (LlzTextMeasure(g_font, text, fontSize, spacing) <= GetMaxTextWidth()) {
         // Single line
         return fontSize * LYRICS_LINE_SPACING;
     }
 
-    // Wrapped text - estimate line count
-    WrappedText wrapped;
-    WrapText(text, fontSize, spacing, &wrapped);
-    return wrapped.totalHeight + (fontSize * 0.3f);  // Extra padding for wrapped text
+    // Wrapped text
+    LlzTextLayout layout;
+    int lineCount = WrapText(text, fontSize, spacing, &layout);
+    return lineCount * fontSize * 1.3f + (fontSize * 0.3f);  // Extra padding for wrapped text
 }
 
 // ============================================================================
 // Color Extraction from Album Art
 // ============================================================================
 
-static void ExtractColorsFromImage(Image img) {
-    if (img.data == NULL || img.width <= 0 || img.height <= 0) {
-        g_colors.hasColors = false;
-        return;
-    }
-
-    // Sample colors from the image
-    int sampleCount = 0;
-    float totalR = 0, totalG = 0, totalB = 0;
-    float maxSat = 0;
-    Color vibrantColor = {0};
-
-    int sampleStep = (img.width * img.height > 10000) ? 8 : 4;
-
-    for (int y = 0; y < img.height; y += sampleStep) {
-        for (int x = 0; x < img.width; x += sampleStep) {
-            Color pixel = GetImageColor(img, x, y);
-
-            // Skip very dark or very bright pixels
-            float brightness = (pixel.r + pixel.g + pixel.b) / 3.0f / 255.0f;
-            if (brightness < 0.1f || brightness > 0.95f) continue;
-
-            totalR += pixel.r;
-            totalG += pixel.g;
-            totalB += pixel.b;
-            sampleCount++;
-
-            // Track most saturated color for accent
-            Vector3 hsv = ColorToHSV(pixel);
-            if (hsv.y > maxSat && hsv.z > 0.3f) {
-                maxSat = hsv.y;
-                vibrantColor = pixel;
-            }
-        }
-    }
-
-    if (sampleCount == 0) {
+// Derive lyric colors from the palette extracted by the art worker
+static void ApplyAlbumArtColors(const LlzPalette *palette) {
+    if (!palette->valid) {
         g_colors.hasColors = false;
         return;
     }
 
-    // Calculate average color
-    Color avgColor = {
-        (unsigned char)(totalR / sampleCount),
-        (unsigned char)(totalG / sampleCount),
-        (unsigned char)(totalB / sampleCount),
-        255
-    };
+    Color avgColor = palette->dominant;
+    Color vibrantColor = palette->vibrant;
+    float maxSat = palette->vibrantSaturation;
 
     // Create accent color (boosted saturation from vibrant or average)
     Vector3 accentHSV;
@@ -540,11 +418,12 @@ static void ExtractColorsFromImage(Image img) {
     g_colors.textPrimary = COLOR_TEXT_PRIMARY;
     g_colors.textSecondary = COLOR_TEXT_SECONDARY;
     g_colors.glow = glow;
+    g_colors.palette = *palette;
     g_colors.hasColors = true;
 
     // Update background system colors
     if (g_bgMode >= BG_MODE_ANIMATED_START) {
-        LlzBackgroundSetColors(avgColor, accent);
+        LlzBackgroundSetPalette(palette);
     }
 
     printf("[LYRICS] Extracted colors - Primary: (%d,%d,%d) Accent: (%d,%d,%d)\n",
@@ -556,106 +435,53 @@ static void ExtractColorsFromImage(Image img) {
 // ============================================================================
 
 static void CleanupPrevAlbumArt(void) {
-    if (g_prevAlbumArt.texture.id != 0) {
-        UnloadTexture(g_prevAlbumArt.texture);
-        memset(&g_prevAlbumArt.texture, 0, sizeof(Texture2D));
-    }
-    if (g_prevAlbumArt.blurred.id != 0) {
-        UnloadTexture(g_prevAlbumArt.blurred);
-        memset(&g_prevAlbumArt.blurred, 0, sizeof(Texture2D));
-    }
+    LlzArtCacheRelease(g_prevAlbumArt.art);
+    LlzArtCacheRelease(g_prevAlbumArt.blurArt);
+    g_prevAlbumArt.art = 0;
+    g_prevAlbumArt.blurArt = 0;
+    memset(&g_prevAlbumArt.texture, 0, sizeof(Texture2D));
+    memset(&g_prevAlbumArt.blurred, 0, sizeof(Texture2D));
+}
+
+static void ReleasePendingAlbumArt(void) {
+    LlzArtCacheRelease(g_pendingArt);
+    LlzArtCacheRelease(g_pendingBlurArt);
+    g_pendingArt = 0;
+    g_pendingBlurArt = 0;
+    g_pendingArtPath[0] = '\0';
+}
+
+static void ReleaseCurrentAlbumArt(void) {
+    LlzArtCacheRelease(g_albumArt.art);
+    LlzArtCacheRelease(g_albumArt.blurArt);
+    g_albumArt.art = 0;
+    g_albumArt.blurArt = 0;
+    memset(&g_albumArt.texture, 0, sizeof(Texture2D));
+    memset(&g_albumArt.blurred, 0, sizeof(Texture2D));
 }
 
 static void UnloadAlbumArt(void) {
+    ReleasePendingAlbumArt();
+
     if (g_albumArt.loaded && g_albumArt.texture.id != 0) {
         // Move current to prev for crossfade
         CleanupPrevAlbumArt();
         g_prevAlbumArt.texture = g_albumArt.texture;
         g_prevAlbumArt.blurred = g_albumArt.blurred;
+        g_prevAlbumArt.art = g_albumArt.art;
+        g_prevAlbumArt.blurArt = g_albumArt.blurArt;
         g_prevAlbumArt.alpha = g_currentAlbumArtAlpha;
         g_currentAlbumArtAlpha = 0.0f;
         g_inAlbumArtTransition = true;
 
-        memset(&g_albumArt.texture, 0, sizeof(Texture2D));
-        memset(&g_albumArt.blurred, 0, sizeof(Texture2D));
+        g_albumArt.art = 0;
+        g_albumArt.blurArt = 0;
     }
+    ReleaseCurrentAlbumArt();
     g_albumArt.loaded = false;
     g_albumArt.loadedPath[0] = '\0';
 }
 
-// Check if file path has WebP extension
-static bool IsWebPFile(const char *path) {
-    if (!path) return false;
-    size_t len = strlen(path);
-    if (len < 5) return false;
-    const char *ext = path + len - 5;
-    return (strcmp(ext, ".webp") == 0 || strcmp(ext, ".WEBP") == 0);
-}
-
-// Load WebP image file and convert to raylib Image format
-static Image LoadImageWebP(const char *path) {
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        printf("[LYRICS] LoadImageWebP: failed to open file '%s'\n", path);
-        return image;
-    }
-
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Read file data
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        printf("[LYRICS] LoadImageWebP: failed to allocate %ld bytes\n", fileSize);
-        fclose(file);
-        return image;
-    }
-
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        printf("[LYRICS] LoadImageWebP: read %zu bytes, expected %ld\n", bytesRead, fileSize);
-        free(fileData);
-        return image;
-    }
-
-    // Decode WebP
-    int width = 0, height = 0;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
-
-    if (!rgbaData) {
-        printf("[LYRICS] LoadImageWebP: WebPDecodeRGBA failed\n");
-        return image;
-    }
-
-    // Create raylib Image from RGBA data
-    // We need to copy the data because WebP uses its own allocator
-    size_t dataSize = width * height * 4;
-    void *imageCopy = RL_MALLOC(dataSize);
-    if (!imageCopy) {
-        printf("[LYRICS] LoadImageWebP: failed to allocate image data\n");
-        WebPFree(rgbaData);
-        return image;
-    }
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
-
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    printf("[LYRICS] LoadImageWebP: decoded %dx%d image\n", width, height);
-    return image;
-}
-
 static void LoadAlbumArt(const char *path) {
     if (!path || path[0] == '\0') {
         printf("[LYRICS] LoadAlbumArt: path is NULL or empty\n");
@@ -667,73 +493,68 @@ static void LoadAlbumArt(const char *path) {
         return;
     }
 
-    printf("[LYRICS] LoadAlbumArt: attempting to load '%s'\n", path);
-
-    // Check file exists using stat (more reliable)
-    struct stat st;
-    if (stat(path, &st) != 0) {
-        printf("[LYRICS] LoadAlbumArt: FILE NOT FOUND '%s'\n", path);
+    // Already waiting for it
+    if (g_pendingArt != 0 && strcmp(path, g_pendingArtPath) == 0) {
         return;
     }
-    printf("[LYRICS] LoadAlbumArt: file exists, size=%ld bytes\n", (long)st.st_size);
 
-    // Load image - use WebP decoder for WebP files
-    Image img;
-    if (IsWebPFile(path)) {
-        printf("[LYRICS] LoadAlbumArt: using WebP decoder\n");
-        img = LoadImageWebP(path);
-    } else {
-        img = LoadImage(path);
-    }
+    ReleasePendingAlbumArt();
 
-    if (img.data == NULL) {
-        printf("[LYRICS] LoadAlbumArt: LoadImage FAILED for '%s'\n", path);
+    // Same variants as nowplaying, so coming from there is a cache hit
+    g_pendingArt = LlzArtCacheAcquirePath(path, LLZ_ART_VARIANT_FULL);
+    g_pendingBlurArt = LlzArtCacheAcquirePath(path, LLZ_ART_VARIANT_BLUR);
+    if (g_pendingArt == 0 || g_pendingBlurArt == 0) {
+        printf("[LYRICS] LoadAlbumArt: art cache full, skipping '%s'\n", path);
+        ReleasePendingAlbumArt();
         return;
     }
-    printf("[LYRICS] LoadAlbumArt: image loaded %dx%d\n", img.width, img.height);
 
-    // Extract colors before creating texture
-    ExtractColorsFromImage(img);
+    strncpy(g_pendingArtPath, path, sizeof(g_pendingArtPath) - 1);
+    g_pendingArtPath[sizeof(g_pendingArtPath) - 1] = '\0';
+    printf("[LYRICS] LoadAlbumArt: requested '%s'\n", path);
+}
 
-    // Create texture
-    Texture2D newTexture = LoadTextureFromImage(img);
-    if (newTexture.id == 0) {
-        UnloadImage(img);
-        printf("[LYRICS] LoadAlbumArt: LoadTextureFromImage FAILED\n");
-        return;
-    }
+// Install album art once the cache has it loaded (call each frame)
+static void PollAlbumArt(void) {
+    if (g_pendingArt == 0) return;
+    if (!LlzArtCacheIsReady(g_pendingArt) || !LlzArtCacheIsReady(g_pendingBlurArt)) return;
 
-    // Generate blurred version for background effect
-    // Using same parameters as nowplaying: blurRadius=15, darkenAmount=0.4
-    Texture2D blurred = LlzTextureBlur(newTexture, 15, 0.4f);
-    if (blurred.id != 0) {
-        printf("[LYRICS] LoadAlbumArt: Blurred texture generated, id=%u\n", blurred.id);
-    } else {
-        printf("[LYRICS] LoadAlbumArt: Warning - failed to generate blurred texture\n");
+    LlzPalette palette;
+    if (LlzArtCacheGetPalette(g_pendingArt, &palette)) {
+        ApplyAlbumArtColors(&palette);
     }
 
-    UnloadImage(img);
-
     // Setup crossfade transition
     CleanupPrevAlbumArt();
     if (g_albumArt.loaded && g_albumArt.texture.id != 0) {
         g_prevAlbumArt.texture = g_albumArt.texture;
         g_prevAlbumArt.blurred = g_albumArt.blurred;
+        g_prevAlbumArt.art = g_albumArt.art;
+        g_prevAlbumArt.blurArt = g_albumArt.blurArt;
         g_prevAlbumArt.alpha = g_currentAlbumArtAlpha;
+        g_albumArt.art = 0;
+        g_albumArt.blurArt = 0;
     } else {
         g_prevAlbumArt.alpha = 0.0f;
     }
+    ReleaseCurrentAlbumArt();
 
-    g_albumArt.texture = newTexture;
-    g_albumArt.blurred = blurred;
+    g_albumArt.art = g_pendingArt;
+    g_albumArt.blurArt = g_pendingBlurArt;
+    g_albumArt.texture = LlzArtCacheGetTexture(g_albumArt.art);
+    g_albumArt.blurred = LlzArtCacheGetTexture(g_albumArt.blurArt);
     g_albumArt.loaded = true;
-    strncpy(g_albumArt.loadedPath, path, sizeof(g_albumArt.loadedPath) - 1);
+    strncpy(g_albumArt.loadedPath, g_pendingArtPath, sizeof(g_albumArt.loadedPath) - 1);
+    g_albumArt.loadedPath[sizeof(g_albumArt.loadedPath) - 1] = '\0';
+    g_pendingArt = 0;
+    g_pendingBlurArt = 0;
+    g_pendingArtPath[0] = '\0';
 
     g_currentAlbumArtAlpha = 0.0f;
     g_inAlbumArtTransition = true;
 
-    printf("[LYRICS] LoadAlbumArt: SUCCESS texture_id=%u loaded='%s'\n",
-           newTexture.id, path);
+    printf("[LYRICS] LoadAlbumArt: SUCCESS texture_id=%u blurred_id=%u loaded='%s'\n",
+           g_albumArt.texture.id, g_albumArt.blurred.id, g_albumArt.loadedPath);
 }
 
 static void UpdateAlbumArtTransition(float deltaTime) {
@@ -929,6 +750,8 @@ static void LoadLyrics(void) {
 }
 
 static void CheckForLyricsUpdate(void) {
+    LlzLyricsUpdate();
+
     char newHash[64] = {0};
     bool gotHash = LlzLyricsGetHash(newHash, sizeof(newHash));
 
@@ -1008,28 +831,28 @@ static void DrawLyricsLine(const char *text, float y, bool isCurrent, float fade
     float glowIntensity = highlightProgress * fadeAlpha;
 
     // Wrap text if necessary
-    WrappedText wrapped;
-    WrapText(text, fontSize, spacing, &wrapped);
+    LlzTextLayout layout;
+    WrapText(text, fontSize, spacing, &layout);
 
-    if (wrapped.lineCount <= 1) {
+    if (layout.lineCount <= 1) {
         // Single line - center and draw
-        Vector2 measure = MeasureTextEx(g_font, text, fontSize, spacing);
-        float x = (g_screenWidth - measure.x) / 2.0f;
+        float x = (g_screenWidth - LlzTextMeasure(g_font, text, fontSize, spacing)) / 2.0f;
         DrawWrappedLineWithGlow(text, x, y, fontSize, spacing, finalColor, glowColor, hasGlow, glowIntensity);
     } else {
         // Multiple lines - draw each centered
         float lineHeight = fontSize * 1.3f;
-        float totalHeight = wrapped.lineCount * lineHeight;
+        float totalHeight = layout.lineCount * lineHeight;
 
         // Center the block vertically around y
         float startY = y - (totalHeight / 2.0f) + (lineHeight / 2.0f);
 
-        for (int i = 0; i < wrapped.lineCount; i++) {
-            Vector2 measure = MeasureTextEx(g_font, wrapped.lines[i], fontSize, spacing);
-            float x = (g_screenWidth - measure.x) / 2.0f;
+        for (int i = 0; i < layout.lineCount; i++) {
+            char line[MAX_WRAP_LINE_LEN];
+            LlzTextLayoutCopyLine(text, &layout, i, line, sizeof(line));
+            float x = (g_screenWidth - layout.lines[i].width) / 2.0f;
             float lineY = startY + i * lineHeight;
 
-            DrawWrappedLineWithGlow(wrapped.lines[i], x, lineY, fontSize, spacing,
+            DrawWrappedLineWithGlow(line, x, lineY, fontSize, spacing,
                                    finalColor, glowColor, hasGlow, glowIntensity);
         }
     }
@@ -1042,13 +865,13 @@ static float GetLineDisplayHeight(int lineIndex, bool isCurrent, float highlight
     float fontSize = isCurrent ? Lerpf(GetOtherFontSize(), GetCurrentFontSize(), highlightProgress) : GetOtherFontSize();
     float spacing = 1.2f;
 
-    WrappedText wrapped;
-    WrapText(g_lyrics.lines[lineIndex].text, fontSize, spacing, &wrapped);
+    LlzTextLayout layout;
+    int lineCount = WrapText(g_lyrics.lines[lineIndex].text, fontSize, spacing, &layout);
 
-    if (wrapped.lineCount <= 1) {
+    if (lineCount <= 1) {
         return fontSize * LYRICS_LINE_SPACING;
     } else {
-        return wrapped.totalHeight + (fontSize * 0.2f);
+        return lineCount * fontSize * 1.3f + (fontSize * 0.2f);
     }
 }
 
@@ -1589,6 +1412,7 @@ static void PluginInit(int width, int height) {
     LoadPluginSettings();
 
     // Load initial lyrics
+    LlzLyricsUpdate();
     LoadLyrics();
 
     // Get track info and album art
@@ -1606,7 +1430,7 @@ static void PluginInit(int width, int height) {
             if (hash && hash[0] != '\0') {
                 char generatedPath[512];
                 snprintf(generatedPath, sizeof(generatedPath),
-                         "/var/mediadash/album_art_cache/%s.webp", hash);
+                         "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
                 LoadAlbumArt(generatedPath);
             }
         }
@@ -1672,6 +1496,7 @@ static void PluginUpdate(const LlzInputState *input, float deltaTime) {
     if (g_volumeOverlayAlpha < 0.01f && targetAlpha == 0.0f) g_volumeOverlayAlpha = 0.0f;
 
     // Update album art transition
+    PollAlbumArt();
     UpdateAlbumArtTransition(deltaTime);
 
     // Check for lyrics updates
@@ -1716,7 +1541,7 @@ static void PluginUpdate(const LlzInputState *input, float deltaTime) {
             if (hash && hash[0] != '\0') {
                 char generatedPath[512];
                 snprintf(generatedPath, sizeof(generatedPath),
-                         "/var/mediadash/album_art_cache/%s.webp", hash);
+                         "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
                 LoadAlbumArt(generatedPath);
             }
         }
@@ -1865,7 +1690,7 @@ static void PluginUpdate(const LlzInputState *input, float deltaTime) {
             LlzBackgroundSetEnabled(true);
             LlzBackgroundSetStyle(LLZ_BG_STYLE_PULSE, true);
             if (g_colors.hasColors) {
-                LlzBackgroundSetColors(g_colors.primary, g_colors.accent);
+                LlzBackgroundSetPalette(&g_colors.palette);
             }
             ShowIndicator("Background: Pulse");
         } else {
@@ -1982,8 +1807,8 @@ static void PluginShutdown(void) {
     }
 
     // Unload album art
-    if (g_albumArt.texture.id != 0) UnloadTexture(g_albumArt.texture);
-    if (g_albumArt.blurred.id != 0) UnloadTexture(g_albumArt.blurred);
+    ReleasePendingAlbumArt();
+    ReleaseCurrentAlbumArt();
     CleanupPrevAlbumArt();
 
     // Note: Don't call LlzBackgroundShutdown() - host manages the lifecycle
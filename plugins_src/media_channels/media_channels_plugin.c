@@ -528,7 +528,7 @@ static void PluginDraw(void) {
         DrawEmptyState();
     } else {
         // Clip content area
-        BeginScissorMode(0, CONTENT_TOP, g_screenWidth, (int)CONTENT_HEIGHT);
+        LlzDisplayBeginScissor(0, CONTENT_TOP, g_screenWidth, (int)CONTENT_HEIGHT);
 
         int uiIndex = 0;
 
@@ -561,7 +561,7 @@ static void PluginDraw(void) {
             uiIndex++;
         }
 
-        EndScissorMode();
+        LlzDisplayEndScissor();
     }
 
     DrawFooter();
@@ -438,7 +438,7 @@ static void DrawItemList(void) {
 
     g_scrollOffset += (g_targetScrollOffset - g_scrollOffset) * 0.15f;
 
-    BeginScissorMode(0, (int)startY, g_screenWidth, (int)visibleHeight);
+    LlzDisplayBeginScissor(0, (int)startY, g_screenWidth, (int)visibleHeight);
 
     for (int i = 0; i < g_itemCount; i++) {
         float itemY = startY + i * itemHeight - g_scrollOffset;
@@ -446,7 +446,7 @@ static void DrawItemList(void) {
         DrawItemCard(&g_items[i], i, itemY);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Scroll indicators
     if (g_scrollOffset > 5) {
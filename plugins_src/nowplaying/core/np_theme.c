@@ -6,57 +6,6 @@
 #include <stdlib.h>
 #include <math.h>
 
-// Unicode codepoint ranges for international character support
-// Build array of codepoints for font loading
-static int *BuildUnicodeCodepoints(int *outCount) {
-    // Define ranges: start, end (inclusive)
-    static const int ranges[][2] = {
-        // Basic ASCII (standard printable characters)
-        {0x0020, 0x007E},   // Space to tilde (95 chars)
-
-        // Latin-1 Supplement (French accents: é, è, ê, ë, à, â, ç, ù, û, ü, ô, î, ï, etc.)
-        {0x00A0, 0x00FF},   // 96 chars
-
-        // Latin Extended-A (additional accented: Œ, œ, Ÿ, etc.)
-        {0x0100, 0x017F},   // 128 chars
-
-        // Latin Extended-B (less common, but useful)
-        {0x0180, 0x024F},   // 208 chars
-
-        // Cyrillic (Russian: А-Я, а-я, Ё, ё, etc.)
-        {0x0400, 0x04FF},   // 256 chars - full Cyrillic block
-
-        // Cyrillic Supplement (additional Cyrillic characters)
-        {0x0500, 0x052F},   // 48 chars
-    };
-
-    const int numRanges = sizeof(ranges) / sizeof(ranges[0]);
-
-    // Calculate total codepoints
-    int total = 0;
-    for (int i = 0; i < numRanges; i++) {
-        total += (ranges[i][1] - ranges[i][0] + 1);
-    }
-
-    // Allocate array
-    int *codepoints = (int *)malloc(total * sizeof(int));
-    if (!codepoints) {
-        *outCount = 0;
-        return NULL;
-    }
-
-    // Fill array
-    int idx = 0;
-    for (int i = 0; i < numRanges; i++) {
-        for (int cp = ranges[i][0]; cp <= ranges[i][1]; cp++) {
-            codepoints[idx++] = cp;
-        }
-    }
-
-    *outCount = total;
-    return codepoints;
-}
-
 // Color token
 typedef struct {
     Color color;
@@ -232,29 +181,10 @@ void NpThemeInit(int width, int height) {
     g_theme.screenWidth = width;
     g_theme.screenHeight = height;
 
-    // Build Unicode codepoints array for international character support
-    int codepointCount = 0;
-    int *codepoints = BuildUnicodeCodepoints(&codepointCount);
-
-    // Initialize SDK font system and use its path discovery
+    // Shared SDK font; glyphs beyond Latin-1 (track metadata, lyrics) are
+    // added as text arrives, see LlzFontRequireText
     LlzFontInit();
-
-    // Try to load via SDK which searches all the correct paths
-    g_theme.mainFont = GetFontDefault();
-    const char *fontPath = LlzFontGetPath(LLZ_FONT_UI);
-    if (fontPath) {
-        Font loaded = LoadFontEx(fontPath, 48, codepoints, codepointCount);
-        if (loaded.texture.id != 0) {
-            g_theme.mainFont = loaded;
-            SetTextureFilter(g_theme.mainFont.texture, TEXTURE_FILTER_BILINEAR);
-            printf("NowPlaying: Loaded font %s with %d Unicode codepoints\n", fontPath, codepointCount);
-        }
-    }
-
-    // Free codepoints array
-    if (codepoints) {
-        free(codepoints);
-    }
+    g_theme.mainFont = LlzFontGet(LLZ_FONT_UI, 48);
 
     // Initialize all theme variants
     InitializePalettes();
@@ -266,10 +196,7 @@ void NpThemeInit(int width, int height) {
 }
 
 void NpThemeShutdown(void) {
-    Font defaultFont = GetFontDefault();
-    if (g_theme.mainFont.texture.id != 0 && g_theme.mainFont.texture.id != defaultFont.texture.id) {
-        UnloadFont(g_theme.mainFont);
-    }
+    // mainFont is shared with the SDK; nothing to unload
     g_theme.initialized = false;
 }
 
@@ -332,12 +259,14 @@ void NpThemeDrawTextColored(NpTypographyId typo, const char *text, Vector2 pos,
         source = buffer;
     }
 
+    LlzFontRequireText(style->font, source);
     DrawTextEx(style->font, source, pos, style->fontSize, style->spacing, color);
 }
 
 float NpThemeMeasureTextWidth(NpTypographyId typo, const char *text) {
     if (!text || typo < 0 || typo >= NP_TYPO_COUNT) return 0.0f;
     TypographyStyle *style = &g_theme.variants[g_theme.activeVariant].typography[typo];
+    LlzFontRequireText(style->font, text);
     Vector2 size = MeasureTextEx(style->font, text, style->fontSize, style->spacing);
     return size.x;
 }
@@ -20,8 +20,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include <sys/stat.h>
-#include <webp/decode.h>
 
 // Screen dimensions
 static int g_screenWidth = 800;
@@ -69,16 +67,24 @@ static const float JUST_SEEKED_COOLDOWN = 0.5f;
 static float g_playPauseGracePeriod = 0.0f;
 static const float PLAY_PAUSE_GRACE_DURATION = 0.5f;
 
-// Album art texture state
+// Album art texture state. Textures belong to the SDK art cache and stay
+// valid while their handle is held.
 static Texture2D g_albumArtTexture = {0};
 static Texture2D g_albumArtBlurred = {0};
+static LlzArtHandle g_albumArt = 0;
+static LlzArtHandle g_albumArtBlur = 0;
 static bool g_albumArtLoaded = false;
 static char g_albumArtLoadedPath[LLZ_MEDIA_PATH_MAX] = {0};
+static LlzArtHandle g_albumArtPending = 0;      // Requested art, installed once loaded
+static LlzArtHandle g_albumArtPendingBlur = 0;
+static char g_albumArtPendingPath[LLZ_MEDIA_PATH_MAX] = {0};
 
 // Album art crossfade transition state
 typedef struct {
     Texture2D prevTexture;      // Previous album art (for crossfade out)
     Texture2D prevBlurred;      // Previous blurred (for crossfade out)
+    LlzArtHandle prevArt;       // Cache handles keeping the previous textures alive
+    LlzArtHandle prevBlurArt;
     float currentAlpha;         // Alpha for current textures (fade in)
     float prevAlpha;            // Alpha for previous textures (fade out)
     bool inTransition;          // Currently transitioning
@@ -93,6 +99,7 @@ typedef struct {
     Color primary;          // Dominant color from album art
     Color accent;           // Vibrant/saturated variant
     Color complementary;    // Complementary color for contrast
+    LlzPalette palette;     // Palette extracted by the art worker
     bool hasColors;         // Whether colors have been extracted
 } AlbumArtColors;
 
@@ -115,10 +122,12 @@ static NpPlaybackState g_playback = {
 static void MediaInitialize(void);
 static void MediaPoll(float deltaTime);
 static void MediaApplyState(const LlzMediaState *state);
+static void MediaFetch(void);
 static void TogglePlayback(void);
 static void SkipTrack(bool next);
 static void HandleScrubState(const NpPlaybackActions *actions);
 static void LoadAlbumArtTexture(const char *path);
+static void PollAlbumArtTexture(void);
 static void UnloadAlbumArtTexture(void);
 static void UpdateAlbumArtTransition(float deltaTime);
 static void CleanupPrevAlbumArt(void);
@@ -205,7 +214,7 @@ static void LoadPluginSettings(void) {
         LlzBackgroundSetStyle((LlzBackgroundStyle)bgStyle, false);
         // Set colors from album art if available
         if (g_albumArtColors.hasColors) {
-            LlzBackgroundSetColors(g_albumArtColors.primary, g_albumArtColors.accent);
+            LlzBackgroundSetPalette(&g_albumArtColors.palette);
         }
     }
 
@@ -236,7 +245,7 @@ static float Clamp01(float value)
 static void UpdateBackgroundColors(void)
 {
     if (g_albumArtColors.hasColors) {
-        LlzBackgroundSetColors(g_albumArtColors.primary, g_albumArtColors.accent);
+        LlzBackgroundSetPalette(&g_albumArtColors.palette);
     } else {
         LlzBackgroundClearColors();
     }
@@ -451,92 +460,15 @@ static void DrawVolumeOverlay(void)
     }
 }
 
-// Load WebP image file and convert to raylib Image format
-static Image LoadImageWebP(const char *path)
-{
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        printf("[ALBUMART] LoadImageWebP: failed to open file '%s'\n", path);
-        return image;
-    }
-
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Read file data
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        printf("[ALBUMART] LoadImageWebP: failed to allocate %ld bytes\n", fileSize);
-        fclose(file);
-        return image;
-    }
-
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        printf("[ALBUMART] LoadImageWebP: read %zu bytes, expected %ld\n", bytesRead, fileSize);
-        free(fileData);
-        return image;
-    }
-
-    // Decode WebP
-    int width = 0, height = 0;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
-
-    if (!rgbaData) {
-        printf("[ALBUMART] LoadImageWebP: WebPDecodeRGBA failed\n");
-        return image;
-    }
-
-    // Create raylib Image from RGBA data
-    // We need to copy the data because WebP uses its own allocator
-    size_t dataSize = width * height * 4;
-    void *imageCopy = RL_MALLOC(dataSize);
-    if (!imageCopy) {
-        printf("[ALBUMART] LoadImageWebP: failed to allocate image data\n");
-        WebPFree(rgbaData);
-        return image;
-    }
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
-
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    printf("[ALBUMART] LoadImageWebP: decoded %dx%d image\n", width, height);
-    return image;
-}
-
-// Check if file path has WebP extension
-static bool IsWebPFile(const char *path)
-{
-    if (!path) return false;
-    size_t len = strlen(path);
-    if (len < 5) return false;
-    const char *ext = path + len - 5;
-    return (strcmp(ext, ".webp") == 0 || strcmp(ext, ".WEBP") == 0);
-}
-
-// Cleanup previous album art textures after crossfade completes
+// Release previous album art after crossfade completes
 static void CleanupPrevAlbumArt(void)
 {
-    if (g_albumArtTransition.prevTexture.id != 0) {
-        UnloadTexture(g_albumArtTransition.prevTexture);
-        memset(&g_albumArtTransition.prevTexture, 0, sizeof(Texture2D));
-    }
-    if (g_albumArtTransition.prevBlurred.id != 0) {
-        UnloadTexture(g_albumArtTransition.prevBlurred);
-        memset(&g_albumArtTransition.prevBlurred, 0, sizeof(Texture2D));
-    }
+    LlzArtCacheRelease(g_albumArtTransition.prevArt);
+    LlzArtCacheRelease(g_albumArtTransition.prevBlurArt);
+    g_albumArtTransition.prevArt = 0;
+    g_albumArtTransition.prevBlurArt = 0;
+    memset(&g_albumArtTransition.prevTexture, 0, sizeof(Texture2D));
+    memset(&g_albumArtTransition.prevBlurred, 0, sizeof(Texture2D));
 }
 
 // Update album art transition (call each frame)
@@ -622,59 +554,16 @@ static Color HSVToRGB(float h, float s, float v)
     };
 }
 
-// Extract dominant color from image using sampling
-static void ExtractAlbumArtColors(Image img)
+// Derive UI colors from the palette extracted when the art was decoded
+static void ApplyAlbumArtColors(const LlzPalette *palette)
 {
-    if (img.data == NULL || img.width <= 0 || img.height <= 0) {
+    if (!palette->valid) {
         g_albumArtColors.hasColors = false;
         return;
     }
 
-    // Sample colors from the image
-    int sampleCount = 0;
-    float avgR = 0, avgG = 0, avgB = 0;
-    float maxSat = 0;
-    Color mostVibrant = {128, 128, 128, 255};
-
-    int stepX = img.width / 8;
-    int stepY = img.height / 8;
-    if (stepX < 1) stepX = 1;
-    if (stepY < 1) stepY = 1;
-
-    for (int y = stepY / 2; y < img.height; y += stepY) {
-        for (int x = stepX / 2; x < img.width; x += stepX) {
-            Color pixel = GetImageColor(img, x, y);
-
-            // Skip very dark or very light pixels
-            float brightness = (pixel.r + pixel.g + pixel.b) / 3.0f;
-            if (brightness < 30 || brightness > 240) continue;
-
-            avgR += pixel.r;
-            avgG += pixel.g;
-            avgB += pixel.b;
-            sampleCount++;
-
-            // Track most vibrant/saturated color
-            Vector3 hsv = RGBToHSV(pixel);
-            if (hsv.y > maxSat && hsv.z > 0.2f) {
-                maxSat = hsv.y;
-                mostVibrant = pixel;
-            }
-        }
-    }
-
-    if (sampleCount == 0) {
-        g_albumArtColors.hasColors = false;
-        return;
-    }
-
-    // Calculate average color
-    Color avgColor = {
-        (unsigned char)(avgR / sampleCount),
-        (unsigned char)(avgG / sampleCount),
-        (unsigned char)(avgB / sampleCount),
-        255
-    };
+    Color avgColor = palette->dominant;
+    Color mostVibrant = palette->vibrant;
 
     // Generate complementary color (opposite hue)
     Vector3 hsv = RGBToHSV(mostVibrant);
@@ -687,6 +576,7 @@ static void ExtractAlbumArtColors(Image img)
     g_albumArtColors.primary = avgColor;
     g_albumArtColors.accent = accent;
     g_albumArtColors.complementary = complementary;
+    g_albumArtColors.palette = *palette;
     g_albumArtColors.hasColors = true;
 
     // Update SDK background colors with album art colors
@@ -698,8 +588,19 @@ static void ExtractAlbumArtColors(Image img)
            complementary.r, complementary.g, complementary.b);
 }
 
+static void ReleasePendingAlbumArt(void)
+{
+    LlzArtCacheRelease(g_albumArtPending);
+    LlzArtCacheRelease(g_albumArtPendingBlur);
+    g_albumArtPending = 0;
+    g_albumArtPendingBlur = 0;
+    g_albumArtPendingPath[0] = '\0';
+}
+
 static void UnloadAlbumArtTexture(void)
 {
+    ReleasePendingAlbumArt();
+
     // If we have textures, move them to prev for fade-out
     if (g_albumArtLoaded && g_albumArtTexture.id != 0) {
         // Cleanup any existing prev textures first
@@ -708,14 +609,23 @@ static void UnloadAlbumArtTexture(void)
         // Move current to prev for crossfade
         g_albumArtTransition.prevTexture = g_albumArtTexture;
         g_albumArtTransition.prevBlurred = g_albumArtBlurred;
+        g_albumArtTransition.prevArt = g_albumArt;
+        g_albumArtTransition.prevBlurArt = g_albumArtBlur;
         g_albumArtTransition.prevAlpha = g_albumArtTransition.currentAlpha;
         g_albumArtTransition.currentAlpha = 0.0f;
         g_albumArtTransition.inTransition = true;
         g_albumArtTransition.fadingOut = true;
 
-        // Clear current (but don't unload - they're now in prev)
+        // Clear current (the handles are now owned by prev)
         memset(&g_albumArtTexture, 0, sizeof(g_albumArtTexture));
         memset(&g_albumArtBlurred, 0, sizeof(g_albumArtBlurred));
+        g_albumArt = 0;
+        g_albumArtBlur = 0;
+    } else {
+        LlzArtCacheRelease(g_albumArt);
+        LlzArtCacheRelease(g_albumArtBlur);
+        g_albumArt = 0;
+        g_albumArtBlur = 0;
     }
     g_albumArtLoaded = false;
     g_albumArtLoadedPath[0] = '\0';
@@ -733,41 +643,38 @@ static void LoadAlbumArtTexture(const char *path)
         return;  // Skip logging for already loaded
     }
 
-    printf("[ALBUMART] LoadAlbumArtTexture: attempting to load '%s'\n", path);
-
-    // Check if file exists before doing anything
-    struct stat st;
-    if (stat(path, &st) != 0) {
-        printf("[ALBUMART] LoadAlbumArtTexture: FILE NOT FOUND '%s'\n", path);
+    // Already waiting for this path
+    if (g_albumArtPending != 0 && strcmp(path, g_albumArtPendingPath) == 0) {
         return;
     }
-    printf("[ALBUMART] LoadAlbumArtTexture: file exists, size=%ld bytes\n", (long)st.st_size);
 
-    Image img;
-    if (IsWebPFile(path)) {
-        // Use custom WebP loader (raylib doesn't support WebP natively)
-        printf("[ALBUMART] LoadAlbumArtTexture: using WebP decoder\n");
-        img = LoadImageWebP(path);
-    } else {
-        // Use raylib's built-in image loader for other formats
-        img = LoadImage(path);
-    }
+    ReleasePendingAlbumArt();
 
-    if (img.data == NULL) {
-        printf("[ALBUMART] LoadAlbumArtTexture: LoadImage FAILED for '%s'\n", path);
+    // The art cache decodes, blurs and samples colours on the SDK worker and
+    // shares the textures with the lyrics plugin and the menu background
+    g_albumArtPending = LlzArtCacheAcquirePath(path, LLZ_ART_VARIANT_FULL);
+    g_albumArtPendingBlur = LlzArtCacheAcquirePath(path, LLZ_ART_VARIANT_BLUR);
+    if (g_albumArtPending == 0 || g_albumArtPendingBlur == 0) {
+        printf("[ALBUMART] LoadAlbumArtTexture: art cache full, skipping '%s'\n", path);
+        ReleasePendingAlbumArt();
         return;
     }
-    printf("[ALBUMART] LoadAlbumArtTexture: image loaded %dx%d\n", img.width, img.height);
 
-    // Extract colors from image before converting to texture
-    ExtractAlbumArtColors(img);
+    strncpy(g_albumArtPendingPath, path, sizeof(g_albumArtPendingPath) - 1);
+    g_albumArtPendingPath[sizeof(g_albumArtPendingPath) - 1] = '\0';
+    printf("[ALBUMART] LoadAlbumArtTexture: requested '%s'\n", path);
+}
 
-    Texture2D newTexture = LoadTextureFromImage(img);
-    UnloadImage(img);
+// Install album art once the cache has it loaded (call each frame). Art that
+// is not downloaded yet stays pending and is retried by the cache.
+static void PollAlbumArtTexture(void)
+{
+    if (g_albumArtPending == 0) return;
+    if (!LlzArtCacheIsReady(g_albumArtPending) || !LlzArtCacheIsReady(g_albumArtPendingBlur)) return;
 
-    if (newTexture.id == 0) {
-        printf("[ALBUMART] LoadAlbumArtTexture: LoadTextureFromImage FAILED\n");
-        return;
+    LlzPalette palette;
+    if (LlzArtCacheGetPalette(g_albumArtPending, &palette)) {
+        ApplyAlbumArtColors(&palette);
     }
 
     // Move current textures to prev for crossfade (if we have any)
@@ -775,27 +682,28 @@ static void LoadAlbumArtTexture(const char *path)
     if (g_albumArtLoaded && g_albumArtTexture.id != 0) {
         g_albumArtTransition.prevTexture = g_albumArtTexture;
         g_albumArtTransition.prevBlurred = g_albumArtBlurred;
+        g_albumArtTransition.prevArt = g_albumArt;
+        g_albumArtTransition.prevBlurArt = g_albumArtBlur;
         g_albumArtTransition.prevAlpha = g_albumArtTransition.currentAlpha;
     } else {
+        LlzArtCacheRelease(g_albumArt);
+        LlzArtCacheRelease(g_albumArtBlur);
         g_albumArtTransition.prevAlpha = 0.0f;
     }
 
     // Set new textures
-    g_albumArtTexture = newTexture;
+    g_albumArt = g_albumArtPending;
+    g_albumArtBlur = g_albumArtPendingBlur;
+    g_albumArtTexture = LlzArtCacheGetTexture(g_albumArt);
+    g_albumArtBlurred = LlzArtCacheGetTexture(g_albumArtBlur);
     g_albumArtLoaded = true;
-    strncpy(g_albumArtLoadedPath, path, sizeof(g_albumArtLoadedPath) - 1);
+    strncpy(g_albumArtLoadedPath, g_albumArtPendingPath, sizeof(g_albumArtLoadedPath) - 1);
     g_albumArtLoadedPath[sizeof(g_albumArtLoadedPath) - 1] = '\0';
-    printf("[ALBUMART] LoadAlbumArtTexture: SUCCESS texture_id=%u loaded='%s'\n",
-           g_albumArtTexture.id, g_albumArtLoadedPath);
-
-    // Generate blurred version for background effect
-    // blurRadius=15 gives good blur, darkenAmount=0.4 darkens to make text readable
-    g_albumArtBlurred = LlzTextureBlur(g_albumArtTexture, 15, 0.4f);
-    if (g_albumArtBlurred.id != 0) {
-        printf("[ALBUMART] LoadAlbumArtTexture: Blurred texture generated, id=%u\n", g_albumArtBlurred.id);
-    } else {
-        printf("[ALBUMART] LoadAlbumArtTexture: Warning - failed to generate blurred texture\n");
-    }
+    g_albumArtPending = 0;
+    g_albumArtPendingBlur = 0;
+    g_albumArtPendingPath[0] = '\0';
+    printf("[ALBUMART] LoadAlbumArtTexture: SUCCESS texture_id=%u blurred_id=%u loaded='%s'\n",
+           g_albumArtTexture.id, g_albumArtBlurred.id, g_albumArtLoadedPath);
 
     // Start fade-in transition for new album art
     g_albumArtTransition.currentAlpha = 0.0f;
@@ -823,13 +731,9 @@ static void MediaApplyState(const LlzMediaState *state)
     g_playback.trackArtist = g_trackArtist;
     g_playback.trackAlbum = g_trackAlbum;
 
-    // Get the controlled media channel (e.g., "Spotify", "YouTube Music")
-    if (LlzMediaGetControlledChannel(g_mediaChannel, sizeof(g_mediaChannel))) {
-        g_playback.mediaChannel = g_mediaChannel;
-    } else {
-        g_mediaChannel[0] = '\0';
-        g_playback.mediaChannel = g_mediaChannel;
-    }
+    // Controlled media channel (e.g., "Spotify", "YouTube Music"), fetched
+    // alongside the state by MediaFetch
+    g_playback.mediaChannel = g_mediaChannel;
 
     // Only update isPlaying from Redis if grace period has expired
     // This prevents "flicker" when toggling play/pause (local state is correct,
@@ -862,7 +766,7 @@ static void MediaApplyState(const LlzMediaState *state)
         if (hash && hash[0] != '\0') {
             static char generatedPath[512];
             snprintf(generatedPath, sizeof(generatedPath),
-                     "/var/mediadash/album_art_cache/%s.webp", hash);
+                     "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
             printf("[ALBUMART] MediaApplyState: albumArtPath empty, trying generated path '%s'\n", generatedPath);
             LoadAlbumArtTexture(generatedPath);
         }
@@ -877,12 +781,29 @@ static void MediaPoll(float deltaTime)
     if (g_mediaRefreshTimer < MEDIA_REFRESH_INTERVAL) return;
     g_mediaRefreshTimer = 0.0f;
 
+    MediaFetch();
+}
+
+// State and controlled channel in one batch: the state comes from the poller
+// snapshot, so the channel GET is the only round trip
+static void MediaFetch(void)
+{
     LlzMediaState latest;
-    if (LlzMediaGetState(&latest)) {
-        g_mediaState = latest;
-        g_mediaStateValid = true;
-        MediaApplyState(&g_mediaState);
-    }
+    char channel[LLZ_MEDIA_TEXT_MAX] = "";
+    LlzMediaBatch batch;
+    LlzMediaBatchBegin(&batch);
+    int stateIdx = LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_STATE, &latest, sizeof(latest));
+    LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL, channel, sizeof(channel));
+    LlzMediaBatchFlush(&batch);
+
+    if (!LlzMediaBatchItemOk(&batch, stateIdx)) return;
+
+    // The channel stays empty when its GET failed
+    strncpy(g_mediaChannel, channel, sizeof(g_mediaChannel) - 1);
+    g_mediaChannel[sizeof(g_mediaChannel) - 1] = '\0';
+    g_mediaState = latest;
+    g_mediaStateValid = true;
+    MediaApplyState(&g_mediaState);
 }
 
 static void MediaInitialize(void)
@@ -898,10 +819,7 @@ static void MediaInitialize(void)
         printf("NowPlaying plugin: Redis media init failed (retry background)\n");
     }
 
-    if (LlzMediaGetState(&g_mediaState)) {
-        g_mediaStateValid = true;
-        MediaApplyState(&g_mediaState);
-    }
+    MediaFetch();
 }
 
 static void TogglePlayback(void)
@@ -1001,6 +919,7 @@ static void PluginUpdate(const LlzInputState *hostInput, float deltaTime)
     LlzBackgroundUpdate(deltaTime);
     LlzBackgroundSetEnergy(g_playback.isPlaying ? 1.0f : 0.0f);
     UpdateSwipeIndicator(deltaTime);
+    PollAlbumArtTexture();
     UpdateAlbumArtTransition(deltaTime);
 
     // Color picker - toggle on button4 hold event (button code 5 / mapped 6)
@@ -1385,8 +1304,10 @@ static void PluginShutdown(void)
         g_pluginConfigInitialized = false;
     }
 
-    // Unload album art texture
+    // Release album art (the textures stay in the SDK art cache)
     UnloadAlbumArtTexture();
+    CleanupPrevAlbumArt();
+    memset(&g_albumArtTransition, 0, sizeof(g_albumArtTransition));
 
     if (g_mediaInitialized) {
         LlzMediaShutdown();
@@ -1411,6 +1332,20 @@ static bool PluginWantsClose(void)
     return g_wantsClose;
 }
 
+// A paused, settled screen is static: track changes arrive as media
+// snapshots, which the governor redraws by itself, and the SDK background
+// asks for its own frames
+static bool PluginWantsRedraw(void)
+{
+    if (g_playback.isPlaying || g_scrubActive || g_justSeeked || g_playPauseGracePeriod > 0.0f) return true;
+    if (g_albumArtTransition.inTransition || g_swipeIndicator.active) return true;
+    if (g_volumeOverlayTimer > 0.0f || g_volumeOverlayAlpha > 0.0f) return true;
+    return NpOverlayManagerIsVisible(&g_overlayManager) ||
+           NpColorPickerOverlayIsActive(&g_colorPicker) ||
+           NpMediaChannelsOverlayIsActive(&g_mediaChannelsOverlay) ||
+           NpActionsOverlayIsActive(&g_actionsOverlay);
+}
+
 static LlzPluginAPI g_api = {
     .name = "Now Playing",
     .description = "Now playing screen with clock overlay and theming",
@@ -1419,7 +1354,8 @@ static LlzPluginAPI g_api = {
     .draw = PluginDraw,
     .shutdown = PluginShutdown,
     .wants_close = PluginWantsClose,
-    .category = LLZ_CATEGORY_MEDIA
+    .category = LLZ_CATEGORY_MEDIA,
+    .wants_redraw = PluginWantsRedraw
 };
 
 const LlzPluginAPI *LlzGetPlugin(void)
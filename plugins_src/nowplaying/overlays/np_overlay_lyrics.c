@@ -2,6 +2,7 @@
 #include "../core/np_theme.h"
 #include "../screens/np_screen_now_playing.h"
 #include "llz_sdk_media.h"
+#include "llz_sdk_font.h"
 #include "raylib.h"
 #include <stdio.h>
 #include <string.h>
@@ -22,6 +23,14 @@
 static LlzLyricsData s_cachedLyrics = {0};
 static bool s_lyricsLoaded = false;
 
+// Add the glyphs of newly loaded lyrics to the theme font before they are drawn
+static void RequireLyricsGlyphs(void) {
+    Font font = NpThemeGetFont();
+    for (int i = 0; i < s_cachedLyrics.lineCount; i++) {
+        LlzFontRequireText(font, s_cachedLyrics.lines[i].text);
+    }
+}
+
 // Clamp a value between min and max
 static float Clamp(float value, float min, float max) {
     if (value < min) return min;
@@ -155,6 +164,7 @@ void NpLyricsOverlayUpdate(NpLyricsOverlay *overlay, float deltaTime, int64_t po
     if (!overlay) return;
 
     // Check if lyrics hash has changed (new track)
+    LlzLyricsUpdate();
     char currentHash[64] = {0};
     if (LlzLyricsGetHash(currentHash, sizeof(currentHash))) {
         if (strcmp(currentHash, overlay->lyricsHash) != 0) {
@@ -173,6 +183,7 @@ void NpLyricsOverlayUpdate(NpLyricsOverlay *overlay, float deltaTime, int64_t po
             printf("[LYRICS] Update: Attempting to load new lyrics from Redis\n");
             if (LlzLyricsGet(&s_cachedLyrics)) {
                 s_lyricsLoaded = true;
+                RequireLyricsGlyphs();
                 overlay->hasLyrics = (s_cachedLyrics.lineCount > 0);
                 overlay->isSynced = s_cachedLyrics.synced;
                 strncpy(overlay->lyricsHash, currentHash, sizeof(overlay->lyricsHash) - 1);
@@ -198,6 +209,7 @@ void NpLyricsOverlayUpdate(NpLyricsOverlay *overlay, float deltaTime, int64_t po
         printf("[LYRICS] Update: No hash in Redis, attempting initial lyrics load\n");
         if (LlzLyricsGet(&s_cachedLyrics)) {
             s_lyricsLoaded = true;
+            RequireLyricsGlyphs();
             overlay->hasLyrics = (s_cachedLyrics.lineCount > 0);
             overlay->isSynced = s_cachedLyrics.synced;
             if (s_cachedLyrics.hash[0]) {
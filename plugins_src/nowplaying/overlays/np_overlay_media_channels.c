@@ -32,6 +32,14 @@ void NpMediaChannelsOverlayInit(NpMediaChannelsOverlay *overlay) {
     overlay->selectedChannel[0] = '\0';
 }
 
+// Add the glyphs of received channel names to the theme font
+static void RequireChannelGlyphs(void) {
+    Font font = NpThemeGetFont();
+    for (int i = 0; i < g_channels.count; i++) {
+        LlzFontRequireText(font, g_channels.channels[i]);
+    }
+}
+
 static int GetItemCount(void) {
     // +1 for refresh button at index 0
     return g_channels.count + 1;
@@ -59,6 +67,7 @@ void NpMediaChannelsOverlayUpdate(NpMediaChannelsOverlay *overlay, const LlzInpu
         if (LlzMediaGetChannels(&g_channels)) {
             overlay->channelsLoading = false;
             printf("[MEDIA_CHANNELS_OVERLAY] Received %d channels\n", g_channels.count);
+            RequireChannelGlyphs();
             LlzMediaGetControlledChannel(g_controlledChannel, sizeof(g_controlledChannel));
         } else if (overlay->requestTime > 10.0f) {
             // Timeout
@@ -166,8 +175,8 @@ void NpMediaChannelsOverlayDraw(const NpMediaChannelsOverlay *overlay, const NpA
     float contentHeight = PANEL_HEIGHT - 100.0f;
 
     // Clip content area
-    BeginScissorMode((int)panelX + ITEM_MARGIN, (int)contentY,
-                     PANEL_WIDTH - ITEM_MARGIN * 2, (int)contentHeight);
+    LlzDisplayBeginScissor((int)panelX + ITEM_MARGIN, (int)contentY,
+                           PANEL_WIDTH - ITEM_MARGIN * 2, (int)contentHeight);
 
     int itemCount = GetItemCount();
 
@@ -273,7 +282,7 @@ void NpMediaChannelsOverlayDraw(const NpMediaChannelsOverlay *overlay, const NpA
         }
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Draw hint at bottom
     const char *hint = "Scroll: navigate  |  Select: choose  |  Back: cancel";
@@ -296,6 +305,7 @@ void NpMediaChannelsOverlayShow(NpMediaChannelsOverlay *overlay) {
     // Load current channels
     if (LlzMediaGetChannels(&g_channels)) {
         printf("[MEDIA_CHANNELS_OVERLAY] Loaded %d cached channels\n", g_channels.count);
+        RequireChannelGlyphs();
         LlzMediaGetControlledChannel(g_controlledChannel, sizeof(g_controlledChannel));
 
         // Select the currently controlled channel
@@ -443,7 +443,7 @@ static void DrawPluginList(void) {
     g_scrollOffset += (g_targetScrollOffset - g_scrollOffset) * 0.15f;
 
     // Clipping region
-    BeginScissorMode(0, (int)startY, g_screenWidth, (int)visibleHeight);
+    LlzDisplayBeginScissor(0, (int)startY, g_screenWidth, (int)visibleHeight);
 
     for (int i = 0; i < g_pluginCount; i++) {
         float itemY = startY + i * itemHeight - g_scrollOffset;
@@ -454,7 +454,7 @@ static void DrawPluginList(void) {
         DrawPluginCard(&g_plugins[i], i, itemY);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Scroll fade indicators
     if (g_scrollOffset > 5) {
@@ -147,7 +147,6 @@ static const Color COLOR_CARD_BORDER = {60, 55, 80, 255};
 
 // Font
 static Font g_podcastFont;
-static bool g_fontLoaded = false;
 
 // Smooth scroll state
 static float g_smoothScrollOffset = 0.0f;
@@ -163,64 +162,16 @@ static void RequestPodcastEpisodes(const char *podcastId, int offset, int limit)
 // Font Loading (using SDK)
 // ============================================================================
 
-static int *BuildUnicodeCodepoints(int *outCount) {
-    static const int ranges[][2] = {
-        {0x0020, 0x007E},   // ASCII
-        {0x00A0, 0x00FF},   // Latin-1 Supplement
-        {0x0100, 0x017F},   // Latin Extended-A
-    };
-
-    const int numRanges = sizeof(ranges) / sizeof(ranges[0]);
-    int total = 0;
-    for (int i = 0; i < numRanges; i++) {
-        total += (ranges[i][1] - ranges[i][0] + 1);
-    }
-
-    int *codepoints = (int *)malloc(total * sizeof(int));
-    if (!codepoints) {
-        *outCount = 0;
-        return NULL;
-    }
-
-    int idx = 0;
-    for (int i = 0; i < numRanges; i++) {
-        for (int cp = ranges[i][0]; cp <= ranges[i][1]; cp++) {
-            codepoints[idx++] = cp;
-        }
-    }
-
-    *outCount = total;
-    return codepoints;
-}
-
 static void LoadPodcastFont(void) {
-    // Build custom codepoints for extended Latin support (podcast titles may have accented characters)
-    int codepointCount = 0;
-    int *codepoints = BuildUnicodeCodepoints(&codepointCount);
-
-    // Use SDK to load font with custom codepoints - handles path discovery automatically
-    g_podcastFont = LlzFontLoadCustom(LLZ_FONT_UI, 48, codepoints, codepointCount);
-
-    if (g_podcastFont.texture.id != 0) {
-        g_fontLoaded = true;
-        SetTextureFilter(g_podcastFont.texture, TEXTURE_FILTER_BILINEAR);
-        printf("Podcast: Loaded font via SDK with extended Latin codepoints\n");
-    } else {
-        // Fallback to default SDK font if custom loading fails
-        g_podcastFont = LlzFontGet(LLZ_FONT_UI, 48);
-        g_fontLoaded = false;  // Mark as not custom-loaded so we don't unload SDK-cached font
-        printf("Podcast: Using SDK default font (custom codepoint loading failed)\n");
-    }
-
-    if (codepoints) free(codepoints);
+    // Shared SDK font; glyphs for accented or non-Latin titles are added as
+    // the lists are parsed (LlzFontRequireText)
+    g_podcastFont = LlzFontGet(LLZ_FONT_UI, 48);
+    printf("Podcast: Loaded font via SDK\n");
 }
 
 static void UnloadPodcastFont(void) {
-    // Only unload if we loaded a custom font (LlzFontLoadCustom returns caller-owned font)
-    if (g_fontLoaded && g_podcastFont.texture.id != 0) {
-        UnloadFont(g_podcastFont);
-    }
-    g_fontLoaded = false;
+    // The SDK font is shared with other plugins; nothing to unload
+    g_podcastFont = GetFontDefault();
 }
 
 // ============================================================================
@@ -431,6 +382,8 @@ static int ParsePodcastListJson(const char *json) {
         }
 
         if (*p == '}') p++;
+        LlzFontRequireText(g_podcastFont, channel->title);
+        LlzFontRequireText(g_podcastFont, channel->author);
         count++;
 
         p = skipWs(p);
@@ -512,6 +465,8 @@ static int ParseRecentEpisodesJson(const char *json) {
         }
 
         if (*p == '}') p++;
+        LlzFontRequireText(g_podcastFont, ep->podcastTitle);
+        LlzFontRequireText(g_podcastFont, ep->title);
         count++;
 
         p = skipWs(p);
@@ -570,6 +525,7 @@ static bool ParsePodcastEpisodesJson(const char *json) {
             p = parseString(p, g_currentEpisodes.podcastId, sizeof(g_currentEpisodes.podcastId));
         } else if (fieldLen == 12 && strncmp(fieldStart, "podcastTitle", 12) == 0) {
             p = parseString(p, g_currentEpisodes.podcastTitle, sizeof(g_currentEpisodes.podcastTitle));
+            LlzFontRequireText(g_podcastFont, g_currentEpisodes.podcastTitle);
         } else if (fieldLen == 13 && strncmp(fieldStart, "totalEpisodes", 13) == 0) {
             g_currentEpisodes.totalEpisodes = parseInt(p);
             p = skipValue(p);
@@ -635,6 +591,7 @@ static bool ParsePodcastEpisodesJson(const char *json) {
                 }
 
                 if (*p == '}') p++;
+                LlzFontRequireText(g_podcastFont, ep->title);
                 epCount++;
 
                 p = skipWs(p);
@@ -1090,7 +1047,7 @@ static void DrawPodcastListScreen(void) {
     bool canScrollDown = g_smoothScrollOffset < maxScroll - 1.0f;
 
     // Clipping region for list
-    BeginScissorMode(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
+    LlzDisplayBeginScissor(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
 
     // Show list of podcast channels
     for (int i = 0; i < g_podcastChannelCount; i++) {
@@ -1117,7 +1074,7 @@ static void DrawPodcastListScreen(void) {
         DrawListItem(bounds, channel->title, subtitle, isHighlighted, 0);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Scroll indicators
     DrawScrollFades(canScrollUp, canScrollDown);
@@ -1261,7 +1218,7 @@ static void DrawEpisodeListScreen(void) {
     bool canScrollDown = g_smoothScrollOffset < maxScroll - 1.0f;
 
     // Clipping region for list
-    BeginScissorMode(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
+    LlzDisplayBeginScissor(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
 
     // Draw episodes
     for (int i = 0; i < g_currentEpisodes.loadedCount; i++) {
@@ -1311,7 +1268,7 @@ static void DrawEpisodeListScreen(void) {
         }
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Scroll indicators
     DrawScrollFades(canScrollUp, canScrollDown);
@@ -1462,7 +1419,7 @@ static void DrawRecentEpisodesScreen(void) {
     bool canScrollDown = g_smoothScrollOffset < maxScroll - 1.0f;
 
     // Clipping region for list
-    BeginScissorMode(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
+    LlzDisplayBeginScissor(0, LIST_TOP, SCREEN_WIDTH, (int)visibleArea);
 
     for (int i = 0; i < g_recentEpisodeListCount; i++) {
         float itemY = LIST_TOP + i * itemTotalHeight - g_smoothScrollOffset;
@@ -1489,7 +1446,7 @@ static void DrawRecentEpisodesScreen(void) {
         DrawListItem(bounds, ep->title, subtitle, isHighlighted, 0);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Scroll indicators
     DrawScrollFades(canScrollUp, canScrollDown);
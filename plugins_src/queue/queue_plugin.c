@@ -142,9 +142,46 @@ static void RequestQueue(void) {
     }
 }
 
+// Keep "Now Playing" in sync with media state and refresh the queue list
+// when the track changes
+static void SyncNowPlaying(const LlzMediaState *mediaState) {
+    strncpy(g_queueData.currentlyPlaying.title, mediaState->track,
+            sizeof(g_queueData.currentlyPlaying.title) - 1);
+    g_queueData.currentlyPlaying.title[sizeof(g_queueData.currentlyPlaying.title) - 1] = '\0';
+
+    strncpy(g_queueData.currentlyPlaying.artist, mediaState->artist,
+            sizeof(g_queueData.currentlyPlaying.artist) - 1);
+    g_queueData.currentlyPlaying.artist[sizeof(g_queueData.currentlyPlaying.artist) - 1] = '\0';
+
+    strncpy(g_queueData.currentlyPlaying.album, mediaState->album,
+            sizeof(g_queueData.currentlyPlaying.album) - 1);
+    g_queueData.currentlyPlaying.album[sizeof(g_queueData.currentlyPlaying.album) - 1] = '\0';
+
+    g_queueData.currentlyPlaying.durationMs = mediaState->durationSeconds * 1000;
+    g_queueData.hasCurrentlyPlaying = true;
+
+    // Check if track changed - refresh the queue list
+    if (g_lastTrackTitle[0] != '\0' &&
+        strcmp(g_lastTrackTitle, mediaState->track) != 0) {
+        printf("[QUEUE] Track changed: '%s' -> '%s', refreshing queue\n",
+               g_lastTrackTitle, mediaState->track);
+
+        // Request fresh queue data for the full queue list
+        g_queueValid = false;
+        g_queueRequested = false;
+        g_autoRefreshTimer = 0.0f;
+        RequestQueue();
+    }
+
+    // Update last known track
+    strncpy(g_lastTrackTitle, mediaState->track, sizeof(g_lastTrackTitle) - 1);
+    g_lastTrackTitle[sizeof(g_lastTrackTitle) - 1] = '\0';
+}
+
 static void PollQueueData(float deltaTime) {
     g_refreshTimer += deltaTime;
     g_autoRefreshTimer += deltaTime;
+    g_trackCheckTimer += deltaTime;
 
     if (g_autoRefreshTimer >= AUTO_REFRESH_INTERVAL) {
         g_autoRefreshTimer = 0.0f;
@@ -152,19 +189,38 @@ static void PollQueueData(float deltaTime) {
         RequestQueue();
     }
 
+    bool wantQueue = false;
     if (g_refreshTimer >= REFRESH_INTERVAL) {
         g_refreshTimer = 0.0f;
+        wantQueue = g_queueRequested && !g_queueValid;
+    }
 
-        if (g_queueRequested && !g_queueValid) {
-            LlzQueueData tempQueue;
-            if (LlzMediaGetQueue(&tempQueue)) {
-                memcpy(&g_queueData, &tempQueue, sizeof(LlzQueueData));
-                g_queueValid = true;
-                g_isLoading = false;
-                printf("[QUEUE] Loaded queue: %d tracks, currently playing: %s\n",
-                       g_queueData.trackCount,
-                       g_queueData.hasCurrentlyPlaying ? g_queueData.currentlyPlaying.title : "(none)");
-            }
+    bool wantState = false;
+    if (g_trackCheckTimer >= TRACK_CHECK_INTERVAL) {
+        g_trackCheckTimer = 0.0f;
+        wantState = true;
+    }
+
+    // Queue and track check share one round trip
+    if (wantQueue || wantState) {
+        LlzQueueData tempQueue;
+        LlzMediaState mediaState;
+        LlzMediaBatch batch;
+        LlzMediaBatchBegin(&batch);
+        int queueIdx = wantQueue ? LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_QUEUE, &tempQueue, sizeof(tempQueue)) : -1;
+        int stateIdx = wantState ? LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_STATE, &mediaState, sizeof(mediaState)) : -1;
+        LlzMediaBatchFlush(&batch);
+
+        if (LlzMediaBatchItemOk(&batch, queueIdx)) {
+            memcpy(&g_queueData, &tempQueue, sizeof(LlzQueueData));
+            g_queueValid = true;
+            g_isLoading = false;
+            printf("[QUEUE] Loaded queue: %d tracks, currently playing: %s\n",
+                   g_queueData.trackCount,
+                   g_queueData.hasCurrentlyPlaying ? g_queueData.currentlyPlaying.title : "(none)");
+        }
+        if (LlzMediaBatchItemOk(&batch, stateIdx) && mediaState.track[0] != '\0') {
+            SyncNowPlaying(&mediaState);
         }
     }
 
@@ -206,27 +262,17 @@ static void DrawLoadingSpinner(float x, float y, float radius) {
 
 static void DrawTruncatedText(const char *text, float x, float y,
                               float maxWidth, int fontSize, Color color) {
-    Font font = LlzFontGet(LLZ_FONT_UI, fontSize);
-    int textWidth = LlzMeasureText(text, fontSize);
-
-    if (textWidth <= (int)maxWidth) {
+    int keep = LlzFitText(text, fontSize, (int)maxWidth, "...");
+    if (text[keep] == '\0') {
         LlzDrawText(text, (int)x, (int)y, fontSize, color);
         return;
     }
 
     // Truncate with ellipsis
     char truncated[256];
-    int len = strlen(text);
-    for (int i = len; i > 0; i--) {
-        strncpy(truncated, text, i);
-        truncated[i] = '\0';
-        strcat(truncated, "...");
-        if (LlzMeasureText(truncated, fontSize) <= (int)maxWidth) {
-            LlzDrawText(truncated, (int)x, (int)y, fontSize, color);
-            return;
-        }
-    }
-    LlzDrawText("...", (int)x, (int)y, fontSize, color);
+    if (keep > 250) keep = 250;
+    snprintf(truncated, sizeof(truncated), "%.*s...", keep, text);
+    LlzDrawText(truncated, (int)x, (int)y, fontSize, color);
 }
 
 static void DrawQueueItem(int index, const LlzQueueTrack *track, float yPos,
@@ -380,48 +426,6 @@ static void plugin_update(const LlzInputState *input, float deltaTime) {
     PollQueueData(deltaTime);
     UpdateSmoothScroll(deltaTime);
 
-    // Check for track changes and keep "Now Playing" in sync with media state
-    g_trackCheckTimer += deltaTime;
-    if (g_trackCheckTimer >= TRACK_CHECK_INTERVAL) {
-        g_trackCheckTimer = 0.0f;
-
-        LlzMediaState mediaState;
-        if (LlzMediaGetState(&mediaState) && mediaState.track[0] != '\0') {
-            // Always keep "Now Playing" in sync with current media state
-            strncpy(g_queueData.currentlyPlaying.title, mediaState.track,
-                    sizeof(g_queueData.currentlyPlaying.title) - 1);
-            g_queueData.currentlyPlaying.title[sizeof(g_queueData.currentlyPlaying.title) - 1] = '\0';
-
-            strncpy(g_queueData.currentlyPlaying.artist, mediaState.artist,
-                    sizeof(g_queueData.currentlyPlaying.artist) - 1);
-            g_queueData.currentlyPlaying.artist[sizeof(g_queueData.currentlyPlaying.artist) - 1] = '\0';
-
-            strncpy(g_queueData.currentlyPlaying.album, mediaState.album,
-                    sizeof(g_queueData.currentlyPlaying.album) - 1);
-            g_queueData.currentlyPlaying.album[sizeof(g_queueData.currentlyPlaying.album) - 1] = '\0';
-
-            g_queueData.currentlyPlaying.durationMs = mediaState.durationSeconds * 1000;
-            g_queueData.hasCurrentlyPlaying = true;
-
-            // Check if track changed - refresh the queue list
-            if (g_lastTrackTitle[0] != '\0' &&
-                strcmp(g_lastTrackTitle, mediaState.track) != 0) {
-                printf("[QUEUE] Track changed: '%s' -> '%s', refreshing queue\n",
-                       g_lastTrackTitle, mediaState.track);
-
-                // Request fresh queue data for the full queue list
-                g_queueValid = false;
-                g_queueRequested = false;
-                g_autoRefreshTimer = 0.0f;
-                RequestQueue();
-            }
-
-            // Update last known track
-            strncpy(g_lastTrackTitle, mediaState.track, sizeof(g_lastTrackTitle) - 1);
-            g_lastTrackTitle[sizeof(g_lastTrackTitle) - 1] = '\0';
-        }
-    }
-
     int totalItems = g_queueValid ? g_queueData.trackCount : 0;
     if (g_queueValid && g_queueData.hasCurrentlyPlaying) totalItems++;
 
@@ -234,7 +234,7 @@ static void DrawHeader(void)
 
     // Redis connection
     indicatorX += 70;
-    bool redisOk = g_state.mediaInitDone;
+    bool redisOk = g_state.mediaInitDone && LlzRedisIsConnected();
     LlzDrawText("Redis", (int)indicatorX, 12, 14, RS_TEXT_MUTED);
     DrawStatusIndicator(indicatorX + 55, 20, redisOk);
 
@@ -280,9 +280,77 @@ static void DrawConnectionCard(Rectangle bounds)
     // Device name
     if (g_state.conn.deviceName[0]) {
         DrawLabelValue("Device", g_state.conn.deviceName, bounds.x + pad, y, bounds.width - pad * 2);
+        y += 52;
+    }
+
+    // Redis round-trip statistics from the SDK connection manager
+    LlzRedisStats stats;
+    LlzRedisGetStats(&stats);
+    char rttText[64];
+    if (stats.health == LLZ_REDIS_CONNECTED) {
+        snprintf(rttText, sizeof(rttText), "%.1f p50 / %.1f p99 / %.1f max ms (%.0f/s)",
+                 stats.p50RttMs, stats.p99RttMs, stats.maxRttMs, stats.commandsPerSec);
+    } else {
+        snprintf(rttText, sizeof(rttText), "Reconnecting (retry in %d ms)", stats.retryInMs);
+    }
+    DrawLabelValue("Redis RTT", rttText, bounds.x + pad, y, bounds.width - pad * 2);
+}
+
+// One budget row: label, used / soft budget, and a bar against the hard
+// budget with a tick at the soft one
+static void DrawMemoryRow(const char *label, size_t used, size_t soft, size_t hard,
+                          float x, float y, float width)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%.1f / %zu MB", used / 1048576.0, soft >> 20);
+    LlzDrawText(label, (int)x, (int)y, 14, RS_TEXT_MUTED);
+    int textWidth = LlzMeasureText(text, 14);
+    LlzDrawText(text, (int)(x + width - textWidth), (int)y, 14, RS_TEXT_PRIMARY);
+
+    Color barColor = used > hard ? RS_ERROR_COLOR : (used > soft ? RS_WARNING_COLOR : RS_ACCENT_COLOR);
+    Rectangle bar = {x, y + 20, width, 8.0f};
+    DrawProgress(hard > 0 ? (float)used / (float)hard : 0.0f, bar, barColor);
+    if (hard > 0) {
+        float tickX = x + width * (float)soft / (float)hard;
+        DrawRectangle((int)tickX, (int)bar.y - 2, 2, (int)bar.height + 4, RS_TEXT_SECONDARY);
     }
 }
 
+static void DrawMemoryCard(Rectangle bounds)
+{
+    DrawRectangleRounded(bounds, 0.1f, 8, RS_PANEL_COLOR);
+
+    float pad = RS_SPACING_SM;
+    float x = bounds.x + pad;
+    float y = bounds.y + pad;
+    float contentWidth = bounds.width - pad * 2;
+
+    LlzDrawText("Memory", (int)x, (int)y, 20, RS_TEXT_SECONDARY);
+    y += 28;
+
+    // Textures, fonts and buffers tracked by the SDK resource registry
+    LlzResourceStats stats;
+    LlzResourceGetStats(&stats);
+    DrawMemoryRow("GPU", stats.bytes[LLZ_RESOURCE_GPU], stats.soft[LLZ_RESOURCE_GPU],
+                  stats.hard[LLZ_RESOURCE_GPU], x, y, contentWidth);
+    y += 36;
+    DrawMemoryRow("CPU", stats.bytes[LLZ_RESOURCE_CPU], stats.soft[LLZ_RESOURCE_CPU],
+                  stats.hard[LLZ_RESOURCE_CPU], x, y, contentWidth);
+    y += 38;
+
+    // Largest owners
+    LlzResourceOwnerStats owners[2];
+    int ownerCount = LlzResourceGetOwners(owners, 2);
+    char text[64] = "";
+    for (int i = 0; i < ownerCount; i++) {
+        char part[32];
+        snprintf(part, sizeof(part), "%s%.12s %.1fM", i > 0 ? "  " : "", owners[i].name,
+                 (owners[i].bytes[LLZ_RESOURCE_GPU] + owners[i].bytes[LLZ_RESOURCE_CPU]) / 1048576.0);
+        strncat(text, part, sizeof(text) - strlen(text) - 1);
+    }
+    LlzDrawText(ownerCount > 0 ? text : "Nothing tracked", (int)x, (int)y, 14, RS_TEXT_MUTED);
+}
+
 static void DrawMediaCard(Rectangle bounds)
 {
     DrawRectangleRounded(bounds, 0.1f, 8, RS_PANEL_COLOR);
@@ -466,19 +534,28 @@ static void PluginDraw(void)
     float contentY = headerHeight + RS_SPACING_SM;
     float contentHeight = g_screenHeight - headerHeight - footerHeight - RS_SPACING_SM * 2;
 
-    // Two-column layout: Connection (left, narrower), Media (right, wider)
+    // Two-column layout: Connection over Memory (left, narrower), Media (right, wider)
     float leftWidth = 240.0f;
     float gap = RS_SPACING_SM;
     float rightWidth = g_screenWidth - RS_SPACING_MD * 2 - leftWidth - gap;
+    float memoryHeight = 146.0f;
 
     Rectangle connectionCard = {
         RS_SPACING_MD,
         contentY,
         leftWidth,
-        contentHeight
+        contentHeight - memoryHeight - gap
     };
     DrawConnectionCard(connectionCard);
 
+    Rectangle memoryCard = {
+        RS_SPACING_MD,
+        contentY + contentHeight - memoryHeight,
+        leftWidth,
+        memoryHeight
+    };
+    DrawMemoryCard(memoryCard);
+
     Rectangle mediaCard = {
         RS_SPACING_MD + leftWidth + gap,
         contentY,
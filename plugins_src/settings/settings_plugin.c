@@ -62,6 +62,7 @@ static float g_editModeAnim = 0.0f;
 static float g_toggleAnim = 0.0f;
 static float g_sliderPulse = 0.0f;
 static float g_modeTransitionAnim = 0.0f;
+static unsigned char g_drawnGlowAlpha[2] = {0};  // Background glow in the last drawn frame
 
 // ============================================================================
 // Color Palette - Modern Dark Theme
@@ -257,20 +258,23 @@ static void UpdateScroll(float deltaTime) {
 // ============================================================================
 // Drawing Functions
 // ============================================================================
+static unsigned char GlowAlpha(int glow) {
+    if (glow == 0) return (unsigned char)(25 * (0.4f + 0.3f * sinf(g_animTime * 0.6f)));
+    return (unsigned char)(15 * (0.3f + 0.2f * sinf(g_animTime * 0.4f + 1.0f)));
+}
+
 static void DrawGradientBackground(void) {
     ClearBackground(COLOR_BG_DARK);
     DrawRectangleGradientV(0, 0, g_screenWidth, g_screenHeight,
                            COLOR_BG_GRADIENT_START, COLOR_BG_GRADIENT_END);
 
     // Subtle animated accent glow
-    float glowPulse = 0.4f + 0.3f * sinf(g_animTime * 0.6f);
     Color glowColor = COLOR_ACCENT_GLOW;
-    glowColor.a = (unsigned char)(25 * glowPulse);
+    glowColor.a = g_drawnGlowAlpha[0] = GlowAlpha(0);
     DrawCircleGradient(g_screenWidth - 80, 80, 250, glowColor, BLANK);
 
     // Secondary glow
-    float glow2 = 0.3f + 0.2f * sinf(g_animTime * 0.4f + 1.0f);
-    glowColor.a = (unsigned char)(15 * glow2);
+    glowColor.a = g_drawnGlowAlpha[1] = GlowAlpha(1);
     DrawCircleGradient(100, g_screenHeight - 100, 200, glowColor, BLANK);
 }
 
@@ -789,6 +793,11 @@ static void PluginUpdate(const LlzInputState *hostInput, float deltaTime) {
     g_animTime += deltaTime;
     g_sliderPulse += deltaTime;
 
+    // The glow drifts a step every second or so; redraw only when it has
+    if (GlowAlpha(0) != g_drawnGlowAlpha[0] || GlowAlpha(1) != g_drawnGlowAlpha[1]) {
+        LlzGovernorRequestRedraw();
+    }
+
     // Selection animations
     for (int i = 0; i < MENU_ITEM_COUNT; i++) {
         float target = (i == g_selectedItem) ? 1.0f : 0.0f;
@@ -1076,7 +1085,7 @@ static void PluginDraw(void) {
     DrawHeader();
 
     // Clip content area
-    BeginScissorMode(0, CONTENT_TOP, g_screenWidth, (int)CONTENT_HEIGHT);
+    LlzDisplayBeginScissor(0, CONTENT_TOP, g_screenWidth, (int)CONTENT_HEIGHT);
 
     // Draw setting cards
     for (int i = 0; i < MENU_ITEM_COUNT; i++) {
@@ -1103,7 +1112,7 @@ static void PluginDraw(void) {
         DrawSettingCard(i, titles[i], descriptions[i], cardY, selected, editing, g_selectionAnim[i]);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     DrawFooter();
     DrawRestartConfirmation();
@@ -1126,6 +1135,21 @@ static bool PluginWantsClose(void) {
     return g_wantsClose;
 }
 
+static bool Settled(float value, float target) {
+    return fabsf(value - target) < 0.004f;
+}
+
+// Editing and the restart screen pulse continuously; otherwise idle once
+// the selection, toggle and scroll animations have settled
+static bool PluginWantsRedraw(void) {
+    if (g_mode == MODE_EDIT || g_restartConfirmActive || g_mediaChannelsLoading) return true;
+    if (g_scrollOffset != g_targetScrollOffset) return true;
+    for (int i = 0; i < MENU_ITEM_COUNT; i++) {
+        if (!Settled(g_selectionAnim[i], (i == g_selectedItem) ? 1.0f : 0.0f)) return true;
+    }
+    return !Settled(g_editModeAnim, 0.0f) || !Settled(g_toggleAnim, g_lyricsEnabled ? 1.0f : 0.0f);
+}
+
 static LlzPluginAPI g_api = {
     .name = "Settings",
     .description = "Brightness, lyrics, media channels, restart",
@@ -1134,7 +1158,8 @@ static LlzPluginAPI g_api = {
     .draw = PluginDraw,
     .shutdown = PluginShutdown,
     .wants_close = PluginWantsClose,
-    .category = LLZ_CATEGORY_UTILITIES
+    .category = LLZ_CATEGORY_UTILITIES,
+    .wants_redraw = PluginWantsRedraw
 };
 
 const LlzPluginAPI *LlzGetPlugin(void) {
@@ -175,24 +175,16 @@ static void PollLibraryData(float dt);
 static void DrawTruncatedText(const char *text, float x, float y, float maxWidth, int fontSize, Color color) {
     if (!text || text[0] == '\0') return;
 
-    int textWidth = LlzMeasureText(text, fontSize);
-    if (textWidth <= (int)maxWidth) {
+    int keep = LlzFitText(text, fontSize, (int)maxWidth, "..");
+    if (text[keep] == '\0') {
         LlzDrawText(text, (int)x, (int)y, fontSize, color);
         return;
     }
 
     char truncated[256];
-    int len = strlen(text);
-    for (int i = len; i > 0; i--) {
-        strncpy(truncated, text, i);
-        truncated[i] = '\0';
-        strcat(truncated, "..");
-        if (LlzMeasureText(truncated, fontSize) <= (int)maxWidth) {
-            LlzDrawText(truncated, (int)x, (int)y, fontSize, color);
-            return;
-        }
-    }
-    LlzDrawText("..", (int)x, (int)y, fontSize, color);
+    if (keep > 250) keep = 250;
+    snprintf(truncated, sizeof(truncated), "%.*s..", keep, text);
+    LlzDrawText(truncated, (int)x, (int)y, fontSize, color);
 }
 
 static void DrawRoundedCard(float x, float y, float w, float h, Color color) {
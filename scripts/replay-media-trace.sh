@@ -0,0 +1,136 @@
+#!/bin/bash
+
+# Stand-in for golang_ble_client/MediaDash on a desktop: replays recorded
+# Redis writes (track changes, progress ticks, library blobs, lyrics) into a
+# local redis-server so the host and plugins see a realistic media feed
+# without a phone or BLE. Watch the Redis Status plugin (RTT p50/p99,
+# round trips per second) or LlzRedisGetStats/LlzMediaGetBlobCacheStats
+# while a trace plays to compare SDK changes.
+#
+# Usage:
+#   replay-media-trace.sh record <trace>   Capture writes from a running device Redis
+#   replay-media-trace.sh play <trace>     Replay a trace into the local Redis
+#
+# Options (before the subcommand):
+#   -h HOST     Redis host (default 127.0.0.1)
+#   -p PORT     Redis port (default 6379)
+#   -s SPEED    Playback speed multiplier (default 1, 0 = no delays)
+#   -l          Loop playback until interrupted
+#
+# Trace format, one write per line:
+#   <delay_ms> <redis command with redis-cli quoting>
+#   <delay_ms> SETFILE <key> <path>     Value read from a file (large JSON blobs)
+# Lines starting with # are ignored. delay_ms is the wait before the line.
+# sdk/bench/bench_media reads the same format against an in-process stub.
+#
+#   0    SET media:track "Intro"
+#   0    SET media:artist "The Band"
+#   1000 SET media:progress 1
+#   0    SETFILE spotify:library:albums traces/albums.json
+
+set -e
+
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m'
+
+REDIS_HOST="127.0.0.1"
+REDIS_PORT="6379"
+SPEED="1"
+LOOP=0
+
+while getopts "h:p:s:l" opt; do
+    case "$opt" in
+        h) REDIS_HOST="$OPTARG" ;;
+        p) REDIS_PORT="$OPTARG" ;;
+        s) SPEED="$OPTARG" ;;
+        l) LOOP=1 ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+MODE="$1"
+TRACE="$2"
+
+if [ -z "$MODE" ] || [ -z "$TRACE" ]; then
+    sed -n '3,29p' "$0" | sed 's/^# \{0,1\}//'
+    exit 1
+fi
+
+if ! command -v redis-cli &> /dev/null; then
+    echo -e "${RED}redis-cli is required. Install with: sudo apt install redis-tools${NC}"
+    exit 1
+fi
+
+CLI=(redis-cli -h "$REDIS_HOST" -p "$REDIS_PORT")
+
+if ! "${CLI[@]}" PING &> /dev/null; then
+    echo -e "${RED}No Redis at $REDIS_HOST:$REDIS_PORT (start one with: redis-server --port $REDIS_PORT)${NC}"
+    exit 1
+fi
+
+record_trace() {
+    echo -e "${GREEN}=== Recording writes from $REDIS_HOST:$REDIS_PORT to $TRACE (Ctrl-C to stop) ===${NC}"
+    # MONITOR lines look like: 1700000000.123456 [0 127.0.0.1:5555] "SET" "media:track" "X"
+    # Keep the companion's writes and drop the host's own command-queue pushes.
+    "${CLI[@]}" MONITOR | awk '
+        / "(SET|MSET|DEL|HSET|EXPIRE)" / && !/playback_cmd_q|request_q/ {
+            ts = $1
+            sub(/^[^]]*\] /, "")
+            delay = (last == "") ? 0 : int((ts - last) * 1000)
+            last = ts
+            print delay, $0
+            fflush()
+        }' > "$TRACE"
+}
+
+play_line() {
+    local delay="$1" rest="$2"
+
+    if [ "$SPEED" != "0" ] && [ "$delay" -gt 0 ]; then
+        sleep "$(awk -v d="$delay" -v s="$SPEED" 'BEGIN { printf "%.3f", d / 1000 / s }')"
+    fi
+
+    if [[ "$rest" == SETFILE\ * ]]; then
+        read -r _ key path <<< "$rest"
+        "${CLI[@]}" -x SET "$key" < "$path" > /dev/null
+    else
+        # redis-cli parses its own quoting when the command comes on stdin
+        printf '%s\n' "$rest" | "${CLI[@]}" > /dev/null
+    fi
+}
+
+play_trace() {
+    local lines=0
+    echo -e "${GREEN}=== Replaying $TRACE into $REDIS_HOST:$REDIS_PORT (speed x$SPEED) ===${NC}"
+
+    while :; do
+        while read -r delay rest; do
+            [[ -z "$delay" || "$delay" == \#* ]] && continue
+            play_line "$delay" "$rest"
+            lines=$((lines + 1))
+        done < "$TRACE"
+
+        [ "$LOOP" -eq 1 ] || break
+        echo -e "${YELLOW}Looping ($lines writes so far)${NC}"
+    done
+
+    echo -e "${GREEN}Replayed $lines writes${NC}"
+}
+
+case "$MODE" in
+    record) record_trace ;;
+    play)
+        if [ ! -f "$TRACE" ]; then
+            echo -e "${RED}Trace not found: $TRACE${NC}"
+            exit 1
+        fi
+        play_trace
+        ;;
+    *)
+        echo -e "${RED}Unknown mode: $MODE (use record or play)${NC}"
+        exit 1
+        ;;
+esac
@@ -0,0 +1,302 @@
+// Background style cost: background.c drawn with the cache off (every shape
+// direct, glows as tessellated circles) and on (cached layer plus glow
+// sprite), counting the geometry each style submits per 60 fps frame.
+//
+// background.c is compiled into this executable against counting stand-ins
+// for the raylib draw calls and the SDK services it uses, so no GPU, display
+// or llz_sdk build is needed. Triangles follow raylib's tessellation (36 per
+// circle, 2 per line, rectangle or sprite); pixels filled are the shapes'
+// areas, scaled down while drawing into the layer.
+//
+//   ./bench_background [frames] [width height]
+
+#include "llz_sdk_background.h"
+#include "llz_sdk_art.h"
+#include "llz_sdk_display.h"
+#include "llz_sdk_governor.h"
+#include "llz_sdk_media.h"
+#include "llz_sdk_profiler.h"
+#include "llz_sdk_resource.h"
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    double triangles;
+    double pixels;
+    double layerTriangles;
+    int layerRedraws;
+} BenchBgCounts;
+
+static BenchBgCounts g_counts;
+static int g_screenWidth = 800;
+static int g_screenHeight = 480;
+static float g_areaScale = 1.0f;   // Pixel area per unit, below 1 inside the layer
+static bool g_inLayer = false;
+
+static void bench_bg_add(double triangles, double area)
+{
+    g_counts.triangles += triangles;
+    g_counts.pixels += area * g_areaScale;
+    if (g_inLayer) g_counts.layerTriangles += triangles;
+}
+
+// ============================================================================
+// raylib stand-ins
+// ============================================================================
+
+void BeginBlendMode(int mode) { (void)mode; }
+void EndBlendMode(void) {}
+
+void ClearBackground(Color color)
+{
+    (void)color;
+    bench_bg_add(2, (double)g_screenWidth * g_screenHeight);
+}
+
+Color ColorAlpha(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    color.a = (unsigned char)(255.0f * alpha);
+    return color;
+}
+
+// Palette colours only tint the shapes, so their exact values do not matter here
+Vector3 ColorToHSV(Color color)
+{
+    (void)color;
+    return (Vector3){200.0f, 0.5f, 0.6f};
+}
+
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    (void)hue;
+    (void)saturation;
+    (void)value;
+    return (Color){100, 120, 140, 255};
+}
+
+void DrawCircleGradient(int centerX, int centerY, float radius, Color inner, Color outer)
+{
+    (void)centerX; (void)centerY; (void)inner; (void)outer;
+    bench_bg_add(36, PI * radius * radius);
+}
+
+void DrawCircleV(Vector2 center, float radius, Color color)
+{
+    (void)center; (void)color;
+    bench_bg_add(36, PI * radius * radius);
+}
+
+void DrawLineEx(Vector2 start, Vector2 end, float thick, Color color)
+{
+    (void)color;
+    bench_bg_add(2, hypotf(end.x - start.x, end.y - start.y) * thick);
+}
+
+void DrawRectangleGradientEx(Rectangle rec, Color c1, Color c2, Color c3, Color c4)
+{
+    (void)c1; (void)c2; (void)c3; (void)c4;
+    bench_bg_add(2, rec.width * rec.height);
+}
+
+void DrawRectangleGradientV(int x, int y, int width, int height, Color top, Color bottom)
+{
+    (void)x; (void)y; (void)top; (void)bottom;
+    bench_bg_add(2, (double)width * height);
+}
+
+void DrawRectangleRec(Rectangle rec, Color color)
+{
+    (void)color;
+    bench_bg_add(2, rec.width * rec.height);
+}
+
+// Only the debug overlay uses these
+void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    (void)rec; (void)roundness; (void)segments; (void)color;
+}
+
+void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, Color color)
+{
+    (void)rec; (void)roundness; (void)segments; (void)color;
+}
+
+void DrawText(const char *text, int x, int y, int fontSize, Color color)
+{
+    (void)text; (void)x; (void)y; (void)fontSize; (void)color;
+}
+
+void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle,
+              int segments, Color color)
+{
+    (void)center; (void)startAngle; (void)endAngle; (void)color;
+    bench_bg_add(2.0 * segments, PI * (outerRadius * outerRadius - innerRadius * innerRadius));
+}
+
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation,
+                    Color tint)
+{
+    (void)texture; (void)source; (void)origin; (void)rotation; (void)tint;
+    bench_bg_add(2, dest.width * dest.height);
+}
+
+int GetRandomValue(int min, int max)
+{
+    return min + rand() % (max - min + 1);
+}
+
+RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    RenderTexture2D target = {0};
+    target.id = 1;
+    target.texture = (Texture2D){2, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    return target;
+}
+
+Texture2D LoadTextureFromImage(Image image)
+{
+    return (Texture2D){3, image.width, image.height, 1, image.format};
+}
+
+void SetTextureFilter(Texture2D texture, int filter) { (void)texture; (void)filter; }
+void UnloadRenderTexture(RenderTexture2D target) { (void)target; }
+void UnloadTexture(Texture2D texture) { (void)texture; }
+
+void rlPushMatrix(void) {}
+void rlPopMatrix(void) {}
+void rlScalef(float x, float y, float z) { (void)x; (void)y; (void)z; }
+
+void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha,
+                               int glEqRGB, int glEqAlpha)
+{
+    (void)glSrcRGB; (void)glDstRGB; (void)glSrcAlpha; (void)glDstAlpha; (void)glEqRGB; (void)glEqAlpha;
+}
+
+// ============================================================================
+// SDK stand-ins (no art, no media, no budgets)
+// ============================================================================
+
+LlzArtHandle LlzArtCacheAcquirePath(const char *path, LlzArtVariant variant)
+{
+    (void)path; (void)variant;
+    return 0;
+}
+
+void LlzArtCacheRelease(LlzArtHandle handle) { (void)handle; }
+Texture2D LlzArtCacheGetTexture(LlzArtHandle handle) { (void)handle; return (Texture2D){0}; }
+bool LlzArtCacheIsReady(LlzArtHandle handle) { (void)handle; return false; }
+
+bool LlzArtCacheGetPalette(LlzArtHandle handle, LlzPalette *outPalette)
+{
+    (void)handle; (void)outPalette;
+    return false;
+}
+
+bool LlzDisplayBeginOffscreen(RenderTexture2D target)
+{
+    g_inLayer = true;
+    g_areaScale = (float)target.texture.width * target.texture.height / ((float)g_screenWidth * g_screenHeight);
+    g_counts.layerRedraws++;
+    return true;
+}
+
+void LlzDisplayEndOffscreen(void)
+{
+    g_inLayer = false;
+    g_areaScale = 1.0f;
+}
+
+void LlzDrawTextureCover(Texture2D texture, Rectangle destRect, Color tint)
+{
+    (void)texture; (void)destRect; (void)tint;
+}
+
+void LlzGovernorRequestRedraw(void) {}
+void LlzGovernorRequestAnimation(float seconds) { (void)seconds; }
+
+bool LlzMediaGetState(LlzMediaState *outState) { (void)outState; return false; }
+uint32_t LlzMediaGetStateSequence(void) { return 0; }
+
+const char *LlzMediaGenerateArtHash(const char *artist, const char *album)
+{
+    (void)artist; (void)album;
+    return "";
+}
+
+uint64_t LlzProfilerSpanBegin(void) { return 0; }
+void LlzProfilerSpanEnd(const char *name, uint64_t startUs) { (void)name; (void)startUs; }
+
+bool LlzResourceRegisterEvictor(LlzResourceEvictCallback callback, void *user)
+{
+    (void)callback; (void)user;
+    return true;
+}
+
+void LlzResourceUnregisterEvictor(LlzResourceEvictCallback callback, void *user) { (void)callback; (void)user; }
+
+size_t LlzResourceTextureBytes(Texture2D texture)
+{
+    return (size_t)texture.width * texture.height * 4;
+}
+
+void LlzResourceTrack(const char *owner, LlzResourceKind kind, uintptr_t key, size_t bytes)
+{
+    (void)owner; (void)kind; (void)key; (void)bytes;
+}
+
+void LlzResourceUntrack(LlzResourceKind kind, uintptr_t key) { (void)kind; (void)key; }
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+static BenchBgCounts bench_bg_run(LlzBackgroundStyle style, bool cached, int frames)
+{
+    srand(1);
+    LlzBackgroundSetCacheEnabled(cached);
+    LlzBackgroundSetStyle(style, false);
+
+    g_counts = (BenchBgCounts){0};
+    for (int i = 0; i < frames; i++) {
+        LlzBackgroundUpdate(1.0f / 60.0f);
+        LlzBackgroundDraw();
+    }
+    return g_counts;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 600;
+    if (frames < 1) frames = 1;
+    if (argc > 3) {
+        g_screenWidth = atoi(argv[2]);
+        g_screenHeight = atoi(argv[3]);
+    }
+
+    LlzBackgroundInit(g_screenWidth, g_screenHeight);
+    LlzBackgroundSetEnabled(true);
+
+    printf("%dx%d, %d frames per style at 60 fps; per-frame averages\n", g_screenWidth, g_screenHeight, frames);
+    printf("%-16s %12s %12s %12s %12s %12s %10s\n", "style", "direct tris", "cached tris",
+           "layer tris", "direct Mpx", "cached Mpx", "redraws/s");
+
+    for (int style = 0; style < LLZ_BG_STYLE_COUNT; style++) {
+        BenchBgCounts direct = bench_bg_run((LlzBackgroundStyle)style, false, frames);
+        BenchBgCounts cached = bench_bg_run((LlzBackgroundStyle)style, true, frames);
+        printf("%-16s %12.0f %12.0f %12.0f %12.2f %12.2f %10.1f\n",
+               LlzBackgroundGetStyleName((LlzBackgroundStyle)style),
+               direct.triangles / frames, cached.triangles / frames, cached.layerTriangles / frames,
+               direct.pixels / frames / 1e6, cached.pixels / frames / 1e6,
+               cached.layerRedraws * 60.0 / frames);
+    }
+
+    LlzBackgroundShutdown();
+    return 0;
+}
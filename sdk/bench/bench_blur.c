@@ -0,0 +1,237 @@
+// Album-art blur cost: the original float box blur, LlzImageBlur at full size
+// and LlzImageBlurReduced, on a synthetic 640x640 RGBA cover.
+//
+// The error columns compare against the original output per channel (0-255);
+// the reduced result is bilinearly upsampled first, which is what the GPU does
+// when the texture is drawn over the screen.
+//
+//   ./bench_blur [iterations] [radius...]
+
+#include "bench_common.h"
+#include "llz_sdk_image.h"
+
+#include "raylib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_BLUR_SIZE 640
+
+// ============================================================================
+// Original implementation (before the fixed-point kernels), kept as reference
+// ============================================================================
+
+static void bench_old_box_horizontal(const Color *src, Color *dst, int width, int height, int radius)
+{
+    float invRadius = 1.0f / (float)(radius * 2 + 1);
+
+    for (int y = 0; y < height; y++) {
+        int rowOffset = y * width;
+
+        float r = 0, g = 0, b = 0, a = 0;
+        for (int x = -radius; x <= radius; x++) {
+            int idx = rowOffset + (x < 0 ? 0 : x);
+            r += src[idx].r;
+            g += src[idx].g;
+            b += src[idx].b;
+            a += src[idx].a;
+        }
+
+        for (int x = 0; x < width; x++) {
+            dst[rowOffset + x] = (Color){
+                (unsigned char)(r * invRadius),
+                (unsigned char)(g * invRadius),
+                (unsigned char)(b * invRadius),
+                (unsigned char)(a * invRadius)
+            };
+
+            int leftIdx = x - radius;
+            int rightIdx = x + radius + 1;
+            if (leftIdx < 0) leftIdx = 0;
+            if (rightIdx >= width) rightIdx = width - 1;
+
+            r += src[rowOffset + rightIdx].r - src[rowOffset + leftIdx].r;
+            g += src[rowOffset + rightIdx].g - src[rowOffset + leftIdx].g;
+            b += src[rowOffset + rightIdx].b - src[rowOffset + leftIdx].b;
+            a += src[rowOffset + rightIdx].a - src[rowOffset + leftIdx].a;
+        }
+    }
+}
+
+static void bench_old_box_vertical(const Color *src, Color *dst, int width, int height, int radius)
+{
+    float invRadius = 1.0f / (float)(radius * 2 + 1);
+
+    for (int x = 0; x < width; x++) {
+        float r = 0, g = 0, b = 0, a = 0;
+        for (int y = -radius; y <= radius; y++) {
+            int idx = (y < 0 ? 0 : y) * width + x;
+            r += src[idx].r;
+            g += src[idx].g;
+            b += src[idx].b;
+            a += src[idx].a;
+        }
+
+        for (int y = 0; y < height; y++) {
+            dst[y * width + x] = (Color){
+                (unsigned char)(r * invRadius),
+                (unsigned char)(g * invRadius),
+                (unsigned char)(b * invRadius),
+                (unsigned char)(a * invRadius)
+            };
+
+            int topIdx = y - radius;
+            int bottomIdx = y + radius + 1;
+            if (topIdx < 0) topIdx = 0;
+            if (bottomIdx >= height) bottomIdx = height - 1;
+
+            r += src[bottomIdx * width + x].r - src[topIdx * width + x].r;
+            g += src[bottomIdx * width + x].g - src[topIdx * width + x].g;
+            b += src[bottomIdx * width + x].b - src[topIdx * width + x].b;
+            a += src[bottomIdx * width + x].a - src[topIdx * width + x].a;
+        }
+    }
+}
+
+static Image bench_old_blur(Image source, int blurRadius, float darkenAmount)
+{
+    Image result = ImageCopy(source);
+    ImageFormat(&result, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int pixelCount = result.width * result.height;
+    Color *pixels = (Color *)result.data;
+    Color *temp = (Color *)malloc((size_t)pixelCount * sizeof(Color));
+    if (!temp) return result;
+
+    int passRadius = blurRadius / 3;
+    if (passRadius < 1) passRadius = 1;
+    for (int pass = 0; pass < 3; pass++) {
+        bench_old_box_horizontal(pixels, temp, result.width, result.height, passRadius);
+        bench_old_box_vertical(temp, pixels, result.width, result.height, passRadius);
+    }
+
+    float brightness = 1.0f - darkenAmount;
+    for (int i = 0; i < pixelCount; i++) {
+        pixels[i].r = (unsigned char)(pixels[i].r * brightness);
+        pixels[i].g = (unsigned char)(pixels[i].g * brightness);
+        pixels[i].b = (unsigned char)(pixels[i].b * brightness);
+    }
+
+    free(temp);
+    return result;
+}
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+// Gradient with a checker pattern and noise, so edges and flat areas both count
+static Image bench_blur_source(void)
+{
+    Image image = GenImageColor(BENCH_BLUR_SIZE, BENCH_BLUR_SIZE, BLACK);
+    Color *pixels = (Color *)image.data;
+    srand(1);
+    for (int y = 0; y < BENCH_BLUR_SIZE; y++) {
+        for (int x = 0; x < BENCH_BLUR_SIZE; x++) {
+            pixels[y * BENCH_BLUR_SIZE + x] = (Color){
+                (unsigned char)((x * 255 / BENCH_BLUR_SIZE) ^ (rand() & 31)),
+                (unsigned char)(y * 255 / BENCH_BLUR_SIZE),
+                (unsigned char)(((x / 40 + y / 40) & 1) * 200 + rand() % 50),
+                255
+            };
+        }
+    }
+    return image;
+}
+
+// Mean absolute difference per channel of candidate (any size, bilinearly
+// sampled) against reference
+static double bench_blur_error(Image reference, Image candidate)
+{
+    const Color *ref = (const Color *)reference.data;
+    const unsigned char *cand = (const unsigned char *)candidate.data;
+    double total = 0.0;
+
+    for (int y = 0; y < reference.height; y++) {
+        float fy = (y + 0.5f) * candidate.height / reference.height - 0.5f;
+        if (fy < 0.0f) fy = 0.0f;
+        int y0 = (int)fy;
+        int y1 = y0 + 1 < candidate.height ? y0 + 1 : y0;
+        float ay = fy - (float)y0;
+
+        for (int x = 0; x < reference.width; x++) {
+            float fx = (x + 0.5f) * candidate.width / reference.width - 0.5f;
+            if (fx < 0.0f) fx = 0.0f;
+            int x0 = (int)fx;
+            int x1 = x0 + 1 < candidate.width ? x0 + 1 : x0;
+            float ax = fx - (float)x0;
+
+            const unsigned char *expected = (const unsigned char *)&ref[y * reference.width + x];
+            for (int c = 0; c < 3; c++) {
+                float v00 = cand[(y0 * candidate.width + x0) * 4 + c];
+                float v01 = cand[(y0 * candidate.width + x1) * 4 + c];
+                float v10 = cand[(y1 * candidate.width + x0) * 4 + c];
+                float v11 = cand[(y1 * candidate.width + x1) * 4 + c];
+                float v = (v00 * (1.0f - ax) + v01 * ax) * (1.0f - ay) + (v10 * (1.0f - ax) + v11 * ax) * ay;
+                int diff = (int)(v + 0.5f) - expected[c];
+                total += diff < 0 ? -diff : diff;
+            }
+        }
+    }
+    return total / ((double)reference.width * reference.height * 3.0);
+}
+
+typedef Image (*BenchBlurFn)(Image source, int radius, float darken);
+
+// Average ms per call; the last result is returned in out
+static double bench_blur_time(BenchBlurFn blur, Image source, int radius, int iterations, Image *out)
+{
+    double start = llz_bench_now_ms();
+    for (int i = 0; i < iterations; i++) {
+        Image result = blur(source, radius, 0.4f);
+        if (i < iterations - 1) UnloadImage(result);
+        else *out = result;
+    }
+    return (llz_bench_now_ms() - start) / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 20;
+    if (iterations < 1) iterations = 1;
+
+    static const int kDefaultRadii[] = {12, 15, 20};
+    int radii[16];
+    int radiusCount = 0;
+    for (int i = 2; i < argc && radiusCount < 16; i++) radii[radiusCount++] = atoi(argv[i]);
+    if (radiusCount == 0) {
+        radiusCount = (int)(sizeof(kDefaultRadii) / sizeof(kDefaultRadii[0]));
+        memcpy(radii, kDefaultRadii, sizeof(kDefaultRadii));
+    }
+
+    Image source = bench_blur_source();
+    printf("%dx%d RGBA, %d runs each, darken 0.4\n", source.width, source.height, iterations);
+    printf("%-6s %10s %10s %8s %12s %10s %9s %8s\n",
+           "radius", "old ms", "full ms", "err", "reduced ms", "size", "err", "speedup");
+
+    for (int i = 0; i < radiusCount; i++) {
+        Image old, full, reduced;
+        double oldMs = bench_blur_time(bench_old_blur, source, radii[i], iterations, &old);
+        double fullMs = bench_blur_time(LlzImageBlur, source, radii[i], iterations, &full);
+        double reducedMs = bench_blur_time(LlzImageBlurReduced, source, radii[i], iterations, &reduced);
+
+        char size[16];
+        snprintf(size, sizeof(size), "%dx%d", reduced.width, reduced.height);
+        printf("%-6d %10.2f %10.2f %8.3f %12.2f %10s %9.3f %7.1fx\n",
+               radii[i], oldMs, fullMs, bench_blur_error(old, full), reducedMs, size,
+               bench_blur_error(old, reduced), oldMs / reducedMs);
+
+        UnloadImage(old);
+        UnloadImage(full);
+        UnloadImage(reduced);
+    }
+
+    UnloadImage(source);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#ifndef LLZ_BENCH_COMMON_H
+#define LLZ_BENCH_COMMON_H
+
+// Helpers shared by the host-side benchmarks in sdk/bench
+
+#include <stdbool.h>
+#include <time.h>
+
+// Monotonic clock in milliseconds
+static inline double llz_bench_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+#endif // LLZ_BENCH_COMMON_H
@@ -0,0 +1,81 @@
+// Library page parse cost for generated payloads of 50 and 2000 items.
+//
+// Android sends the page header before the "it" array, which lets the parser
+// stop once LLZ_SPOTIFY_LIST_MAX items are read. The "tail" rows put the
+// header after the array instead, so the rest of the array has to be walked
+// to reach it; that is the worst case for large libraries.
+//
+//   ./bench_json [iterations]
+
+#include "bench_common.h"
+#include "media_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Build a track page of count items, header first or last
+static char *bench_json_tracks(int count, bool headerLast, size_t *outLen)
+{
+    size_t cap = 256 + (size_t)count * 320;
+    char *buf = malloc(cap);
+    if (!buf) return NULL;
+
+    char header[160];
+    snprintf(header, sizeof(header),
+             "\"ty\":\"liked\",\"o\":0,\"l\":%d,\"tt\":%d,\"hm\":false,\"t\":1700000000000",
+             count, count);
+
+    size_t len = 0;
+    len += (size_t)snprintf(buf + len, cap - len, "{%s%s\"it\":[", headerLast ? "" : header,
+                            headerLast ? "" : ",");
+    for (int i = 0; i < count; i++) {
+        len += (size_t)snprintf(buf + len, cap - len,
+                                "%s{\"i\":\"id%06d\",\"n\":\"Track \\\"%d\\\" name\",\"a\":\"Artist %d\","
+                                "\"al\":\"Album %d\",\"d\":%d,\"u\":\"spotify:track:%06d\","
+                                "\"im\":\"https://i.scdn.co/image/ab67616d0000b273%06d\"}",
+                                i ? "," : "", i, i, i, i, 180000 + i, i, i);
+    }
+    len += (size_t)snprintf(buf + len, cap - len, "]%s%s}", headerLast ? "," : "",
+                            headerLast ? header : "");
+    *outLen = len;
+    return buf;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 500;
+    if (iterations < 1) iterations = 1;
+
+    static const int kCounts[] = {50, 2000};
+    static LlzSpotifyTrackListResponse response;
+
+    printf("%-6s %-7s %9s %10s %9s %6s\n", "items", "header", "bytes", "ms/parse", "MB/s", "kept");
+    for (size_t c = 0; c < sizeof(kCounts) / sizeof(kCounts[0]); c++) {
+        for (int headerLast = 0; headerLast <= 1; headerLast++) {
+            size_t len = 0;
+            char *json = bench_json_tracks(kCounts[c], headerLast, &len);
+            if (!json) return 1;
+
+            double start = llz_bench_now_ms();
+            for (int i = 0; i < iterations; i++) {
+                memset(&response, 0, sizeof(response));
+                llz_lib_parse_track_list(json, len, &response);
+            }
+            double ms = (llz_bench_now_ms() - start) / iterations;
+
+            // Every run must see the header wherever it sits
+            if (response.total != kCounts[c] || response.timestamp != 1700000000000LL ||
+                response.itemCount != LLZ_SPOTIFY_LIST_MAX) {
+                fprintf(stderr, "bench_json: bad parse for %d items\n", kCounts[c]);
+                free(json);
+                return 1;
+            }
+
+            printf("%-6d %-7s %9zu %10.4f %9.1f %6d\n", kCounts[c], headerLast ? "tail" : "head",
+                   len, ms, (double)len / (ms * 1000.0), response.itemCount);
+            free(json);
+        }
+    }
+    return 0;
+}
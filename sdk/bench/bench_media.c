@@ -0,0 +1,768 @@
+// Media read path against an in-process Redis stub.
+//
+// A small RESP server on 127.0.0.1 answers the commands the SDK issues (GET,
+// MGET, SET, the blob digest script, CONFIG/CLIENT probes) from an in-memory
+// store, so the real hiredis and media.c code paths run without redis-server
+// or a phone. The store is fed by a trace in the scripts/replay-media-trace.sh
+// format (SET, SETFILE and DEL lines are applied, anything else is counted and
+// ignored), or by a built-in trace of track changes and progress ticks.
+//
+// Every frame does what a now-playing plugin does: read the state snapshot,
+// flush one batch, read the liked-songs library page (2000 items) and run
+// LlzSubscriptionPoll with track, play state, position and album art
+// subscribers. The track callback requests art for the new album
+// (LlzMediaGenerateArtHash, LlzMediaRequestAlbumArt), and each new album art
+// path is decoded as the art worker does (full size and LLZ_ART_THUMB_SIZE),
+// timed apart from the frame. The run prints frame-work, poll, decode and
+// round-trip percentiles, round trips per second and bytes received, the
+// figures LlzRedisGetStats reports on the device.
+//
+//   ./bench_media [-t trace] [-n frames] [-s speed] [-d reply_delay_us] [-a art_file]
+//
+// -a gives the built-in trace a cover to point media:album_art_path at
+// (e.g. a file from LLZ_ART_CACHE_DIR); without it the built-in trace has no
+// art and nothing is decoded. A -t trace sets its own art paths.
+//
+// -s 0 runs frames back to back; the default paces them at 60 fps like the
+// host so the poller and blob recheck intervals behave as on the device.
+
+#include "bench_common.h"
+#include "llz_sdk_art.h"
+#include "llz_sdk_image.h"
+#include "llz_sdk_media.h"
+#include "llz_sdk_redis.h"
+#include "llz_sdk_subscribe.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define BENCH_STORE_MAX 256
+#define BENCH_ARGS_MAX 64
+#define BENCH_TRACE_MAX 4096
+#define BENCH_FRAME_MS (1000.0 / 60.0)
+#define BENCH_DECODE_MAX 1024
+
+// ============================================================================
+// Key/value store
+// ============================================================================
+
+typedef struct {
+    char *key;
+    char *value;
+    size_t len;
+    char digest[32];
+} BenchEntry;
+
+static BenchEntry g_store[BENCH_STORE_MAX];
+static int g_storeCount = 0;
+static pthread_mutex_t g_storeMutex = PTHREAD_MUTEX_INITIALIZER;
+static int g_replyDelayUs = 0;
+
+static BenchEntry *bench_store_find_locked(const char *key, size_t keyLen)
+{
+    for (int i = 0; i < g_storeCount; i++) {
+        if (strlen(g_store[i].key) == keyLen && memcmp(g_store[i].key, key, keyLen) == 0) {
+            return &g_store[i];
+        }
+    }
+    return NULL;
+}
+
+static void bench_store_set(const char *key, size_t keyLen, const char *value, size_t len)
+{
+    pthread_mutex_lock(&g_storeMutex);
+    BenchEntry *entry = bench_store_find_locked(key, keyLen);
+    if (!entry && g_storeCount < BENCH_STORE_MAX) {
+        entry = &g_store[g_storeCount++];
+        entry->key = strndup(key, keyLen);
+    }
+    if (entry) {
+        free(entry->value);
+        entry->value = malloc(len + 1);
+        memcpy(entry->value, value, len);
+        entry->value[len] = '\0';
+        entry->len = len;
+
+        // The real script returns sha1hex; any stable digest will do here
+        uint64_t hash = 1469598103934665603ULL;
+        for (size_t i = 0; i < len; i++) {
+            hash ^= (unsigned char)value[i];
+            hash *= 1099511628211ULL;
+        }
+        snprintf(entry->digest, sizeof(entry->digest), "%016llx", (unsigned long long)hash);
+    }
+    pthread_mutex_unlock(&g_storeMutex);
+}
+
+static void bench_store_del(const char *key, size_t keyLen)
+{
+    pthread_mutex_lock(&g_storeMutex);
+    BenchEntry *entry = bench_store_find_locked(key, keyLen);
+    if (entry) {
+        free(entry->key);
+        free(entry->value);
+        *entry = g_store[--g_storeCount];
+        memset(&g_store[g_storeCount], 0, sizeof(g_store[0]));
+    }
+    pthread_mutex_unlock(&g_storeMutex);
+}
+
+// ============================================================================
+// RESP stub server
+// ============================================================================
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} BenchBuffer;
+
+static void bench_buf_append(BenchBuffer *buf, const char *data, size_t len)
+{
+    if (buf->len + len > buf->cap) {
+        size_t cap = buf->cap ? buf->cap : 4096;
+        while (cap < buf->len + len) cap *= 2;
+        buf->data = realloc(buf->data, cap);
+        buf->cap = cap;
+    }
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+}
+
+static void bench_buf_puts(BenchBuffer *buf, const char *text)
+{
+    bench_buf_append(buf, text, strlen(text));
+}
+
+// "*3\r\n", "$12\r\n", ":1\r\n"
+static void bench_reply_header(BenchBuffer *out, char type, long long value)
+{
+    char line[32];
+    int n = snprintf(line, sizeof(line), "%c%lld\r\n", type, value);
+    bench_buf_append(out, line, (size_t)n);
+}
+
+static void bench_reply_bulk(BenchBuffer *out, const char *data, size_t len)
+{
+    if (!data) {
+        bench_buf_puts(out, "$-1\r\n");
+        return;
+    }
+    bench_reply_header(out, '$', (long long)len);
+    bench_buf_append(out, data, len);
+    bench_buf_puts(out, "\r\n");
+}
+
+static void bench_reply_text(BenchBuffer *out, const char *text)
+{
+    bench_reply_bulk(out, text, strlen(text));
+}
+
+static void bench_reply_key(BenchBuffer *out, const char *key, size_t keyLen)
+{
+    pthread_mutex_lock(&g_storeMutex);
+    BenchEntry *entry = bench_store_find_locked(key, keyLen);
+    bench_reply_bulk(out, entry ? entry->value : NULL, entry ? entry->len : 0);
+    pthread_mutex_unlock(&g_storeMutex);
+}
+
+static bool bench_arg_is(const char *arg, size_t len, const char *name)
+{
+    return strlen(name) == len && strncasecmp(arg, name, len) == 0;
+}
+
+static void bench_execute(int argc, const char **argv, const size_t *lens, BenchBuffer *out)
+{
+    const char *cmd = argv[0];
+    size_t cmdLen = lens[0];
+
+    if (bench_arg_is(cmd, cmdLen, "GET") && argc == 2) {
+        bench_reply_key(out, argv[1], lens[1]);
+    } else if (bench_arg_is(cmd, cmdLen, "MGET")) {
+        bench_reply_header(out, '*', argc - 1);
+        for (int i = 1; i < argc; i++) bench_reply_key(out, argv[i], lens[i]);
+    } else if (bench_arg_is(cmd, cmdLen, "SET") && argc >= 3) {
+        bench_store_set(argv[1], lens[1], argv[2], lens[2]);
+        bench_buf_puts(out, "+OK\r\n");
+    } else if (bench_arg_is(cmd, cmdLen, "DEL")) {
+        for (int i = 1; i < argc; i++) bench_store_del(argv[i], lens[i]);
+        bench_reply_header(out, ':', argc - 1);
+    } else if (bench_arg_is(cmd, cmdLen, "LPUSH") || bench_arg_is(cmd, cmdLen, "RPUSH")) {
+        bench_buf_puts(out, ":1\r\n");
+    } else if (bench_arg_is(cmd, cmdLen, "SCRIPT")) {
+        bench_reply_text(out, "benchdigestscript");
+    } else if (bench_arg_is(cmd, cmdLen, "EVALSHA") && argc >= 5) {
+        // Same contract as the blob digest script in media.c
+        pthread_mutex_lock(&g_storeMutex);
+        BenchEntry *entry = bench_store_find_locked(argv[3], lens[3]);
+        if (!entry) {
+            bench_buf_puts(out, ":0\r\n");
+        } else if (bench_arg_is(argv[4], lens[4], entry->digest)) {
+            bench_buf_puts(out, ":1\r\n");
+        } else {
+            bench_buf_puts(out, "*2\r\n");
+            bench_reply_bulk(out, entry->digest, strlen(entry->digest));
+            bench_reply_bulk(out, entry->value, entry->len);
+        }
+        pthread_mutex_unlock(&g_storeMutex);
+    } else if (bench_arg_is(cmd, cmdLen, "CONFIG")) {
+        // No keyspace events: the poller polls, as with a default redis.conf
+        bench_buf_puts(out, "*2\r\n$22\r\nnotify-keyspace-events\r\n$0\r\n\r\n");
+    } else if (bench_arg_is(cmd, cmdLen, "CLIENT")) {
+        bench_reply_text(out, "id=1 addr=127.0.0.1 db=0");
+    } else if (bench_arg_is(cmd, cmdLen, "PING")) {
+        bench_buf_puts(out, "+PONG\r\n");
+    } else {
+        bench_buf_puts(out, "-ERR unknown command\r\n");
+    }
+}
+
+// Parse one multibulk request. Returns the bytes consumed, 0 if incomplete
+// or -1 if the request is malformed.
+static long bench_parse_request(const char *data, size_t len, int *argc, const char **argv, size_t *lens)
+{
+    const char *p = data;
+    const char *end = data + len;
+    const char *eol = memchr(p, '\r', (size_t)(end - p));
+    if (!eol || eol + 1 >= end) return 0;
+    if (*p != '*') return -1;
+
+    int count = atoi(p + 1);
+    if (count < 1 || count > BENCH_ARGS_MAX) return -1;
+    p = eol + 2;
+
+    for (int i = 0; i < count; i++) {
+        eol = memchr(p, '\r', (size_t)(end - p));
+        if (!eol || eol + 1 >= end) return 0;
+        if (*p != '$') return -1;
+        long argLen = atol(p + 1);
+        p = eol + 2;
+        if (argLen < 0) return -1;
+        if (end - p < argLen + 2) return 0;
+        argv[i] = p;
+        lens[i] = (size_t)argLen;
+        p += argLen + 2;
+    }
+    *argc = count;
+    return (long)(p - data);
+}
+
+static void *bench_connection_thread(void *arg)
+{
+    int fd = (int)(intptr_t)arg;
+    BenchBuffer in = {0};
+    BenchBuffer out = {0};
+    char chunk[65536];
+
+    for (;;) {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) break;
+        bench_buf_append(&in, chunk, (size_t)n);
+
+        size_t used = 0;
+        for (;;) {
+            int argc = 0;
+            const char *argv[BENCH_ARGS_MAX];
+            size_t lens[BENCH_ARGS_MAX];
+            long consumed = bench_parse_request(in.data + used, in.len - used, &argc, argv, lens);
+            if (consumed < 0) goto done;
+            if (consumed == 0) break;
+            bench_execute(argc, argv, lens, &out);
+            used += (size_t)consumed;
+        }
+        memmove(in.data, in.data + used, in.len - used);
+        in.len -= used;
+
+        // One delay per read so a pipelined batch pays it once, like a round trip
+        if (out.len > 0) {
+            if (g_replyDelayUs > 0) usleep((useconds_t)g_replyDelayUs);
+            size_t sent = 0;
+            while (sent < out.len) {
+                ssize_t w = send(fd, out.data + sent, out.len - sent, MSG_NOSIGNAL);
+                if (w <= 0) goto done;
+                sent += (size_t)w;
+            }
+            out.len = 0;
+        }
+    }
+
+done:
+    close(fd);
+    free(in.data);
+    free(out.data);
+    return NULL;
+}
+
+static void *bench_accept_thread(void *arg)
+{
+    int listenFd = (int)(intptr_t)arg;
+    for (;;) {
+        int fd = accept(listenFd, NULL, NULL);
+        if (fd < 0) continue;
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, bench_connection_thread, (void *)(intptr_t)fd) == 0) {
+            pthread_detach(thread);
+        } else {
+            close(fd);
+        }
+    }
+    return NULL;
+}
+
+// Listen on an ephemeral loopback port; returns the port or -1
+static int bench_server_start(void)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addrLen = sizeof(addr);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 16) != 0 ||
+        getsockname(fd, (struct sockaddr *)&addr, &addrLen) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, bench_accept_thread, (void *)(intptr_t)fd) != 0) {
+        close(fd);
+        return -1;
+    }
+    pthread_detach(thread);
+    return ntohs(addr.sin_port);
+}
+
+// ============================================================================
+// Trace
+// ============================================================================
+
+typedef struct {
+    double atMs;                         // Trace time the write happens
+    char *line;                          // Command text after the delay
+} BenchTraceLine;
+
+static BenchTraceLine g_trace[BENCH_TRACE_MAX];
+static int g_traceCount = 0;
+static double g_traceLengthMs = 0.0;
+static char g_traceDir[512] = ".";
+
+// Art arrives a second after each track change, as it does once the phone
+// answers the request. Lines with %s get the -a cover path and are dropped
+// without one, so they carry no delay of their own.
+static const char *kBuiltinTrace[] = {
+    "0    SET media:track \"Intro\"",
+    "0    SET media:artist \"The Band\"",
+    "0    SET media:album \"First Album\"",
+    "0    DEL media:album_art_path",
+    "0    SET media:playing true",
+    "0    SET media:duration 215",
+    "0    SET media:progress 0",
+    "0    SET system:ble_connected true",
+    "1000 SET media:progress 1",
+    "0    SET media:album_art_path \"%s\"",
+    "1000 SET media:progress 2",
+    "1000 SET media:progress 3",
+    "1000 SET media:progress 4",
+    "0    SET media:track \"Second Song\"",
+    "0    SET media:album \"Second Album\"",
+    "0    DEL media:album_art_path",
+    "0    SET media:progress 0",
+    "1000 SET media:progress 1",
+    "0    SET media:album_art_path \"%s\"",
+    "1000 SET media:progress 2",
+    "1000 SET media:progress 3",
+    "1000 SET media:volume 60",
+};
+
+static void bench_trace_add(const char *text)
+{
+    char *end = NULL;
+    double delay = strtod(text, &end);
+    while (end && (*end == ' ' || *end == '\t')) end++;
+    if (!end || end == text || *end == '\0' || *end == '#' || g_traceCount >= BENCH_TRACE_MAX) return;
+
+    g_traceLengthMs += delay;
+    g_trace[g_traceCount].atMs = g_traceLengthMs;
+    g_trace[g_traceCount].line = strdup(end);
+    g_traceCount++;
+}
+
+static bool bench_trace_load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+
+    const char *slash = strrchr(path, '/');
+    if (slash) snprintf(g_traceDir, sizeof(g_traceDir), "%.*s", (int)(slash - path), path);
+
+    char line[8192];
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        const char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\0' || *p == '#') continue;
+        bench_trace_add(p);
+    }
+    fclose(f);
+    return true;
+}
+
+// ============================================================================
+// Subscriptions and album art
+// ============================================================================
+
+typedef struct {
+    int track;
+    int playstate;
+    int position;
+    int albumArt;
+    int artRequests;
+    int artRequestFailures;
+    char pendingArt[LLZ_MEDIA_PATH_MAX];   // Last art path not yet decoded
+} BenchEvents;
+
+static BenchEvents g_events;
+
+// What nowplaying does on a track change: ask the phone for the new cover
+static void bench_on_track(const char *track, const char *artist, const char *album, void *user)
+{
+    (void)track;
+    (void)user;
+    g_events.track++;
+    if (LlzMediaRequestAlbumArt(LlzMediaGenerateArtHash(artist, album))) g_events.artRequests++;
+    else g_events.artRequestFailures++;
+}
+
+static void bench_on_playstate(bool isPlaying, void *user)
+{
+    (void)isPlaying;
+    (void)user;
+    g_events.playstate++;
+}
+
+static void bench_on_position(int positionSeconds, int durationSeconds, void *user)
+{
+    (void)positionSeconds;
+    (void)durationSeconds;
+    (void)user;
+    g_events.position++;
+}
+
+static void bench_on_art(const char *artPath, void *user)
+{
+    (void)user;
+    g_events.albumArt++;
+    snprintf(g_events.pendingArt, sizeof(g_events.pendingArt), "%s", artPath ? artPath : "");
+}
+
+// Split a redis-cli style line into tokens in place ("..." with \ escapes)
+static int bench_tokenize(char *line, char **tokens, size_t *lens, int maxTokens)
+{
+    int count = 0;
+    char *p = line;
+    while (*p && count < maxTokens) {
+        while (*p == ' ' || *p == '\t') p++;
+        if (!*p) break;
+
+        char *out = p;
+        tokens[count] = out;
+        if (*p == '"') {
+            p++;
+            while (*p && *p != '"') {
+                if (*p == '\\' && p[1]) {
+                    p++;
+                    *out++ = *p == 'n' ? '\n' : *p;
+                } else {
+                    *out++ = *p;
+                }
+                p++;
+            }
+            if (*p) p++;
+        } else {
+            while (*p && *p != ' ' && *p != '\t') *out++ = *p++;
+        }
+        lens[count] = (size_t)(out - tokens[count]);
+        if (*p) p++;
+        *out = '\0';
+        count++;
+    }
+    return count;
+}
+
+static bool bench_trace_apply(const BenchTraceLine *entry)
+{
+    char *line = strdup(entry->line);
+    char *tokens[BENCH_ARGS_MAX];
+    size_t lens[BENCH_ARGS_MAX];
+    int count = bench_tokenize(line, tokens, lens, BENCH_ARGS_MAX);
+
+    bool applied = true;
+    if (count >= 3 && bench_arg_is(tokens[0], lens[0], "SET")) {
+        bench_store_set(tokens[1], lens[1], tokens[2], lens[2]);
+    } else if (count >= 3 && bench_arg_is(tokens[0], lens[0], "SETFILE")) {
+        char path[1024];
+        if (tokens[2][0] == '/') snprintf(path, sizeof(path), "%s", tokens[2]);
+        else snprintf(path, sizeof(path), "%s/%s", g_traceDir, tokens[2]);
+
+        FILE *f = fopen(path, "rb");
+        if (f) {
+            fseek(f, 0, SEEK_END);
+            long size = ftell(f);
+            fseek(f, 0, SEEK_SET);
+            char *data = malloc(size > 0 ? (size_t)size : 1);
+            size_t got = fread(data, 1, size > 0 ? (size_t)size : 0, f);
+            bench_store_set(tokens[1], lens[1], data, got);
+            free(data);
+            fclose(f);
+        } else {
+            fprintf(stderr, "bench_media: cannot read %s\n", path);
+            applied = false;
+        }
+    } else if (count >= 2 && bench_arg_is(tokens[0], lens[0], "DEL")) {
+        for (int i = 1; i < count; i++) bench_store_del(tokens[i], lens[i]);
+    } else {
+        applied = false;
+    }
+    free(line);
+    return applied;
+}
+
+// Liked-songs page with count items, seeded unless the trace sets one
+static void bench_seed_library(int count)
+{
+    size_t cap = 256 + (size_t)count * 320;
+    char *buf = malloc(cap);
+    size_t len = (size_t)snprintf(buf, cap,
+                                  "{\"ty\":\"liked\",\"o\":0,\"l\":%d,\"tt\":%d,\"hm\":false,"
+                                  "\"t\":1700000000000,\"it\":[", count, count);
+    for (int i = 0; i < count; i++) {
+        len += (size_t)snprintf(buf + len, cap - len,
+                                "%s{\"i\":\"id%06d\",\"n\":\"Track %d\",\"a\":\"Artist %d\","
+                                "\"al\":\"Album %d\",\"d\":%d,\"u\":\"spotify:track:%06d\","
+                                "\"im\":\"https://i.scdn.co/image/ab67616d0000b273%06d\"}",
+                                i ? "," : "", i, i, i, i, 180000 + i, i, i);
+    }
+    len += (size_t)snprintf(buf + len, cap - len, "]}");
+    const char *key = "spotify:library:liked";
+    bench_store_set(key, strlen(key), buf, len);
+    free(buf);
+}
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+static int bench_compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+    const char *tracePath = NULL;
+    int frames = 600;
+    const char *artPath = NULL;
+    double speed = 1.0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "t:n:s:d:a:")) != -1) {
+        switch (opt) {
+            case 't': tracePath = optarg; break;
+            case 'a': artPath = optarg; break;
+            case 'n': frames = atoi(optarg); break;
+            case 's': speed = atof(optarg); break;
+            case 'd': g_replyDelayUs = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-t trace] [-n frames] [-s speed] [-d reply_delay_us] [-a art_file]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+    if (frames < 1) frames = 1;
+
+    bench_seed_library(2000);
+    if (tracePath) {
+        if (!bench_trace_load(tracePath)) {
+            fprintf(stderr, "bench_media: cannot open trace %s\n", tracePath);
+            return 1;
+        }
+    } else {
+        for (size_t i = 0; i < sizeof(kBuiltinTrace) / sizeof(kBuiltinTrace[0]); i++) {
+            if (!strstr(kBuiltinTrace[i], "%s")) {
+                bench_trace_add(kBuiltinTrace[i]);
+            } else if (artPath) {
+                char line[LLZ_MEDIA_PATH_MAX + 64];
+                snprintf(line, sizeof(line), kBuiltinTrace[i], artPath);
+                bench_trace_add(line);
+            }
+        }
+    }
+
+    int port = bench_server_start();
+    if (port < 0) {
+        fprintf(stderr, "bench_media: cannot start the RESP stub\n");
+        return 1;
+    }
+
+    // Apply the writes at trace time 0 before the SDK seeds its snapshot
+    int nextLine = 0;
+    int applied = 0;
+    int ignored = 0;
+    while (nextLine < g_traceCount && g_trace[nextLine].atMs <= 0.0) {
+        if (bench_trace_apply(&g_trace[nextLine++])) applied++;
+        else ignored++;
+    }
+
+    LlzMediaConfig config = {0};
+    config.host = "127.0.0.1";
+    config.port = port;
+    config.pollOnly = true;
+    if (!LlzMediaInit(&config)) {
+        fprintf(stderr, "bench_media: SDK could not connect to the stub on port %d\n", port);
+        return 1;
+    }
+    LlzSubscribeTrackChanged(bench_on_track, NULL);
+    LlzSubscribePlaystateChanged(bench_on_playstate, NULL);
+    LlzSubscribePositionChanged(bench_on_position, NULL);
+    LlzSubscribeAlbumArtChanged(bench_on_art, NULL);
+    LlzRedisResetStats();
+
+    static LlzSpotifyTrackListResponse tracks;
+    double *frameMs = malloc((size_t)frames * sizeof(double));
+    double *pollMs = malloc((size_t)frames * sizeof(double));
+    double decodeMs[BENCH_DECODE_MAX];
+    double thumbMs[BENCH_DECODE_MAX];
+    int decodes = 0;
+    int decodeFailures = 0;
+    int artWidth = 0;
+    int artHeight = 0;
+    double traceMs = 0.0;
+    double traceBase = 0.0;
+    double runStart = llz_bench_now_ms();
+    int libraryOk = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+        // Writes due by this frame's trace time; the trace loops
+        traceMs += BENCH_FRAME_MS;
+        while (g_traceCount > 0 && g_trace[nextLine].atMs + traceBase <= traceMs) {
+            if (bench_trace_apply(&g_trace[nextLine])) applied++;
+            else ignored++;
+            if (++nextLine == g_traceCount) {
+                nextLine = 0;
+                traceBase += g_traceLengthMs > 0.0 ? g_traceLengthMs : BENCH_FRAME_MS;
+            }
+        }
+
+        double start = llz_bench_now_ms();
+
+        LlzMediaState state;
+        LlzMediaGetState(&state);
+
+        LlzMediaBatch batch;
+        LlzTimezone tz;
+        LlzPodcastState podcast;
+        LlzSpotifyPlaybackState playback;
+        char channel[LLZ_MEDIA_CHANNEL_NAME_MAX];
+        char lyricsHash[64];
+        LlzMediaBatchBegin(&batch);
+        LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_TIMEZONE, &tz, sizeof(tz));
+        LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_PODCAST_STATE, &podcast, sizeof(podcast));
+        LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL, channel, sizeof(channel));
+        LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_LYRICS_HASH, lyricsHash, sizeof(lyricsHash));
+        LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK, &playback, sizeof(playback));
+        LlzMediaBatchFlush(&batch);
+
+        if (LlzMediaGetLibraryTracks("liked", &tracks)) libraryOk++;
+
+        double pollStart = llz_bench_now_ms();
+        LlzSubscriptionPoll();
+        double end = llz_bench_now_ms();
+        pollMs[frame] = end - pollStart;
+        frameMs[frame] = end - start;
+
+        // The art worker's decode, off the frame: full size, then the thumbnail
+        if (g_events.pendingArt[0] && decodes < BENCH_DECODE_MAX) {
+            double decodeStart = llz_bench_now_ms();
+            Image full = LlzImageLoadScaled(g_events.pendingArt, 0);
+            double thumbStart = llz_bench_now_ms();
+            Image thumb = LlzImageLoadScaled(g_events.pendingArt, LLZ_ART_THUMB_SIZE);
+            double decodeEnd = llz_bench_now_ms();
+            if (full.data && thumb.data) {
+                decodeMs[decodes] = thumbStart - decodeStart;
+                thumbMs[decodes] = decodeEnd - thumbStart;
+                artWidth = full.width;
+                artHeight = full.height;
+                decodes++;
+            } else {
+                decodeFailures++;
+            }
+            if (full.data) UnloadImage(full);
+            if (thumb.data) UnloadImage(thumb);
+            g_events.pendingArt[0] = '\0';
+            end = llz_bench_now_ms();
+        }
+
+        if (speed > 0.0) {
+            double due = runStart + (frame + 1) * BENCH_FRAME_MS / speed;
+            if (due > end) usleep((useconds_t)((due - end) * 1000.0));
+        }
+    }
+    double runMs = llz_bench_now_ms() - runStart;
+
+    LlzRedisStats redis;
+    LlzMediaBlobCacheStats blobs;
+    LlzRedisGetStats(&redis);
+    LlzMediaGetBlobCacheStats(&blobs);
+    LlzMediaShutdown();
+
+    qsort(frameMs, (size_t)frames, sizeof(double), bench_compare_double);
+    qsort(pollMs, (size_t)frames, sizeof(double), bench_compare_double);
+    qsort(decodeMs, (size_t)decodes, sizeof(double), bench_compare_double);
+    qsort(thumbMs, (size_t)decodes, sizeof(double), bench_compare_double);
+    printf("frames        %d in %.1f s (trace %s, %d writes applied, %d lines ignored)\n",
+           frames, runMs / 1000.0, tracePath ? tracePath : "built-in", applied, ignored);
+    printf("frame work    p50 %.3f ms  p99 %.3f ms  max %.3f ms\n",
+           frameMs[frames / 2], frameMs[(int)(frames * 0.99)], frameMs[frames - 1]);
+    printf("round trips   %llu (%.1f/s)  p50 %.3f ms  p99 %.3f ms  errors %llu\n",
+           (unsigned long long)redis.commands, redis.commandsPerSec, redis.p50RttMs, redis.p99RttMs,
+           (unsigned long long)redis.errors);
+    printf("bytes         %llu received, %.1f KB/frame\n",
+           (unsigned long long)redis.bytesReceived, redis.bytesReceived / 1024.0 / frames);
+    printf("library blob  %lu lookups, %lu unchanged, %lu transfers (%llu bytes), %lu parses, %d/%d frames ok\n",
+           blobs.lookups, blobs.unchanged, blobs.transfers, blobs.bytesTransferred, blobs.parses,
+           libraryOk, frames);
+    printf("subscriptions poll p50 %.3f ms  p99 %.3f ms; %d track, %d play state, %d position, %d art events\n",
+           pollMs[frames / 2], pollMs[(int)(frames * 0.99)], g_events.track, g_events.playstate,
+           g_events.position, g_events.albumArt);
+    if (decodes > 0) {
+        printf("album art     %d requests (%d failed); %d decodes of %dx%d, full p50 %.2f ms, thumb p50 %.2f ms, "
+               "%d failed\n",
+               g_events.artRequests, g_events.artRequestFailures, decodes, artWidth, artHeight,
+               decodeMs[decodes / 2], thumbMs[decodes / 2], decodeFailures);
+    } else {
+        printf("album art     %d requests (%d failed); no decodes (%d failed)%s\n",
+               g_events.artRequests, g_events.artRequestFailures, decodeFailures,
+               artPath || tracePath ? "" : ", pass -a for a cover");
+    }
+
+    free(frameMs);
+    free(pollMs);
+    return 0;
+}
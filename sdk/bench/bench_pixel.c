@@ -0,0 +1,117 @@
+// Pixel kernel cost: the backend pixel.c selected for this target against the
+// scalar reference (sdk/tests/pixel_scalar.c) on a 640x640 RGBA image.
+//
+//   ./bench_pixel [iterations]
+
+#include "bench_common.h"
+#include "pixel_scalar.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_PIXEL_SIZE 640
+
+typedef struct {
+    const Color *src;
+    Color *dst;
+    uint16_t *sums;
+    uint32_t *bins;
+    bool reference;
+} BenchPixelArgs;
+
+static void bench_box_rows(const BenchPixelArgs *a)
+{
+    if (a->reference) ref_llz_pixel_box_rows(a->src, a->dst, BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, 5);
+    else llz_pixel_box_rows(a->src, a->dst, BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, 5);
+}
+
+static void bench_box_columns(const BenchPixelArgs *a)
+{
+    if (a->reference) {
+        ref_llz_pixel_box_columns(a->src, a->dst, a->sums, BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, 5, 3971, 5957);
+    } else {
+        llz_pixel_box_columns(a->src, a->dst, a->sums, BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, 5, 3971, 5957);
+    }
+}
+
+static void bench_downscale(const BenchPixelArgs *a)
+{
+    if (a->reference) ref_llz_pixel_downscale(a->src, BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, 3, a->dst, a->sums);
+    else llz_pixel_downscale(a->src, BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, 3, a->dst, a->sums);
+}
+
+static void bench_scale_rgb(const BenchPixelArgs *a)
+{
+    size_t count = (size_t)BENCH_PIXEL_SIZE * BENCH_PIXEL_SIZE;
+    if (a->reference) ref_llz_pixel_scale_rgb(a->dst, count, 39321);
+    else llz_pixel_scale_rgb(a->dst, count, 39321);
+}
+
+static void bench_premultiply(const BenchPixelArgs *a)
+{
+    size_t count = (size_t)BENCH_PIXEL_SIZE * BENCH_PIXEL_SIZE;
+    if (a->reference) ref_llz_pixel_premultiply(a->dst, count);
+    else llz_pixel_premultiply(a->dst, count);
+}
+
+static void bench_histogram(const BenchPixelArgs *a)
+{
+    size_t count = (size_t)BENCH_PIXEL_SIZE * BENCH_PIXEL_SIZE;
+    if (a->reference) ref_llz_pixel_histogram(a->src, count, a->bins);
+    else llz_pixel_histogram(a->src, count, a->bins);
+}
+
+static const struct {
+    const char *name;
+    void (*run)(const BenchPixelArgs *args);
+} kKernels[] = {
+    {"box_rows r5", bench_box_rows},
+    {"box_columns r5", bench_box_columns},
+    {"downscale f3", bench_downscale},
+    {"scale_rgb", bench_scale_rgb},
+    {"premultiply", bench_premultiply},
+    {"histogram", bench_histogram},
+};
+
+static double bench_pixel_time(void (*run)(const BenchPixelArgs *), const BenchPixelArgs *args, int iterations)
+{
+    double start = llz_bench_now_ms();
+    for (int i = 0; i < iterations; i++) run(args);
+    return (llz_bench_now_ms() - start) / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 50;
+    if (iterations < 1) iterations = 1;
+
+    size_t count = (size_t)BENCH_PIXEL_SIZE * BENCH_PIXEL_SIZE;
+    Color *src = malloc(count * sizeof(Color));
+    Color *dst = malloc(count * sizeof(Color));
+    uint16_t *sums = malloc((size_t)BENCH_PIXEL_SIZE * 4 * sizeof(uint16_t));
+    uint32_t *bins = calloc(LLZ_PIXEL_HIST_BINS, sizeof(uint32_t));
+    if (!src || !dst || !sums || !bins) return 1;
+
+    srand(1);
+    unsigned char *bytes = (unsigned char *)src;
+    for (size_t i = 0; i < count * 4; i++) bytes[i] = (unsigned char)rand();
+    memcpy(dst, src, count * sizeof(Color));
+
+    printf("%dx%d RGBA, %d runs each\n", BENCH_PIXEL_SIZE, BENCH_PIXEL_SIZE, iterations);
+    printf("%-16s %10s %10s %8s\n", llz_pixel_backend(), "ms", "scalar ms", "speedup");
+
+    for (size_t k = 0; k < sizeof(kKernels) / sizeof(kKernels[0]); k++) {
+        BenchPixelArgs args = {src, dst, sums, bins, false};
+        double simdMs = bench_pixel_time(kKernels[k].run, &args, iterations);
+        args.reference = true;
+        double refMs = bench_pixel_time(kKernels[k].run, &args, iterations);
+        printf("%-16s %10.3f %10.3f %7.1fx\n", kKernels[k].name, simdMs, refMs, refMs / simdMs);
+    }
+
+    free(src);
+    free(dst);
+    free(sums);
+    free(bins);
+    return 0;
+}
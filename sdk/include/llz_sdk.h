@@ -13,5 +13,15 @@
 #include "llz_sdk_font.h"
 #include "llz_sdk_shapes.h"
 #include "llz_sdk_connections.h"
+#include "llz_sdk_redis.h"
+#include "llz_sdk_profiler.h"
+#include "llz_sdk_palette.h"
+#include "llz_sdk_atlas.h"
+#include "llz_sdk_art.h"
+#include "llz_sdk_prefetch.h"
+#include "llz_sdk_resource.h"
+#include "llz_sdk_governor.h"
+#include "llz_sdk_text.h"
+#include "llz_sdk_glyph.h"
 
 #endif
@@ -0,0 +1,198 @@
+#ifndef LLZ_SDK_ART_H
+#define LLZ_SDK_ART_H
+
+#include "raylib.h"
+#include "llz_sdk_atlas.h"
+#include "llz_sdk_palette.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Album Art Loader
+// ============================================================================
+//
+// Decoding and blurring a 640x640 cover takes long enough on the CarThing to
+// drop frames, so the work is done on a single SDK worker thread: file read,
+// WebP/PNG/JPEG decode, optional downscale, blur and palette extraction. The
+// render thread only uploads the finished images when it polls the job, and
+// plugins start their crossfade once LlzArtPoll reports LLZ_ART_READY.
+//
+//   g_artJob = LlzArtLoadAsync(path, &(LlzArtOptions){ .blurRadius = 15,
+//                                                      .blurDarken = 0.4f,
+//                                                      .extractPalette = true });
+//   ...each frame...
+//   LlzArtResult art;
+//   if (LlzArtPoll(g_artJob, &art) == LLZ_ART_READY) { /* swap textures */ }
+//
+// The worker is started on first use and shared by the host and all plugins.
+// Queued jobs run highest priority first, then in the order they were queued.
+
+#define LLZ_ART_PATH_MAX 512
+#define LLZ_ART_MAX_JOBS 16
+
+typedef uint32_t LlzArtJob;   // 0 is never a valid job
+
+typedef enum {
+    LLZ_ART_PENDING = 0,      // Queued or being decoded
+    LLZ_ART_READY,            // Result filled in; the job handle is now spent
+    LLZ_ART_FAILED,           // Decode failed; the job handle is now spent
+    LLZ_ART_INVALID           // Unknown, cancelled or already collected job
+} LlzArtStatus;
+
+typedef struct {
+    int maxSize;              // Downscale so the longer side fits (0 = keep size)
+    int blurRadius;           // Also produce a blurred copy, at reduced size (0 = none)
+    float blurDarken;         // Darkening applied to the blurred copy (0-1)
+    bool extractPalette;      // Run LlzPaletteExtract on the (downscaled) art
+    bool blurOnly;            // Upload only the blurred copy (texture stays empty)
+    bool diskCache;           // Reuse/store thumbnail, blur and palette in LLZ_ART_DERIVED_DIR
+    LlzAtlas *atlas;          // Pack the image into this atlas instead of a texture of its own
+    int priority;             // Higher runs first (0 = normal; prefetches use negative values)
+} LlzArtOptions;
+
+typedef struct {
+    Texture2D texture;        // Caller owns; UnloadTexture when done (id 0 with blurOnly or atlasSlot)
+    LlzAtlasSlot atlasSlot;   // Caller owns; LlzAtlasRemove when done (0 if the atlas was full)
+    Texture2D blurred;        // Caller owns; bilinear filtered, id 0 when no blur was requested
+    LlzPalette palette;
+    int sourceWidth;          // Size of the file before any downscale
+    int sourceHeight;
+} LlzArtResult;
+
+// Queue a load. Returns 0 when the file does not exist (yet) or the queue is
+// full, so callers can simply retry on their next poll. options->atlas must
+// outlive the job.
+LlzArtJob LlzArtLoadAsync(const char *path, const LlzArtOptions *options);
+
+// Check a job from the render thread. On LLZ_ART_READY the textures are
+// uploaded here and ownership passes to the caller.
+LlzArtStatus LlzArtPoll(LlzArtJob job, LlzArtResult *outResult);
+
+// Drop a job; its result is discarded when the worker finishes with it
+void LlzArtCancel(LlzArtJob job);
+
+// Change the priority of a job that has not started yet
+void LlzArtSetPriority(LlzArtJob job, int priority);
+
+// Number of jobs queued or running (for debugging and idle checks)
+int LlzArtPendingCount(void);
+
+// Stop the worker, free unclaimed results and unload every cached texture.
+// Called by the host at exit, before LlzDisplayShutdown.
+void LlzArtShutdown(void);
+
+// ============================================================================
+// Album Art Cache
+// ============================================================================
+//
+// One set of uploaded album art textures shared by the host and every plugin,
+// keyed by art hash (the file name in LLZ_ART_CACHE_DIR). Each hash can be
+// held in three variants. Handles are reference counted: an entry with a live
+// handle is never evicted, and released entries stay resident in LRU order
+// until the byte budget is exceeded, so going from nowplaying to lyrics to the
+// menu reuses the textures that are already on the GPU.
+//
+// Loads go through the worker above. A FULL and a BLUR request for the same
+// art made in the same frame share one decode. Missing files are retried
+// every second while a handle is held. Render thread only.
+//
+// Only LLZ_ART_CACHE_MAX_PENDING loads are handed to the worker at a time,
+// highest LlzArtCacheSetPriority first, so art that scrolls into view can
+// overtake art queued earlier. A load whose handles are all released before
+// it finishes is cancelled, and finished loads are uploaded at up to
+// LLZ_ART_CACHE_UPLOAD_BUDGET bytes per frame (at least one per frame).
+//
+// Thumbnails, blurred copies and palettes are also kept on disk in
+// LLZ_ART_DERIVED_DIR, keyed by hash and parameters and capped at
+// LLZ_ART_DERIVED_MAX_BYTES, so art seen before is loaded without decoding
+// or blurring it again.
+//
+// THUMB art is packed into one shared texture atlas (at most
+// LLZ_ART_ATLAS_PAGES pages), so a carousel of covers draws from one or two
+// textures. Draw it with LlzArtCacheGetRegion, which works for every variant:
+//
+//   LlzArtHandle art = LlzArtCacheAcquire(hash, LLZ_ART_VARIANT_THUMB);
+//   ...
+//   Texture2D tex;
+//   Rectangle src;
+//   if (LlzArtCacheGetRegion(art, &tex, &src)) {   // false until loaded
+//       LlzDrawTextureRegionRounded(tex, src, bounds, 0.08f, 8, WHITE);
+//   }
+//   ...
+//   LlzArtCacheRelease(art);
+
+#define LLZ_ART_CACHE_DIR "/var/mediadash/album_art_cache"
+#define LLZ_ART_PREVIEW_DIR "/var/mediadash/album_art_previews"
+#define LLZ_ART_DERIVED_DIR "/var/mediadash/album_art_derived"
+#define LLZ_ART_DERIVED_MAX_BYTES (32u * 1024u * 1024u)
+#define LLZ_ART_CACHE_MAX_ENTRIES 128
+#define LLZ_ART_CACHE_DEFAULT_BUDGET (32u * 1024u * 1024u)
+#define LLZ_ART_THUMB_SIZE 256       // Longest side of THUMB when no preview file exists
+#define LLZ_ART_ATLAS_PAGES 2        // Atlas pages for THUMB (about 49 thumbnails each)
+#define LLZ_ART_BLUR_RADIUS 15
+#define LLZ_ART_BLUR_DARKEN 0.4f
+#define LLZ_ART_CACHE_MAX_PENDING 4              // Cache loads queued or running at once
+#define LLZ_ART_CACHE_UPLOAD_BUDGET (1024u * 1024u)  // Texture bytes uploaded per frame
+
+typedef enum {
+    LLZ_ART_VARIANT_FULL = 0,        // Art at its stored size
+    LLZ_ART_VARIANT_THUMB,           // Preview file if present, else full art downscaled; in the atlas
+    LLZ_ART_VARIANT_BLUR,            // Blurred and darkened copy for backgrounds
+    LLZ_ART_VARIANT_COUNT
+} LlzArtVariant;
+
+typedef uint32_t LlzArtHandle;       // 0 is never a valid handle
+
+typedef struct {
+    int entries;                     // Entries in any state
+    int referenced;                  // Entries with at least one live handle
+    int loading;                     // Entries waiting on the worker
+    size_t bytes;                    // Texture bytes resident
+    size_t budget;
+    unsigned long hits;              // Acquires served by a loaded entry
+    unsigned long loads;             // Textures uploaded
+    unsigned long evictions;
+    unsigned long cancelled;         // Loads dropped because every handle was released
+} LlzArtCacheStats;
+
+// Take a reference to the art for a hash / an image path. A path inside
+// LLZ_ART_CACHE_DIR shares entries with the same hash. Returns 0 only for an
+// empty key or when every entry is referenced.
+LlzArtHandle LlzArtCacheAcquire(const char *hash, LlzArtVariant variant);
+LlzArtHandle LlzArtCacheAcquirePath(const char *path, LlzArtVariant variant);
+void LlzArtCacheRelease(LlzArtHandle handle);
+
+// Texture for a handle; id 0 while loading, missing or for a stale handle,
+// and for THUMB art that sits in the atlas. The texture stays valid until the
+// handle is released.
+Texture2D LlzArtCacheGetTexture(LlzArtHandle handle);
+// Texture and source rectangle to draw; the whole texture except for atlas
+// art. False while loading. Call it every frame rather than keeping the
+// result: atlas art can be moved when the atlas is full.
+bool LlzArtCacheGetRegion(LlzArtHandle handle, Texture2D *outTexture, Rectangle *outSource);
+bool LlzArtCacheIsReady(LlzArtHandle handle);
+// True while the file is not on disk yet (it is retried automatically)
+bool LlzArtCacheIsMissing(LlzArtHandle handle);
+// Palette extracted when the art was decoded; false until loaded
+bool LlzArtCacheGetPalette(LlzArtHandle handle, LlzPalette *outPalette);
+
+// Load order of an entry: higher first, 0 by default. Applies to a load
+// already queued as well.
+void LlzArtCacheSetPriority(LlzArtHandle handle, int priority);
+
+// Host: start queued loads, collect finished ones, evict. Once per frame.
+void LlzArtCacheUpdate(void);
+
+void LlzArtCacheSetBudget(size_t bytes);
+void LlzArtCacheSetUploadBudget(size_t bytesPerFrame);
+void LlzArtCacheGetStats(LlzArtCacheStats *outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_ART_H
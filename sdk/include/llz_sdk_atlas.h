@@ -0,0 +1,74 @@
+#ifndef LLZ_SDK_ATLAS_H
+#define LLZ_SDK_ATLAS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Texture Atlas
+// ============================================================================
+//
+// Packs many small images of similar size (album thumbnails) into a few
+// LLZ_ATLAS_PAGE_SIZE x LLZ_ATLAS_PAGE_SIZE textures, so a carousel or grid
+// draws from one or two textures and the number of GPU textures stays fixed
+// however far the user scrolls. Pages are created as they are needed.
+//
+// Images are placed on shelves (rows as tall as the first image placed on
+// them). A removed image leaves its slot free for the next image that fits.
+// When the pages are full, the least recently drawn slot that is big enough
+// is reused, so a slot can disappear: look it up with LlzAtlasGet each frame
+// and reload the image when that fails. Render thread only.
+//
+//   LlzAtlas *atlas = LlzAtlasCreate(2);
+//   LlzAtlasSlot slot = LlzAtlasAdd(atlas, image);   // image can be unloaded now
+//   ...each frame...
+//   Texture2D page;
+//   Rectangle source;
+//   if (LlzAtlasGet(atlas, slot, &page, &source)) {
+//       LlzDrawTextureRegionRounded(page, source, bounds, 0.08f, 8, WHITE);
+//   }
+
+#define LLZ_ATLAS_PAGE_SIZE 2048
+#define LLZ_ATLAS_MAX_PAGES 4
+#define LLZ_ATLAS_MAX_SLOTS 512
+#define LLZ_ATLAS_PADDING 1           // Edge pixels repeated around each image for bilinear filtering
+
+typedef struct LlzAtlas LlzAtlas;
+typedef uint32_t LlzAtlasSlot;        // 0 is never a valid slot
+
+typedef struct {
+    int pages;                        // Page textures allocated
+    int slots;                        // Slots carved out of the pages
+    int used;                         // Slots holding an image
+    unsigned long uploads;
+    unsigned long reuses;             // Uploads that took the least recently drawn slot
+} LlzAtlasStats;
+
+// Create an atlas of at most maxPages pages (1-LLZ_ATLAS_MAX_PAGES).
+// No texture is allocated until the first image is added.
+LlzAtlas *LlzAtlasCreate(int maxPages);
+void LlzAtlasDestroy(LlzAtlas *atlas);
+
+// Copy an image into the atlas; the caller keeps the image. Returns 0 when it
+// is larger than a page, or when no page has room and no slot is big enough.
+LlzAtlasSlot LlzAtlasAdd(LlzAtlas *atlas, Image image);
+
+// Page texture and source rectangle of a slot. Marks the slot as drawn for
+// the LRU. False for a removed or reused slot.
+bool LlzAtlasGet(LlzAtlas *atlas, LlzAtlasSlot slot, Texture2D *outTexture, Rectangle *outSource);
+
+// Free a slot for reuse; stale or 0 slots are ignored
+void LlzAtlasRemove(LlzAtlas *atlas, LlzAtlasSlot slot);
+
+void LlzAtlasGetStats(const LlzAtlas *atlas, LlzAtlasStats *outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_ATLAS_H
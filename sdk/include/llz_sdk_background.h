@@ -2,6 +2,7 @@
 #define LLZ_SDK_BACKGROUND_H
 
 #include "raylib.h"
+#include "llz_sdk_palette.h"
 #include <stdbool.h>
 
 /**
@@ -40,6 +41,15 @@ typedef enum {
     LLZ_BG_STYLE_COUNT
 } LlzBackgroundStyle;
 
+// Slow styles (pulse, aurora, radial, constellation, liquid, bokeh) are drawn
+// into a render texture at LLZ_BG_LAYER_SCALE of the screen, refreshed at
+// LLZ_BG_LAYER_FPS and upscaled each frame; constellation's lines and stars
+// stay at screen resolution on top. Glows are drawn from one precomputed
+// radial sprite instead of tessellated circles.
+#define LLZ_BG_LAYER_SCALE 0.5f
+#define LLZ_BG_LAYER_FPS 20.0f
+#define LLZ_BG_GLOW_SPRITE_SIZE 128
+
 // Color palette for backgrounds (6 colors derived from primary/accent)
 typedef struct {
     Color colors[6];
@@ -125,6 +135,16 @@ void LlzBackgroundSetEnabled(bool enabled);
  */
 void LlzBackgroundSetColors(Color primary, Color accent);
 
+/**
+ * Set the background palette from an album art palette.
+ * Uses the dominant and vibrant colors as primary/accent, and the muted
+ * tones for the secondary and dark background slots. An invalid palette
+ * reverts to the default colors.
+ *
+ * @param palette  Palette from LlzArtCacheGetPalette or LlzPaletteExtract
+ */
+void LlzBackgroundSetPalette(const LlzPalette *palette);
+
 /**
  * Clear custom colors and revert to default theme colors.
  */
@@ -168,6 +188,16 @@ void LlzBackgroundSetAutoBlurEnabled(bool enabled);
  */
 void LlzBackgroundSetEnergy(float energy);
 
+/**
+ * Enable or disable the cached layers and the glow sprite (on by default,
+ * LLZ_BG_CACHE=0 turns them off at init). Off draws every style in full
+ * each frame as before, to compare the "bg ..." spans in the profiler.
+ *
+ * @param enabled  true to cache, false to draw everything per frame
+ */
+void LlzBackgroundSetCacheEnabled(bool enabled);
+bool LlzBackgroundIsCacheEnabled(void);
+
 /**
  * Get the name of a background style.
  *
@@ -12,11 +12,49 @@ extern "C" {
 #define LLZ_LOGICAL_WIDTH 800
 #define LLZ_LOGICAL_HEIGHT 480
 
+// How a frame reaches the screen. The CarThing panel is 480x800 portrait;
+// plugins always draw on the 800x480 logical canvas.
+//   WINDOW  desktop, the window is the logical canvas
+//   DIRECT  rotated panel, drawn straight to the framebuffer through a
+//           rotated rlgl modelview (the default)
+//   TARGET  rotated panel, drawn to an 800x480 render texture that is then
+//           blitted rotated; used while a plugin requires it or with
+//           LLZ_DISPLAY_PATH=target
+// LLZ_EMULATE_ROTATION=1 on the desktop opens a 480x800 window and takes the
+// rotated paths, to test and profile them without the device.
+typedef enum {
+    LLZ_DISPLAY_PATH_WINDOW = 0,
+    LLZ_DISPLAY_PATH_DIRECT,
+    LLZ_DISPLAY_PATH_TARGET
+} LlzDisplayPath;
+
 bool LlzDisplayInit(void);
 void LlzDisplayBegin(void);
 void LlzDisplayEnd(void);
 void LlzDisplayShutdown(void);
 
+// Plugins that change the matrix state themselves (BeginMode2D/3D,
+// rlLoadIdentity) must require the render target from init. The host clears
+// it when a plugin starts and closes.
+void LlzDisplayRequireTarget(bool require);
+LlzDisplayPath LlzDisplayGetPath(void);
+bool LlzDisplayIsRotated(void);
+
+// Scissor in logical coordinates on every path; use instead of BeginScissorMode
+void LlzDisplayBeginScissor(int x, int y, int width, int height);
+void LlzDisplayEndScissor(void);
+
+// Draw into a render texture in the middle of a frame, on every path. Use
+// instead of BeginTextureMode/EndTextureMode; the frame's canvas is restored
+// by EndOffscreen. Returns false (draw nothing, skip EndOffscreen) when an
+// offscreen pass is already open.
+bool LlzDisplayBeginOffscreen(RenderTexture2D target);
+void LlzDisplayEndOffscreen(void);
+
+// Window (mouse) position to logical coordinates. Touch input on the device
+// is already logical.
+Vector2 LlzDisplayToLogical(Vector2 native);
+
 #ifdef __cplusplus
 }
 #endif
@@ -94,8 +94,10 @@ Font LlzFontGetDefault(void);
 
 /**
  * Get a font at a specific size.
- * Fonts are cached internally - repeated calls with same parameters
- * return the same font instance.
+ * Fonts are views on the shared glyph atlas (llz_sdk_glyph.h): every plugin
+ * asking for the same type and size gets the same instance, and it stays
+ * loaded across plugin switches. ASCII and Latin-1 are always present; call
+ * LlzFontRequireText for other characters. Never unload the result.
  *
  * @param type Font type to load
  * @param size Font size in pixels
@@ -104,9 +106,32 @@ Font LlzFontGetDefault(void);
 Font LlzFontGet(LlzFontType type, int size);
 
 /**
- * Load a font with custom settings.
- * Use this for special cases requiring specific glyph sets.
- * The caller is responsible for unloading with UnloadFont().
+ * Get any font file (e.g. a theme's .ttf) at a size from the shared
+ * glyph atlas, like LlzFontGet. Never unload the result.
+ *
+ * @param path Path to a TrueType/OpenType file
+ * @param size Font size in pixels
+ * @return Font handle, with texture.id 0 if the file cannot be loaded
+ */
+Font LlzFontGetFile(const char* path, int size);
+
+/**
+ * Make sure a shared font has every glyph of a string, rasterizing the
+ * missing ones into the atlas. Call it when a string arrives (track title,
+ * lyric line, file contents) rather than on every draw; it is cheap when
+ * nothing is missing. Fonts that are not shared are ignored.
+ *
+ * @param font Font from LlzFontGet or LlzFontGetFile
+ * @param text UTF-8 text
+ * @return Number of glyphs added
+ */
+int LlzFontRequireText(Font font, const char* text);
+
+/**
+ * Load a private copy of a font with a fixed glyph set.
+ * Rasterizes every codepoint up front on each call; prefer LlzFontGet with
+ * LlzFontRequireText, which shares and caches the glyphs.
+ * The caller is responsible for unloading with LlzFontUnloadCustom().
  *
  * @param type Font type to load
  * @param size Font size in pixels
@@ -116,6 +141,15 @@ Font LlzFontGet(LlzFontType type, int size);
  */
 Font LlzFontLoadCustom(LlzFontType type, int size, int* codepoints, int codepointCount);
 
+/**
+ * Unload a font from LlzFontLoadCustom.
+ * Safe to call with the raylib default font it falls back to, and a no-op
+ * for shared fonts.
+ *
+ * @param font Font returned by LlzFontLoadCustom
+ */
+void LlzFontUnloadCustom(Font font);
+
 // ============================================================================
 // Font Path Utilities
 // ============================================================================
@@ -179,6 +213,7 @@ void LlzDrawTextShadow(const char* text, int x, int y, int fontSize, Color color
 
 /**
  * Measure text width using the SDK font.
+ * Goes through the text layout cache (llz_sdk_text.h).
  *
  * @param text Text to measure
  * @param fontSize Font size in pixels
@@ -186,6 +221,18 @@ void LlzDrawTextShadow(const char* text, int x, int y, int fontSize, Color color
  */
 int LlzMeasureText(const char* text, int fontSize);
 
+/**
+ * Find how much of a string fits before an ellipsis, measured like
+ * LlzMeasureText through the text layout cache.
+ *
+ * @param text Text to truncate
+ * @param fontSize Font size in pixels
+ * @param maxWidth Width available for the text and the suffix
+ * @param suffix Appended when the text is cut (e.g. "..")
+ * @return Bytes of text to keep; strlen(text) when it fits whole
+ */
+int LlzFitText(const char* text, int fontSize, int maxWidth, const char* suffix);
+
 /**
  * Measure text size using the SDK font.
  *
@@ -0,0 +1,89 @@
+#ifndef LLZ_SDK_GLYPH_H
+#define LLZ_SDK_GLYPH_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Glyph Atlas
+// ============================================================================
+//
+// One set of glyph pages shared by every font size, every plugin and the
+// menu. A font file at a pixel size is a view: a raylib Font whose glyphs
+// live on one of the LLZ_GLYPH_PAGE_SIZE pages. A view starts with ASCII
+// and Latin-1, and other glyphs are rasterized into its page the first time
+// text needs them (LlzGlyphRequireText). LlzFontGet, the SDK text helpers
+// and the text layout cache do this for you; plugins that draw with
+// DrawTextEx require their strings when they arrive.
+//
+//   Font font = LlzFontGet(LLZ_FONT_UI, 48);         // shared, never unload
+//   LlzFontRequireText(font, track.title);           // once per new string
+//   DrawTextEx(font, track.title, pos, 32, 1.5f, WHITE);
+//
+// A view's glyph arrays are allocated at LLZ_GLYPH_MAX_GLYPHS and never move,
+// so a Font copied into a plugin keeps working as glyphs are added. Views
+// are charged to the owners that asked for them; a page whose views are
+// only held by plugins that stopped is dropped over the resource budget.
+//
+// The pages and glyph metrics are saved to LLZ_GLYPH_CACHE_DIR (when a
+// plugin closes and at shutdown, if anything was added) and loaded on the
+// next start, so a cold start draws without rasterizing. Each font file's
+// size and mtime are recorded; a changed file discards the cache.
+// LLZ_GLYPH_CACHE=0 turns the disk cache off and LLZ_GLYPH_CACHE_DIR
+// moves it. Render thread only.
+
+#define LLZ_GLYPH_PAGE_SIZE 1024
+#define LLZ_GLYPH_MAX_PAGES 4
+#define LLZ_GLYPH_MAX_FACES 8                // Font files
+#define LLZ_GLYPH_MAX_VIEWS 48
+#define LLZ_GLYPH_MAX_SIZES 16               // Views per face; later sizes borrow the nearest
+#define LLZ_GLYPH_MAX_GLYPHS 1024            // Glyphs per view
+#define LLZ_GLYPH_PADDING 2
+#define LLZ_GLYPH_CACHE_DIR "/var/mediadash/glyph_cache"
+
+typedef struct {
+    int faces;
+    int views;
+    int pages;
+    int glyphs;                              // Across all views
+    size_t pageBytesUsed;                    // Rows of the pages holding glyphs
+    unsigned long rasterized;                // Glyphs rasterized this run
+    unsigned long missing;                   // Codepoints the font does not have
+    unsigned long pageFull;                  // Glyphs dropped for lack of page space
+    unsigned long borrowed;                  // Requests served by another size's view
+    bool cacheLoaded;                        // Pages came from the disk cache
+    unsigned long cacheSaves;
+} LlzGlyphStats;
+
+// Shared view of a font file at a pixel size. Returns a Font with
+// texture.id 0 when the file cannot be read or no page has room.
+Font LlzGlyphGetFont(const char *path, int size);
+
+// Rasterize the glyphs of text (UTF-8) / of codepoints that the view does not
+// have yet. Returns the number added; 0 for fonts that are not views.
+int LlzGlyphRequireText(Font font, const char *text);
+int LlzGlyphRequireCodepoints(Font font, const int *codepoints, int count);
+
+// True for a Font returned by LlzGlyphGetFont (never pass it to UnloadFont)
+bool LlzGlyphIsShared(Font font);
+
+// Write the pages to the disk cache if glyphs were added since the last
+// save. Synchronous. Host: on the first undrawn iteration after a plugin
+// closes, so the write does not hold up a frame.
+bool LlzGlyphSaveCache(void);
+
+// Save, then free every page and view
+void LlzGlyphShutdown(void);
+
+void LlzGlyphGetStats(LlzGlyphStats *outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_GLYPH_H
@@ -0,0 +1,82 @@
+#ifndef LLZ_SDK_GOVERNOR_H
+#define LLZ_SDK_GOVERNOR_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Frame Governor
+// ============================================================================
+//
+// Decides whether the host draws a frame. The host still runs input and
+// update every iteration, but only draws and presents when something asked
+// for it; otherwise it sleeps until the next idle tick, waking early on
+// input or a new media snapshot from Redis.
+//
+// Full rate (the 60 fps display limit) while any of these hold:
+//   - input in the last LLZ_GOVERNOR_INPUT_HOLD seconds, or a button held
+//   - the plugin's wants_redraw hook returns true (a plugin without the hook
+//     is always drawn at full rate) or the menu is animating
+//   - LlzGovernorRequestAnimation was called for a period still running
+// Otherwise the loop ticks at the idle rate and draws a tick only if
+// LlzGovernorRequestRedraw was called or the media state changed, so a
+// static screen costs one update per tick and no drawing at all.
+//
+//   // Plugin: something changed that is not driven by input
+//   if (newLyricLine) LlzGovernorRequestRedraw();
+//   // Plugin: a 0.3 s fade has started
+//   LlzGovernorRequestAnimation(0.3f);
+//
+// The idle rate is LLZ_GOVERNOR_IDLE_FPS, or LLZ_IDLE_FPS from the
+// environment; 0 blocks until input or a media change, and a negative value
+// turns the governor off (every frame is drawn). Damage is tracked per frame,
+// not per region: a drawn frame is always redrawn in full.
+//
+// RequestRedraw may be called from any thread; the rest is render thread only.
+
+#define LLZ_GOVERNOR_IDLE_FPS 10
+#define LLZ_GOVERNOR_INPUT_HOLD 0.5f          // Seconds of full rate after input
+#define LLZ_GOVERNOR_MAX_DELTA 0.25f          // Longest update step after an idle wait
+
+typedef struct {
+    unsigned long drawnFrames;
+    unsigned long skippedFrames;              // Iterations that updated without drawing
+    unsigned long inputWakes;                 // Idle waits cut short by input
+    int idleFps;
+    bool idle;                                // The last iteration was not drawn
+} LlzGovernorStats;
+
+// Host: read LLZ_IDLE_FPS. Called once after LlzInputInit.
+void LlzGovernorInit(void);
+
+// Host: start of a loop iteration. Returns the update delta in seconds,
+// measured across skipped frames and capped at LLZ_GOVERNOR_MAX_DELTA.
+float LlzGovernorFrameBegin(void);
+
+// Host: after update. animating is the plugin's wants_redraw result (true
+// for plugins without the hook) or the menu's animation state. Consumes the
+// pending redraw request when it returns true.
+bool LlzGovernorShouldDraw(bool animating);
+
+// Host: end of a loop iteration, drawn or not. Returns at once at full rate;
+// otherwise sleeps until the next idle tick, input, a media change or a new
+// redraw request from another thread.
+void LlzGovernorFrameEnd(void);
+
+// Draw the next frame (at the idle rate when nothing else is going on)
+void LlzGovernorRequestRedraw(void);
+
+// Stay at full rate for the next seconds (0 = the next frame only)
+void LlzGovernorRequestAnimation(float seconds);
+
+void LlzGovernorSetIdleFps(int fps);
+void LlzGovernorGetStats(LlzGovernorStats *outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_GOVERNOR_H
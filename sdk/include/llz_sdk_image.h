@@ -2,11 +2,107 @@
 #define LLZ_SDK_IMAGE_H
 
 #include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Loads an image file into CPU memory. WebP files are decoded with libwebp
+ * (raylib has no WebP loader); other formats go through raylib's LoadImage.
+ * Does not touch the GPU, so it is safe to call from worker threads.
+ *
+ * @param path Path to the image file
+ * @return Loaded image in RGBA8 for WebP (data is NULL on failure, caller must call UnloadImage)
+ */
+Image LlzImageLoad(const char *path);
+
+/**
+ * Loads an image so its longer side fits maxSize (0 keeps the stored size).
+ * WebP files are scaled by libwebp while decoding, straight into the returned
+ * buffer, so the full-size image is never allocated; other formats are loaded
+ * and then resized. Safe to call from worker threads.
+ *
+ * @param path Path to the image file
+ * @param maxSize Longest side of the result in pixels, or 0
+ * @return RGBA8 image (data is NULL on failure, caller must call UnloadImage)
+ */
+Image LlzImageLoadScaled(const char *path, int maxSize);
+
+/**
+ * Decodes an image into an existing RGBA8 image, scaled to its width and
+ * height (the aspect ratio is not preserved). Nothing is allocated for WebP
+ * output. Safe to call from worker threads.
+ *
+ * @param path Path to the image file
+ * @param target Destination; target.data must hold width * height pixels
+ * @return true when target.data was filled
+ */
+bool LlzImageDecodeInto(const char *path, Image target);
+
+// Incremental decoder. Open reads the header and allocates the one output
+// buffer; each Step feeds up to maxBytes of the file to libwebp, so a large
+// cover can be decoded a slice per frame (or between cancellation checks on a
+// worker). Only WebP is incremental: other formats are fully loaded by Open,
+// which then reports LLZ_IMAGE_DECODE_DONE.
+//
+//   LlzImageDecoder *dec = LlzImageDecoderOpen(path, 0);
+//   // once per frame:
+//   if (dec && LlzImageDecoderStep(dec, 32 * 1024) != LLZ_IMAGE_DECODE_MORE) {
+//       Image img = LlzImageDecoderFinish(dec);   // data NULL on error
+//       dec = NULL;
+//   }
+typedef struct LlzImageDecoder LlzImageDecoder;
+
+typedef enum {
+    LLZ_IMAGE_DECODE_ERROR = -1,
+    LLZ_IMAGE_DECODE_MORE = 0,        // Call Step again
+    LLZ_IMAGE_DECODE_DONE = 1
+} LlzImageDecodeStatus;
+
+/**
+ * Starts decoding an image scaled to fit maxSize (0 keeps the stored size).
+ *
+ * @return Decoder, or NULL if the file is missing or not a valid image
+ */
+LlzImageDecoder *LlzImageDecoderOpen(const char *path, int maxSize);
+
+/**
+ * Starts decoding into an existing RGBA8 image, scaled to its size. The
+ * caller keeps ownership of target.data and must keep it alive until the
+ * decoder is closed.
+ *
+ * @return Decoder, or NULL on failure or if target is not RGBA8
+ */
+LlzImageDecoder *LlzImageDecoderOpenInto(const char *path, Image target);
+
+/**
+ * Feeds up to maxBytes of compressed data (0 = the rest of the file).
+ *
+ * @return LLZ_IMAGE_DECODE_MORE until the image is complete
+ */
+LlzImageDecodeStatus LlzImageDecoderStep(LlzImageDecoder *decoder, size_t maxBytes);
+
+/**
+ * Output size and the size stored in the file. Any pointer may be NULL.
+ */
+void LlzImageDecoderGetInfo(const LlzImageDecoder *decoder, int *width, int *height,
+                            int *sourceWidth, int *sourceHeight);
+
+/**
+ * Frees the decoder and returns the decoded image. The image data is NULL if
+ * decoding did not complete, or for decoders opened with
+ * LlzImageDecoderOpenInto (the pixels are already in the target).
+ */
+Image LlzImageDecoderFinish(LlzImageDecoder *decoder);
+
+/**
+ * Frees the decoder and any output it allocated, finished or not.
+ */
+void LlzImageDecoderClose(LlzImageDecoder *decoder);
+
 /**
  * Creates a blurred and optionally darkened version of an image.
  *
@@ -17,14 +113,34 @@ extern "C" {
  */
 Image LlzImageBlur(Image source, int blurRadius, float darkenAmount);
 
+// Smallest side LlzImageBlurReduced will shrink an image to
+#define LLZ_IMAGE_BLUR_MIN_SIZE 32
+
+/**
+ * Blurs an image at reduced resolution. The source is first shrunk by an
+ * integer factor chosen from the radius (about 3x for radius 15), then blurred
+ * and darkened there, so the result is smaller than the source. Upload it with
+ * TEXTURE_FILTER_BILINEAR and draw it scaled up (e.g. LlzDrawTextureCover);
+ * for a blur this strong the result looks the same as LlzImageBlur at a small
+ * fraction of the cost. Does not touch the GPU, so it is safe on worker threads.
+ *
+ * @param source The source image to blur (any format; RGBA8 avoids a copy)
+ * @param blurRadius Blur radius in source pixels (1-50)
+ * @param darkenAmount Amount to darken (0.0 = no darkening, 1.0 = fully black)
+ * @return New reduced-size RGBA8 Image (caller must call UnloadImage when done)
+ */
+Image LlzImageBlurReduced(Image source, int blurRadius, float darkenAmount);
+
 /**
  * Creates a blurred texture from an existing texture.
- * Useful for creating background effects from album art.
+ * Useful for creating background effects from album art. This reads the
+ * texture back from the GPU; when the Image is still at hand, blur it with
+ * LlzImageBlurReduced before uploading instead.
  *
  * @param source The source texture to blur
  * @param blurRadius Blur radius in pixels (1-20 recommended)
  * @param darkenAmount Amount to darken (0.0 = no darkening, 1.0 = fully black)
- * @return New Texture2D with blur applied (caller must call UnloadTexture when done)
+ * @return New reduced-size, bilinear-filtered Texture2D (caller must call UnloadTexture when done)
  */
 Texture2D LlzTextureBlur(Texture2D source, int blurRadius, float darkenAmount);
 
@@ -89,6 +205,21 @@ void LlzDrawTextureRoundedContain(Texture2D texture, Rectangle destRect, float r
  */
 void LlzDrawTextureRounded(Texture2D texture, Rectangle destRect, float roundness, int segments, Color tint);
 
+/**
+ * Draws part of a texture with rounded corners, stretched to fill the
+ * destination. Use it for atlas regions (LlzAtlasGet, LlzArtCacheGetRegion);
+ * consecutive draws from the same page share one draw call.
+ *
+ * @param texture The texture (atlas page) to draw from
+ * @param sourceRect Area of the texture to draw, in pixels
+ * @param destRect The destination rectangle to fill
+ * @param roundness Corner roundness (0.0-1.0, relative to shorter side)
+ * @param segments Number of segments per corner (higher = smoother, 8-16 recommended)
+ * @param tint Color tint to apply
+ */
+void LlzDrawTextureRegionRounded(Texture2D texture, Rectangle sourceRect, Rectangle destRect,
+                                 float roundness, int segments, Color tint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -87,6 +87,14 @@ void LlzInputUpdate(LlzInputState *state);
 void LlzInputShutdown(void);
 const LlzInputState *LlzInputGetState(void);
 
+// True if the last LlzInputUpdate saw any event, or a button or touch is
+// still held. Used by the frame governor to leave idle mode.
+bool LlzInputHadActivity(void);
+
+// Block until input arrives or timeoutSeconds pass. Returns true on input;
+// the events are left for the next LlzInputUpdate.
+bool LlzInputWait(double timeoutSeconds);
+
 extern bool llzSimulatedMousePressed;
 extern bool llzSimulatedMouseJustPressed;
 extern bool llzSimulatedMouseJustReleased;
@@ -12,6 +12,10 @@ extern "C" {
 #define LLZ_MEDIA_TEXT_MAX 128
 #define LLZ_MEDIA_PATH_MAX 256
 
+// Background state poller refresh rate (see LlzMediaSetPollInterval)
+#define LLZ_MEDIA_DEFAULT_POLL_MS 250
+#define LLZ_MEDIA_MIN_POLL_MS 20
+
 // Repeat mode values (matches Spotify API)
 typedef enum {
     LLZ_REPEAT_OFF = 0,
@@ -107,19 +111,74 @@ typedef struct {
     const char *host;
     int port;
     const LlzMediaKeyMap *keyMap;
+    int pollIntervalMs;                  // State poller interval, 0 = keep current (default 250)
+    bool pollOnly;                       // Never use keyspace notifications, always poll
 } LlzMediaConfig;
 
 bool LlzMediaInit(const LlzMediaConfig *config);
 void LlzMediaShutdown(void);
 
+// Media and BLE connection state are refreshed by an SDK-owned background thread.
+// These return a copy of the latest snapshot and never touch Redis, so they
+// are cheap enough to call every frame. Returns false while Redis is
+// unreachable or before the first successful poll.
 bool LlzMediaGetState(LlzMediaState *outState);
 bool LlzMediaGetConnection(LlzConnectionStatus *outStatus);
+
+// Sequence number of the state snapshot; increments only when media or
+// connection state actually changed. Compare against a stored value to skip
+// work when nothing is new.
+uint32_t LlzMediaGetStateSequence(void);
+
+// Set how often the poller refreshes the snapshot (clamped to LLZ_MEDIA_MIN_POLL_MS).
+// Only used while keyspace notifications are unavailable.
+void LlzMediaSetPollInterval(int intervalMs);
+int LlzMediaGetPollInterval(void);
+
+// True while the poller receives push updates via Redis keyspace notifications
+// (only changed keys are fetched); false when it falls back to interval polling.
+bool LlzMediaIsPushActive(void);
 float LlzMediaGetProgressPercent(const LlzMediaState *state);
 
+// Playback commands are queued and sent by a background worker; these return
+// true once the command is queued (not delivered). Consecutive volume/seek
+// commands still waiting to be sent collapse into the latest value.
 bool LlzMediaSendCommand(LlzPlaybackCommand action, int value);
 bool LlzMediaSeekSeconds(int seconds);
 bool LlzMediaSetVolume(int percent);
 
+#define LLZ_MEDIA_COMMAND_QUEUE_MAX 32
+#define LLZ_MEDIA_COMMAND_ACTION_MAX 32
+
+// Delivery status of a queued command (see LLZ_EVENT_COMMAND_STATUS)
+typedef enum {
+    LLZ_COMMAND_SENT = 0,     // Pushed to the playback command queue in Redis
+    LLZ_COMMAND_COALESCED,    // Replaced by a newer command of the same kind before sending
+    LLZ_COMMAND_FAILED,       // Redis unreachable or rejected the push
+    LLZ_COMMAND_DROPPED       // Outbound queue was full
+} LlzCommandStatus;
+
+typedef struct {
+    uint32_t id;                                 // Matches LlzMediaGetLastCommandId() after queuing
+    char action[LLZ_MEDIA_COMMAND_ACTION_MAX];   // e.g. "volume", "seek", "like_track"
+    int value;
+    LlzCommandStatus status;
+} LlzCommandResult;
+
+// ID of the most recently queued command (0 if none)
+uint32_t LlzMediaGetLastCommandId(void);
+
+// Number of commands queued or in flight
+int LlzMediaGetPendingCommandCount(void);
+
+// Pop the oldest delivery result. LlzSubscriptionPoll drains these into
+// LLZ_EVENT_COMMAND_STATUS callbacks, so most callers never need this.
+bool LlzMediaPopCommandResult(LlzCommandResult *outResult);
+
+// Block until all queued commands are delivered or timeoutMs elapses
+// Returns true if the queue is empty
+bool LlzMediaFlushCommands(int timeoutMs);
+
 // ============================================================================
 // Spotify Playback Controls (require Spotify auth in companion app)
 // ============================================================================
@@ -255,13 +314,14 @@ bool LlzMediaGetPodcastEpisodesForId(const char *podcastId, char *outJson, size_
 // Lyrics API
 // ============================================================================
 
-#define LLZ_LYRICS_LINE_MAX 256
+#define LLZ_LYRICS_LINE_MAX 256     // Longest line text kept, in bytes
 #define LLZ_LYRICS_MAX_LINES 500
+#define LLZ_LYRICS_CACHE_MAX 8      // Parsed lyric sets kept, keyed by hash
 
 // A single line of lyrics with timestamp
 typedef struct {
     int64_t timestampMs;  // Timestamp in milliseconds (0 if unsynced)
-    char text[LLZ_LYRICS_LINE_MAX];
+    const char *text;     // UTF-8 text, owned by the LlzLyricsData it belongs to
 } LlzLyricsLine;
 
 // Complete lyrics data
@@ -269,9 +329,17 @@ typedef struct {
     char hash[64];        // CRC32 hash of "artist|track"
     bool synced;          // True if lyrics have timestamps
     int lineCount;        // Number of lines
-    LlzLyricsLine *lines; // Dynamically allocated array of lines
+    LlzLyricsLine *lines; // Lines followed by their packed text, one allocation
 } LlzLyricsData;
 
+typedef struct {
+    int entries;              // Lyric sets currently cached
+    size_t bytes;             // Memory held by those sets
+    unsigned long hits;       // LlzLyricsGet calls served from the cache
+    unsigned long parses;     // Lyrics JSON parses performed
+    unsigned long prefetches; // Requests issued for the upcoming track
+} LlzLyricsCacheStats;
+
 // Check if lyrics feature is enabled
 // Returns true if lyrics are enabled in settings
 bool LlzLyricsIsEnabled(void);
@@ -281,7 +349,14 @@ bool LlzLyricsIsEnabled(void);
 // Returns true if setting was stored successfully
 bool LlzLyricsSetEnabled(bool enabled);
 
-// Get current lyrics from Redis
+// Resolve the current lyrics and do the Redis work behind them: read a new
+// set from the Redis slot once, request queue:data on a track change and
+// prefetch lyrics for the upcoming track. Call once per frame while lyrics
+// are shown, before the getters below, which only read what it resolved.
+void LlzLyricsUpdate(void);
+
+// Get lyrics for the hash LlzLyricsGetHash reports
+// Served from the cache LlzLyricsUpdate fills; never touches Redis.
 // outLyrics: pointer to receive lyrics data (caller must call LlzLyricsFree after use)
 // Returns true if lyrics are available
 bool LlzLyricsGet(LlzLyricsData *outLyrics);
@@ -295,14 +370,17 @@ void LlzLyricsFree(LlzLyricsData *lyrics);
 // Returns true if lyrics were retrieved successfully
 bool LlzLyricsGetJson(char *outJson, size_t maxLen);
 
-// Get current lyrics hash (for checking if lyrics changed)
+// Get current lyrics hash (for checking if lyrics changed), as of the last
+// LlzLyricsUpdate. When the playing track's lyrics are already cached their
+// hash is reported at once, before the companion rewrites the Redis keys. Lyrics that arrive
+// for a prefetched upcoming track are cached but not reported until it plays.
 // outHash: buffer to store hash (at least 32 bytes)
 // maxLen: buffer size
 // Returns true if hash was retrieved
 bool LlzLyricsGetHash(char *outHash, size_t maxLen);
 
 // Check if lyrics are synced (have timestamps)
-// Returns true if current lyrics have timestamps
+// Returns true if the lyrics LlzLyricsGet would return have timestamps
 bool LlzLyricsAreSynced(void);
 
 // Find the current lyrics line for a given playback position
@@ -322,6 +400,14 @@ const char *LlzLyricsGenerateHash(const char *artist, const char *track);
 // Returns true if request was queued successfully
 bool LlzLyricsRequest(const char *artist, const char *track);
 
+// Prefetch lyrics for the next track in the queue (enabled by default)
+// While enabled, LlzLyricsUpdate periodically checks queue:data and requests
+// lyrics for the upcoming track once the current track's lyrics are cached.
+void LlzLyricsSetPrefetchEnabled(bool enabled);
+
+// Snapshot of the lyrics cache counters
+void LlzLyricsGetCacheStats(LlzLyricsCacheStats *outStats);
+
 // Store lyrics data to Redis (used when lyrics are successfully received)
 // This stores the lyrics JSON and sets the hash/synced keys
 // lyricsJson: the complete lyrics JSON string
@@ -685,6 +771,99 @@ typedef struct {
 // Returns true if state was retrieved successfully
 bool LlzSpotifyGetPlaybackState(LlzSpotifyPlaybackState *outState);
 
+// ============================================================================
+// Batch Query API (many reads, one Redis round trip)
+// ============================================================================
+//
+// Usage:
+//   LlzMediaBatch batch;
+//   LlzTimezone tz;
+//   char channel[LLZ_MEDIA_CHANNEL_NAME_MAX];
+//   LlzMediaBatchBegin(&batch);
+//   int tzIdx = LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_TIMEZONE, &tz, sizeof(tz));
+//   int chIdx = LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL, channel, sizeof(channel));
+//   LlzMediaBatchFlush(&batch);
+//   if (LlzMediaBatchItemOk(&batch, chIdx)) { ... }
+
+#define LLZ_MEDIA_BATCH_MAX 16
+#define LLZ_MEDIA_BATCH_KEY_MAX 128
+
+typedef enum {
+    LLZ_MEDIA_BATCH_STATE = 0,           // out: LlzMediaState* (poller snapshot, no round trip)
+    LLZ_MEDIA_BATCH_CONNECTION,          // out: LlzConnectionStatus* (poller snapshot, no round trip)
+    LLZ_MEDIA_BATCH_TIMEZONE,            // out: LlzTimezone* (cached for 60 s)
+    LLZ_MEDIA_BATCH_PODCAST_STATE,       // out: LlzPodcastState*
+    LLZ_MEDIA_BATCH_PODCAST_COUNT,       // out: int*
+    LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL,  // out: char buffer of outSize
+    LLZ_MEDIA_BATCH_LYRICS_HASH,         // out: char buffer of outSize
+    LLZ_MEDIA_BATCH_LYRICS_ENABLED,      // out: bool*
+    LLZ_MEDIA_BATCH_LYRICS_SYNCED,       // out: bool*
+    LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK,    // out: LlzSpotifyPlaybackState*
+    LLZ_MEDIA_BATCH_STRING_KEY,          // out: char buffer, added with LlzMediaBatchAddKey
+    LLZ_MEDIA_BATCH_QUEUE                // out: LlzQueueData* (shares the blob cache with LlzMediaGetQueue)
+} LlzMediaBatchQuery;
+
+typedef struct {
+    LlzMediaBatchQuery query;
+    void *out;
+    size_t outSize;
+    char key[LLZ_MEDIA_BATCH_KEY_MAX];   // Only for LLZ_MEDIA_BATCH_STRING_KEY
+    bool ok;                             // Set by LlzMediaBatchFlush
+} LlzMediaBatchItem;
+
+typedef struct {
+    LlzMediaBatchItem items[LLZ_MEDIA_BATCH_MAX];
+    int count;
+} LlzMediaBatch;
+
+// Reset a batch (stack allocation is fine, no cleanup needed)
+void LlzMediaBatchBegin(LlzMediaBatch *batch);
+
+// Queue a typed query. out must stay valid until LlzMediaBatchFlush returns.
+// Returns the item index, or -1 if the batch is full, the query is unknown or
+// outSize is smaller than the type the query writes
+int LlzMediaBatchAdd(LlzMediaBatch *batch, LlzMediaBatchQuery query, void *out, size_t outSize);
+
+// Queue a plain GET of an arbitrary string key
+// Returns the item index, or -1 on error
+int LlzMediaBatchAddKey(LlzMediaBatch *batch, const char *key, char *out, size_t outSize);
+
+// Send all queued queries as one pipeline and decode the replies into the
+// callers' buffers. Returns the number of items that succeeded.
+int LlzMediaBatchFlush(LlzMediaBatch *batch);
+
+// Check whether a single item was retrieved successfully
+bool LlzMediaBatchItemOk(const LlzMediaBatch *batch, int index);
+
+// ============================================================================
+// JSON Blob Cache
+// ============================================================================
+//
+// The library, queue, podcast-list and channel getters read large JSON blobs.
+// They are fetched only when their content changed (checked with a
+// server-side digest) and the parsed struct is reused while it is unchanged,
+// so polling them every frame costs one small round trip. Each
+// LlzMediaRequest* call invalidates the blob it refreshes.
+
+#define LLZ_MEDIA_BLOB_CACHE_MAX 16
+
+typedef struct {
+    int entries;                         // Blobs currently cached
+    unsigned long lookups;               // Getter calls that consulted the cache
+    unsigned long unchanged;             // Checks that found the blob unchanged
+    unsigned long transfers;             // Blob values transferred from Redis
+    unsigned long long bytesTransferred; // Total bytes of those values
+    unsigned long parses;                // JSON parses performed
+    unsigned long parseHits;             // Parsed results served from the cache
+} LlzMediaBlobCacheStats;
+
+// Drop the cached value for a Redis key (e.g. "spotify:library:albums"),
+// or every blob when key is NULL. The next getter call re-fetches it.
+void LlzMediaInvalidateBlob(const char *key);
+
+// Snapshot of the cache counters
+void LlzMediaGetBlobCacheStats(LlzMediaBlobCacheStats *outStats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,56 @@
+#ifndef LLZ_SDK_PALETTE_H
+#define LLZ_SDK_PALETTE_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Palette Extraction
+// ============================================================================
+//
+// Median-cut palette for album art. The image is box-downscaled to about
+// LLZ_PALETTE_SAMPLE_SIZE pixels, binned into a 5-bit-per-channel histogram
+// and split into up to LLZ_PALETTE_MAX_SWATCHES boxes; near-black and
+// near-white pixels are left out. Named colours are then picked from the
+// swatches by target HSL saturation and lightness, weighted by population.
+//
+// The art worker runs this once per decode and the result is cached with the
+// art (LlzArtCacheGetPalette), so plugins normally never call
+// LlzPaletteExtract themselves:
+//
+//   LlzPalette palette;
+//   if (LlzArtCacheGetPalette(art, &palette)) LlzBackgroundSetPalette(&palette);
+//
+// Pure CPU code; safe on any thread.
+
+#define LLZ_PALETTE_MAX_SWATCHES 8
+#define LLZ_PALETTE_SAMPLE_SIZE 96    // Longest side sampled after downscaling
+
+typedef struct {
+    Color color;
+    float population;                 // Share of the counted pixels (0-1)
+} LlzPaletteSwatch;
+
+typedef struct {
+    LlzPaletteSwatch swatches[LLZ_PALETTE_MAX_SWATCHES];   // Most populous first
+    int swatchCount;
+    Color dominant;                   // Most populous swatch
+    Color vibrant;                    // Saturated, mid lightness
+    Color muted;                      // Low saturation, mid lightness
+    Color darkMuted;                  // Low saturation, dark; suits backdrops
+    float vibrantSaturation;          // HSV saturation of vibrant (0-1)
+    bool valid;                       // False for art that is almost entirely black/white
+} LlzPalette;
+
+// Extract a palette from an RGBA8 image. Returns palette->valid.
+bool LlzPaletteExtract(Image image, LlzPalette *outPalette);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_PALETTE_H
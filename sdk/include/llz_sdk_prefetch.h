@@ -0,0 +1,82 @@
+#ifndef LLZ_SDK_PREFETCH_H
+#define LLZ_SDK_PREFETCH_H
+
+#include "llz_sdk_art.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Art Prefetch
+// ============================================================================
+//
+// Keeps art cache handles for the items of a scrolling list that are on
+// screen or about to be. Each frame the list reports where it is and how fast
+// it is moving; the prefetcher holds the visible items plus a lookahead in the
+// direction of travel that grows with the scroll speed (about
+// LLZ_PREFETCH_LOOKAHEAD_SECONDS of scrolling), and ranks them so the centre
+// item loads first, then the next ones ahead. Items that drop out of the
+// window are released, which cancels their loads if they have not finished,
+// so a fast flick does not leave the worker busy with covers scrolled past.
+//
+//   static LlzPrefetch *g_prefetch;
+//   static const char *AlbumArtKey(int index, void *user) {
+//       return LlzMediaGenerateArtHash(g_items[index].artist, g_items[index].album);
+//   }
+//   ...init...
+//   g_prefetch = LlzPrefetchCreate(LLZ_ART_VARIANT_THUMB);
+//   ...update, after the scroll physics...
+//   LlzPrefetchView view = { count, g_visualOffset, g_scrollVelocity / dt, 3 };
+//   LlzPrefetchUpdate(g_prefetch, view, AlbumArtKey, NULL);
+//   ...draw item i...
+//   LlzArtCacheGetRegion(LlzPrefetchGet(g_prefetch, i), &tex, &src);
+//
+// Render thread only.
+
+#define LLZ_PREFETCH_MAX_ITEMS 24
+#define LLZ_PREFETCH_MAX_AHEAD 12             // Items prefetched beyond the visible ones
+#define LLZ_PREFETCH_LOOKAHEAD_SECONDS 0.6f
+#define LLZ_PREFETCH_KEY_MAX 64
+#define LLZ_PREFETCH_RETRY_UPDATES 30         // Updates between retries of refused acquires
+
+typedef struct LlzPrefetch LlzPrefetch;
+
+typedef struct {
+    int count;                // Items in the list
+    float position;           // Item at the centre of the viewport (fractional while scrolling)
+    float velocity;           // Items per second, positive towards higher indices
+    int visibleRadius;        // Items visible on each side of position
+} LlzPrefetchView;
+
+// Art hash of an item, or NULL/"" when it has none. The string is copied, so
+// a static buffer (LlzMediaGenerateArtHash) is fine.
+typedef const char *(*LlzPrefetchKeyCallback)(int index, void *user);
+
+LlzPrefetch *LlzPrefetchCreate(LlzArtVariant variant);
+// Releases every handle
+void LlzPrefetchDestroy(LlzPrefetch *prefetch);
+
+// Move the window. Keys are fetched on every call and the art cache is only
+// touched when the window or one of its keys changed, so items whose data
+// arrives later are picked up without a reset. Acquires the cache refused
+// (every entry in use) are retried every LLZ_PREFETCH_RETRY_UPDATES calls.
+void LlzPrefetchUpdate(LlzPrefetch *prefetch, LlzPrefetchView view,
+                       LlzPrefetchKeyCallback key, void *user);
+
+// Handle for an item in the window, 0 outside it. Owned by the prefetcher.
+LlzArtHandle LlzPrefetchGet(const LlzPrefetch *prefetch, int index);
+
+// Release every handle; the next update rebuilds the window
+void LlzPrefetchReset(LlzPrefetch *prefetch);
+
+// Item indices in load order for a view, without touching the art cache.
+// Returns the number written (at most maxIndices).
+int LlzPrefetchPlan(LlzPrefetchView view, int *outIndices, int maxIndices);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_PREFETCH_H
@@ -0,0 +1,101 @@
+#ifndef LLZ_SDK_PROFILER_H
+#define LLZ_SDK_PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Frame Profiler
+// ============================================================================
+//
+// The host times every frame it runs (input poll, plugin update, plugin draw,
+// LlzDisplayEnd) into a ring buffer per plugin. SDK internals and plugins can
+// add named spans (Redis calls, image decodes, ...) that are kept in a shared
+// ring tagged with the plugin that was active. Each frame also records the
+// GPU/CPU memory tracked by the resource registry (llz_sdk_resource.h).
+//
+// Recording is off until LLZ_PROFILE=1 is set or the overlay is shown; while
+// off, every entry point returns after a single flag check. On the desktop
+// F3 toggles the overlay and F4 dumps; on the device send SIGUSR2 to toggle
+// the overlay and SIGUSR1 to dump. Dumps are written to LLZ_PROFILE_DIR
+// (default /tmp) as CSV and Chrome trace JSON (open in chrome://tracing or
+// ui.perfetto.dev).
+
+#define LLZ_PROFILER_MAX_PLUGINS 16
+#define LLZ_PROFILER_FRAME_HISTORY 300   // Frames kept per plugin (~5 s at 60 fps)
+#define LLZ_PROFILER_SPAN_HISTORY 4096   // Spans kept across all plugins
+#define LLZ_PROFILER_NAME_MAX 64
+#define LLZ_PROFILER_SPAN_NAME_MAX 32    // Span names are copied, longer ones truncated
+
+typedef enum {
+    LLZ_PROFILER_INPUT = 0,   // LlzInputUpdate
+    LLZ_PROFILER_UPDATE,      // Plugin update (or menu logic)
+    LLZ_PROFILER_DRAW,        // Plugin draw (or menu draw)
+    LLZ_PROFILER_PRESENT,     // LlzDisplayEnd, including the frame limiter wait
+    LLZ_PROFILER_PHASE_COUNT
+} LlzProfilerPhase;
+
+// Summary of the frames recorded for one plugin
+typedef struct {
+    char name[LLZ_PROFILER_NAME_MAX];
+    int frames;                                  // Frames in the ring
+    float lastMs[LLZ_PROFILER_PHASE_COUNT];
+    float avgMs[LLZ_PROFILER_PHASE_COUNT];
+    float maxMs[LLZ_PROFILER_PHASE_COUNT];
+    float avgFrameMs;                            // Whole frame, begin to begin
+    float maxFrameMs;
+} LlzProfilerStats;
+
+// Read LLZ_PROFILE / LLZ_PROFILE_DIR and install the dump/toggle signal
+// handlers. Called once by the host after LlzDisplayInit.
+void LlzProfilerInit(void);
+void LlzProfilerShutdown(void);
+
+void LlzProfilerSetEnabled(bool enabled);
+bool LlzProfilerIsEnabled(void);
+
+// Overlay drawn by LlzProfilerDrawOverlay; showing it enables recording
+void LlzProfilerSetOverlayVisible(bool visible);
+bool LlzProfilerIsOverlayVisible(void);
+
+// Host frame bracketing. FrameBegin closes a frame left open by the
+// previous iteration; pluginName is copied ("menu" for the launcher).
+// FrameCancel drops the open frame, for iterations the governor did not draw.
+void LlzProfilerFrameBegin(const char *pluginName);
+void LlzProfilerFrameEnd(void);
+void LlzProfilerFrameCancel(void);
+void LlzProfilerPhaseBegin(LlzProfilerPhase phase);
+void LlzProfilerPhaseEnd(LlzProfilerPhase phase);
+
+// Named spans. SpanBegin returns 0 while recording is off, which makes the
+// matching SpanEnd a no-op. name is copied (up to LLZ_PROFILER_SPAN_NAME_MAX
+// - 1 bytes), so plugin strings stay readable after the plugin is unloaded.
+//   uint64_t t = LlzProfilerSpanBegin();
+//   DecodeArt(path);
+//   LlzProfilerSpanEnd("art decode", t);
+uint64_t LlzProfilerSpanBegin(void);
+void LlzProfilerSpanEnd(const char *name, uint64_t startUs);
+
+// Draw the overlay for the plugin of the current frame (no-op when hidden).
+// Call between the plugin's draw and LlzDisplayEnd.
+void LlzProfilerDrawOverlay(void);
+
+// Stats for a plugin by name; false if it has no recorded frames
+bool LlzProfilerGetStats(const char *pluginName, LlzProfilerStats *outStats);
+
+// Write every ring to a CSV file / Chrome trace JSON file
+bool LlzProfilerDumpCsv(const char *path);
+bool LlzProfilerDumpTrace(const char *path);
+
+// Write both formats to LLZ_PROFILE_DIR with a timestamped name
+bool LlzProfilerDump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_PROFILER_H
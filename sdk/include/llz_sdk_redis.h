@@ -0,0 +1,84 @@
+#ifndef LLZ_SDK_REDIS_H
+#define LLZ_SDK_REDIS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Redis Connection Manager
+// ============================================================================
+//
+// One shared connection for all UI-thread SDK calls (media, connections,
+// lyrics, library, ...). When the connection drops, calls fail immediately
+// instead of blocking on a connect timeout, and a background thread
+// reconnects with exponential backoff. Worker threads (state poller,
+// command queue) open their own connections to the same host/port.
+//
+// LlzMediaInit configures the target; plugins normally only need the
+// health/statistics getters below.
+
+#define LLZ_REDIS_HOST_MAX 128
+#define LLZ_REDIS_DEFAULT_HOST "127.0.0.1"
+#define LLZ_REDIS_DEFAULT_PORT 6379
+
+// Reconnect backoff bounds in milliseconds
+#define LLZ_REDIS_BACKOFF_MIN_MS 250
+#define LLZ_REDIS_BACKOFF_MAX_MS 8000
+
+typedef enum {
+    LLZ_REDIS_DISCONNECTED = 0,   // Never connected
+    LLZ_REDIS_CONNECTED,          // Connection is up
+    LLZ_REDIS_RECONNECTING        // Connection lost, retrying in the background
+} LlzRedisHealth;
+
+typedef struct {
+    LlzRedisHealth health;
+    char host[LLZ_REDIS_HOST_MAX];
+    int port;
+    uint32_t reconnects;          // Successful reconnects after a drop
+    uint32_t failedAttempts;      // Consecutive failed connection attempts
+    uint64_t commands;            // Round trips measured (all SDK threads)
+    uint64_t errors;              // Round trips that failed
+    uint64_t failFast;            // Calls rejected immediately while disconnected
+    float lastRttMs;              // Most recent round-trip time
+    float avgRttMs;               // Exponential moving average of round-trip time
+    float maxRttMs;               // Worst round-trip time since last reset
+    float p50RttMs;               // Median round-trip time since last reset (~19% resolution)
+    float p99RttMs;               // 99th percentile round-trip time since last reset
+    float commandsPerSec;         // Round trips per second since the first one after reset
+    uint64_t bytesReceived;       // Reply payload bytes read by UI-thread calls and batches
+    int64_t connectedSince;       // Unix time the current connection was made (0 if down)
+    int retryInMs;                // Time until the next reconnect attempt (0 if connected)
+} LlzRedisStats;
+
+// Set the Redis target. Drops the shared connection if host/port changed.
+// host: NULL or empty for LLZ_REDIS_DEFAULT_HOST; port <= 0 for LLZ_REDIS_DEFAULT_PORT
+void LlzRedisConfigure(const char *host, int port);
+
+// Returns true if the shared connection is up. Only the first attempt after
+// configuring connects inline (may block for the connect timeout); after a
+// drop this returns false immediately until the background retry succeeds.
+bool LlzRedisConnect(void);
+
+// Current connection health
+LlzRedisHealth LlzRedisGetHealth(void);
+bool LlzRedisIsConnected(void);
+
+// Copy connection statistics
+void LlzRedisGetStats(LlzRedisStats *outStats);
+
+// Reset counters, RTT statistics and percentiles (health and host are kept)
+void LlzRedisResetStats(void);
+
+// Skip the remaining backoff and retry the connection immediately
+void LlzRedisRequestReconnect(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_REDIS_H
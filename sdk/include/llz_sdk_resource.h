@@ -0,0 +1,132 @@
+#ifndef LLZ_SDK_RESOURCE_H
+#define LLZ_SDK_RESOURCE_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Resource Registry
+// ============================================================================
+//
+// Accounts for the textures, fonts and large buffers held by the SDK and by
+// plugins, so the total is known on a device with little memory. Every
+// resource is recorded with an owner (a plugin name or an SDK module such as
+// "art" or "fonts") and its size, in GPU or CPU memory depending on its kind.
+//
+// Each memory domain has a soft and a hard budget. Over the soft budget the
+// host asks the registered evictors (art cache, font cache, background) to
+// drop what is idle; over the hard budget they also drop what can be rebuilt.
+// Budgets default to LLZ_RESOURCE_*_DEFAULT and can be set with
+// LLZ_RESOURCE_GPU_MB / LLZ_RESOURCE_CPU_MB ("soft:hard" in MB) or
+// LlzResourceSetBudget. The numbers are shown by the profiler overlay and
+// the Redis Status plugin.
+//
+//   Texture2D tex = LoadTextureFromImage(image);
+//   LlzResourceTrack(NULL, LLZ_RESOURCE_TEXTURE, tex.id, LlzResourceTextureBytes(tex));
+//   ...
+//   LlzResourceUntrack(LLZ_RESOURCE_TEXTURE, tex.id);
+//   UnloadTexture(tex);
+//
+// Tracking is thread safe; evictors run on the render thread from
+// LlzResourceUpdate.
+
+#define LLZ_RESOURCE_MAX_ENTRIES 1024
+#define LLZ_RESOURCE_MAX_OWNERS 32
+#define LLZ_RESOURCE_MAX_EVICTORS 8
+#define LLZ_RESOURCE_NAME_MAX 48
+#define LLZ_RESOURCE_MENU_OWNER "menu"      // Owner while no plugin is running
+
+#define LLZ_RESOURCE_GPU_SOFT_DEFAULT (64u * 1024u * 1024u)
+#define LLZ_RESOURCE_GPU_HARD_DEFAULT (96u * 1024u * 1024u)
+#define LLZ_RESOURCE_CPU_SOFT_DEFAULT (32u * 1024u * 1024u)
+#define LLZ_RESOURCE_CPU_HARD_DEFAULT (48u * 1024u * 1024u)
+
+typedef enum {
+    LLZ_RESOURCE_GPU = 0,
+    LLZ_RESOURCE_CPU,
+    LLZ_RESOURCE_DOMAIN_COUNT
+} LlzResourceDomain;
+
+typedef enum {
+    LLZ_RESOURCE_TEXTURE = 0,         // GPU
+    LLZ_RESOURCE_RENDER_TEXTURE,      // GPU
+    LLZ_RESOURCE_FONT,                // GPU (glyph atlas)
+    LLZ_RESOURCE_IMAGE,               // CPU
+    LLZ_RESOURCE_BUFFER,              // CPU
+    LLZ_RESOURCE_KIND_COUNT
+} LlzResourceKind;
+
+typedef int LlzResourceOwner;         // -1 when the owner table is full
+
+// Free up to bytes of a domain, least valuable first. hard is set over the
+// hard budget. Returns the bytes freed (resources must also be untracked).
+typedef size_t (*LlzResourceEvictCallback)(LlzResourceDomain domain, size_t bytes, bool hard, void *user);
+
+typedef struct {
+    size_t bytes[LLZ_RESOURCE_DOMAIN_COUNT];
+    size_t peak[LLZ_RESOURCE_DOMAIN_COUNT];
+    size_t soft[LLZ_RESOURCE_DOMAIN_COUNT];
+    size_t hard[LLZ_RESOURCE_DOMAIN_COUNT];
+    size_t kindBytes[LLZ_RESOURCE_KIND_COUNT];
+    int resources;
+    unsigned long evictionRuns;       // Updates that found a domain over its soft budget
+    size_t evictedBytes;              // Reported freed by evictors
+} LlzResourceStats;
+
+typedef struct {
+    char name[LLZ_RESOURCE_NAME_MAX];
+    size_t bytes[LLZ_RESOURCE_DOMAIN_COUNT];
+    int resources;
+    bool live;                        // An SDK module or the menu, or the running plugin
+} LlzResourceOwnerStats;
+
+// Host: read the budget environment variables. Called once after LlzDisplayInit.
+void LlzResourceInit(void);
+
+// Host: the plugin being started (before its init), or NULL when back at the
+// menu. Untagged resources are charged to it, and plugins that are not
+// running count as gone for LlzResourceOwnerIsLive.
+void LlzResourceSetActivePlugin(const char *name);
+
+// Host: enforce the budgets. Once per frame.
+void LlzResourceUpdate(void);
+
+// Record a resource, or update its size if (kind, key) is already tracked.
+// owner NULL charges the running plugin (or LLZ_RESOURCE_MENU_OWNER), or
+// keeps the owner of a resource already tracked. The key is any value unique
+// per kind: texture id, pointer, ...
+void LlzResourceTrack(const char *owner, LlzResourceKind kind, uintptr_t key, size_t bytes);
+void LlzResourceUntrack(LlzResourceKind kind, uintptr_t key);
+
+// Owner id for a name (registered on first use); NULL is the current owner
+LlzResourceOwner LlzResourceGetOwner(const char *name);
+bool LlzResourceOwnerIsLive(LlzResourceOwner owner);
+
+bool LlzResourceRegisterEvictor(LlzResourceEvictCallback callback, void *user);
+void LlzResourceUnregisterEvictor(LlzResourceEvictCallback callback, void *user);
+
+void LlzResourceSetBudget(LlzResourceDomain domain, size_t softBytes, size_t hardBytes);
+void LlzResourceGetStats(LlzResourceStats *outStats);
+// Owners holding anything, largest first. Returns the number written.
+int LlzResourceGetOwners(LlzResourceOwnerStats *outOwners, int maxOwners);
+
+// Bytes of a texture (all mip levels) / an image
+size_t LlzResourceTextureBytes(Texture2D texture);
+size_t LlzResourceImageBytes(Image image);
+
+// A font is its glyph texture (FONT) plus the glyph images raylib keeps in
+// CPU memory (BUFFER). The raylib default font is never tracked.
+void LlzResourceTrackFont(const char *owner, Font font);
+void LlzResourceUntrackFont(Font font);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_RESOURCE_H
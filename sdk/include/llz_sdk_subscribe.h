@@ -21,6 +21,7 @@ typedef enum {
     LLZ_EVENT_CONNECTION_CHANGED, // BLE connection status changed
     LLZ_EVENT_ALBUM_ART_CHANGED,  // Album art path changed
     LLZ_EVENT_NOTIFICATION,       // Generic notification from system
+    LLZ_EVENT_COMMAND_STATUS,     // Queued playback command sent/coalesced/failed
     LLZ_EVENT_COUNT
 } LlzEventType;
 
@@ -83,6 +84,12 @@ typedef void (*LlzNotificationCallback)(
     void *userData
 );
 
+// Playback command delivery status
+typedef void (*LlzCommandStatusCallback)(
+    const LlzCommandResult *result,
+    void *userData
+);
+
 // Subscription ID (0 = invalid/failed)
 typedef int LlzSubscriptionId;
 
@@ -109,6 +116,9 @@ LlzSubscriptionId LlzSubscribeAlbumArtChanged(LlzAlbumArtChangedCallback callbac
 // Subscribe to system notifications
 LlzSubscriptionId LlzSubscribeNotification(LlzNotificationCallback callback, void *userData);
 
+// Subscribe to delivery status of queued playback commands
+LlzSubscriptionId LlzSubscribeCommandStatus(LlzCommandStatusCallback callback, void *userData);
+
 // Unsubscribe by ID
 // Safe to call with invalid ID (no-op)
 void LlzUnsubscribe(LlzSubscriptionId id);
@@ -0,0 +1,94 @@
+#ifndef LLZ_SDK_TEXT_H
+#define LLZ_SDK_TEXT_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Text Layout Cache
+// ============================================================================
+//
+// Measures, wraps and truncates strings once instead of on every draw. The
+// first request for a (font, string) pair walks the string's glyphs and
+// keeps their advances; widths at any size and spacing, word-wrap line
+// breaks and ellipsis cut points then come from those advances without
+// MeasureTextEx. Each entry also remembers its last few wrap layouts, keyed
+// by size, spacing, width and line limit, so a lyric set or a list of labels
+// is laid out once and redrawn from the cache.
+//
+//   LlzTextLayout layout;
+//   LlzTextWrap(font, lyric, 32.0f, 1.2f, 720.0f, 4, &layout);
+//   for (int i = 0; i < layout.lineCount; i++) {
+//       char line[256];
+//       LlzTextLayoutCopyLine(lyric, &layout, i, line, sizeof(line));
+//       DrawTextEx(font, line, (Vector2){(800 - layout.lines[i].width) / 2, y}, 32.0f, 1.2f, WHITE);
+//       y += 32.0f * 1.3f;
+//   }
+//
+// Widths match MeasureTextEx for single-line text. Entries are evicted least
+// recently used; strings longer than LLZ_TEXT_CACHE_MAX_BYTES are measured
+// each time. Measuring a string with an SDK font (llz_sdk_glyph.h) first
+// adds any glyphs it is missing. Render thread only.
+
+#define LLZ_TEXT_MAX_LINES 8
+#define LLZ_TEXT_CACHE_ENTRIES 192
+#define LLZ_TEXT_CACHE_MAX_BYTES 1024
+#define LLZ_TEXT_LAYOUTS_PER_ENTRY 2          // Wrap layouts remembered per string
+
+typedef struct {
+    int start;                                // Byte offset into the text
+    int length;                               // Bytes, without surrounding spaces
+    float width;
+} LlzTextLine;
+
+typedef struct {
+    LlzTextLine lines[LLZ_TEXT_MAX_LINES];
+    int lineCount;
+    float width;                              // Widest line
+    bool truncated;                           // Words past maxLines were dropped
+} LlzTextLayout;
+
+typedef struct {
+    unsigned long hits;
+    unsigned long misses;                     // Strings measured from the font
+    unsigned long layouts;                    // Wraps computed from cached advances
+    unsigned long evictions;
+    int entries;
+    size_t bytes;
+} LlzTextCacheStats;
+
+// Width of text as MeasureTextEx would report it (widest line for '\n')
+float LlzTextMeasure(Font font, const char *text, float fontSize, float spacing);
+
+// Break text at spaces (and '\n') into lines no wider than maxWidth. A word
+// wider than maxWidth gets a line of its own. At most maxLines lines
+// (capped at LLZ_TEXT_MAX_LINES); returns false for empty text.
+bool LlzTextWrap(Font font, const char *text, float fontSize, float spacing,
+                 float maxWidth, int maxLines, LlzTextLayout *outLayout);
+
+// Bytes of text to keep so that it, followed by suffix (e.g. ".."), fits in
+// maxWidth. Returns strlen(text) when the whole text fits without the
+// suffix, and 0 when not even one character fits. Cuts on UTF-8 boundaries.
+int LlzTextFit(Font font, const char *text, float fontSize, float spacing,
+               float maxWidth, const char *suffix);
+
+// Copy one line of a layout into buf as a C string; returns buf
+char *LlzTextLayoutCopyLine(const char *text, const LlzTextLayout *layout, int line,
+                            char *buf, int bufSize);
+
+// Drop the entries measured with a font (called by the font module before
+// it unloads one) or everything
+void LlzTextCacheForgetFont(Font font);
+void LlzTextCacheClear(void);
+
+void LlzTextCacheGetStats(LlzTextCacheStats *outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLZ_SDK_TEXT_H
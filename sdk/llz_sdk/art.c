@@ -0,0 +1,1110 @@
+#include "llz_sdk_art.h"
+#include "llz_sdk_governor.h"
+#include "llz_sdk_image.h"
+#include "llz_sdk_profiler.h"
+#include "llz_sdk_resource.h"
+
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+typedef enum {
+    LLZ_ART_SLOT_FREE = 0,
+    LLZ_ART_SLOT_QUEUED,
+    LLZ_ART_SLOT_RUNNING,
+    LLZ_ART_SLOT_DONE
+} LlzArtSlotState;
+
+typedef struct {
+    LlzArtJob id;
+    LlzArtSlotState state;
+    bool cancelled;
+    bool ok;
+    char path[LLZ_ART_PATH_MAX];
+    LlzArtOptions options;
+    Image image;
+    Image blurred;
+    LlzPalette palette;
+    int sourceWidth;
+    int sourceHeight;
+} LlzArtSlot;
+
+static LlzArtSlot g_artSlots[LLZ_ART_MAX_JOBS];
+static pthread_mutex_t g_artMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_artCond = PTHREAD_COND_INITIALIZER;
+static pthread_t g_artThread;
+static bool g_artThreadStarted = false;
+static bool g_artStopping = false;
+static LlzArtJob g_artNextId = 1;
+
+// Compressed bytes decoded between cancellation checks
+#define LLZ_ART_DECODE_SLICE (64 * 1024)
+
+// ============================================================================
+// Derived art on disk
+// ============================================================================
+//
+// Thumbnails, blurred copies and palettes are stored in LLZ_ART_DERIVED_DIR
+// as raw RGBA (or the LlzPalette struct) behind a small header, named after the
+// art hash and the parameters that produced them:
+//
+//   <hash>.t256.rgba          downscaled to maxSize 256
+//   <hash>.b15d40s0.rgba      blur radius 15, darken 0.40, from maxSize 0
+//   <hash>.p0.pal             palette extracted at maxSize 0
+//
+// The header records the source file's size and mtime, so replaced art is
+// decoded again. Files are written to a .tmp name and renamed into place.
+// Only the worker thread touches the directory.
+
+#define LLZ_ART_DERIVED_MAGIC 0x44415A4Cu   // "LZAD"
+#define LLZ_ART_DERIVED_VERSION 2
+#define LLZ_ART_DERIVED_MAX_PAYLOAD (8u * 1024u * 1024u)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceSize;
+    int64_t sourceMtime;
+    int32_t width;                // 0 for palettes
+    int32_t height;
+    int32_t sourceWidth;
+    int32_t sourceHeight;
+    uint32_t payloadBytes;
+    uint32_t reserved;
+} LlzArtDerivedHeader;
+
+typedef struct {
+    char key[72];                 // Art hash; empty when the path is not cached art
+    uint64_t size;
+    int64_t mtime;
+} LlzArtDerivedSource;
+
+typedef struct {
+    char name[128];
+    time_t mtime;
+    off_t size;
+} LlzArtDerivedFile;
+
+static size_t g_artDerivedBytes = SIZE_MAX;   // SIZE_MAX until the directory is scanned
+
+// Only art in LLZ_ART_CACHE_DIR is keyed by a stable hash worth caching
+static bool llz_art_derived_source(const char *path, LlzArtDerivedSource *out)
+{
+    memset(out, 0, sizeof(*out));
+    size_t dirLen = strlen(LLZ_ART_CACHE_DIR);
+    if (strncmp(path, LLZ_ART_CACHE_DIR, dirLen) != 0 || path[dirLen] != '/') return false;
+
+    const char *name = path + dirLen + 1;
+    size_t len = strcspn(name, ".");
+    if (len == 0 || len >= sizeof(out->key)) return false;
+    for (size_t i = 0; i < len; i++) {
+        if (!isalnum((unsigned char)name[i]) && name[i] != '_' && name[i] != '-') return false;
+    }
+
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+    memcpy(out->key, name, len);
+    out->key[len] = '\0';
+    out->size = (uint64_t)st.st_size;
+    out->mtime = (int64_t)st.st_mtime;
+    return true;
+}
+
+static void llz_art_derived_path(char *out, size_t size, const LlzArtDerivedSource *src,
+                                 const char *fmt, ...)
+{
+    char tag[32];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(tag, sizeof(tag), fmt, args);
+    va_end(args);
+    snprintf(out, size, "%s/%s.%s", LLZ_ART_DERIVED_DIR, src->key, tag);
+}
+
+// Payload (RL_MALLOC'd) of a file made from this version of the source, or
+// NULL when it is missing, stale or truncated
+static void *llz_art_derived_read(const char *file, const LlzArtDerivedSource *src,
+                                  LlzArtDerivedHeader *header)
+{
+    FILE *f = fopen(file, "rb");
+    if (!f) return NULL;
+
+    void *payload = NULL;
+    if (fread(header, sizeof(*header), 1, f) == 1 &&
+        header->magic == LLZ_ART_DERIVED_MAGIC && header->version == LLZ_ART_DERIVED_VERSION &&
+        header->sourceSize == src->size && header->sourceMtime == src->mtime &&
+        header->payloadBytes > 0 && header->payloadBytes <= LLZ_ART_DERIVED_MAX_PAYLOAD) {
+        payload = RL_MALLOC(header->payloadBytes);
+        if (payload && fread(payload, header->payloadBytes, 1, f) != 1) {
+            RL_FREE(payload);
+            payload = NULL;
+        }
+    }
+    fclose(f);
+
+    // Touch so trimming removes the least recently used files first
+    if (payload) utime(file, NULL);
+    return payload;
+}
+
+static bool llz_art_derived_read_image(const char *file, const LlzArtDerivedSource *src,
+                                       Image *out, LlzArtSlot *job)
+{
+    LlzArtDerivedHeader header;
+    void *pixels = llz_art_derived_read(file, src, &header);
+    if (!pixels) return false;
+    if (header.width <= 0 || header.height <= 0 ||
+        header.payloadBytes != (uint32_t)header.width * (uint32_t)header.height * 4u) {
+        RL_FREE(pixels);
+        return false;
+    }
+
+    *out = (Image){ pixels, header.width, header.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    job->sourceWidth = header.sourceWidth;
+    job->sourceHeight = header.sourceHeight;
+    return true;
+}
+
+static bool llz_art_derived_read_palette(const char *file, const LlzArtDerivedSource *src,
+                                         LlzPalette *out)
+{
+    LlzArtDerivedHeader header;
+    void *palette = llz_art_derived_read(file, src, &header);
+    if (!palette) return false;
+    bool ok = header.payloadBytes == sizeof(*out);
+    if (ok) memcpy(out, palette, sizeof(*out));
+    RL_FREE(palette);
+    return ok;
+}
+
+static int llz_art_derived_oldest_first(const void *a, const void *b)
+{
+    time_t ta = ((const LlzArtDerivedFile *)a)->mtime;
+    time_t tb = ((const LlzArtDerivedFile *)b)->mtime;
+    return (ta > tb) - (ta < tb);
+}
+
+// Recount the directory and remove the least recently used files once it is
+// over LLZ_ART_DERIVED_MAX_BYTES, down to three quarters of the cap
+static void llz_art_derived_trim(void)
+{
+    DIR *dir = opendir(LLZ_ART_DERIVED_DIR);
+    if (!dir) {
+        g_artDerivedBytes = 0;
+        return;
+    }
+
+    LlzArtDerivedFile *files = NULL;
+    int count = 0, capacity = 0;
+    size_t total = 0;
+    char file[LLZ_ART_PATH_MAX];
+    struct dirent *ent;
+
+    while ((ent = readdir(dir)) != NULL) {
+        if (ent->d_name[0] == '.' || strlen(ent->d_name) >= sizeof(files[0].name)) continue;
+        snprintf(file, sizeof(file), "%s/%s", LLZ_ART_DERIVED_DIR, ent->d_name);
+
+        struct stat st;
+        if (stat(file, &st) != 0 || !S_ISREG(st.st_mode)) continue;
+
+        // Only this thread writes here, so a leftover .tmp is from a crash
+        size_t len = strlen(ent->d_name);
+        if (len > 4 && strcmp(ent->d_name + len - 4, ".tmp") == 0) {
+            remove(file);
+            continue;
+        }
+
+        if (count == capacity) {
+            int grown = capacity ? capacity * 2 : 64;
+            LlzArtDerivedFile *bigger = realloc(files, (size_t)grown * sizeof(*files));
+            if (!bigger) break;
+            files = bigger;
+            capacity = grown;
+        }
+        snprintf(files[count].name, sizeof(files[count].name), "%s", ent->d_name);
+        files[count].mtime = st.st_mtime;
+        files[count].size = st.st_size;
+        count++;
+        total += (size_t)st.st_size;
+    }
+    closedir(dir);
+
+    if (total > LLZ_ART_DERIVED_MAX_BYTES) {
+        qsort(files, (size_t)count, sizeof(*files), llz_art_derived_oldest_first);
+        int removed = 0;
+        for (int i = 0; i < count && total > LLZ_ART_DERIVED_MAX_BYTES / 4 * 3; i++) {
+            snprintf(file, sizeof(file), "%s/%s", LLZ_ART_DERIVED_DIR, files[i].name);
+            if (remove(file) == 0) {
+                total -= (size_t)files[i].size;
+                removed++;
+            }
+        }
+        printf("[ART] Trimmed %d derived files, %zu KB left\n", removed, total / 1024);
+    }
+
+    free(files);
+    g_artDerivedBytes = total;
+}
+
+static void llz_art_derived_write(const char *file, const LlzArtDerivedSource *src,
+                                  LlzArtDerivedHeader header, const void *payload)
+{
+    char tmp[LLZ_ART_PATH_MAX + 8];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", file);
+
+    FILE *f = fopen(tmp, "wb");
+    if (!f && errno == ENOENT && mkdir(LLZ_ART_DERIVED_DIR, 0755) == 0) f = fopen(tmp, "wb");
+    if (!f) return;
+
+    header.magic = LLZ_ART_DERIVED_MAGIC;
+    header.version = LLZ_ART_DERIVED_VERSION;
+    header.sourceSize = src->size;
+    header.sourceMtime = src->mtime;
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(payload, header.payloadBytes, 1, f) == 1;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmp, file) != 0) {
+        printf("[ART] Failed to write '%s'\n", file);
+        remove(tmp);
+        return;
+    }
+
+    if (g_artDerivedBytes != SIZE_MAX) g_artDerivedBytes += sizeof(header) + header.payloadBytes;
+    if (g_artDerivedBytes == SIZE_MAX || g_artDerivedBytes > LLZ_ART_DERIVED_MAX_BYTES) {
+        llz_art_derived_trim();
+    }
+}
+
+static void llz_art_derived_write_image(const char *file, const LlzArtDerivedSource *src,
+                                        Image img, const LlzArtSlot *job)
+{
+    LlzArtDerivedHeader header = {0};
+    header.width = img.width;
+    header.height = img.height;
+    header.sourceWidth = job->sourceWidth;
+    header.sourceHeight = job->sourceHeight;
+    header.payloadBytes = (uint32_t)img.width * (uint32_t)img.height * 4u;
+    llz_art_derived_write(file, src, header, img.data);
+}
+
+static void llz_art_derived_write_palette(const char *file, const LlzArtDerivedSource *src,
+                                          const LlzArtSlot *job)
+{
+    LlzArtDerivedHeader header = {0};
+    header.sourceWidth = job->sourceWidth;
+    header.sourceHeight = job->sourceHeight;
+    header.payloadBytes = sizeof(job->palette);
+    llz_art_derived_write(file, src, header, &job->palette);
+}
+
+static bool llz_art_cancelled(const LlzArtSlot *slot)
+{
+    pthread_mutex_lock(&g_artMutex);
+    bool cancelled = slot->cancelled;
+    pthread_mutex_unlock(&g_artMutex);
+    return cancelled;
+}
+
+static void llz_art_free_images(LlzArtSlot *slot)
+{
+    if (slot->image.data) UnloadImage(slot->image);
+    if (slot->blurred.data) UnloadImage(slot->blurred);
+    slot->image = (Image){0};
+    slot->blurred = (Image){0};
+}
+
+// Runs on the worker without the lock held; only touches CPU images
+static void llz_art_process(LlzArtSlot *job, const char *path, const LlzArtOptions *options)
+{
+    LlzArtDerivedSource src;
+    bool useDisk = options->diskCache && llz_art_derived_source(path, &src);
+    bool wantImage = !options->blurOnly;
+    bool wantBlur = options->blurRadius > 0;
+    bool havePalette = !options->extractPalette;
+    char thumbFile[LLZ_ART_PATH_MAX];
+    char blurFile[LLZ_ART_PATH_MAX];
+    char paletteFile[LLZ_ART_PATH_MAX];
+
+    if (useDisk) {
+        int darken = (int)(options->blurDarken * 100.0f + 0.5f);
+        llz_art_derived_path(thumbFile, sizeof(thumbFile), &src, "t%d.rgba", options->maxSize);
+        llz_art_derived_path(blurFile, sizeof(blurFile), &src, "b%dd%ds%d.rgba",
+                             options->blurRadius, darken, options->maxSize);
+        llz_art_derived_path(paletteFile, sizeof(paletteFile), &src, "p%d.pal", options->maxSize);
+
+        // Full-size art is the source file itself; only thumbnails are stored
+        if (wantImage && options->maxSize > 0) {
+            llz_art_derived_read_image(thumbFile, &src, &job->image, job);
+        }
+        if (wantBlur) llz_art_derived_read_image(blurFile, &src, &job->blurred, job);
+        if (!havePalette) havePalette = llz_art_derived_read_palette(paletteFile, &src, &job->palette);
+
+        if ((!wantImage || job->image.data) && (!wantBlur || job->blurred.data) && havePalette) {
+            job->ok = true;
+            return;
+        }
+    }
+
+    // WebP is decoded at the target size, in slices so a job cancelled
+    // mid-decode (e.g. while scrolling) stops early
+    uint64_t decodeSpan = LlzProfilerSpanBegin();
+    LlzImageDecoder *decoder = LlzImageDecoderOpen(path, options->maxSize);
+    LlzImageDecodeStatus status = decoder ? LlzImageDecoderStep(decoder, LLZ_ART_DECODE_SLICE)
+                                          : LLZ_IMAGE_DECODE_ERROR;
+    while (status == LLZ_IMAGE_DECODE_MORE && !llz_art_cancelled(job)) {
+        status = LlzImageDecoderStep(decoder, LLZ_ART_DECODE_SLICE);
+    }
+    LlzImageDecoderGetInfo(decoder, NULL, NULL, &job->sourceWidth, &job->sourceHeight);
+    Image img = LlzImageDecoderFinish(decoder);
+    LlzProfilerSpanEnd("art decode", decodeSpan);
+
+    if (img.data == NULL) {
+        if (status != LLZ_IMAGE_DECODE_MORE) printf("[ART] Failed to load '%s'\n", path);
+        llz_art_free_images(job);
+        return;
+    }
+
+    bool downscaled = img.width != job->sourceWidth || img.height != job->sourceHeight;
+
+    if (!havePalette) {
+        uint64_t paletteSpan = LlzProfilerSpanBegin();
+        LlzPaletteExtract(img, &job->palette);
+        LlzProfilerSpanEnd("art palette", paletteSpan);
+        if (useDisk) llz_art_derived_write_palette(paletteFile, &src, job);
+    }
+
+    if (wantBlur && !job->blurred.data) {
+        uint64_t blurSpan = LlzProfilerSpanBegin();
+        job->blurred = LlzImageBlurReduced(img, options->blurRadius, options->blurDarken);
+        LlzProfilerSpanEnd("art blur", blurSpan);
+        if (useDisk && job->blurred.data) llz_art_derived_write_image(blurFile, &src, job->blurred, job);
+    }
+
+    if (job->image.data || (options->blurOnly && job->blurred.data)) {
+        UnloadImage(img);
+    } else {
+        if (useDisk && downscaled) llz_art_derived_write_image(thumbFile, &src, img, job);
+        job->image = img;
+    }
+    job->ok = true;
+}
+
+// Highest priority queued job, oldest first among equals (ids grow
+// monotonically), or NULL. Caller holds the lock.
+static LlzArtSlot *llz_art_next_queued(void)
+{
+    LlzArtSlot *next = NULL;
+    for (int i = 0; i < LLZ_ART_MAX_JOBS; i++) {
+        LlzArtSlot *slot = &g_artSlots[i];
+        if (slot->state != LLZ_ART_SLOT_QUEUED) continue;
+        if (!next || slot->options.priority > next->options.priority ||
+            (slot->options.priority == next->options.priority && slot->id < next->id)) {
+            next = slot;
+        }
+    }
+    return next;
+}
+
+static void *llz_art_worker(void *arg)
+{
+    (void)arg;
+    char path[LLZ_ART_PATH_MAX];
+    LlzArtOptions options;
+
+    pthread_mutex_lock(&g_artMutex);
+    while (!g_artStopping) {
+        LlzArtSlot *slot = llz_art_next_queued();
+        if (!slot) {
+            pthread_cond_wait(&g_artCond, &g_artMutex);
+            continue;
+        }
+
+        slot->state = LLZ_ART_SLOT_RUNNING;
+        memcpy(path, slot->path, sizeof(path));
+        options = slot->options;
+
+        // The slot cannot be reused while RUNNING, so results are written
+        // into it directly and published under the lock afterwards
+        pthread_mutex_unlock(&g_artMutex);
+        llz_art_process(slot, path, &options);
+        pthread_mutex_lock(&g_artMutex);
+
+        if (slot->cancelled) {
+            llz_art_free_images(slot);
+            memset(slot, 0, sizeof(*slot));
+        } else {
+            slot->state = LLZ_ART_SLOT_DONE;
+            // Wake an idle host loop to upload and show it
+            LlzGovernorRequestRedraw();
+        }
+    }
+    pthread_mutex_unlock(&g_artMutex);
+    return NULL;
+}
+
+// Caller holds the lock
+static LlzArtSlot *llz_art_find(LlzArtJob job)
+{
+    if (job == 0) return NULL;
+    for (int i = 0; i < LLZ_ART_MAX_JOBS; i++) {
+        if (g_artSlots[i].state != LLZ_ART_SLOT_FREE && g_artSlots[i].id == job) {
+            return &g_artSlots[i];
+        }
+    }
+    return NULL;
+}
+
+LlzArtJob LlzArtLoadAsync(const char *path, const LlzArtOptions *options)
+{
+    if (!path || path[0] == '\0') return 0;
+
+    // Art downloads land after the track change; a missing file is the
+    // common case and is cheaper to reject here than to queue
+    struct stat st;
+    if (stat(path, &st) != 0) return 0;
+
+    LlzArtJob job = 0;
+    pthread_mutex_lock(&g_artMutex);
+
+    if (!g_artThreadStarted && !g_artStopping) {
+        if (pthread_create(&g_artThread, NULL, llz_art_worker, NULL) == 0) {
+            g_artThreadStarted = true;
+        } else {
+            printf("[ART] Failed to start worker thread\n");
+        }
+    }
+
+    if (g_artThreadStarted) {
+        for (int i = 0; i < LLZ_ART_MAX_JOBS; i++) {
+            LlzArtSlot *slot = &g_artSlots[i];
+            if (slot->state != LLZ_ART_SLOT_FREE) continue;
+
+            memset(slot, 0, sizeof(*slot));
+            slot->id = g_artNextId++;
+            if (g_artNextId == 0) g_artNextId = 1;
+            slot->state = LLZ_ART_SLOT_QUEUED;
+            strncpy(slot->path, path, sizeof(slot->path) - 1);
+            if (options) slot->options = *options;
+            job = slot->id;
+            pthread_cond_signal(&g_artCond);
+            break;
+        }
+        if (job == 0) printf("[ART] Job queue full, dropping '%s'\n", path);
+    }
+
+    pthread_mutex_unlock(&g_artMutex);
+    return job;
+}
+
+LlzArtStatus LlzArtPoll(LlzArtJob job, LlzArtResult *outResult)
+{
+    pthread_mutex_lock(&g_artMutex);
+    LlzArtSlot *slot = llz_art_find(job);
+    if (!slot || slot->cancelled) {
+        pthread_mutex_unlock(&g_artMutex);
+        return LLZ_ART_INVALID;
+    }
+    if (slot->state != LLZ_ART_SLOT_DONE) {
+        pthread_mutex_unlock(&g_artMutex);
+        return LLZ_ART_PENDING;
+    }
+
+    // Take the result and release the slot before touching the GPU
+    LlzArtSlot done = *slot;
+    memset(slot, 0, sizeof(*slot));
+    pthread_mutex_unlock(&g_artMutex);
+
+    if (!done.ok) return LLZ_ART_FAILED;
+
+    LlzArtResult result;
+    memset(&result, 0, sizeof(result));
+    if (done.image.data) {
+        if (done.options.atlas) result.atlasSlot = LlzAtlasAdd(done.options.atlas, done.image);
+        // No room in the atlas: fall back to a texture of its own
+        if (result.atlasSlot == 0) result.texture = LoadTextureFromImage(done.image);
+    }
+    if (done.blurred.data) {
+        // The blurred copy is reduced in size and always drawn scaled up
+        result.blurred = LoadTextureFromImage(done.blurred);
+        SetTextureFilter(result.blurred, TEXTURE_FILTER_BILINEAR);
+    }
+    result.palette = done.palette;
+    result.sourceWidth = done.sourceWidth;
+    result.sourceHeight = done.sourceHeight;
+    llz_art_free_images(&done);
+
+    bool uploaded = done.options.blurOnly ? result.blurred.id != 0
+                                          : (result.texture.id != 0 || result.atlasSlot != 0);
+    if (!uploaded || !outResult) {
+        if (!uploaded) printf("[ART] Texture upload failed for '%s'\n", done.path);
+        if (result.texture.id != 0) UnloadTexture(result.texture);
+        if (result.blurred.id != 0) UnloadTexture(result.blurred);
+        LlzAtlasRemove(done.options.atlas, result.atlasSlot);
+        return uploaded ? LLZ_ART_READY : LLZ_ART_FAILED;
+    }
+
+    *outResult = result;
+    return LLZ_ART_READY;
+}
+
+void LlzArtCancel(LlzArtJob job)
+{
+    pthread_mutex_lock(&g_artMutex);
+    LlzArtSlot *slot = llz_art_find(job);
+    if (slot) {
+        if (slot->state == LLZ_ART_SLOT_RUNNING) {
+            slot->cancelled = true;   // The worker frees it when done
+        } else {
+            llz_art_free_images(slot);
+            memset(slot, 0, sizeof(*slot));
+        }
+    }
+    pthread_mutex_unlock(&g_artMutex);
+}
+
+void LlzArtSetPriority(LlzArtJob job, int priority)
+{
+    pthread_mutex_lock(&g_artMutex);
+    LlzArtSlot *slot = llz_art_find(job);
+    if (slot && slot->state == LLZ_ART_SLOT_QUEUED) slot->options.priority = priority;
+    pthread_mutex_unlock(&g_artMutex);
+}
+
+int LlzArtPendingCount(void)
+{
+    int count = 0;
+    pthread_mutex_lock(&g_artMutex);
+    for (int i = 0; i < LLZ_ART_MAX_JOBS; i++) {
+        LlzArtSlotState state = g_artSlots[i].state;
+        if (state == LLZ_ART_SLOT_QUEUED || state == LLZ_ART_SLOT_RUNNING) count++;
+    }
+    pthread_mutex_unlock(&g_artMutex);
+    return count;
+}
+
+static void llz_art_cache_clear(void);
+
+void LlzArtShutdown(void)
+{
+    // Cached textures go first; cancelling their jobs needs the worker lock
+    llz_art_cache_clear();
+
+    pthread_mutex_lock(&g_artMutex);
+    bool started = g_artThreadStarted;
+    g_artStopping = true;
+    pthread_cond_broadcast(&g_artCond);
+    pthread_mutex_unlock(&g_artMutex);
+
+    if (started) pthread_join(g_artThread, NULL);
+
+    pthread_mutex_lock(&g_artMutex);
+    for (int i = 0; i < LLZ_ART_MAX_JOBS; i++) {
+        llz_art_free_images(&g_artSlots[i]);
+        memset(&g_artSlots[i], 0, sizeof(g_artSlots[i]));
+    }
+    g_artThreadStarted = false;
+    g_artStopping = false;
+    pthread_mutex_unlock(&g_artMutex);
+}
+
+// ============================================================================
+// Album Art Cache
+// ============================================================================
+
+#define LLZ_ART_MISSING_RETRY_SECONDS 1.0
+#define LLZ_ART_FAILED_RETRY_SECONDS 5.0
+
+typedef enum {
+    LLZ_ART_ENTRY_FREE = 0,
+    LLZ_ART_ENTRY_WAITING,      // Needs a job: new, or due for a retry
+    LLZ_ART_ENTRY_LOADING,      // Job on the worker
+    LLZ_ART_ENTRY_READY,
+    LLZ_ART_ENTRY_MISSING       // Not on disk or undecodable; retried while referenced
+} LlzArtEntryState;
+
+typedef struct {
+    char key[LLZ_ART_PATH_MAX];     // Art hash, or the path for art outside LLZ_ART_CACHE_DIR
+    char path[LLZ_ART_PATH_MAX];    // Full-size source file
+    bool keyIsHash;
+    LlzArtVariant variant;
+    LlzArtEntryState state;
+    uint32_t generation;            // Bumped on reuse so stale handles miss
+    int refs;
+    LlzArtJob job;                  // May be shared by the FULL and BLUR entries of a key
+    Texture2D texture;
+    LlzAtlasSlot atlasSlot;         // THUMB art in g_artAtlas (texture is then empty)
+    LlzPalette palette;
+    size_t bytes;
+    double retryAt;
+    unsigned long lastUse;
+    int priority;
+} LlzArtCacheEntry;
+
+static LlzArtCacheEntry g_artCache[LLZ_ART_CACHE_MAX_ENTRIES];
+static LlzAtlas *g_artAtlas = NULL;           // Created with the first THUMB load
+static size_t g_artCacheBudget = LLZ_ART_CACHE_DEFAULT_BUDGET;
+static size_t g_artCacheUploadBudget = LLZ_ART_CACHE_UPLOAD_BUDGET;
+static size_t g_artCacheBytes = 0;
+static unsigned long g_artCacheClock = 0;
+static unsigned long g_artCacheHits = 0;
+static unsigned long g_artCacheLoads = 0;
+static unsigned long g_artCacheEvictions = 0;
+static unsigned long g_artCacheCancelled = 0;
+static bool g_artCacheEvictorRegistered = false;
+
+// Handles pack the slot index (1-based, low byte) and the slot generation
+static LlzArtHandle llz_art_handle(int index)
+{
+    return (g_artCache[index].generation << 8) | (uint32_t)(index + 1);
+}
+
+static LlzArtCacheEntry *llz_art_entry(LlzArtHandle handle)
+{
+    int index = (int)(handle & 0xFF) - 1;
+    if (index < 0 || index >= LLZ_ART_CACHE_MAX_ENTRIES) return NULL;
+
+    LlzArtCacheEntry *entry = &g_artCache[index];
+    if (entry->state == LLZ_ART_ENTRY_FREE || entry->generation != (handle >> 8)) return NULL;
+    return entry;
+}
+
+static bool llz_art_job_shared(const LlzArtCacheEntry *entry)
+{
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        const LlzArtCacheEntry *other = &g_artCache[i];
+        if (other != entry && other->state == LLZ_ART_ENTRY_LOADING && other->job == entry->job) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void llz_art_entry_free(LlzArtCacheEntry *entry)
+{
+    if (entry->job != 0 && !llz_art_job_shared(entry)) LlzArtCancel(entry->job);
+    if (entry->texture.id != 0) {
+        LlzResourceUntrack(LLZ_RESOURCE_TEXTURE, entry->texture.id);
+        UnloadTexture(entry->texture);
+    }
+    LlzAtlasRemove(g_artAtlas, entry->atlasSlot);
+    g_artCacheBytes -= entry->bytes;
+
+    uint32_t generation = (entry->generation + 1) & 0xFFFFFF;
+    memset(entry, 0, sizeof(*entry));
+    entry->generation = generation;
+}
+
+// Least recently used entry nobody holds; readyOnly skips entries without a texture
+static LlzArtCacheEntry *llz_art_lru_victim(bool readyOnly)
+{
+    LlzArtCacheEntry *victim = NULL;
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        LlzArtCacheEntry *entry = &g_artCache[i];
+        if (entry->state == LLZ_ART_ENTRY_FREE || entry->refs > 0) continue;
+        if (readyOnly && entry->state != LLZ_ART_ENTRY_READY) continue;
+        if (!victim || entry->lastUse < victim->lastUse) victim = entry;
+    }
+    return victim;
+}
+
+// Resource registry evictor: frees released full-size textures, least
+// recently used first. Thumbnails live on atlas pages, which stay allocated.
+static size_t llz_art_cache_evict(LlzResourceDomain domain, size_t bytes, bool hard, void *user)
+{
+    (void)hard;
+    (void)user;
+    if (domain != LLZ_RESOURCE_GPU) return 0;
+
+    size_t freed = 0;
+    while (freed < bytes) {
+        LlzArtCacheEntry *victim = NULL;
+        for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+            LlzArtCacheEntry *entry = &g_artCache[i];
+            if (entry->state != LLZ_ART_ENTRY_READY || entry->refs > 0 || entry->texture.id == 0) continue;
+            if (!victim || entry->lastUse < victim->lastUse) victim = entry;
+        }
+        if (!victim) break;
+        freed += LlzResourceTextureBytes(victim->texture);
+        llz_art_entry_free(victim);
+        g_artCacheEvictions++;
+    }
+    return freed;
+}
+
+static LlzArtCacheEntry *llz_art_find_entry(const char *key, LlzArtVariant variant)
+{
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        LlzArtCacheEntry *entry = &g_artCache[i];
+        if (entry->state != LLZ_ART_ENTRY_FREE && entry->variant == variant &&
+            strcmp(entry->key, key) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static LlzArtHandle llz_art_acquire(const char *key, const char *path, bool keyIsHash,
+                                    LlzArtVariant variant)
+{
+    if (variant < 0 || variant >= LLZ_ART_VARIANT_COUNT) return 0;
+    if (!g_artCacheEvictorRegistered) {
+        g_artCacheEvictorRegistered = LlzResourceRegisterEvictor(llz_art_cache_evict, NULL);
+    }
+
+    LlzArtCacheEntry *entry = llz_art_find_entry(key, variant);
+    if (entry) {
+        entry->refs++;
+        entry->lastUse = ++g_artCacheClock;
+        if (entry->state == LLZ_ART_ENTRY_READY) g_artCacheHits++;
+        return llz_art_handle((int)(entry - g_artCache));
+    }
+
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES && !entry; i++) {
+        if (g_artCache[i].state == LLZ_ART_ENTRY_FREE) entry = &g_artCache[i];
+    }
+    if (!entry) {
+        entry = llz_art_lru_victim(false);
+        if (!entry) {
+            printf("[ART] Cache full, every entry is referenced\n");
+            return 0;
+        }
+        llz_art_entry_free(entry);
+        g_artCacheEvictions++;
+    }
+
+    strncpy(entry->key, key, sizeof(entry->key) - 1);
+    strncpy(entry->path, path, sizeof(entry->path) - 1);
+    entry->keyIsHash = keyIsHash;
+    entry->variant = variant;
+    entry->state = LLZ_ART_ENTRY_WAITING;
+    entry->refs = 1;
+    entry->lastUse = ++g_artCacheClock;
+    return llz_art_handle((int)(entry - g_artCache));
+}
+
+LlzArtHandle LlzArtCacheAcquire(const char *hash, LlzArtVariant variant)
+{
+    if (!hash || hash[0] == '\0') return 0;
+
+    char path[LLZ_ART_PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
+    return llz_art_acquire(hash, path, true, variant);
+}
+
+LlzArtHandle LlzArtCacheAcquirePath(const char *path, LlzArtVariant variant)
+{
+    if (!path || path[0] == '\0') return 0;
+
+    // <LLZ_ART_CACHE_DIR>/<hash>.webp is the same art as LlzArtCacheAcquire(hash)
+    size_t dirLen = strlen(LLZ_ART_CACHE_DIR);
+    size_t len = strlen(path);
+    if (len > dirLen + 6 && strncmp(path, LLZ_ART_CACHE_DIR, dirLen) == 0 &&
+        path[dirLen] == '/' && strchr(path + dirLen + 1, '/') == NULL &&
+        strcmp(path + len - 5, ".webp") == 0) {
+        char hash[LLZ_ART_PATH_MAX];
+        size_t hashLen = len - dirLen - 1 - 5;
+        memcpy(hash, path + dirLen + 1, hashLen);
+        hash[hashLen] = '\0';
+        return llz_art_acquire(hash, path, true, variant);
+    }
+    return llz_art_acquire(path, path, false, variant);
+}
+
+void LlzArtCacheRelease(LlzArtHandle handle)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    if (!entry) return;
+    if (entry->refs > 0) entry->refs--;
+    entry->lastUse = ++g_artCacheClock;
+}
+
+Texture2D LlzArtCacheGetTexture(LlzArtHandle handle)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    if (!entry || entry->state != LLZ_ART_ENTRY_READY) return (Texture2D){0};
+    return entry->texture;
+}
+
+bool LlzArtCacheGetRegion(LlzArtHandle handle, Texture2D *outTexture, Rectangle *outSource)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    if (!entry || entry->state != LLZ_ART_ENTRY_READY) return false;
+
+    if (entry->atlasSlot == 0) {
+        if (outTexture) *outTexture = entry->texture;
+        if (outSource) *outSource = (Rectangle){ 0, 0, (float)entry->texture.width, (float)entry->texture.height };
+        return true;
+    }
+    if (LlzAtlasGet(g_artAtlas, entry->atlasSlot, outTexture, outSource)) return true;
+
+    // A full atlas handed the slot to newer art; load it again (normally
+    // straight from the derived thumbnail on disk)
+    g_artCacheBytes -= entry->bytes;
+    entry->bytes = 0;
+    entry->atlasSlot = 0;
+    entry->state = LLZ_ART_ENTRY_WAITING;
+    return false;
+}
+
+bool LlzArtCacheIsReady(LlzArtHandle handle)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    return entry && entry->state == LLZ_ART_ENTRY_READY;
+}
+
+bool LlzArtCacheIsMissing(LlzArtHandle handle)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    return entry && entry->state == LLZ_ART_ENTRY_MISSING;
+}
+
+bool LlzArtCacheGetPalette(LlzArtHandle handle, LlzPalette *outPalette)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    if (!entry || entry->state != LLZ_ART_ENTRY_READY || !outPalette) return false;
+    *outPalette = entry->palette;
+    return true;
+}
+
+void LlzArtCacheSetPriority(LlzArtHandle handle, int priority)
+{
+    LlzArtCacheEntry *entry = llz_art_entry(handle);
+    if (!entry || entry->priority == priority) return;
+    entry->priority = priority;
+    if (entry->state == LLZ_ART_ENTRY_LOADING && entry->job != 0) LlzArtSetPriority(entry->job, priority);
+}
+
+// Hand a finished job's textures to every entry waiting on it
+static void llz_art_cache_collect(LlzArtJob job, double now)
+{
+    LlzArtResult art;
+    LlzArtStatus status = LlzArtPoll(job, &art);
+    if (status == LLZ_ART_PENDING) return;
+
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        LlzArtCacheEntry *entry = &g_artCache[i];
+        if (entry->state != LLZ_ART_ENTRY_LOADING || entry->job != job) continue;
+        entry->job = 0;
+
+        Texture2D *tex = (entry->variant == LLZ_ART_VARIANT_BLUR) ? &art.blurred : &art.texture;
+        Rectangle region;
+        if (status == LLZ_ART_READY && entry->variant == LLZ_ART_VARIANT_THUMB && art.atlasSlot != 0 &&
+            LlzAtlasGet(g_artAtlas, art.atlasSlot, NULL, &region)) {
+            entry->atlasSlot = art.atlasSlot;
+            entry->palette = art.palette;
+            entry->bytes = (size_t)region.width * region.height * 4;
+            entry->state = LLZ_ART_ENTRY_READY;
+            g_artCacheBytes += entry->bytes;
+            g_artCacheLoads++;
+            art.atlasSlot = 0;
+        } else if (status == LLZ_ART_READY && tex->id != 0) {
+            entry->texture = *tex;
+            LlzResourceTrack("art", LLZ_RESOURCE_TEXTURE, tex->id, LlzResourceTextureBytes(*tex));
+            entry->palette = art.palette;
+            entry->bytes = (size_t)tex->width * tex->height * 4;
+            entry->state = LLZ_ART_ENTRY_READY;
+            g_artCacheBytes += entry->bytes;
+            g_artCacheLoads++;
+            *tex = (Texture2D){0};
+        } else {
+            entry->state = LLZ_ART_ENTRY_MISSING;
+            entry->retryAt = now + LLZ_ART_FAILED_RETRY_SECONDS;
+        }
+    }
+
+    if (status == LLZ_ART_READY) {
+        if (art.texture.id != 0) UnloadTexture(art.texture);
+        if (art.blurred.id != 0) UnloadTexture(art.blurred);
+        LlzAtlasRemove(g_artAtlas, art.atlasSlot);
+    }
+}
+
+static void llz_art_cache_start(LlzArtCacheEntry *entry, double now)
+{
+    const char *path = entry->path;
+    char previewPath[LLZ_ART_PATH_MAX];
+    LlzArtCacheEntry *sibling = NULL;
+    struct stat st;
+
+    LlzArtOptions options = {0};
+    options.extractPalette = true;
+    options.diskCache = true;
+    options.priority = entry->priority;
+
+    if (entry->variant == LLZ_ART_VARIANT_THUMB) {
+        // Small preview files are written for library browsing; prefer them
+        if (entry->keyIsHash) {
+            snprintf(previewPath, sizeof(previewPath), "%s/%s.webp", LLZ_ART_PREVIEW_DIR, entry->key);
+            if (stat(previewPath, &st) == 0 && st.st_size > 0) path = previewPath;
+        }
+        options.maxSize = LLZ_ART_THUMB_SIZE;
+        if (!g_artAtlas) g_artAtlas = LlzAtlasCreate(LLZ_ART_ATLAS_PAGES);
+        options.atlas = g_artAtlas;
+    } else {
+        // FULL and BLUR of the same art requested together share one decode
+        LlzArtVariant other = (entry->variant == LLZ_ART_VARIANT_FULL) ? LLZ_ART_VARIANT_BLUR
+                                                                       : LLZ_ART_VARIANT_FULL;
+        sibling = llz_art_find_entry(entry->key, other);
+        if (sibling && (sibling->state != LLZ_ART_ENTRY_WAITING || sibling->refs == 0)) sibling = NULL;
+        if (sibling && sibling->priority > options.priority) options.priority = sibling->priority;
+
+        if (entry->variant == LLZ_ART_VARIANT_BLUR || sibling) {
+            options.blurRadius = LLZ_ART_BLUR_RADIUS;
+            options.blurDarken = LLZ_ART_BLUR_DARKEN;
+        }
+        options.blurOnly = (entry->variant == LLZ_ART_VARIANT_BLUR && !sibling);
+    }
+
+    if (stat(path, &st) != 0) {
+        entry->state = LLZ_ART_ENTRY_MISSING;
+        entry->retryAt = now + LLZ_ART_MISSING_RETRY_SECONDS;
+        if (sibling) {
+            sibling->state = LLZ_ART_ENTRY_MISSING;
+            sibling->retryAt = entry->retryAt;
+        }
+        return;
+    }
+
+    // A full worker queue leaves the entry WAITING for the next frame
+    LlzArtJob job = LlzArtLoadAsync(path, &options);
+    if (job == 0) return;
+
+    entry->state = LLZ_ART_ENTRY_LOADING;
+    entry->job = job;
+    if (sibling) {
+        sibling->state = LLZ_ART_ENTRY_LOADING;
+        sibling->job = job;
+    }
+}
+
+static int llz_art_cache_by_priority(const void *a, const void *b)
+{
+    const LlzArtCacheEntry *ea = &g_artCache[*(const int *)a];
+    const LlzArtCacheEntry *eb = &g_artCache[*(const int *)b];
+    if (ea->priority != eb->priority) return (ea->priority < eb->priority) ? 1 : -1;
+    return *(const int *)a - *(const int *)b;
+}
+
+// Highest priority entry that needs a job, or NULL
+static LlzArtCacheEntry *llz_art_cache_next_waiting(void)
+{
+    LlzArtCacheEntry *next = NULL;
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        LlzArtCacheEntry *entry = &g_artCache[i];
+        if (entry->state != LLZ_ART_ENTRY_WAITING || entry->refs == 0) continue;
+        if (!next || entry->priority > next->priority) next = entry;
+    }
+    return next;
+}
+
+void LlzArtCacheUpdate(void)
+{
+    double now = GetTime();
+
+    // Finished loads in priority order, until this frame's upload budget is
+    // spent; the rest stay finished on the worker until the next frame
+    int order[LLZ_ART_CACHE_MAX_ENTRIES];
+    int loading = 0;
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        if (g_artCache[i].state == LLZ_ART_ENTRY_LOADING && g_artCache[i].job != 0) order[loading++] = i;
+    }
+    qsort(order, (size_t)loading, sizeof(order[0]), llz_art_cache_by_priority);
+
+    size_t uploaded = 0;
+    for (int i = 0; i < loading && (uploaded == 0 || uploaded < g_artCacheUploadBudget); i++) {
+        LlzArtCacheEntry *entry = &g_artCache[order[i]];
+        // Collecting a shared job also completes its sibling
+        if (entry->state != LLZ_ART_ENTRY_LOADING || entry->job == 0) continue;
+        size_t before = g_artCacheBytes;
+        llz_art_cache_collect(entry->job, now);
+        uploaded += g_artCacheBytes - before;
+    }
+
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        LlzArtCacheEntry *entry = &g_artCache[i];
+        if (entry->state == LLZ_ART_ENTRY_MISSING && entry->refs > 0 && now >= entry->retryAt) {
+            entry->state = LLZ_ART_ENTRY_WAITING;
+        }
+        if (entry->refs > 0) continue;
+
+        if (entry->state == LLZ_ART_ENTRY_WAITING) {
+            llz_art_entry_free(entry);   // Released before it was ever loaded
+        } else if (entry->state == LLZ_ART_ENTRY_LOADING) {
+            llz_art_entry_free(entry);   // Scrolled past before it finished
+            g_artCacheCancelled++;
+        }
+    }
+
+    // A short worker queue keeps priorities meaningful: art that becomes
+    // urgent is started next rather than behind everything requested so far
+    int pending = LlzArtPendingCount();
+    while (pending < LLZ_ART_CACHE_MAX_PENDING) {
+        LlzArtCacheEntry *entry = llz_art_cache_next_waiting();
+        if (!entry) break;
+        llz_art_cache_start(entry, now);
+        if (entry->state == LLZ_ART_ENTRY_WAITING) break;   // Worker queue full
+        if (entry->state == LLZ_ART_ENTRY_LOADING) pending++;
+    }
+
+    while (g_artCacheBytes > g_artCacheBudget) {
+        LlzArtCacheEntry *victim = llz_art_lru_victim(true);
+        if (!victim) break;   // Everything resident is in use
+        llz_art_entry_free(victim);
+        g_artCacheEvictions++;
+    }
+}
+
+void LlzArtCacheSetBudget(size_t bytes)
+{
+    g_artCacheBudget = bytes;
+}
+
+void LlzArtCacheSetUploadBudget(size_t bytesPerFrame)
+{
+    g_artCacheUploadBudget = bytesPerFrame;
+}
+
+void LlzArtCacheGetStats(LlzArtCacheStats *outStats)
+{
+    if (!outStats) return;
+    memset(outStats, 0, sizeof(*outStats));
+
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        const LlzArtCacheEntry *entry = &g_artCache[i];
+        if (entry->state == LLZ_ART_ENTRY_FREE) continue;
+        outStats->entries++;
+        if (entry->refs > 0) outStats->referenced++;
+        if (entry->state == LLZ_ART_ENTRY_WAITING || entry->state == LLZ_ART_ENTRY_LOADING) {
+            outStats->loading++;
+        }
+    }
+    outStats->bytes = g_artCacheBytes;
+    outStats->budget = g_artCacheBudget;
+    outStats->hits = g_artCacheHits;
+    outStats->loads = g_artCacheLoads;
+    outStats->evictions = g_artCacheEvictions;
+    outStats->cancelled = g_artCacheCancelled;
+}
+
+static void llz_art_cache_clear(void)
+{
+    for (int i = 0; i < LLZ_ART_CACHE_MAX_ENTRIES; i++) {
+        if (g_artCache[i].state != LLZ_ART_ENTRY_FREE) llz_art_entry_free(&g_artCache[i]);
+    }
+    g_artCacheBytes = 0;
+    LlzAtlasDestroy(g_artAtlas);
+    g_artAtlas = NULL;
+    if (g_artCacheEvictorRegistered) {
+        LlzResourceUnregisterEvictor(llz_art_cache_evict, NULL);
+        g_artCacheEvictorRegistered = false;
+    }
+}
@@ -0,0 +1,309 @@
+#include "llz_sdk_atlas.h"
+#include "llz_sdk_resource.h"
+#include "rlgl.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LLZ_ATLAS_MAX_SHELVES 64
+
+typedef struct {
+    int page;
+    int x, y, width, height;          // Padded rectangle on the page
+    int imageWidth, imageHeight;
+    bool used;
+    uint16_t generation;              // Bumped on removal so stale slots miss
+    unsigned long lastUse;
+} LlzAtlasRect;
+
+typedef struct {
+    int y, height;
+    int x;                            // Next free column
+} LlzAtlasShelf;
+
+typedef struct {
+    Texture2D texture;
+    LlzAtlasShelf shelves[LLZ_ATLAS_MAX_SHELVES];
+    int shelfCount;
+    int nextY;                        // Top of the next shelf
+} LlzAtlasPage;
+
+struct LlzAtlas {
+    LlzAtlasPage pages[LLZ_ATLAS_MAX_PAGES];
+    int pageCount;
+    int maxPages;
+    LlzAtlasRect rects[LLZ_ATLAS_MAX_SLOTS];
+    int rectCount;
+    unsigned long clock;
+    unsigned long uploads;
+    unsigned long reuses;
+};
+
+// Slots pack the rect index (1-based, low 16 bits) and its generation
+static LlzAtlasSlot llz_atlas_slot(const LlzAtlas *atlas, int index)
+{
+    return ((uint32_t)atlas->rects[index].generation << 16) | (uint32_t)(index + 1);
+}
+
+static LlzAtlasRect *llz_atlas_rect(LlzAtlas *atlas, LlzAtlasSlot slot)
+{
+    if (!atlas) return NULL;
+    int index = (int)(slot & 0xFFFF) - 1;
+    if (index < 0 || index >= atlas->rectCount) return NULL;
+
+    LlzAtlasRect *rect = &atlas->rects[index];
+    if (!rect->used || rect->generation != (slot >> 16)) return NULL;
+    return rect;
+}
+
+static void llz_atlas_release(LlzAtlasRect *rect)
+{
+    rect->used = false;
+    rect->generation++;
+    if (rect->generation == 0) rect->generation = 1;
+}
+
+// Page storage is allocated on the GPU only; nothing is uploaded until images arrive
+static bool llz_atlas_add_page(LlzAtlas *atlas)
+{
+    if (atlas->pageCount >= atlas->maxPages) return false;
+
+    LlzAtlasPage *page = &atlas->pages[atlas->pageCount];
+    memset(page, 0, sizeof(*page));
+    page->texture.id = rlLoadTexture(NULL, LLZ_ATLAS_PAGE_SIZE, LLZ_ATLAS_PAGE_SIZE,
+                                     PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    if (page->texture.id == 0) {
+        printf("[ATLAS] Failed to allocate a %dx%d page\n", LLZ_ATLAS_PAGE_SIZE, LLZ_ATLAS_PAGE_SIZE);
+        return false;
+    }
+    page->texture.width = LLZ_ATLAS_PAGE_SIZE;
+    page->texture.height = LLZ_ATLAS_PAGE_SIZE;
+    page->texture.mipmaps = 1;
+    page->texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    SetTextureFilter(page->texture, TEXTURE_FILTER_BILINEAR);
+    LlzResourceTrack("atlas", LLZ_RESOURCE_TEXTURE, page->texture.id, LlzResourceTextureBytes(page->texture));
+    atlas->pageCount++;
+    return true;
+}
+
+// Carve a new rect from a shelf: the tightest shelf with room, else a new
+// shelf, else a new page. Returns the rect index or -1.
+static int llz_atlas_shelf_alloc(LlzAtlas *atlas, int width, int height)
+{
+    if (atlas->rectCount >= LLZ_ATLAS_MAX_SLOTS) return -1;
+
+    int bestPage = -1;
+    LlzAtlasShelf *best = NULL;
+    for (int p = 0; p < atlas->pageCount; p++) {
+        LlzAtlasPage *page = &atlas->pages[p];
+        for (int s = 0; s < page->shelfCount; s++) {
+            LlzAtlasShelf *shelf = &page->shelves[s];
+            if (shelf->height < height || shelf->x + width > LLZ_ATLAS_PAGE_SIZE) continue;
+            if (!best || shelf->height < best->height) {
+                best = shelf;
+                bestPage = p;
+            }
+        }
+    }
+
+    // A shelf much taller than the image wastes the difference; open a fitting one instead
+    if (best && best->height > height + height / 4) {
+        for (int p = 0; p < atlas->pageCount; p++) {
+            LlzAtlasPage *page = &atlas->pages[p];
+            if (page->shelfCount < LLZ_ATLAS_MAX_SHELVES && page->nextY + height <= LLZ_ATLAS_PAGE_SIZE) {
+                best = NULL;
+                break;
+            }
+        }
+    }
+
+    if (!best) {
+        for (int p = 0; p <= atlas->pageCount && !best; p++) {
+            if (p == atlas->pageCount && !llz_atlas_add_page(atlas)) break;
+            LlzAtlasPage *page = &atlas->pages[p];
+            if (page->shelfCount >= LLZ_ATLAS_MAX_SHELVES || page->nextY + height > LLZ_ATLAS_PAGE_SIZE) {
+                continue;
+            }
+            best = &page->shelves[page->shelfCount++];
+            best->y = page->nextY;
+            best->height = height;
+            best->x = 0;
+            page->nextY += height;
+            bestPage = p;
+        }
+    }
+    if (!best) return -1;
+
+    int index = atlas->rectCount++;
+    LlzAtlasRect *rect = &atlas->rects[index];
+    memset(rect, 0, sizeof(*rect));
+    rect->page = bestPage;
+    rect->x = best->x;
+    rect->y = best->y;
+    rect->width = width;
+    rect->height = best->height;
+    rect->generation = 1;
+    best->x += width;
+    return index;
+}
+
+// Smallest free rect that fits, or with evict set the least recently drawn
+// used one. Returns the rect index or -1.
+static int llz_atlas_find_rect(LlzAtlas *atlas, int width, int height, bool evict)
+{
+    int best = -1;
+    for (int i = 0; i < atlas->rectCount; i++) {
+        const LlzAtlasRect *rect = &atlas->rects[i];
+        if (rect->used != evict || rect->width < width || rect->height < height) continue;
+        if (best < 0) {
+            best = i;
+        } else if (evict) {
+            if (rect->lastUse < atlas->rects[best].lastUse) best = i;
+        } else if (rect->width * rect->height < atlas->rects[best].width * atlas->rects[best].height) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Upload with the edge pixels repeated into the padding, so bilinear
+// sampling at the border never reads a neighbour
+static bool llz_atlas_upload(LlzAtlas *atlas, const LlzAtlasRect *rect, const Color *pixels)
+{
+    int pad = LLZ_ATLAS_PADDING;
+    int w = rect->imageWidth + pad * 2;
+    int h = rect->imageHeight + pad * 2;
+    Color *padded = (Color *)malloc((size_t)w * h * sizeof(Color));
+    if (!padded) return false;
+
+    for (int y = 0; y < h; y++) {
+        int sy = y - pad;
+        if (sy < 0) sy = 0;
+        if (sy >= rect->imageHeight) sy = rect->imageHeight - 1;
+        const Color *src = pixels + (size_t)sy * rect->imageWidth;
+        Color *dst = padded + (size_t)y * w;
+        for (int x = 0; x < pad; x++) {
+            dst[x] = src[0];
+            dst[w - 1 - x] = src[rect->imageWidth - 1];
+        }
+        memcpy(dst + pad, src, (size_t)rect->imageWidth * sizeof(Color));
+    }
+
+    Rectangle area = { (float)rect->x, (float)rect->y, (float)w, (float)h };
+    UpdateTextureRec(atlas->pages[rect->page].texture, area, padded);
+    free(padded);
+    return true;
+}
+
+LlzAtlas *LlzAtlasCreate(int maxPages)
+{
+    if (maxPages < 1) maxPages = 1;
+    if (maxPages > LLZ_ATLAS_MAX_PAGES) maxPages = LLZ_ATLAS_MAX_PAGES;
+
+    LlzAtlas *atlas = (LlzAtlas *)calloc(1, sizeof(LlzAtlas));
+    if (!atlas) return NULL;
+    atlas->maxPages = maxPages;
+    return atlas;
+}
+
+void LlzAtlasDestroy(LlzAtlas *atlas)
+{
+    if (!atlas) return;
+    for (int p = 0; p < atlas->pageCount; p++) {
+        if (atlas->pages[p].texture.id == 0) continue;
+        LlzResourceUntrack(LLZ_RESOURCE_TEXTURE, atlas->pages[p].texture.id);
+        UnloadTexture(atlas->pages[p].texture);
+    }
+    free(atlas);
+}
+
+LlzAtlasSlot LlzAtlasAdd(LlzAtlas *atlas, Image image)
+{
+    if (!atlas || image.data == NULL || image.width <= 0 || image.height <= 0) return 0;
+
+    int width = image.width + LLZ_ATLAS_PADDING * 2;
+    int height = image.height + LLZ_ATLAS_PADDING * 2;
+    if (width > LLZ_ATLAS_PAGE_SIZE || height > LLZ_ATLAS_PAGE_SIZE) return 0;
+
+    Image rgba = image;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        rgba = ImageCopy(image);
+        ImageFormat(&rgba, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    // A free slot that fits snugly, then fresh shelf space, then any free
+    // slot, then the least recently drawn slot
+    int index = llz_atlas_find_rect(atlas, width, height, false);
+    if (index >= 0) {
+        const LlzAtlasRect *rect = &atlas->rects[index];
+        if (rect->width * rect->height > width * height + width * height / 4) {
+            int fresh = llz_atlas_shelf_alloc(atlas, width, height);
+            if (fresh >= 0) index = fresh;
+        }
+    } else {
+        index = llz_atlas_shelf_alloc(atlas, width, height);
+    }
+    if (index < 0) {
+        index = llz_atlas_find_rect(atlas, width, height, true);
+        if (index >= 0) {
+            llz_atlas_release(&atlas->rects[index]);
+            atlas->reuses++;
+        }
+    }
+
+    LlzAtlasSlot slot = 0;
+    if (index >= 0) {
+        LlzAtlasRect *rect = &atlas->rects[index];
+        rect->imageWidth = image.width;
+        rect->imageHeight = image.height;
+        if (llz_atlas_upload(atlas, rect, (const Color *)rgba.data)) {
+            rect->used = true;
+            rect->lastUse = ++atlas->clock;
+            atlas->uploads++;
+            slot = llz_atlas_slot(atlas, index);
+        }
+    }
+
+    if (rgba.data != image.data) UnloadImage(rgba);
+    return slot;
+}
+
+bool LlzAtlasGet(LlzAtlas *atlas, LlzAtlasSlot slot, Texture2D *outTexture, Rectangle *outSource)
+{
+    LlzAtlasRect *rect = llz_atlas_rect(atlas, slot);
+    if (!rect) return false;
+
+    rect->lastUse = ++atlas->clock;
+    if (outTexture) *outTexture = atlas->pages[rect->page].texture;
+    if (outSource) {
+        *outSource = (Rectangle){
+            (float)(rect->x + LLZ_ATLAS_PADDING),
+            (float)(rect->y + LLZ_ATLAS_PADDING),
+            (float)rect->imageWidth,
+            (float)rect->imageHeight
+        };
+    }
+    return true;
+}
+
+void LlzAtlasRemove(LlzAtlas *atlas, LlzAtlasSlot slot)
+{
+    LlzAtlasRect *rect = llz_atlas_rect(atlas, slot);
+    if (rect) llz_atlas_release(rect);
+}
+
+void LlzAtlasGetStats(const LlzAtlas *atlas, LlzAtlasStats *outStats)
+{
+    if (!outStats) return;
+    memset(outStats, 0, sizeof(*outStats));
+    if (!atlas) return;
+
+    outStats->pages = atlas->pageCount;
+    outStats->slots = atlas->rectCount;
+    for (int i = 0; i < atlas->rectCount; i++) {
+        if (atlas->rects[i].used) outStats->used++;
+    }
+    outStats->uploads = atlas->uploads;
+    outStats->reuses = atlas->reuses;
+}
@@ -5,14 +5,19 @@
  */
 
 #include "llz_sdk_background.h"
+#include "llz_sdk_art.h"
+#include "llz_sdk_display.h"
 #include "llz_sdk_image.h"
 #include "llz_sdk_media.h"
+#include "llz_sdk_governor.h"
+#include "llz_sdk_profiler.h"
+#include "llz_sdk_resource.h"
+#include "rlgl.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include <sys/stat.h>
-#include <webp/decode.h>
 
 // Album art crossfade speed (alpha change per second)
 #define AUTO_BLUR_FADE_SPEED 3.0f
@@ -30,6 +35,34 @@ static const char* kStyleNames[LLZ_BG_STYLE_COUNT] = {
     "Bokeh Lights"
 };
 
+// Profiler span per style, for comparing costs with the cache on and off
+static const char* kStyleSpans[LLZ_BG_STYLE_COUNT] = {
+    "bg pulse",
+    "bg aurora",
+    "bg radial",
+    "bg wave",
+    "bg grid",
+    "bg blur",
+    "bg constellation",
+    "bg liquid",
+    "bg bokeh"
+};
+
+// Styles drawn into the low-resolution layer. Wave and grid are thin sharp
+// lines that upscaling would smear, and blur is a single texture already.
+// Constellation only layers its fill and glows (see DrawStyleSoft).
+static const bool kStyleLayered[LLZ_BG_STYLE_COUNT] = {
+    true,   // Pulse
+    true,   // Aurora
+    true,   // Radial
+    false,  // Wave
+    false,  // Grid
+    false,  // Blur
+    true,   // Constellation
+    true,   // Liquid
+    true    // Bokeh
+};
+
 // Internal state
 typedef struct {
     bool initialized;
@@ -55,6 +88,9 @@ typedef struct {
     bool hasCustomColors;
     Color customPrimary;
     Color customAccent;
+    bool hasArtPalette;                  // Muted tones below come from LlzBackgroundSetPalette
+    Color customMuted;
+    Color customDarkMuted;
 
     float energy;               // For responsive effects (0.0-1.0)
 
@@ -67,14 +103,27 @@ typedef struct {
     // Auto-managed album art blur state (from Redis media state)
     char autoAlbumArtPath[256];          // Currently successfully loaded album art path
     char autoDesiredArtPath[256];        // Path we want to load (may not exist yet)
-    Texture2D autoBlurTexture;           // Current blurred album art
-    Texture2D autoPrevBlurTexture;       // Previous texture for crossfade
+    LlzArtHandle autoBlurArt;            // Current blurred album art (shared art cache)
+    LlzArtHandle autoPrevBlurArt;        // Previous art for crossfade
     float autoBlurCurrentAlpha;          // Current texture alpha (0-1)
     float autoBlurPrevAlpha;             // Previous texture alpha (0-1)
     bool autoBlurInTransition;           // Currently transitioning
     bool autoBlurEnabled;                // Auto-blur tracking enabled
     bool manualBlurOverride;             // Plugin has set manual blur texture
+    LlzArtHandle autoPendingArt;         // Art waiting to load before the crossfade (0 = none)
+    char autoPendingArtPath[256];        // Path of autoPendingArt
     float autoBlurPollTimer;             // Timer for Redis polling
+    uint32_t autoMediaSeq;               // Media snapshot sequence last examined
+    bool autoMediaSeqValid;
+
+    // Cached layer and glow sprite
+    bool cacheEnabled;
+    Texture2D glowSprite;                // Radial gradient cell, then a solid disc cell
+    RenderTexture2D layer;
+    LlzBackgroundStyle layerStyle;
+    bool layerValid;                     // Holds layerStyle with the current palette
+    bool layerSuspended;                 // Dropped under GPU pressure until the style changes
+    float layerAge;                      // Seconds since the layer was drawn
 } BackgroundState;
 
 static BackgroundState g_bg = {0};
@@ -120,18 +169,29 @@ static void GeneratePalette(void)
                                           Clamp01(accentHsv.y * 0.8f + 0.1f),
                                           Clamp01(accentHsv.z * 1.05f));
 
-    // Palette[3]: Complementary-adjacent (200° rotation for variety)
-    g_bg.palette.colors[3] = ColorFromHSV(fmodf(primaryHsv.x + 200.0f, 360.0f),
-                                          Clamp01(primaryHsv.y * 0.6f + 0.2f),
-                                          Clamp01(primaryHsv.z * 0.85f));
+    // Palette[3]: Muted tone from the art, else complementary-adjacent
+    // (200° rotation for variety)
+    if (g_bg.hasCustomColors && g_bg.hasArtPalette) {
+        g_bg.palette.colors[3] = g_bg.customMuted;
+    } else {
+        g_bg.palette.colors[3] = ColorFromHSV(fmodf(primaryHsv.x + 200.0f, 360.0f),
+                                              Clamp01(primaryHsv.y * 0.6f + 0.2f),
+                                              Clamp01(primaryHsv.z * 0.85f));
+    }
 
     // Palette[4]: Analogous color (30° rotation from accent, high saturation)
     g_bg.palette.colors[4] = ColorFromHSV(fmodf(accentHsv.x + 30.0f, 360.0f),
                                           Clamp01(accentHsv.y * 0.9f + 0.1f),
                                           Clamp01(0.8f + 0.2f * accentHsv.z));
 
-    // Palette[5]: Dark background - derived from primary for cohesion
-    if (g_bg.hasCustomColors) {
+    // Palette[5]: Dark background - derived from the art's dark muted tone
+    // or the primary for cohesion
+    if (g_bg.hasCustomColors && g_bg.hasArtPalette) {
+        Vector3 darkHsv = ColorToHSV(g_bg.customDarkMuted);
+        g_bg.palette.colors[5] = ColorFromHSV(darkHsv.x,
+                                              Clamp01(darkHsv.y * 0.6f),
+                                              Clamp01(darkHsv.z * 0.5f));
+    } else if (g_bg.hasCustomColors) {
         g_bg.palette.colors[5] = ColorFromHSV(primaryHsv.x,
                                               Clamp01(primaryHsv.y * 0.3f),
                                               Clamp01(primaryHsv.z * 0.15f));
@@ -141,6 +201,97 @@ static void GeneratePalette(void)
 
     g_bg.styleSeedA = (float)GetRandomValue(25, 90) / 100.0f;
     g_bg.styleSeedB = (float)GetRandomValue(0, 1000) / 1000.0f;
+    g_bg.layerValid = false;
+}
+
+// === Glow Sprite ===
+
+// Two cells side by side: a radial gradient from opaque white at the centre
+// to transparent at the edge, matching DrawCircleGradient with a transparent
+// outer colour, and a solid disc with an anti-aliased edge
+static bool LoadGlowSprite(void)
+{
+    if (g_bg.glowSprite.id != 0) return true;
+
+    const int size = LLZ_BG_GLOW_SPRITE_SIZE;
+    Color *pixels = (Color *)malloc((size_t)size * 2 * size * sizeof(Color));
+    if (!pixels) return false;
+
+    float radius = size * 0.5f;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            float dx = (float)x + 0.5f - radius;
+            float dy = (float)y + 0.5f - radius;
+            float dist = sqrtf(dx * dx + dy * dy);
+            unsigned char glow = (unsigned char)(Clamp01(1.0f - dist / radius) * 255.0f + 0.5f);
+            unsigned char disc = (unsigned char)(Clamp01(radius - dist) * 255.0f + 0.5f);
+            pixels[y * size * 2 + x] = (Color){255, 255, 255, glow};
+            pixels[y * size * 2 + size + x] = (Color){255, 255, 255, disc};
+        }
+    }
+
+    Image image = {
+        .data = pixels,
+        .width = size * 2,
+        .height = size,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+    g_bg.glowSprite = LoadTextureFromImage(image);
+    free(pixels);
+    if (g_bg.glowSprite.id == 0) return false;
+
+    SetTextureFilter(g_bg.glowSprite, TEXTURE_FILTER_BILINEAR);
+    LlzResourceTrack("background", LLZ_RESOURCE_TEXTURE, g_bg.glowSprite.id,
+                     LlzResourceTextureBytes(g_bg.glowSprite));
+    return true;
+}
+
+static void DrawSpriteCell(int cell, float x, float y, float radius, Color color)
+{
+    const float size = (float)LLZ_BG_GLOW_SPRITE_SIZE;
+    Rectangle src = {size * (float)cell, 0.0f, size, size};
+    Rectangle dst = {x - radius, y - radius, radius * 2.0f, radius * 2.0f};
+    DrawTexturePro(g_bg.glowSprite, src, dst, (Vector2){0.0f, 0.0f}, 0.0f, color);
+}
+
+// Radial gradient from inner at the centre to transparent at the radius
+static void DrawGlow(float x, float y, float radius, Color inner)
+{
+    if (inner.a == 0 || radius <= 0.0f) return;
+    if (!g_bg.cacheEnabled || !LoadGlowSprite()) {
+        DrawCircleGradient((int)x, (int)y, radius, inner, ColorAlpha(inner, 0.0f));
+        return;
+    }
+    DrawSpriteCell(0, x, y, radius, inner);
+}
+
+// Radial gradient between two alphas of one colour: a disc at the outer
+// alpha with a glow on top making up the difference at the centre
+static void DrawGlowEx(float x, float y, float radius, Color inner, Color outer)
+{
+    if (radius <= 0.0f) return;
+    if (!g_bg.cacheEnabled || !LoadGlowSprite()) {
+        DrawCircleGradient((int)x, (int)y, radius, inner, outer);
+        return;
+    }
+
+    float outerA = outer.a / 255.0f;
+    float innerA = inner.a / 255.0f;
+    if (outer.a > 0) DrawSpriteCell(1, x, y, radius, outer);
+    if (innerA > outerA && outerA < 1.0f) {
+        DrawSpriteCell(0, x, y, radius, ColorAlpha(inner, (innerA - outerA) / (1.0f - outerA)));
+    }
+}
+
+// Solid disc from the sprite's disc cell: two triangles instead of 36
+static void DrawDisc(Vector2 center, float radius, Color color)
+{
+    if (!g_bg.cacheEnabled || !LoadGlowSprite()) {
+        DrawCircleV(center, radius, color);
+        return;
+    }
+    DrawSpriteCell(1, center.x, center.y, radius, color);
 }
 
 // === Background Drawing Functions ===
@@ -160,13 +311,12 @@ static void DrawPulse(float alpha)
                       (float)g_bg.screenHeight * (0.45f + 0.05f * sinf(g_bg.time * 0.2f))};
     float radius = 380.0f + 60.0f * pulse;
     Color tint = PaletteColor(0, alpha * (0.12f + 0.08f * pulse));
-    DrawCircleGradient((int)center.x, (int)center.y, radius, tint, ColorAlpha(tint, 0.0f));
+    DrawGlow(center.x, center.y, radius, tint);
 
     Color highlight = PaletteColor(1, alpha * (0.08f + 0.04f * pulse2));
     float ox = 80.0f * sinf(g_bg.time * 0.15f);
     float oy = 50.0f * cosf(g_bg.time * 0.12f);
-    DrawCircleGradient((int)(center.x + ox), (int)(center.y + oy),
-                       200.0f + 30.0f * pulse2, highlight, ColorAlpha(highlight, 0.0f));
+    DrawGlow(center.x + ox, center.y + oy, 200.0f + 30.0f * pulse2, highlight);
 }
 
 static void DrawAurora(float alpha)
@@ -215,7 +365,7 @@ static void DrawRadial(float alpha)
 
     float pulse = 0.5f + 0.5f * sinf(g_bg.time * 0.3f);
     Color glow = PaletteColor(0, alpha * (0.06f + 0.03f * pulse));
-    DrawCircleGradient((int)center.x, (int)center.y, 180.0f, glow, ColorAlpha(glow, 0.0f));
+    DrawGlow(center.x, center.y, 180.0f, glow);
 }
 
 static void DrawWave(float alpha)
@@ -267,7 +417,7 @@ static void DrawBgGrid(float alpha)
         float glowX = fmodf(g_bg.styleSeedA * g_bg.screenWidth + i * 200.0f + scroll, g_bg.screenWidth);
         float glowY = fmodf(g_bg.styleSeedB * g_bg.screenHeight + i * 150.0f + scroll * 0.7f, g_bg.screenHeight);
         Color glowColor = PaletteColor(i, alpha * 0.04f * pulse);
-        DrawCircleGradient((int)glowX, (int)glowY, 60.0f, glowColor, ColorAlpha(glowColor, 0.0f));
+        DrawGlow(glowX, glowY, 60.0f, glowColor);
     }
 }
 
@@ -288,8 +438,8 @@ static void DrawBlur(float alpha)
         prevAlpha = g_bg.blurPrevAlpha;
     } else {
         // Use auto-managed textures from Redis album art
-        currentTex = g_bg.autoBlurTexture;
-        prevTex = g_bg.autoPrevBlurTexture;
+        currentTex = LlzArtCacheGetTexture(g_bg.autoBlurArt);
+        prevTex = LlzArtCacheGetTexture(g_bg.autoPrevBlurArt);
         currentAlpha = g_bg.autoBlurCurrentAlpha;
         prevAlpha = g_bg.autoBlurPrevAlpha;
     }
@@ -314,16 +464,11 @@ static void DrawBlur(float alpha)
     }
 }
 
-static void DrawConstellation(float alpha)
-{
-    if (alpha <= 0.01f) return;
-    Rectangle screen = {0, 0, (float)g_bg.screenWidth, (float)g_bg.screenHeight};
-    DrawRectangleRec(screen, PaletteColor(5, alpha));
+#define CONSTELLATION_POINTS 12
 
-    #define CONSTELLATION_POINTS 12
-    Vector2 points[CONSTELLATION_POINTS];
+static void ConstellationPoints(Vector2 *points)
+{
     float time = g_bg.time;
-
     for (int i = 0; i < CONSTELLATION_POINTS; i++) {
         float seed = (float)i * 0.7f + g_bg.styleSeedA * 3.0f;
         float xBase = (float)g_bg.screenWidth * (0.1f + 0.8f * ((float)(i % 4) / 3.0f));
@@ -334,6 +479,33 @@ static void DrawConstellation(float alpha)
 
         points[i] = (Vector2){xBase + xOff, yBase + yOff};
     }
+}
+
+// Base fill and star glows: soft, so they can go in the layer
+static void DrawConstellationGlow(float alpha)
+{
+    if (alpha <= 0.01f) return;
+    Rectangle screen = {0, 0, (float)g_bg.screenWidth, (float)g_bg.screenHeight};
+    DrawRectangleRec(screen, PaletteColor(5, alpha));
+
+    Vector2 points[CONSTELLATION_POINTS];
+    ConstellationPoints(points);
+    for (int i = 0; i < CONSTELLATION_POINTS; i++) {
+        float pulse = 0.6f + 0.4f * sinf(g_bg.time * 0.4f + (float)i * 0.8f);
+        Color glowColor = PaletteColor(i % 4, alpha * 0.04f * pulse);
+        DrawGlow(points[i].x, points[i].y, 25.0f + 10.0f * pulse, glowColor);
+    }
+}
+
+// Connecting lines and star discs: 1.5px lines and 3-5px stars that the
+// layer's upscale would smear, so they are always drawn at screen resolution
+static void DrawConstellationDetail(float alpha)
+{
+    if (alpha <= 0.01f) return;
+
+    Vector2 points[CONSTELLATION_POINTS];
+    ConstellationPoints(points);
+    float time = g_bg.time;
 
     float connectionDist = 180.0f;
     for (int i = 0; i < CONSTELLATION_POINTS; i++) {
@@ -355,15 +527,16 @@ static void DrawConstellation(float alpha)
         float pulse = 0.6f + 0.4f * sinf(time * 0.4f + (float)i * 0.8f);
         float radius = 3.0f + 2.0f * pulse;
         Color starColor = PaletteColor(i % 4, alpha * (0.15f + 0.1f * pulse));
-
-        DrawCircleV(points[i], radius, starColor);
-
-        Color glowColor = PaletteColor(i % 4, alpha * 0.04f * pulse);
-        DrawCircleGradient((int)points[i].x, (int)points[i].y, 25.0f + 10.0f * pulse,
-                           glowColor, ColorAlpha(glowColor, 0.0f));
+        DrawDisc(points[i], radius, starColor);
     }
+}
+
+#undef CONSTELLATION_POINTS
 
-    #undef CONSTELLATION_POINTS
+static void DrawConstellation(float alpha)
+{
+    DrawConstellationGlow(alpha);
+    DrawConstellationDetail(alpha);
 }
 
 static void DrawLiquid(float alpha)
@@ -397,10 +570,10 @@ static void DrawLiquid(float alpha)
         float radius = blobs[i].radiusBase + blobs[i].radiusMod * radiusPulse;
 
         Color blobColor = PaletteColor(blobs[i].colorIdx, alpha * 0.08f);
-        DrawCircleGradient((int)x, (int)y, radius, blobColor, ColorAlpha(blobColor, 0.0f));
+        DrawGlow(x, y, radius, blobColor);
 
         Color innerColor = PaletteColor((blobs[i].colorIdx + 1) % 5, alpha * 0.05f);
-        DrawCircleGradient((int)x, (int)y, radius * 0.4f, innerColor, ColorAlpha(innerColor, 0.0f));
+        DrawGlow(x, y, radius * 0.4f, innerColor);
     }
 
     #undef LIQUID_BLOBS
@@ -437,17 +610,13 @@ static void DrawBokeh(float alpha)
         float depthAlpha = 0.04f + 0.03f * (float)(i % 4) / 3.0f;
         Color bokehColor = PaletteColor(i % 5, alpha * depthAlpha);
 
-        DrawCircleGradient((int)x, (int)y, radius * 1.3f,
-                           ColorAlpha(bokehColor, 0.0f), ColorAlpha(bokehColor, 0.0f));
-
         Color centerColor = PaletteColor(i % 5, alpha * depthAlpha * 1.2f);
-        DrawCircleGradient((int)x, (int)y, radius, centerColor, bokehColor);
+        DrawGlowEx(x, y, radius, centerColor, bokehColor);
 
         Color highlightColor = PaletteColor((i + 1) % 5, alpha * depthAlpha * 0.3f);
         float hlX = x - radius * 0.25f;
         float hlY = y - radius * 0.25f;
-        DrawCircleGradient((int)hlX, (int)hlY, radius * 0.2f,
-                           highlightColor, ColorAlpha(highlightColor, 0.0f));
+        DrawGlow(hlX, hlY, radius * 0.2f, highlightColor);
     }
 
     #undef BOKEH_COUNT
@@ -469,188 +638,229 @@ static void DrawStyle(LlzBackgroundStyle style, float alpha)
     }
 }
 
-// === Public API Implementation ===
-
-void LlzBackgroundInit(int screenWidth, int screenHeight)
+// The part of a layered style that goes in the layer. Most styles go in
+// whole; constellation keeps its sharp lines and stars out.
+static void DrawStyleSoft(LlzBackgroundStyle style, float alpha)
 {
-    memset(&g_bg, 0, sizeof(g_bg));
-    g_bg.screenWidth = screenWidth;
-    g_bg.screenHeight = screenHeight;
-    g_bg.currentStyle = LLZ_BG_STYLE_PULSE;
-    g_bg.targetStyle = LLZ_BG_STYLE_PULSE;
-    g_bg.energy = 1.0f;
-    g_bg.initialized = true;
+    if (style == LLZ_BG_STYLE_CONSTELLATION) DrawConstellationGlow(alpha);
+    else DrawStyle(style, alpha);
+}
 
-    // Enable auto-blur tracking by default
-    g_bg.autoBlurEnabled = true;
-    g_bg.autoBlurCurrentAlpha = 1.0f;
+// The rest of a layered style, drawn directly over the upscaled layer
+static void DrawStyleDetail(LlzBackgroundStyle style, float alpha)
+{
+    if (style == LLZ_BG_STYLE_CONSTELLATION) DrawConstellationDetail(alpha);
+}
 
-    GeneratePalette();
+// === Cached Layer ===
 
-    printf("[SDK] Background system initialized (%dx%d)\n", screenWidth, screenHeight);
+static void UnloadLayer(void)
+{
+    if (g_bg.layer.id == 0) return;
+    LlzResourceUntrack(LLZ_RESOURCE_RENDER_TEXTURE, g_bg.layer.id);
+    UnloadRenderTexture(g_bg.layer);
+    g_bg.layer = (RenderTexture2D){0};
+    g_bg.layerValid = false;
 }
 
-void LlzBackgroundShutdown(void)
+static bool LoadLayer(void)
 {
-    // Cleanup auto-managed textures
-    if (g_bg.autoBlurTexture.id != 0) {
-        UnloadTexture(g_bg.autoBlurTexture);
-    }
-    if (g_bg.autoPrevBlurTexture.id != 0) {
-        UnloadTexture(g_bg.autoPrevBlurTexture);
-    }
+    if (g_bg.layer.id != 0) return true;
 
-    memset(&g_bg, 0, sizeof(g_bg));
-    printf("[SDK] Background system shutdown\n");
+    int width = (int)((float)g_bg.screenWidth * LLZ_BG_LAYER_SCALE);
+    int height = (int)((float)g_bg.screenHeight * LLZ_BG_LAYER_SCALE);
+    if (width <= 0 || height <= 0) return false;
+
+    g_bg.layer = LoadRenderTexture(width, height);
+    if (g_bg.layer.id == 0) {
+        printf("[SDK_BG] Failed to create %dx%d background layer, drawing direct\n", width, height);
+        g_bg.layerSuspended = true;
+        return false;
+    }
+    SetTextureFilter(g_bg.layer.texture, TEXTURE_FILTER_BILINEAR);
+    LlzResourceTrack("background", LLZ_RESOURCE_RENDER_TEXTURE, g_bg.layer.id,
+                     LlzResourceTextureBytes(g_bg.layer.texture));
+    g_bg.layerValid = false;
+    return true;
 }
 
-// Internal: Check if file exists
-static bool FileExistsInternal(const char *path)
+// Redraw the style into the layer at full opacity. The separate alpha blend
+// keeps the layer opaque where the style's translucent shapes overlap its
+// base, so compositing it does not let the frame's black clear through.
+static bool RenderLayer(LlzBackgroundStyle style)
 {
-    struct stat st;
-    return stat(path, &st) == 0;
+    if (!LlzDisplayBeginOffscreen(g_bg.layer)) return false;
+
+    uint64_t span = LlzProfilerSpanBegin();
+    ClearBackground(BLANK);
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    rlPushMatrix();
+    rlScalef((float)g_bg.layer.texture.width / (float)g_bg.screenWidth,
+             (float)g_bg.layer.texture.height / (float)g_bg.screenHeight, 1.0f);
+    DrawStyleSoft(style, 1.0f);
+    rlPopMatrix();
+    EndBlendMode();
+    LlzProfilerSpanEnd("bg layer", span);
+
+    LlzDisplayEndOffscreen();
+    g_bg.layerStyle = style;
+    g_bg.layerValid = true;
+    g_bg.layerAge = 0.0f;
+    return true;
 }
 
-// Internal: Check if file path has WebP extension
-static bool IsWebPFile(const char *path)
+// Draw a slow style from the layer, redrawing the layer at LLZ_BG_LAYER_FPS.
+// Returns false when the style has to be drawn directly.
+static bool DrawStyleLayered(LlzBackgroundStyle style)
 {
-    if (!path) return false;
-    size_t len = strlen(path);
-    if (len < 5) return false;
-    const char *ext = path + len - 5;
-    return (strcmp(ext, ".webp") == 0 || strcmp(ext, ".WEBP") == 0);
+    if (!g_bg.cacheEnabled || g_bg.layerSuspended || !kStyleLayered[style]) return false;
+    if (!LoadLayer()) return false;
+
+    bool stale = !g_bg.layerValid || g_bg.layerStyle != style ||
+                 g_bg.layerAge >= 1.0f / LLZ_BG_LAYER_FPS;
+    if (stale && !RenderLayer(style)) return false;
+
+    Texture2D tex = g_bg.layer.texture;
+    Rectangle src = {0.0f, 0.0f, (float)tex.width, -(float)tex.height};
+    Rectangle dst = {0.0f, 0.0f, (float)g_bg.screenWidth, (float)g_bg.screenHeight};
+    DrawTexturePro(tex, src, dst, (Vector2){0.0f, 0.0f}, 0.0f, WHITE);
+    DrawStyleDetail(style, 1.0f);
+    return true;
 }
 
-// Internal: Load WebP image file and convert to raylib Image format
-// (raylib doesn't support WebP natively, so we use libwebp)
-static Image LoadImageWebP(const char *path)
+// Internal: Resource registry evictor. The background only holds art cache
+// references, so it drops the ones it is not drawing and the art cache
+// evictor (registered after it) frees the textures.
+static size_t EvictBackgroundArt(LlzResourceDomain domain, size_t bytes, bool hard, void *user)
 {
-    Image image = {0};
-
-    FILE *file = fopen(path, "rb");
-    if (!file) {
-        printf("[SDK_BG] LoadImageWebP: failed to open file '%s'\n", path);
-        return image;
+    (void)bytes;
+    (void)user;
+    if (domain != LLZ_RESOURCE_GPU) return 0;
+
+    // Over the hard budget the layer goes too; the style is drawn directly
+    // until it changes, so the layer is not recreated on the next frame
+    size_t freed = 0;
+    if (hard && g_bg.layer.id != 0) {
+        freed = LlzResourceTextureBytes(g_bg.layer.texture);
+        UnloadLayer();
+        g_bg.layerSuspended = true;
     }
 
-    // Get file size
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    // Read file data
-    uint8_t *fileData = (uint8_t *)malloc(fileSize);
-    if (!fileData) {
-        printf("[SDK_BG] LoadImageWebP: failed to allocate %ld bytes\n", fileSize);
-        fclose(file);
-        return image;
+    // Previous art outside a crossfade is invisible
+    if (g_bg.autoPrevBlurArt != 0 && !g_bg.autoBlurInTransition) {
+        LlzArtCacheRelease(g_bg.autoPrevBlurArt);
+        g_bg.autoPrevBlurArt = 0;
+        g_bg.autoBlurPrevAlpha = 0.0f;
     }
 
-    size_t bytesRead = fread(fileData, 1, fileSize, file);
-    fclose(file);
-
-    if (bytesRead != (size_t)fileSize) {
-        printf("[SDK_BG] LoadImageWebP: read %zu bytes, expected %ld\n", bytesRead, fileSize);
-        free(fileData);
-        return image;
+    // Away from the blur style nothing is drawn; clearing the loaded path
+    // requests the art again when the style comes back
+    bool blurShown = g_bg.currentStyle == LLZ_BG_STYLE_BLUR || g_bg.targetStyle == LLZ_BG_STYLE_BLUR;
+    if (!blurShown && (g_bg.autoBlurArt != 0 || g_bg.autoPendingArt != 0)) {
+        LlzArtCacheRelease(g_bg.autoBlurArt);
+        LlzArtCacheRelease(g_bg.autoPrevBlurArt);
+        LlzArtCacheRelease(g_bg.autoPendingArt);
+        g_bg.autoBlurArt = 0;
+        g_bg.autoPrevBlurArt = 0;
+        g_bg.autoPendingArt = 0;
+        g_bg.autoAlbumArtPath[0] = '\0';
+        g_bg.autoPendingArtPath[0] = '\0';
+        g_bg.autoMediaSeqValid = false;
+        g_bg.autoBlurInTransition = false;
     }
+    return freed;
+}
 
-    // Decode WebP
-    int width = 0, height = 0;
-    uint8_t *rgbaData = WebPDecodeRGBA(fileData, fileSize, &width, &height);
-    free(fileData);
+// === Public API Implementation ===
 
-    if (!rgbaData) {
-        printf("[SDK_BG] LoadImageWebP: WebPDecodeRGBA failed\n");
-        return image;
-    }
+void LlzBackgroundInit(int screenWidth, int screenHeight)
+{
+    memset(&g_bg, 0, sizeof(g_bg));
+    g_bg.screenWidth = screenWidth;
+    g_bg.screenHeight = screenHeight;
+    g_bg.currentStyle = LLZ_BG_STYLE_PULSE;
+    g_bg.targetStyle = LLZ_BG_STYLE_PULSE;
+    g_bg.energy = 1.0f;
+    g_bg.initialized = true;
 
-    // Create raylib Image from RGBA data
-    // We need to copy the data because WebP uses its own allocator
-    size_t dataSize = width * height * 4;
-    void *imageCopy = RL_MALLOC(dataSize);
-    if (!imageCopy) {
-        printf("[SDK_BG] LoadImageWebP: failed to allocate image data\n");
-        WebPFree(rgbaData);
-        return image;
-    }
-    memcpy(imageCopy, rgbaData, dataSize);
-    WebPFree(rgbaData);
+    // Enable auto-blur tracking by default
+    g_bg.autoBlurEnabled = true;
+    g_bg.autoBlurCurrentAlpha = 1.0f;
+
+    const char *cacheEnv = getenv("LLZ_BG_CACHE");
+    g_bg.cacheEnabled = !(cacheEnv && cacheEnv[0] == '0');
 
-    image.data = imageCopy;
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    GeneratePalette();
+    LlzResourceRegisterEvictor(EvictBackgroundArt, NULL);
 
-    printf("[SDK_BG] LoadImageWebP: decoded %dx%d image\n", width, height);
-    return image;
+    printf("[SDK] Background system initialized (%dx%d)\n", screenWidth, screenHeight);
 }
 
-// Internal: Load album art from path and create blurred texture
-static bool LoadAutoBlurTexture(const char *path)
+void LlzBackgroundShutdown(void)
 {
-    if (!path || path[0] == '\0') return false;
-    if (!FileExistsInternal(path)) {
-        printf("[SDK_BG] Album art file not found: %s\n", path);
-        return false;
-    }
+    LlzResourceUnregisterEvictor(EvictBackgroundArt, NULL);
 
-    printf("[SDK_BG] Loading album art: %s\n", path);
+    // Release auto-managed album art
+    LlzArtCacheRelease(g_bg.autoPendingArt);
+    LlzArtCacheRelease(g_bg.autoBlurArt);
+    LlzArtCacheRelease(g_bg.autoPrevBlurArt);
 
-    // Load the image - use WebP decoder for .webp files
-    Image img;
-    if (IsWebPFile(path)) {
-        printf("[SDK_BG] Using WebP decoder for: %s\n", path);
-        img = LoadImageWebP(path);
-    } else {
-        img = LoadImage(path);
+    UnloadLayer();
+    if (g_bg.glowSprite.id != 0) {
+        LlzResourceUntrack(LLZ_RESOURCE_TEXTURE, g_bg.glowSprite.id);
+        UnloadTexture(g_bg.glowSprite);
     }
 
-    if (img.data == NULL) {
-        printf("[SDK_BG] Failed to load album art image: %s\n", path);
-        return false;
-    }
+    memset(&g_bg, 0, sizeof(g_bg));
+    printf("[SDK] Background system shutdown\n");
+}
 
-    // Validate image dimensions
-    if (img.width <= 0 || img.height <= 0) {
-        printf("[SDK_BG] Invalid image dimensions: %dx%d\n", img.width, img.height);
-        UnloadImage(img);
-        return false;
-    }
+// Internal: Request the blurred album art from the shared art cache.
+// The crossfade starts in PollAutoBlurArt once the texture is uploaded.
+static void RequestAutoBlurTexture(const char *path)
+{
+    if (!path || path[0] == '\0') return;
 
-    // Create texture from image
-    Texture2D tex = LoadTextureFromImage(img);
-    UnloadImage(img);
+    // Already waiting for this path
+    if (g_bg.autoPendingArt != 0 && strcmp(g_bg.autoPendingArtPath, path) == 0) return;
 
-    if (tex.id == 0) {
-        printf("[SDK_BG] Failed to create texture from album art: %s\n", path);
-        return false;
-    }
+    LlzArtCacheRelease(g_bg.autoPendingArt);
+    g_bg.autoPendingArt = LlzArtCacheAcquirePath(path, LLZ_ART_VARIANT_BLUR);
+    if (g_bg.autoPendingArt == 0) return;
 
-    // Create blurred version
-    Texture2D blurred = LlzTextureBlur(tex, 15, 0.4f);
-    UnloadTexture(tex);
+    strncpy(g_bg.autoPendingArtPath, path, sizeof(g_bg.autoPendingArtPath) - 1);
+    g_bg.autoPendingArtPath[sizeof(g_bg.autoPendingArtPath) - 1] = '\0';
+    printf("[SDK_BG] Loading album art: %s\n", path);
+}
 
-    if (blurred.id == 0) {
-        printf("[SDK_BG] Failed to create blurred texture from album art: %s\n", path);
-        return false;
-    }
+// Internal: Start the crossfade once the pending art is loaded. Art that is
+// not downloaded yet stays pending; the cache retries it.
+static void PollAutoBlurArt(void)
+{
+    if (g_bg.autoPendingArt == 0 || !LlzArtCacheIsReady(g_bg.autoPendingArt)) return;
 
     // Move current to previous for crossfade
-    if (g_bg.autoPrevBlurTexture.id != 0) {
-        UnloadTexture(g_bg.autoPrevBlurTexture);
-    }
-    g_bg.autoPrevBlurTexture = g_bg.autoBlurTexture;
+    LlzArtCacheRelease(g_bg.autoPrevBlurArt);
+    g_bg.autoPrevBlurArt = g_bg.autoBlurArt;
     g_bg.autoBlurPrevAlpha = g_bg.autoBlurCurrentAlpha;
 
-    // Set new current texture
-    g_bg.autoBlurTexture = blurred;
+    // Set new current art
+    g_bg.autoBlurArt = g_bg.autoPendingArt;
+    g_bg.autoPendingArt = 0;
     g_bg.autoBlurCurrentAlpha = 0.0f;  // Start faded out, will fade in
     g_bg.autoBlurInTransition = true;
 
-    printf("[SDK_BG] Loaded and blurred album art: %s\n", path);
-    return true;
+    strncpy(g_bg.autoAlbumArtPath, g_bg.autoPendingArtPath, sizeof(g_bg.autoAlbumArtPath) - 1);
+    g_bg.autoAlbumArtPath[sizeof(g_bg.autoAlbumArtPath) - 1] = '\0';
+    printf("[SDK_BG] Loaded and blurred album art: %s\n", g_bg.autoAlbumArtPath);
+
+    // Tint the palette (and the menu themes reading it) to match the art
+    LlzPalette palette;
+    if (LlzArtCacheGetPalette(g_bg.autoBlurArt, &palette) && palette.valid) {
+        LlzBackgroundSetPalette(&palette);
+    }
 }
 
 // Internal: Update auto-blur album art tracking from Redis
@@ -664,6 +874,9 @@ static void UpdateAutoBlurFromRedis(float deltaTime)
         return;
     }
 
+    // Pick up art loaded by the cache since the last frame
+    PollAutoBlurArt();
+
     // Poll Redis every 0.5 seconds to check for album art changes
     g_bg.autoBlurPollTimer += deltaTime;
     if (g_bg.autoBlurPollTimer < 0.5f) {
@@ -672,6 +885,14 @@ static void UpdateAutoBlurFromRedis(float deltaTime)
     }
     g_bg.autoBlurPollTimer = 0.0f;
 
+    // Skip the path work when the media snapshot is unchanged, unless a
+    // previous load failed and still needs retrying
+    uint32_t mediaSeq = LlzMediaGetStateSequence();
+    if (g_bg.autoMediaSeqValid && mediaSeq == g_bg.autoMediaSeq &&
+        strcmp(g_bg.autoDesiredArtPath, g_bg.autoAlbumArtPath) == 0) {
+        goto update_transition;
+    }
+
     // Get current media state from Redis (safe even if not initialized)
     LlzMediaState media;
     memset(&media, 0, sizeof(media));
@@ -679,6 +900,8 @@ static void UpdateAutoBlurFromRedis(float deltaTime)
         // Redis not available or error - keep current state
         goto update_transition;
     }
+    g_bg.autoMediaSeq = mediaSeq;
+    g_bg.autoMediaSeqValid = true;
 
     // Determine album art path - use albumArtPath if available, otherwise generate from artist/album
     char effectivePath[512] = {0};
@@ -689,7 +912,7 @@ static void UpdateAutoBlurFromRedis(float deltaTime)
         const char *hash = LlzMediaGenerateArtHash(media.artist, media.album);
         if (hash && hash[0] != '\0') {
             snprintf(effectivePath, sizeof(effectivePath),
-                     "/var/mediadash/album_art_cache/%s.webp", hash);
+                     "%s/%s.webp", LLZ_ART_CACHE_DIR, hash);
         }
     }
 
@@ -703,23 +926,19 @@ static void UpdateAutoBlurFromRedis(float deltaTime)
 
     if (needsLoad) {
         if (effectivePath[0] != '\0') {
-            // Try to load new album art
-            if (LoadAutoBlurTexture(effectivePath)) {
-                // Success - update the loaded path
-                strncpy(g_bg.autoAlbumArtPath, effectivePath, sizeof(g_bg.autoAlbumArtPath) - 1);
-                g_bg.autoAlbumArtPath[sizeof(g_bg.autoAlbumArtPath) - 1] = '\0';
-            }
-            // If load fails, we'll retry on next poll (autoAlbumArtPath stays unchanged)
+            // Request new album art; autoAlbumArtPath is updated once it
+            // is loaded, so the old art stays up until then
+            RequestAutoBlurTexture(effectivePath);
         } else {
             // Album art removed - fade out current
+            LlzArtCacheRelease(g_bg.autoPendingArt);
+            g_bg.autoPendingArt = 0;
             g_bg.autoAlbumArtPath[0] = '\0';  // Clear loaded path
-            if (g_bg.autoBlurTexture.id != 0) {
-                if (g_bg.autoPrevBlurTexture.id != 0) {
-                    UnloadTexture(g_bg.autoPrevBlurTexture);
-                }
-                g_bg.autoPrevBlurTexture = g_bg.autoBlurTexture;
+            if (g_bg.autoBlurArt != 0) {
+                LlzArtCacheRelease(g_bg.autoPrevBlurArt);
+                g_bg.autoPrevBlurArt = g_bg.autoBlurArt;
                 g_bg.autoBlurPrevAlpha = g_bg.autoBlurCurrentAlpha;
-                g_bg.autoBlurTexture = (Texture2D){0};
+                g_bg.autoBlurArt = 0;
                 g_bg.autoBlurCurrentAlpha = 0.0f;
                 g_bg.autoBlurInTransition = true;
             }
@@ -730,7 +949,7 @@ update_transition:
     // Update crossfade transition
     if (g_bg.autoBlurInTransition) {
         // Fade in current
-        if (g_bg.autoBlurTexture.id != 0 && g_bg.autoBlurCurrentAlpha < 1.0f) {
+        if (g_bg.autoBlurArt != 0 && g_bg.autoBlurCurrentAlpha < 1.0f) {
             g_bg.autoBlurCurrentAlpha += deltaTime * AUTO_BLUR_FADE_SPEED;
             if (g_bg.autoBlurCurrentAlpha > 1.0f) {
                 g_bg.autoBlurCurrentAlpha = 1.0f;
@@ -742,17 +961,15 @@ update_transition:
             g_bg.autoBlurPrevAlpha -= deltaTime * AUTO_BLUR_FADE_SPEED;
             if (g_bg.autoBlurPrevAlpha <= 0.0f) {
                 g_bg.autoBlurPrevAlpha = 0.0f;
-                // Cleanup previous texture when fully faded
-                if (g_bg.autoPrevBlurTexture.id != 0) {
-                    UnloadTexture(g_bg.autoPrevBlurTexture);
-                    g_bg.autoPrevBlurTexture = (Texture2D){0};
-                }
+                // Release previous art when fully faded
+                LlzArtCacheRelease(g_bg.autoPrevBlurArt);
+                g_bg.autoPrevBlurArt = 0;
             }
         }
 
         // Check if transition complete
-        bool currentDone = (g_bg.autoBlurTexture.id == 0) || (g_bg.autoBlurCurrentAlpha >= 1.0f);
-        bool prevDone = (g_bg.autoPrevBlurTexture.id == 0) || (g_bg.autoBlurPrevAlpha <= 0.0f);
+        bool currentDone = (g_bg.autoBlurArt == 0) || (g_bg.autoBlurCurrentAlpha >= 1.0f);
+        bool prevDone = (g_bg.autoPrevBlurArt == 0) || (g_bg.autoBlurPrevAlpha <= 0.0f);
         if (currentDone && prevDone) {
             g_bg.autoBlurInTransition = false;
         }
@@ -764,6 +981,7 @@ void LlzBackgroundUpdate(float deltaTime)
     if (!g_bg.initialized) return;
 
     g_bg.time += deltaTime;
+    g_bg.layerAge += deltaTime;
 
     // Update auto-blur album art tracking
     UpdateAutoBlurFromRedis(deltaTime);
@@ -801,18 +1019,29 @@ void LlzBackgroundDraw(void)
 {
     if (!g_bg.initialized || !g_bg.enabled) return;
 
+    // Transitions are short and fade two styles, so they draw directly
+    uint64_t span = LlzProfilerSpanBegin();
     if (g_bg.inTransition) {
         DrawStyle(g_bg.currentStyle, Clamp01(1.0f - g_bg.transition));
         DrawStyle(g_bg.targetStyle, Clamp01(g_bg.transition));
-    } else {
+    } else if (!DrawStyleLayered(g_bg.currentStyle)) {
         DrawStyle(g_bg.currentStyle, 1.0f);
     }
+    LlzProfilerSpanEnd(kStyleSpans[g_bg.inTransition ? g_bg.targetStyle : g_bg.currentStyle], span);
 
     // Flash overlay on transition
     if (g_bg.flashStrength > 0.01f) {
         Color flash = ColorAlpha(g_bg.palette.colors[1], 0.1f * g_bg.flashStrength);
         DrawRectangleRec((Rectangle){0, 0, (float)g_bg.screenWidth, (float)g_bg.screenHeight}, flash);
     }
+
+    // Transitions and crossfades run at full rate; the animated styles are
+    // ambient and keep moving at the governor's idle rate; a settled blur is static
+    if (g_bg.inTransition || g_bg.flashStrength > 0.01f || g_bg.autoBlurInTransition) {
+        LlzGovernorRequestAnimation(0.0f);
+    } else if (g_bg.currentStyle != LLZ_BG_STYLE_BLUR) {
+        LlzGovernorRequestRedraw();
+    }
 }
 
 void LlzBackgroundDrawIndicator(void)
@@ -847,6 +1076,7 @@ void LlzBackgroundDrawIndicator(void)
     char detail[32];
     snprintf(detail, sizeof(detail), "Style %d/%d", g_bg.targetStyle + 1, LLZ_BG_STYLE_COUNT);
     DrawText(detail, (int)(panel.x + 20), (int)(panel.y + 40), 16, detailColor);
+    LlzGovernorRequestAnimation(0.0f);
 }
 
 void LlzBackgroundCycleNext(void)
@@ -863,6 +1093,7 @@ void LlzBackgroundCycleNext(void)
     GeneratePalette();
 
     g_bg.targetStyle = (g_bg.currentStyle + 1) % LLZ_BG_STYLE_COUNT;
+    g_bg.layerSuspended = false;
     g_bg.transition = 0.0f;
     g_bg.enabled = true;
     g_bg.inTransition = true;
@@ -881,6 +1112,7 @@ void LlzBackgroundCycleNext(void)
 void LlzBackgroundSetStyle(LlzBackgroundStyle style, bool animate)
 {
     if (!g_bg.initialized || style >= LLZ_BG_STYLE_COUNT) return;
+    if (style != g_bg.targetStyle) g_bg.layerSuspended = false;
 
     if (animate) {
         if (g_bg.inTransition) {
@@ -922,11 +1154,28 @@ void LlzBackgroundSetEnabled(bool enabled)
 void LlzBackgroundSetColors(Color primary, Color accent)
 {
     g_bg.hasCustomColors = true;
+    g_bg.hasArtPalette = false;
     g_bg.customPrimary = primary;
     g_bg.customAccent = accent;
     GeneratePalette();
 }
 
+void LlzBackgroundSetPalette(const LlzPalette *palette)
+{
+    if (!palette || !palette->valid) {
+        LlzBackgroundClearColors();
+        return;
+    }
+
+    g_bg.hasCustomColors = true;
+    g_bg.hasArtPalette = true;
+    g_bg.customPrimary = palette->dominant;
+    g_bg.customAccent = palette->vibrant;
+    g_bg.customMuted = palette->muted;
+    g_bg.customDarkMuted = palette->darkMuted;
+    GeneratePalette();
+}
+
 void LlzBackgroundClearColors(void)
 {
     g_bg.hasCustomColors = false;
@@ -958,6 +1207,18 @@ void LlzBackgroundSetAutoBlurEnabled(bool enabled)
     g_bg.autoBlurEnabled = enabled;
 }
 
+void LlzBackgroundSetCacheEnabled(bool enabled)
+{
+    g_bg.cacheEnabled = enabled;
+    g_bg.layerSuspended = false;
+    if (!enabled) UnloadLayer();
+}
+
+bool LlzBackgroundIsCacheEnabled(void)
+{
+    return g_bg.cacheEnabled;
+}
+
 void LlzBackgroundSetEnergy(float energy)
 {
     g_bg.energy = Clamp01(energy);
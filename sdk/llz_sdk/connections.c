@@ -1,7 +1,10 @@
 #include "llz_sdk_connections.h"
+#include "media_internal.h"
+#include "redis_internal.h"
 
 #include "hiredis.h"
 
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,8 +14,7 @@
 // Redis Keys
 // ============================================================================
 
-// Uses the standard playback command queue for connection status requests
-#define REDIS_KEY_PLAYBACK_CMD_Q      "system:playback_cmd_q"
+// Connection status requests go out through the media command outbox
 #define REDIS_KEY_CONNECTIONS_PREFIX  "connections:"
 #define REDIS_KEY_CONN_SPOTIFY        "connections:spotify"
 #define REDIS_KEY_CONN_TIMESTAMP      "connections:timestamp"
@@ -22,7 +24,6 @@
 // Internal State
 // ============================================================================
 
-static redisContext *g_connCtx = NULL;
 static LlzConnectionsState g_state;
 static LlzConnectionsConfig g_config;
 static float g_timeSinceLastCheck = 0.0f;
@@ -46,59 +47,14 @@ static const char *g_stateStrings[] = {
 // Redis Connection Helpers
 // ============================================================================
 
-static void llz_conn_disconnect(void)
-{
-    if (g_connCtx) {
-        redisFree(g_connCtx);
-        g_connCtx = NULL;
-    }
-}
-
-static bool llz_conn_connect(void)
-{
-    llz_conn_disconnect();
-
-    struct timeval timeout;
-    timeout.tv_sec = 1;
-    timeout.tv_usec = 500000;
-
-    g_connCtx = redisConnectWithTimeout("127.0.0.1", 6379, timeout);
-    if (!g_connCtx || g_connCtx->err) {
-        llz_conn_disconnect();
-        return false;
-    }
-
-    redisSetTimeout(g_connCtx, timeout);
-    return true;
-}
-
-static bool llz_conn_ensure_connection(void)
-{
-    if (g_connCtx) {
-        return true;
-    }
-    return llz_conn_connect();
-}
-
+// Commands share the SDK connection manager's context (host/port from
+// LlzMediaInit) and fail fast while it is reconnecting.
 static redisReply *llz_conn_command(const char *format, ...)
 {
-    if (!llz_conn_ensure_connection()) return NULL;
-
     va_list args;
     va_start(args, format);
-    redisReply *reply = redisvCommand(g_connCtx, format, args);
+    redisReply *reply = llz_redis_vcommand(format, args);
     va_end(args);
-
-    if (!reply) {
-        llz_conn_disconnect();
-        if (!llz_conn_ensure_connection()) {
-            return NULL;
-        }
-        va_start(args, format);
-        reply = redisvCommand(g_connCtx, format, args);
-        va_end(args);
-    }
-
     return reply;
 }
 
@@ -123,32 +79,28 @@ static void llz_conn_init_state(void)
 
 static bool llz_conn_send_status_request(const char *service)
 {
-    if (!llz_conn_ensure_connection()) return false;
+    if (!llz_redis_acquire()) return false;
 
     long long ts = (long long)time(NULL);
 
-    redisReply *reply;
+    bool success;
     if (service) {
-        // Request for specific service - goes through standard playback command queue
-        reply = llz_conn_command(
-            "LPUSH %s {\"action\":\"check_connection\",\"service\":\"%s\",\"timestamp\":%lld}",
-            REDIS_KEY_PLAYBACK_CMD_Q,
+        // Request for specific service - queued behind pending playback commands
+        success = llz_media_queue_request(
+            "check_connection",
+            "{\"action\":\"check_connection\",\"service\":\"%s\",\"timestamp\":%lld}",
             service,
             ts
         );
     } else {
-        // Request for all services - goes through standard playback command queue
-        reply = llz_conn_command(
-            "LPUSH %s {\"action\":\"check_all_connections\",\"timestamp\":%lld}",
-            REDIS_KEY_PLAYBACK_CMD_Q,
+        // Request for all services - queued behind pending playback commands
+        success = llz_media_queue_request(
+            "check_all_connections",
+            "{\"action\":\"check_all_connections\",\"timestamp\":%lld}",
             ts
         );
     }
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
         g_state.lastRefresh = (int64_t)time(NULL);
         g_state.refreshInProgress = true;
@@ -237,7 +189,7 @@ bool LlzConnectionsInit(const LlzConnectionsConfig *config)
 
     llz_conn_init_state();
 
-    if (!llz_conn_connect()) {
+    if (!LlzRedisConnect()) {
         // Connection failed but we can retry later
         g_initialized = true;
         return true;
@@ -260,7 +212,6 @@ bool LlzConnectionsInit(const LlzConnectionsConfig *config)
 
 void LlzConnectionsShutdown(void)
 {
-    llz_conn_disconnect();
     memset(&g_state, 0, sizeof(g_state));
     g_initialized = false;
 }
@@ -1,31 +1,100 @@
 #include "llz_sdk_display.h"
+#include "llz_sdk_resource.h"
 
+#include "rlgl.h"
 #include <stdlib.h>
+#include <string.h>
 
-#ifdef PLATFORM_DRM
+// The panel is portrait; the logical canvas is its landscape view
 #define DRM_NATIVE_WIDTH 480
 #define DRM_NATIVE_HEIGHT 800
+
 static RenderTexture2D g_target = {0};
 static bool g_targetReady = false;
-#endif
+static bool g_targetFailed = false;            // Allocation failed once, stay on the direct path
 
 static bool g_windowReady = false;
+static bool g_rotated = false;                 // Native framebuffer is 480x800
+static bool g_forceTarget = false;             // LLZ_DISPLAY_PATH=target
+static bool g_requireTarget = false;           // Set by the running plugin
+static LlzDisplayPath g_framePath = LLZ_DISPLAY_PATH_WINDOW;
+static bool g_frameOpen = false;
+static bool g_offscreenOpen = false;
+
+static bool llz_display_env_set(const char *name)
+{
+    const char *env = getenv(name);
+    return env && env[0] != '\0' && env[0] != '0';
+}
+
+// Logical (x, y) lands on native (480 - y, x). Pushing the modelview makes
+// rlgl transform every vertex, so plugins draw in logical coordinates with
+// no extra pass.
+static void llz_display_push_rotation(void)
+{
+    rlPushMatrix();
+    rlTranslatef((float)DRM_NATIVE_WIDTH, 0.0f, 0.0f);
+    rlRotatef(90.0f, 0.0f, 0.0f, 1.0f);
+}
+
+static bool llz_display_load_target(void)
+{
+    if (g_targetReady) return true;
+    if (g_targetFailed) return false;
+
+    g_target = LoadRenderTexture(LLZ_LOGICAL_WIDTH, LLZ_LOGICAL_HEIGHT);
+    if (g_target.id == 0) {
+        TraceLog(LOG_ERROR, "LlzDisplay: failed to allocate render target, drawing direct");
+        g_targetFailed = true;
+        return false;
+    }
+    SetTextureFilter(g_target.texture, TEXTURE_FILTER_BILINEAR);
+    LlzResourceTrack("display", LLZ_RESOURCE_RENDER_TEXTURE, g_target.id,
+                     LlzResourceTextureBytes(g_target.texture));
+    g_targetReady = true;
+    return true;
+}
+
+static void llz_display_unload_target(void)
+{
+    if (!g_targetReady) return;
+    LlzResourceUntrack(LLZ_RESOURCE_RENDER_TEXTURE, g_target.id);
+    UnloadRenderTexture(g_target);
+    g_target = (RenderTexture2D){0};
+    g_targetReady = false;
+}
 
 bool LlzDisplayInit(void)
 {
 #ifdef PLATFORM_DRM
-    const char *traceEnv = getenv("LLZ_RAYLIB_TRACE");
-    if (traceEnv && traceEnv[0] != '\0' && traceEnv[0] != '0') {
+    if (llz_display_env_set("LLZ_RAYLIB_TRACE")) {
         SetTraceLogLevel(LOG_TRACE);
         TraceLog(LOG_INFO, "LlzDisplay: verbose raylib tracing enabled via LLZ_RAYLIB_TRACE");
     }
+    g_rotated = true;
+#else
+    g_rotated = llz_display_env_set("LLZ_EMULATE_ROTATION");
 #endif
+
+    const char *pathEnv = getenv("LLZ_DISPLAY_PATH");
+    if (pathEnv && pathEnv[0] != '\0') {
+        if (strcmp(pathEnv, "target") == 0) {
+            g_forceTarget = true;
+        } else if (strcmp(pathEnv, "direct") != 0) {
+            TraceLog(LOG_WARNING, "LlzDisplay: ignoring LLZ_DISPLAY_PATH=%s", pathEnv);
+        }
+    }
+
 #ifdef PLATFORM_DRM
     SetConfigFlags(FLAG_WINDOW_UNDECORATED | FLAG_FULLSCREEN_MODE);
     InitWindow(DRM_NATIVE_WIDTH, DRM_NATIVE_HEIGHT, "llizardgui-host");
 #else
-    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
-    InitWindow(LLZ_LOGICAL_WIDTH, LLZ_LOGICAL_HEIGHT, "llizardgui-host");
+    if (g_rotated) {
+        InitWindow(DRM_NATIVE_WIDTH, DRM_NATIVE_HEIGHT, "llizardgui-host (rotated)");
+    } else {
+        SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+        InitWindow(LLZ_LOGICAL_WIDTH, LLZ_LOGICAL_HEIGHT, "llizardgui-host");
+    }
 #endif
 
     if (!IsWindowReady()) {
@@ -35,17 +104,16 @@ bool LlzDisplayInit(void)
 
     g_windowReady = true;
 
-#ifdef PLATFORM_DRM
-    g_target = LoadRenderTexture(LLZ_LOGICAL_WIDTH, LLZ_LOGICAL_HEIGHT);
-    if (g_target.id == 0) {
-        TraceLog(LOG_ERROR, "LlzDisplay: failed to allocate render target");
+    // The forced target path keeps the old behaviour of failing at startup
+    if (g_rotated && g_forceTarget && !llz_display_load_target()) {
         CloseWindow();
         g_windowReady = false;
         return false;
     }
-    g_targetReady = true;
-    SetTextureFilter(g_target.texture, TEXTURE_FILTER_BILINEAR);
-#endif
+    if (g_rotated) {
+        TraceLog(LOG_INFO, "LlzDisplay: rotated output, %s path",
+                 g_forceTarget ? "render target" : "direct");
+    }
 
     SetTargetFPS(60);
     return true;
@@ -54,44 +122,139 @@ bool LlzDisplayInit(void)
 void LlzDisplayBegin(void)
 {
     if (!g_windowReady) return;
-#ifdef PLATFORM_DRM
-    if (!g_targetReady) return;
-    BeginTextureMode(g_target);
-    ClearBackground(BLACK);
-#else
-    BeginDrawing();
-    ClearBackground(BLACK);
-#endif
+
+    g_framePath = LLZ_DISPLAY_PATH_WINDOW;
+    if (g_rotated) {
+        bool wantTarget = g_forceTarget || g_requireTarget;
+        if (wantTarget && llz_display_load_target()) {
+            g_framePath = LLZ_DISPLAY_PATH_TARGET;
+        } else {
+            // Nobody needs the canvas as a texture any more
+            if (!wantTarget) llz_display_unload_target();
+            g_framePath = LLZ_DISPLAY_PATH_DIRECT;
+        }
+    }
+
+    switch (g_framePath) {
+    case LLZ_DISPLAY_PATH_TARGET:
+        BeginTextureMode(g_target);
+        ClearBackground(BLACK);
+        break;
+    case LLZ_DISPLAY_PATH_DIRECT:
+        BeginDrawing();
+        ClearBackground(BLACK);
+        llz_display_push_rotation();
+        break;
+    default:
+        BeginDrawing();
+        ClearBackground(BLACK);
+        break;
+    }
+    g_frameOpen = true;
 }
 
 void LlzDisplayEnd(void)
 {
-    if (!g_windowReady) return;
-#ifdef PLATFORM_DRM
-    if (!g_targetReady) return;
-    EndTextureMode();
-    BeginDrawing();
-    ClearBackground(BLACK);
-    Rectangle src = {0.0f, 0.0f, (float)g_target.texture.width, -(float)g_target.texture.height};
-    Rectangle dst = {DRM_NATIVE_WIDTH / 2.0f, DRM_NATIVE_HEIGHT / 2.0f, (float)DRM_NATIVE_HEIGHT, (float)DRM_NATIVE_WIDTH};
-    Vector2 origin = {dst.width / 2.0f, dst.height / 2.0f};
-    DrawTexturePro(g_target.texture, src, dst, origin, 90.0f, WHITE);
-    EndDrawing();
-#else
-    EndDrawing();
-#endif
+    if (!g_windowReady || !g_frameOpen) return;
+    if (g_offscreenOpen) LlzDisplayEndOffscreen();
+    g_frameOpen = false;
+
+    switch (g_framePath) {
+    case LLZ_DISPLAY_PATH_TARGET: {
+        EndTextureMode();
+        BeginDrawing();
+        ClearBackground(BLACK);
+        Rectangle src = {0.0f, 0.0f, (float)g_target.texture.width, -(float)g_target.texture.height};
+        Rectangle dst = {DRM_NATIVE_WIDTH / 2.0f, DRM_NATIVE_HEIGHT / 2.0f, (float)DRM_NATIVE_HEIGHT, (float)DRM_NATIVE_WIDTH};
+        Vector2 origin = {dst.width / 2.0f, dst.height / 2.0f};
+        DrawTexturePro(g_target.texture, src, dst, origin, 90.0f, WHITE);
+        EndDrawing();
+        break;
+    }
+    case LLZ_DISPLAY_PATH_DIRECT:
+        rlPopMatrix();
+        EndDrawing();
+        break;
+    default:
+        EndDrawing();
+        break;
+    }
 }
 
 void LlzDisplayShutdown(void)
 {
-#ifdef PLATFORM_DRM
-    if (g_targetReady) {
-        UnloadRenderTexture(g_target);
-        g_targetReady = false;
-    }
-#endif
+    llz_display_unload_target();
     if (g_windowReady) {
         CloseWindow();
         g_windowReady = false;
     }
 }
+
+void LlzDisplayRequireTarget(bool require)
+{
+    g_requireTarget = require;
+}
+
+LlzDisplayPath LlzDisplayGetPath(void)
+{
+    return g_framePath;
+}
+
+bool LlzDisplayIsRotated(void)
+{
+    return g_rotated;
+}
+
+void LlzDisplayBeginScissor(int x, int y, int width, int height)
+{
+    if (g_frameOpen && !g_offscreenOpen && g_framePath == LLZ_DISPLAY_PATH_DIRECT) {
+        // raylib scissors in framebuffer pixels, which the modelview does not touch
+        BeginScissorMode(DRM_NATIVE_WIDTH - y - height, x, height, width);
+    } else {
+        BeginScissorMode(x, y, width, height);
+    }
+}
+
+void LlzDisplayEndScissor(void)
+{
+    EndScissorMode();
+}
+
+bool LlzDisplayBeginOffscreen(RenderTexture2D target)
+{
+    if (g_offscreenOpen || target.id == 0) return false;
+
+    // raylib does not nest texture modes, and BeginTextureMode would keep
+    // the rotation applied, so step out of the frame's own setup first
+    if (g_frameOpen) {
+        if (g_framePath == LLZ_DISPLAY_PATH_TARGET) {
+            EndTextureMode();
+        } else if (g_framePath == LLZ_DISPLAY_PATH_DIRECT) {
+            rlPopMatrix();
+        }
+    }
+    BeginTextureMode(target);
+    g_offscreenOpen = true;
+    return true;
+}
+
+void LlzDisplayEndOffscreen(void)
+{
+    if (!g_offscreenOpen) return;
+    EndTextureMode();
+    g_offscreenOpen = false;
+
+    if (g_frameOpen) {
+        if (g_framePath == LLZ_DISPLAY_PATH_TARGET) {
+            BeginTextureMode(g_target);
+        } else if (g_framePath == LLZ_DISPLAY_PATH_DIRECT) {
+            llz_display_push_rotation();
+        }
+    }
+}
+
+Vector2 LlzDisplayToLogical(Vector2 native)
+{
+    if (!g_rotated) return native;
+    return (Vector2){native.y, (float)DRM_NATIVE_WIDTH - native.x};
+}
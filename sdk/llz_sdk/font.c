@@ -6,6 +6,9 @@
  */
 
 #include "llz_sdk_font.h"
+#include "llz_sdk_glyph.h"
+#include "llz_sdk_resource.h"
+#include "llz_sdk_text.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -14,7 +17,6 @@
 // Internal Constants
 // ============================================================================
 
-#define MAX_CACHED_FONTS 16
 #define DEFAULT_FONT_SIZE 20
 #define DEFAULT_GLYPH_COUNT 256
 
@@ -49,20 +51,11 @@ static const char* FONT_SEARCH_PATHS[] = {
 // Internal State
 // ============================================================================
 
-typedef struct {
-    Font font;
-    LlzFontType type;
-    int size;
-    bool inUse;
-} CachedFont;
-
 static struct {
     bool initialized;
     char fontDirectory[512];
     char fontPaths[LLZ_FONT_COUNT][512];
-    CachedFont cache[MAX_CACHED_FONTS];
-    Font defaultFont;
-    bool defaultFontLoaded;
+    bool warnedShared;
 } g_fontState = {0};
 
 // ============================================================================
@@ -203,26 +196,6 @@ static Font LoadFontInternal(const char* path, int size, int* codepoints, int co
     return font;
 }
 
-static CachedFont* FindCachedFont(LlzFontType type, int size) {
-    for (int i = 0; i < MAX_CACHED_FONTS; i++) {
-        if (g_fontState.cache[i].inUse &&
-            g_fontState.cache[i].type == type &&
-            g_fontState.cache[i].size == size) {
-            return &g_fontState.cache[i];
-        }
-    }
-    return NULL;
-}
-
-static CachedFont* GetFreeCacheSlot(void) {
-    for (int i = 0; i < MAX_CACHED_FONTS; i++) {
-        if (!g_fontState.cache[i].inUse) {
-            return &g_fontState.cache[i];
-        }
-    }
-    return NULL;
-}
-
 // ============================================================================
 // Public API Implementation
 // ============================================================================
@@ -271,22 +244,7 @@ void LlzFontShutdown(void) {
     }
 
     printf("[LlzFont] Shutting down font system...\n");
-
-    // Unload cached fonts
-    for (int i = 0; i < MAX_CACHED_FONTS; i++) {
-        if (g_fontState.cache[i].inUse) {
-            if (g_fontState.cache[i].font.texture.id != GetFontDefault().texture.id) {
-                UnloadFont(g_fontState.cache[i].font);
-            }
-            g_fontState.cache[i].inUse = false;
-        }
-    }
-
-    // Unload default font if loaded
-    if (g_fontState.defaultFontLoaded &&
-        g_fontState.defaultFont.texture.id != GetFontDefault().texture.id) {
-        UnloadFont(g_fontState.defaultFont);
-    }
+    LlzGlyphShutdown();
 
     memset(&g_fontState, 0, sizeof(g_fontState));
 }
@@ -296,20 +254,7 @@ bool LlzFontIsReady(void) {
 }
 
 Font LlzFontGetDefault(void) {
-    if (!g_fontState.initialized) {
-        LlzFontInit();
-    }
-
-    if (!g_fontState.defaultFontLoaded) {
-        g_fontState.defaultFont = LoadFontInternal(
-            g_fontState.fontPaths[LLZ_FONT_UI],
-            DEFAULT_FONT_SIZE,
-            NULL, 0
-        );
-        g_fontState.defaultFontLoaded = true;
-    }
-
-    return g_fontState.defaultFont;
+    return LlzFontGet(LLZ_FONT_UI, DEFAULT_FONT_SIZE);
 }
 
 Font LlzFontGet(LlzFontType type, int size) {
@@ -321,27 +266,30 @@ Font LlzFontGet(LlzFontType type, int size) {
         type = LLZ_FONT_UI;
     }
 
-    // Check cache
-    CachedFont* cached = FindCachedFont(type, size);
-    if (cached) {
-        return cached->font;
+    if (g_fontState.fontPaths[type][0] == '\0') {
+        return GetFontDefault();
     }
 
-    // Load new font
-    Font font = LoadFontInternal(g_fontState.fontPaths[type], size, NULL, 0);
-
-    // Cache it
-    CachedFont* slot = GetFreeCacheSlot();
-    if (slot) {
-        slot->font = font;
-        slot->type = type;
-        slot->size = size;
-        slot->inUse = true;
+    // A view on the shared glyph atlas; every caller gets the same one
+    Font font = LlzGlyphGetFont(g_fontState.fontPaths[type], size);
+    if (font.texture.id == 0) {
+        if (!g_fontState.warnedShared) {
+            printf("[LlzFont] WARNING: Shared glyph atlas unavailable, using raylib default font\n");
+            g_fontState.warnedShared = true;
+        }
+        return GetFontDefault();
     }
-
     return font;
 }
 
+Font LlzFontGetFile(const char* path, int size) {
+    return LlzGlyphGetFont(path, size);
+}
+
+int LlzFontRequireText(Font font, const char* text) {
+    return LlzGlyphRequireText(font, text);
+}
+
 Font LlzFontLoadCustom(LlzFontType type, int size, int* codepoints, int codepointCount) {
     if (!g_fontState.initialized) {
         LlzFontInit();
@@ -351,7 +299,19 @@ Font LlzFontLoadCustom(LlzFontType type, int size, int* codepoints, int codepoin
         type = LLZ_FONT_UI;
     }
 
-    return LoadFontInternal(g_fontState.fontPaths[type], size, codepoints, codepointCount);
+    Font font = LoadFontInternal(g_fontState.fontPaths[type], size, codepoints, codepointCount);
+    LlzResourceTrackFont(NULL, font);
+    return font;
+}
+
+void LlzFontUnloadCustom(Font font) {
+    if (font.texture.id == 0 || font.texture.id == GetFontDefault().texture.id ||
+        LlzGlyphIsShared(font)) {
+        return;
+    }
+    LlzResourceUntrackFont(font);
+    LlzTextCacheForgetFont(font);
+    UnloadFont(font);
 }
 
 const char* LlzFontGetPath(LlzFontType type) {
@@ -384,6 +344,7 @@ const char* LlzFontGetDirectory(void) {
 
 void LlzDrawText(const char* text, int x, int y, int fontSize, Color color) {
     Font font = LlzFontGet(LLZ_FONT_UI, fontSize);
+    LlzGlyphRequireText(font, text);
     float spacing = fontSize * 0.05f;
     DrawTextEx(font, text, (Vector2){x, y}, fontSize, spacing, color);
 }
@@ -401,12 +362,18 @@ void LlzDrawTextShadow(const char* text, int x, int y, int fontSize, Color color
 int LlzMeasureText(const char* text, int fontSize) {
     Font font = LlzFontGet(LLZ_FONT_UI, fontSize);
     float spacing = fontSize * 0.05f;
-    Vector2 size = MeasureTextEx(font, text, fontSize, spacing);
-    return (int)size.x;
+    return (int)LlzTextMeasure(font, text, (float)fontSize, spacing);
+}
+
+int LlzFitText(const char* text, int fontSize, int maxWidth, const char* suffix) {
+    Font font = LlzFontGet(LLZ_FONT_UI, fontSize);
+    float spacing = fontSize * 0.05f;
+    return LlzTextFit(font, text, (float)fontSize, spacing, (float)maxWidth, suffix);
 }
 
 Vector2 LlzMeasureTextEx(const char* text, int fontSize) {
     Font font = LlzFontGet(LLZ_FONT_UI, fontSize);
+    LlzGlyphRequireText(font, text);
     float spacing = fontSize * 0.05f;
     return MeasureTextEx(font, text, fontSize, spacing);
 }
@@ -0,0 +1,1029 @@
+#include "llz_sdk_glyph.h"
+#include "llz_sdk_profiler.h"
+#include "llz_sdk_resource.h"
+#include "llz_sdk_text.h"
+#include "rlgl.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define LLZ_GLYPH_MAX_SHELVES 128
+#define LLZ_GLYPH_PATH_MAX 256
+#define LLZ_GLYPH_KNOWN_WORDS (0x10000 / 32)  // Bit per BMP codepoint
+#define LLZ_GLYPH_BATCH 256                   // Codepoints rasterized per LoadFontData call
+
+// Every view starts with what LlzFontGet used to load: ASCII and Latin-1
+static const int kSeedRanges[][2] = {
+    {0x0020, 0x007E},
+    {0x00A0, 0x00FF},
+};
+
+typedef struct {
+    int y, height;
+    int x;                            // Next free column
+} LlzGlyphShelf;
+
+typedef struct {
+    bool used;
+    Texture2D texture;                // GRAY_ALPHA: white, coverage in alpha (as raylib fonts)
+    unsigned char *alpha;             // Coverage kept for the disk cache
+    LlzGlyphShelf shelves[LLZ_GLYPH_MAX_SHELVES];
+    int shelfCount;
+    int nextY;                        // Top of the next shelf
+    int dirtyTop, dirtyBottom;        // Rows waiting for upload
+} LlzGlyphPage;
+
+typedef struct {
+    bool used;
+    char path[LLZ_GLYPH_PATH_MAX];
+    uint64_t fileSize;
+    int64_t fileMtime;
+    unsigned char *data;              // TTF bytes, read at the first rasterization
+    int dataSize;
+    bool dataFailed;
+    bool warnedSizes;
+} LlzGlyphFace;
+
+typedef struct {
+    bool used;
+    int face;
+    int size;
+    int page;
+    Font font;                        // glyphCount stays LLZ_GLYPH_MAX_GLYPHS; free slots have value -1
+    int glyphCount;                   // Slots filled
+    uint32_t owners;                  // Bit per LlzResourceOwner that asked for the view
+    uint32_t *known;                  // BMP codepoints already looked up
+    int *missingAstral;               // Astral codepoints that failed, sorted
+    int missingCount;
+    int missingCapacity;
+    bool warnedFull;
+} LlzGlyphView;
+
+static LlzGlyphFace g_glyphFaces[LLZ_GLYPH_MAX_FACES];
+static LlzGlyphPage g_glyphPages[LLZ_GLYPH_MAX_PAGES];
+static LlzGlyphView g_glyphViews[LLZ_GLYPH_MAX_VIEWS];
+static bool g_glyphStarted = false;
+static bool g_glyphDirty = false;     // Added since the cache was loaded or saved
+static LlzGlyphStats g_glyphStats = {0};
+
+// ============================================================================
+// Disk cache
+// ============================================================================
+//
+// One file, LLZ_GLYPH_CACHE_DIR/glyphs.bin:
+//
+//   LlzGlyphCacheHeader
+//   LlzGlyphCacheFace    x faces
+//   per page:  LlzGlyphCachePage, LlzGlyphShelf x shelfCount,
+//              coverage rows [0, nextY) of LLZ_GLYPH_PAGE_SIZE bytes
+//   per view:  LlzGlyphCacheView, LlzGlyphCacheGlyph x glyphCount
+//
+// Written to a .tmp name and renamed into place.
+
+#define LLZ_GLYPH_CACHE_MAGIC 0x41475A4Cu    // "LZGA"
+#define LLZ_GLYPH_CACHE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    int32_t pageSize;
+    int32_t padding;
+    int32_t faces;
+    int32_t pages;
+    int32_t views;
+    int32_t reserved;
+} LlzGlyphCacheHeader;
+
+typedef struct {
+    char path[LLZ_GLYPH_PATH_MAX];
+    uint64_t fileSize;
+    int64_t fileMtime;
+} LlzGlyphCacheFace;
+
+typedef struct {
+    int32_t nextY;
+    int32_t shelfCount;
+} LlzGlyphCachePage;
+
+typedef struct {
+    int32_t face;
+    int32_t size;
+    int32_t page;
+    int32_t glyphCount;
+} LlzGlyphCacheView;
+
+typedef struct {
+    int32_t value;
+    int32_t offsetX, offsetY;
+    int32_t advanceX;
+    float x, y, width, height;
+} LlzGlyphCacheGlyph;
+
+// NULL when LLZ_GLYPH_CACHE=0
+static const char *llz_glyph_cache_dir(void)
+{
+    const char *enabled = getenv("LLZ_GLYPH_CACHE");
+    if (enabled && enabled[0] == '0') return NULL;
+
+    const char *dir = getenv("LLZ_GLYPH_CACHE_DIR");
+    return (dir && dir[0] != '\0') ? dir : LLZ_GLYPH_CACHE_DIR;
+}
+
+// ============================================================================
+// Pages
+// ============================================================================
+
+static size_t llz_glyph_page_alpha_bytes(void)
+{
+    return (size_t)LLZ_GLYPH_PAGE_SIZE * LLZ_GLYPH_PAGE_SIZE;
+}
+
+static int llz_glyph_add_page(void)
+{
+    int index = -1;
+    for (int i = 0; i < LLZ_GLYPH_MAX_PAGES; i++) {
+        if (!g_glyphPages[i].used) {
+            index = i;
+            break;
+        }
+    }
+    if (index < 0) return -1;
+
+    // Transparent white, so filtering at glyph edges never darkens them
+    size_t pixels = llz_glyph_page_alpha_bytes();
+    unsigned char *clear = (unsigned char *)malloc(pixels * 2);
+    unsigned char *alpha = (unsigned char *)calloc(pixels, 1);
+    if (!clear || !alpha) {
+        free(clear);
+        free(alpha);
+        return -1;
+    }
+    for (size_t i = 0; i < pixels; i++) {
+        clear[i * 2] = 255;
+        clear[i * 2 + 1] = 0;
+    }
+
+    LlzGlyphPage *page = &g_glyphPages[index];
+    memset(page, 0, sizeof(*page));
+    page->texture.id = rlLoadTexture(clear, LLZ_GLYPH_PAGE_SIZE, LLZ_GLYPH_PAGE_SIZE,
+                                     PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, 1);
+    free(clear);
+    if (page->texture.id == 0) {
+        printf("[GLYPH] Failed to allocate a %dx%d page\n", LLZ_GLYPH_PAGE_SIZE, LLZ_GLYPH_PAGE_SIZE);
+        free(alpha);
+        return -1;
+    }
+    page->texture.width = LLZ_GLYPH_PAGE_SIZE;
+    page->texture.height = LLZ_GLYPH_PAGE_SIZE;
+    page->texture.mipmaps = 1;
+    page->texture.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    SetTextureFilter(page->texture, TEXTURE_FILTER_BILINEAR);
+    page->alpha = alpha;
+    page->used = true;
+
+    LlzResourceTrack("fonts", LLZ_RESOURCE_FONT, page->texture.id, LlzResourceTextureBytes(page->texture));
+    LlzResourceTrack("fonts", LLZ_RESOURCE_BUFFER, (uintptr_t)page->alpha, pixels);
+    return index;
+}
+
+static void llz_glyph_free_page(LlzGlyphPage *page)
+{
+    if (!page->used) return;
+    LlzResourceUntrack(LLZ_RESOURCE_FONT, page->texture.id);
+    LlzResourceUntrack(LLZ_RESOURCE_BUFFER, (uintptr_t)page->alpha);
+    UnloadTexture(page->texture);
+    free(page->alpha);
+    memset(page, 0, sizeof(*page));
+}
+
+static void llz_glyph_mark_dirty(LlzGlyphPage *page, int top, int bottom)
+{
+    if (page->dirtyBottom <= page->dirtyTop) {
+        page->dirtyTop = top;
+        page->dirtyBottom = bottom;
+        return;
+    }
+    if (top < page->dirtyTop) page->dirtyTop = top;
+    if (bottom > page->dirtyBottom) page->dirtyBottom = bottom;
+}
+
+// Upload the changed rows in one call, expanded to gray+alpha
+static void llz_glyph_flush_page(LlzGlyphPage *page)
+{
+    int rows = page->dirtyBottom - page->dirtyTop;
+    if (rows <= 0) return;
+
+    size_t count = (size_t)rows * LLZ_GLYPH_PAGE_SIZE;
+    unsigned char *pixels = (unsigned char *)malloc(count * 2);
+    if (pixels) {
+        const unsigned char *src = page->alpha + (size_t)page->dirtyTop * LLZ_GLYPH_PAGE_SIZE;
+        for (size_t i = 0; i < count; i++) {
+            pixels[i * 2] = 255;
+            pixels[i * 2 + 1] = src[i];
+        }
+        Rectangle area = { 0.0f, (float)page->dirtyTop, (float)LLZ_GLYPH_PAGE_SIZE, (float)rows };
+        UpdateTextureRec(page->texture, area, pixels);
+        free(pixels);
+    }
+    page->dirtyTop = 0;
+    page->dirtyBottom = 0;
+}
+
+// Carve a padded rectangle: the tightest shelf with room, else a new shelf.
+// Same policy as the thumbnail atlas, within one page.
+static bool llz_glyph_shelf_alloc(LlzGlyphPage *page, int width, int height, int *outX, int *outY)
+{
+    if (width > LLZ_GLYPH_PAGE_SIZE || height > LLZ_GLYPH_PAGE_SIZE) return false;
+
+    LlzGlyphShelf *best = NULL;
+    for (int s = 0; s < page->shelfCount; s++) {
+        LlzGlyphShelf *shelf = &page->shelves[s];
+        if (shelf->height < height || shelf->x + width > LLZ_GLYPH_PAGE_SIZE) continue;
+        if (!best || shelf->height < best->height) best = shelf;
+    }
+
+    bool canOpen = page->shelfCount < LLZ_GLYPH_MAX_SHELVES &&
+                   page->nextY + height <= LLZ_GLYPH_PAGE_SIZE;
+    if (!best || (best->height > height + height / 4 && canOpen)) {
+        if (!canOpen) return false;
+        best = &page->shelves[page->shelfCount++];
+        best->y = page->nextY;
+        best->height = height;
+        best->x = 0;
+        page->nextY += height;
+    }
+
+    *outX = best->x;
+    *outY = best->y;
+    best->x += width;
+    return true;
+}
+
+// Page for a new view: the first with room for its seed glyphs and half as
+// many again, else a new page, else the emptiest. An average glyph bitmap is
+// about half the size wide and three quarters of it tall.
+static int llz_glyph_pick_page(int size)
+{
+    int seedCount = 0;
+    for (size_t r = 0; r < sizeof(kSeedRanges) / sizeof(kSeedRanges[0]); r++) {
+        seedCount += kSeedRanges[r][1] - kSeedRanges[r][0] + 1;
+    }
+    long cellWidth = size / 2 + LLZ_GLYPH_PADDING * 2;
+    long cellHeight = size * 3 / 4 + LLZ_GLYPH_PADDING * 2;
+    long needRows = seedCount * cellWidth * cellHeight * 3 / 2 / LLZ_GLYPH_PAGE_SIZE;
+
+    int emptiest = -1;
+    for (int i = 0; i < LLZ_GLYPH_MAX_PAGES; i++) {
+        if (!g_glyphPages[i].used) continue;
+        int freeRows = LLZ_GLYPH_PAGE_SIZE - g_glyphPages[i].nextY;
+        if (freeRows >= needRows) return i;
+        if (emptiest < 0 || g_glyphPages[i].nextY < g_glyphPages[emptiest].nextY) emptiest = i;
+    }
+
+    int added = llz_glyph_add_page();
+    return added >= 0 ? added : emptiest;
+}
+
+// ============================================================================
+// Faces and views
+// ============================================================================
+
+static bool llz_glyph_stat(const char *path, uint64_t *outSize, int64_t *outMtime)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+    *outSize = (uint64_t)st.st_size;
+    *outMtime = (int64_t)st.st_mtime;
+    return true;
+}
+
+static int llz_glyph_find_face(const char *path)
+{
+    for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) {
+        if (g_glyphFaces[i].used && strcmp(g_glyphFaces[i].path, path) == 0) return i;
+    }
+    return -1;
+}
+
+static int llz_glyph_add_face(const char *path, uint64_t fileSize, int64_t fileMtime)
+{
+    if (strlen(path) >= LLZ_GLYPH_PATH_MAX) return -1;
+    for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) {
+        LlzGlyphFace *face = &g_glyphFaces[i];
+        if (face->used) continue;
+        memset(face, 0, sizeof(*face));
+        snprintf(face->path, sizeof(face->path), "%s", path);
+        face->fileSize = fileSize;
+        face->fileMtime = fileMtime;
+        face->used = true;
+        return i;
+    }
+    printf("[GLYPH] No room for font '%s' (%d faces)\n", path, LLZ_GLYPH_MAX_FACES);
+    return -1;
+}
+
+static void llz_glyph_drop_face_data(LlzGlyphFace *face)
+{
+    if (!face->data) return;
+    LlzResourceUntrack(LLZ_RESOURCE_BUFFER, (uintptr_t)face->data);
+    UnloadFileData(face->data);
+    face->data = NULL;
+    face->dataSize = 0;
+}
+
+static bool llz_glyph_face_data(LlzGlyphFace *face)
+{
+    if (face->data) return true;
+    if (face->dataFailed) return false;
+
+    face->data = LoadFileData(face->path, &face->dataSize);
+    if (!face->data || face->dataSize <= 0) {
+        printf("[GLYPH] Failed to read font '%s'\n", face->path);
+        face->data = NULL;
+        face->dataFailed = true;
+        return false;
+    }
+    LlzResourceTrack("fonts", LLZ_RESOURCE_BUFFER, (uintptr_t)face->data, (size_t)face->dataSize);
+    return true;
+}
+
+static LlzGlyphView *llz_glyph_view_of(Font font)
+{
+    if (!font.glyphs) return NULL;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        if (g_glyphViews[i].used && g_glyphViews[i].font.glyphs == font.glyphs) return &g_glyphViews[i];
+    }
+    return NULL;
+}
+
+static size_t llz_glyph_view_bytes(void)
+{
+    return (size_t)LLZ_GLYPH_MAX_GLYPHS * (sizeof(GlyphInfo) + sizeof(Rectangle)) +
+           LLZ_GLYPH_KNOWN_WORDS * sizeof(uint32_t);
+}
+
+static LlzGlyphView *llz_glyph_alloc_view(int face, int size, int page)
+{
+    LlzGlyphView *view = NULL;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        if (!g_glyphViews[i].used) {
+            view = &g_glyphViews[i];
+            break;
+        }
+    }
+    if (!view) return NULL;
+
+    GlyphInfo *glyphs = (GlyphInfo *)calloc(LLZ_GLYPH_MAX_GLYPHS, sizeof(GlyphInfo));
+    Rectangle *recs = (Rectangle *)calloc(LLZ_GLYPH_MAX_GLYPHS, sizeof(Rectangle));
+    uint32_t *known = (uint32_t *)calloc(LLZ_GLYPH_KNOWN_WORDS, sizeof(uint32_t));
+    if (!glyphs || !recs || !known) {
+        free(glyphs);
+        free(recs);
+        free(known);
+        return NULL;
+    }
+    for (int i = 0; i < LLZ_GLYPH_MAX_GLYPHS; i++) glyphs[i].value = -1;
+
+    memset(view, 0, sizeof(*view));
+    view->used = true;
+    view->face = face;
+    view->size = size;
+    view->page = page;
+    view->known = known;
+    view->font.baseSize = size;
+    view->font.glyphCount = LLZ_GLYPH_MAX_GLYPHS;
+    view->font.glyphPadding = LLZ_GLYPH_PADDING;
+    view->font.texture = g_glyphPages[page].texture;
+    view->font.recs = recs;
+    view->font.glyphs = glyphs;
+    LlzResourceTrack("fonts", LLZ_RESOURCE_BUFFER, (uintptr_t)glyphs, llz_glyph_view_bytes());
+    return view;
+}
+
+static void llz_glyph_free_view(LlzGlyphView *view)
+{
+    if (!view->used) return;
+    LlzTextCacheForgetFont(view->font);
+    LlzResourceUntrack(LLZ_RESOURCE_BUFFER, (uintptr_t)view->font.glyphs);
+    free(view->font.glyphs);
+    free(view->font.recs);
+    free(view->known);
+    free(view->missingAstral);
+    memset(view, 0, sizeof(*view));
+}
+
+static void llz_glyph_mark_owner(LlzGlyphView *view)
+{
+    LlzResourceOwner owner = LlzResourceGetOwner(NULL);
+    if (owner >= 0 && owner < 32) view->owners |= 1u << owner;
+}
+
+static bool llz_glyph_owners_live(uint32_t owners)
+{
+    for (int i = 0; i < 32; i++) {
+        if ((owners & (1u << i)) && LlzResourceOwnerIsLive(i)) return true;
+    }
+    return false;
+}
+
+// Index of the first failed astral codepoint >= codepoint
+static int llz_glyph_missing_find(const LlzGlyphView *view, int codepoint)
+{
+    int lo = 0, hi = view->missingCount;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (view->missingAstral[mid] < codepoint) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static bool llz_glyph_known(const LlzGlyphView *view, int codepoint)
+{
+    if (codepoint < 0x10000) return (view->known[codepoint >> 5] >> (codepoint & 31)) & 1u;
+
+    int at = llz_glyph_missing_find(view, codepoint);
+    if (at < view->missingCount && view->missingAstral[at] == codepoint) return true;
+    for (int i = 0; i < view->glyphCount; i++) {
+        if (view->font.glyphs[i].value == codepoint) return true;
+    }
+    return false;
+}
+
+static void llz_glyph_set_known(LlzGlyphView *view, int codepoint)
+{
+    if (codepoint < 0x10000) view->known[codepoint >> 5] |= 1u << (codepoint & 31);
+}
+
+// Astral codepoints have no known bit; remember every one that failed so it
+// is not rasterized again on every draw. A failed allocation only means the
+// codepoint is tried again next time.
+static void llz_glyph_note_failed(LlzGlyphView *view, int codepoint)
+{
+    if (codepoint < 0x10000) return;
+
+    int at = llz_glyph_missing_find(view, codepoint);
+    if (at < view->missingCount && view->missingAstral[at] == codepoint) return;
+
+    if (view->missingCount == view->missingCapacity) {
+        int capacity = view->missingCapacity ? view->missingCapacity * 2 : 16;
+        int *grown = (int *)realloc(view->missingAstral, (size_t)capacity * sizeof(int));
+        if (!grown) return;
+        view->missingAstral = grown;
+        view->missingCapacity = capacity;
+    }
+    memmove(&view->missingAstral[at + 1], &view->missingAstral[at],
+            (size_t)(view->missingCount - at) * sizeof(int));
+    view->missingAstral[at] = codepoint;
+    view->missingCount++;
+}
+
+static bool llz_glyph_image_blank(Image image)
+{
+    if (!image.data || image.width <= 0 || image.height <= 0) return true;
+    const unsigned char *p = (const unsigned char *)image.data;
+    size_t count = (size_t)image.width * image.height;
+    for (size_t i = 0; i < count; i++) {
+        if (p[i] != 0) return false;
+    }
+    return true;
+}
+
+// Rasterize codepoints (none of them known yet) into the view's page
+static int llz_glyph_rasterize(LlzGlyphView *view, int *codepoints, int count)
+{
+    LlzGlyphFace *face = &g_glyphFaces[view->face];
+    if (!llz_glyph_face_data(face)) return 0;
+
+    GlyphInfo *glyphs = LoadFontData(face->data, face->dataSize, view->size, codepoints, count, FONT_DEFAULT);
+    if (!glyphs) return 0;
+
+    LlzGlyphPage *page = &g_glyphPages[view->page];
+    int added = 0;
+    for (int i = 0; i < count; i++) {
+        const GlyphInfo *glyph = &glyphs[i];
+        int codepoint = codepoints[i];
+
+        // stb_truetype leaves glyphs the font lacks empty
+        if (codepoint != ' ' && !glyph->image.data && glyph->advanceX == 0) {
+            g_glyphStats.missing++;
+            llz_glyph_note_failed(view, codepoint);
+            continue;
+        }
+
+        Rectangle rec = {0};
+        bool placed = view->glyphCount < LLZ_GLYPH_MAX_GLYPHS;
+        if (placed && !llz_glyph_image_blank(glyph->image)) {
+            int x = 0, y = 0;
+            int width = glyph->image.width + LLZ_GLYPH_PADDING * 2;
+            int height = glyph->image.height + LLZ_GLYPH_PADDING * 2;
+            placed = llz_glyph_shelf_alloc(page, width, height, &x, &y);
+            if (placed) {
+                const unsigned char *src = (const unsigned char *)glyph->image.data;
+                for (int row = 0; row < glyph->image.height; row++) {
+                    unsigned char *dst = page->alpha +
+                        (size_t)(y + LLZ_GLYPH_PADDING + row) * LLZ_GLYPH_PAGE_SIZE + x + LLZ_GLYPH_PADDING;
+                    memcpy(dst, src + (size_t)row * glyph->image.width, (size_t)glyph->image.width);
+                }
+                llz_glyph_mark_dirty(page, y, y + height);
+                rec = (Rectangle){ (float)(x + LLZ_GLYPH_PADDING), (float)(y + LLZ_GLYPH_PADDING),
+                                   (float)glyph->image.width, (float)glyph->image.height };
+            }
+        }
+        if (!placed) {
+            g_glyphStats.pageFull++;
+            llz_glyph_note_failed(view, codepoint);
+            if (!view->warnedFull) {
+                printf("[GLYPH] %s %dpx: atlas page full, drawing '?' for new glyphs\n",
+                       face->path, view->size);
+                view->warnedFull = true;
+            }
+            continue;
+        }
+
+        int slot = view->glyphCount++;
+        view->font.glyphs[slot].value = codepoint;
+        view->font.glyphs[slot].offsetX = glyph->offsetX;
+        view->font.glyphs[slot].offsetY = glyph->offsetY;
+        view->font.glyphs[slot].advanceX = glyph->advanceX;
+        view->font.recs[slot] = rec;
+        added++;
+    }
+    UnloadFontData(glyphs, count);
+    llz_glyph_flush_page(page);
+
+    g_glyphStats.rasterized += (unsigned long)added;
+    if (added > 0) g_glyphDirty = true;
+    return added;
+}
+
+static int llz_glyph_require(LlzGlyphView *view, const int *codepoints, int count)
+{
+    int batch[LLZ_GLYPH_BATCH];
+    int pending = 0;
+    int added = 0;
+    bool rasterizing = false;
+    uint64_t span = 0;
+
+    for (int i = 0; i < count; i++) {
+        int codepoint = codepoints[i];
+        if (codepoint < 0 || codepoint == '\n' || llz_glyph_known(view, codepoint)) continue;
+
+        bool queued = false;
+        for (int k = 0; k < pending && !queued; k++) queued = batch[k] == codepoint;
+        if (queued) continue;
+
+        llz_glyph_set_known(view, codepoint);
+        if (!rasterizing) {
+            span = LlzProfilerSpanBegin();
+            rasterizing = true;
+        }
+        batch[pending++] = codepoint;
+        if (pending == LLZ_GLYPH_BATCH) {
+            added += llz_glyph_rasterize(view, batch, pending);
+            pending = 0;
+        }
+    }
+    if (pending > 0) added += llz_glyph_rasterize(view, batch, pending);
+    if (rasterizing) LlzProfilerSpanEnd("glyphs", span);
+    return added;
+}
+
+static LlzGlyphView *llz_glyph_new_view(int face, int size)
+{
+    int page = llz_glyph_pick_page(size);
+    if (page < 0) return NULL;
+
+    LlzGlyphView *view = llz_glyph_alloc_view(face, size, page);
+    if (!view) return NULL;
+
+    int seed[0x0100];
+    int count = 0;
+    for (size_t r = 0; r < sizeof(kSeedRanges) / sizeof(kSeedRanges[0]); r++) {
+        for (int cp = kSeedRanges[r][0]; cp <= kSeedRanges[r][1]; cp++) seed[count++] = cp;
+    }
+    llz_glyph_require(view, seed, count);
+    g_glyphDirty = true;
+    printf("[GLYPH] %s %dpx: %d glyphs on page %d\n", g_glyphFaces[face].path, size, view->glyphCount, page);
+    return view;
+}
+
+// The closest size a face already has, larger preferred (it scales down better)
+static LlzGlyphView *llz_glyph_nearest_view(int face, int size)
+{
+    LlzGlyphView *best = NULL;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        LlzGlyphView *view = &g_glyphViews[i];
+        if (!view->used || view->face != face) continue;
+        if (!best) {
+            best = view;
+            continue;
+        }
+        bool bigger = view->size >= size;
+        bool bestBigger = best->size >= size;
+        if (bigger != bestBigger) {
+            if (bigger) best = view;
+        } else if (abs(view->size - size) < abs(best->size - size)) {
+            best = view;
+        }
+    }
+    return best;
+}
+
+static void llz_glyph_free_all(void)
+{
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) llz_glyph_free_view(&g_glyphViews[i]);
+    for (int i = 0; i < LLZ_GLYPH_MAX_PAGES; i++) llz_glyph_free_page(&g_glyphPages[i]);
+    for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) {
+        llz_glyph_drop_face_data(&g_glyphFaces[i]);
+        memset(&g_glyphFaces[i], 0, sizeof(g_glyphFaces[i]));
+    }
+}
+
+// ============================================================================
+// Disk cache load / save
+// ============================================================================
+
+static bool llz_glyph_read(FILE *f, void *out, size_t bytes)
+{
+    return fread(out, bytes, 1, f) == 1;
+}
+
+static bool llz_glyph_load_views(FILE *f, const LlzGlyphCacheHeader *header, const int *faceMap,
+                                 const int *pageMap)
+{
+    for (int v = 0; v < header->views; v++) {
+        LlzGlyphCacheView record;
+        if (!llz_glyph_read(f, &record, sizeof(record))) return false;
+        if (record.face < 0 || record.face >= header->faces || record.page < 0 ||
+            record.page >= header->pages || record.glyphCount < 0 ||
+            record.glyphCount > LLZ_GLYPH_MAX_GLYPHS || record.size <= 0) {
+            return false;
+        }
+
+        LlzGlyphView *view = llz_glyph_alloc_view(faceMap[record.face], record.size, pageMap[record.page]);
+        if (!view) return false;
+        for (int i = 0; i < record.glyphCount; i++) {
+            LlzGlyphCacheGlyph glyph;
+            if (!llz_glyph_read(f, &glyph, sizeof(glyph))) return false;
+            view->font.glyphs[i].value = glyph.value;
+            view->font.glyphs[i].offsetX = glyph.offsetX;
+            view->font.glyphs[i].offsetY = glyph.offsetY;
+            view->font.glyphs[i].advanceX = glyph.advanceX;
+            view->font.recs[i] = (Rectangle){ glyph.x, glyph.y, glyph.width, glyph.height };
+            if (glyph.value >= 0) llz_glyph_set_known(view, glyph.value);
+        }
+        view->glyphCount = record.glyphCount;
+    }
+    return true;
+}
+
+static bool llz_glyph_load_file(FILE *f)
+{
+    LlzGlyphCacheHeader header;
+    if (!llz_glyph_read(f, &header, sizeof(header))) return false;
+    if (header.magic != LLZ_GLYPH_CACHE_MAGIC || header.version != LLZ_GLYPH_CACHE_VERSION ||
+        header.pageSize != LLZ_GLYPH_PAGE_SIZE || header.padding != LLZ_GLYPH_PADDING ||
+        header.faces < 0 || header.faces > LLZ_GLYPH_MAX_FACES ||
+        header.pages < 0 || header.pages > LLZ_GLYPH_MAX_PAGES ||
+        header.views < 0 || header.views > LLZ_GLYPH_MAX_VIEWS) {
+        return false;
+    }
+
+    int faceMap[LLZ_GLYPH_MAX_FACES];
+    for (int i = 0; i < header.faces; i++) {
+        LlzGlyphCacheFace record;
+        if (!llz_glyph_read(f, &record, sizeof(record))) return false;
+        record.path[LLZ_GLYPH_PATH_MAX - 1] = '\0';
+
+        uint64_t size = 0;
+        int64_t mtime = 0;
+        if (!llz_glyph_stat(record.path, &size, &mtime) ||
+            size != record.fileSize || mtime != record.fileMtime) {
+            printf("[GLYPH] '%s' changed since the cache was written\n", record.path);
+            return false;
+        }
+        faceMap[i] = llz_glyph_add_face(record.path, size, mtime);
+        if (faceMap[i] < 0) return false;
+    }
+
+    int pageMap[LLZ_GLYPH_MAX_PAGES];
+    for (int i = 0; i < header.pages; i++) {
+        LlzGlyphCachePage record;
+        if (!llz_glyph_read(f, &record, sizeof(record))) return false;
+        if (record.nextY < 0 || record.nextY > LLZ_GLYPH_PAGE_SIZE ||
+            record.shelfCount < 0 || record.shelfCount > LLZ_GLYPH_MAX_SHELVES) {
+            return false;
+        }
+
+        pageMap[i] = llz_glyph_add_page();
+        if (pageMap[i] < 0) return false;
+        LlzGlyphPage *page = &g_glyphPages[pageMap[i]];
+        if (!llz_glyph_read(f, page->shelves, sizeof(LlzGlyphShelf) * (size_t)record.shelfCount) ||
+            !llz_glyph_read(f, page->alpha, (size_t)record.nextY * LLZ_GLYPH_PAGE_SIZE)) {
+            return false;
+        }
+        page->shelfCount = record.shelfCount;
+        page->nextY = record.nextY;
+        llz_glyph_mark_dirty(page, 0, record.nextY);
+        llz_glyph_flush_page(page);
+    }
+
+    return llz_glyph_load_views(f, &header, faceMap, pageMap);
+}
+
+static void llz_glyph_load_cache(void)
+{
+    const char *dir = llz_glyph_cache_dir();
+    if (!dir) return;
+    char path[LLZ_GLYPH_PATH_MAX + 16];
+    snprintf(path, sizeof(path), "%s/glyphs.bin", dir);
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return;
+
+    uint64_t span = LlzProfilerSpanBegin();
+    bool ok = llz_glyph_load_file(f);
+    fclose(f);
+    LlzProfilerSpanEnd("glyph cache", span);
+
+    if (!ok) {
+        printf("[GLYPH] Ignoring glyph cache '%s'\n", path);
+        llz_glyph_free_all();
+        return;
+    }
+
+    int glyphs = 0;
+    int views = 0;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        if (!g_glyphViews[i].used) continue;
+        glyphs += g_glyphViews[i].glyphCount;
+        views++;
+    }
+    g_glyphStats.cacheLoaded = true;
+    printf("[GLYPH] Loaded %d glyphs in %d sizes from '%s'\n", glyphs, views, path);
+}
+
+static bool llz_glyph_write_file(FILE *f)
+{
+    int faceMap[LLZ_GLYPH_MAX_FACES];
+    int pageMap[LLZ_GLYPH_MAX_PAGES];
+    LlzGlyphCacheHeader header = {0};
+    header.magic = LLZ_GLYPH_CACHE_MAGIC;
+    header.version = LLZ_GLYPH_CACHE_VERSION;
+    header.pageSize = LLZ_GLYPH_PAGE_SIZE;
+    header.padding = LLZ_GLYPH_PADDING;
+    for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) faceMap[i] = g_glyphFaces[i].used ? header.faces++ : -1;
+    for (int i = 0; i < LLZ_GLYPH_MAX_PAGES; i++) pageMap[i] = g_glyphPages[i].used ? header.pages++ : -1;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) header.views += g_glyphViews[i].used ? 1 : 0;
+
+    if (fwrite(&header, sizeof(header), 1, f) != 1) return false;
+
+    for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) {
+        if (faceMap[i] < 0) continue;
+        LlzGlyphCacheFace record = {0};
+        snprintf(record.path, sizeof(record.path), "%s", g_glyphFaces[i].path);
+        record.fileSize = g_glyphFaces[i].fileSize;
+        record.fileMtime = g_glyphFaces[i].fileMtime;
+        if (fwrite(&record, sizeof(record), 1, f) != 1) return false;
+    }
+
+    for (int i = 0; i < LLZ_GLYPH_MAX_PAGES; i++) {
+        const LlzGlyphPage *page = &g_glyphPages[i];
+        if (pageMap[i] < 0) continue;
+        LlzGlyphCachePage record = { page->nextY, page->shelfCount };
+        if (fwrite(&record, sizeof(record), 1, f) != 1) return false;
+        if (page->shelfCount > 0 &&
+            fwrite(page->shelves, sizeof(LlzGlyphShelf) * (size_t)page->shelfCount, 1, f) != 1) {
+            return false;
+        }
+        if (page->nextY > 0 &&
+            fwrite(page->alpha, (size_t)page->nextY * LLZ_GLYPH_PAGE_SIZE, 1, f) != 1) {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        const LlzGlyphView *view = &g_glyphViews[i];
+        if (!view->used) continue;
+        LlzGlyphCacheView record = { faceMap[view->face], view->size, pageMap[view->page], view->glyphCount };
+        if (fwrite(&record, sizeof(record), 1, f) != 1) return false;
+        for (int g = 0; g < view->glyphCount; g++) {
+            const GlyphInfo *glyph = &view->font.glyphs[g];
+            const Rectangle *rec = &view->font.recs[g];
+            LlzGlyphCacheGlyph out = { glyph->value, glyph->offsetX, glyph->offsetY, glyph->advanceX,
+                                       rec->x, rec->y, rec->width, rec->height };
+            if (fwrite(&out, sizeof(out), 1, f) != 1) return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Eviction
+// ============================================================================
+
+// Resource registry evictor. Glyphs cannot be removed from a page without
+// moving the others, so a page goes as a whole once none of its views is
+// held by a live owner. Over the hard budget the font files read for
+// rasterizing are dropped too (read again when a glyph is missing).
+static size_t llz_glyph_evict(LlzResourceDomain domain, size_t bytes, bool hard, void *user)
+{
+    (void)bytes;
+    (void)user;
+
+    size_t freed = 0;
+    for (int p = 0; p < LLZ_GLYPH_MAX_PAGES; p++) {
+        LlzGlyphPage *page = &g_glyphPages[p];
+        if (!page->used) continue;
+
+        bool held = false;
+        for (int v = 0; v < LLZ_GLYPH_MAX_VIEWS && !held; v++) {
+            const LlzGlyphView *view = &g_glyphViews[v];
+            held = view->used && view->page == p && llz_glyph_owners_live(view->owners);
+        }
+        if (held) continue;
+
+        for (int v = 0; v < LLZ_GLYPH_MAX_VIEWS; v++) {
+            LlzGlyphView *view = &g_glyphViews[v];
+            if (!view->used || view->page != p) continue;
+            if (domain == LLZ_RESOURCE_CPU) freed += llz_glyph_view_bytes();
+            llz_glyph_free_view(view);
+        }
+        freed += domain == LLZ_RESOURCE_GPU ? LlzResourceTextureBytes(page->texture)
+                                            : llz_glyph_page_alpha_bytes();
+        printf("[GLYPH] Evicted page %d\n", p);
+        llz_glyph_free_page(page);
+    }
+
+    if (hard && domain == LLZ_RESOURCE_CPU) {
+        for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) {
+            LlzGlyphFace *face = &g_glyphFaces[i];
+            if (!face->data) continue;
+            freed += (size_t)face->dataSize;
+            llz_glyph_drop_face_data(face);
+        }
+    }
+    return freed;
+}
+
+static void llz_glyph_start(void)
+{
+    if (g_glyphStarted) return;
+    g_glyphStarted = true;
+    LlzResourceRegisterEvictor(llz_glyph_evict, NULL);
+    llz_glyph_load_cache();
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+Font LlzGlyphGetFont(const char *path, int size)
+{
+    Font none = {0};
+    if (!path || path[0] == '\0' || size <= 0) return none;
+    llz_glyph_start();
+
+    int face = llz_glyph_find_face(path);
+    if (face < 0) {
+        uint64_t fileSize = 0;
+        int64_t fileMtime = 0;
+        if (!llz_glyph_stat(path, &fileSize, &fileMtime)) {
+            printf("[GLYPH] Font '%s' not found\n", path);
+            return none;
+        }
+        face = llz_glyph_add_face(path, fileSize, fileMtime);
+        if (face < 0) return none;
+    }
+
+    int sizes = 0;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        LlzGlyphView *view = &g_glyphViews[i];
+        if (!view->used || view->face != face) continue;
+        if (view->size == size) {
+            llz_glyph_mark_owner(view);
+            return view->font;
+        }
+        sizes++;
+    }
+
+    LlzGlyphView *view = NULL;
+    if (sizes < LLZ_GLYPH_MAX_SIZES) view = llz_glyph_new_view(face, size);
+    if (!view) {
+        view = llz_glyph_nearest_view(face, size);
+        if (!view) return none;
+        g_glyphStats.borrowed++;
+        if (!g_glyphFaces[face].warnedSizes) {
+            printf("[GLYPH] %s: no room for %dpx, scaling %dpx instead\n", path, size, view->size);
+            g_glyphFaces[face].warnedSizes = true;
+        }
+    }
+    llz_glyph_mark_owner(view);
+    return view->font;
+}
+
+int LlzGlyphRequireText(Font font, const char *text)
+{
+    if (!text || text[0] == '\0') return 0;
+    LlzGlyphView *view = llz_glyph_view_of(font);
+    if (!view) return 0;
+
+    // Most strings are already covered; only collect what is missing
+    int missing[LLZ_GLYPH_BATCH];
+    int count = 0;
+    int added = 0;
+    for (const char *p = text; *p;) {
+        int next = 0;
+        int codepoint = GetCodepointNext(p, &next);
+        p += next > 0 ? next : 1;
+        if (llz_glyph_known(view, codepoint)) continue;
+
+        missing[count++] = codepoint;
+        if (count == LLZ_GLYPH_BATCH) {
+            added += llz_glyph_require(view, missing, count);
+            count = 0;
+        }
+    }
+    if (count > 0) added += llz_glyph_require(view, missing, count);
+    return added;
+}
+
+int LlzGlyphRequireCodepoints(Font font, const int *codepoints, int count)
+{
+    if (!codepoints || count <= 0) return 0;
+    LlzGlyphView *view = llz_glyph_view_of(font);
+    return view ? llz_glyph_require(view, codepoints, count) : 0;
+}
+
+bool LlzGlyphIsShared(Font font)
+{
+    return llz_glyph_view_of(font) != NULL;
+}
+
+bool LlzGlyphSaveCache(void)
+{
+    if (!g_glyphDirty) return true;
+
+    const char *dir = llz_glyph_cache_dir();
+    if (!dir) return false;
+    char path[LLZ_GLYPH_PATH_MAX + 16];
+    char tmp[LLZ_GLYPH_PATH_MAX + 24];
+    snprintf(path, sizeof(path), "%s/glyphs.bin", dir);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    uint64_t span = LlzProfilerSpanBegin();
+    FILE *f = fopen(tmp, "wb");
+    if (!f && errno == ENOENT && mkdir(dir, 0755) == 0) f = fopen(tmp, "wb");
+    if (!f) return false;
+
+    bool ok = llz_glyph_write_file(f);
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmp, path) != 0) {
+        printf("[GLYPH] Failed to write '%s'\n", path);
+        remove(tmp);
+        return false;
+    }
+    LlzProfilerSpanEnd("glyph cache", span);
+
+    g_glyphDirty = false;
+    g_glyphStats.cacheSaves++;
+    return true;
+}
+
+void LlzGlyphShutdown(void)
+{
+    if (!g_glyphStarted) return;
+    LlzGlyphSaveCache();
+    LlzResourceUnregisterEvictor(llz_glyph_evict, NULL);
+    llz_glyph_free_all();
+    g_glyphStarted = false;
+    g_glyphDirty = false;
+    memset(&g_glyphStats, 0, sizeof(g_glyphStats));
+}
+
+void LlzGlyphGetStats(LlzGlyphStats *outStats)
+{
+    if (!outStats) return;
+    *outStats = g_glyphStats;
+    outStats->faces = 0;
+    outStats->views = 0;
+    outStats->pages = 0;
+    outStats->glyphs = 0;
+    outStats->pageBytesUsed = 0;
+    for (int i = 0; i < LLZ_GLYPH_MAX_FACES; i++) outStats->faces += g_glyphFaces[i].used ? 1 : 0;
+    for (int i = 0; i < LLZ_GLYPH_MAX_VIEWS; i++) {
+        if (!g_glyphViews[i].used) continue;
+        outStats->views++;
+        outStats->glyphs += g_glyphViews[i].glyphCount;
+    }
+    for (int i = 0; i < LLZ_GLYPH_MAX_PAGES; i++) {
+        if (!g_glyphPages[i].used) continue;
+        outStats->pages++;
+        outStats->pageBytesUsed += (size_t)g_glyphPages[i].nextY * LLZ_GLYPH_PAGE_SIZE * 2;
+    }
+}
@@ -0,0 +1,154 @@
+#include "llz_sdk_governor.h"
+#include "llz_sdk_input.h"
+#include "llz_sdk_media.h"
+
+#include "raylib.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Longest single sleep while idle, so Redis snapshots and redraw requests
+// from worker threads are noticed without a wakeup fd
+#define LLZ_GOVERNOR_WAKE_SLICE 0.025
+
+static int g_govIdleFps = LLZ_GOVERNOR_IDLE_FPS;
+static double g_govFrameStart = 0.0;
+static double g_govInputUntil = 0.0;
+static double g_govAnimateUntil = 0.0;
+static bool g_govAnimateNext = false;         // RequestAnimation since the last draw decision
+static bool g_govFullRate = true;             // Decision for the current iteration
+static bool g_govWokeByInput = false;
+static uint32_t g_govRedrawSeq = 1;           // Bumped by RequestRedraw from any thread
+static uint32_t g_govRedrawSeen = 0;
+static uint32_t g_govMediaSeq = 0;
+static bool g_govMediaSeqValid = false;
+static LlzGovernorStats g_govStats = {0};
+
+void LlzGovernorInit(void)
+{
+    const char *env = getenv("LLZ_IDLE_FPS");
+    if (env && env[0] != '\0') {
+        char *end = NULL;
+        long fps = strtol(env, &end, 10);
+        if (end && *end == '\0' && fps <= 60) {
+            g_govIdleFps = (int)fps;
+        } else {
+            printf("[GOVERNOR] Ignoring LLZ_IDLE_FPS=%s\n", env);
+        }
+    }
+
+    g_govFrameStart = GetTime();
+    g_govInputUntil = g_govFrameStart + LLZ_GOVERNOR_INPUT_HOLD;
+    if (g_govIdleFps < 0) {
+        printf("[GOVERNOR] Disabled, drawing every frame\n");
+    } else if (g_govIdleFps == 0) {
+        printf("[GOVERNOR] Idle: wait for input or media changes\n");
+    } else {
+        printf("[GOVERNOR] Idle rate %d fps\n", g_govIdleFps);
+    }
+}
+
+float LlzGovernorFrameBegin(void)
+{
+    double now = GetTime();
+    float delta = (float)(now - g_govFrameStart);
+    g_govFrameStart = now;
+
+    if (delta < 0.0f) delta = 0.0f;
+    if (delta > LLZ_GOVERNOR_MAX_DELTA) delta = LLZ_GOVERNOR_MAX_DELTA;
+    return delta;
+}
+
+bool LlzGovernorShouldDraw(bool animating)
+{
+    double now = GetTime();
+
+    if (LlzInputHadActivity() || g_govWokeByInput) {
+        g_govInputUntil = now + LLZ_GOVERNOR_INPUT_HOLD;
+    }
+    g_govWokeByInput = false;
+
+    // A new Redis snapshot usually means new text or art on screen
+    uint32_t seq = LlzMediaGetStateSequence();
+    bool mediaChanged = g_govMediaSeqValid && seq != g_govMediaSeq;
+    g_govMediaSeq = seq;
+    g_govMediaSeqValid = true;
+
+    uint32_t redrawSeq = __atomic_load_n(&g_govRedrawSeq, __ATOMIC_ACQUIRE);
+    bool redraw = redrawSeq != g_govRedrawSeen;
+    g_govRedrawSeen = redrawSeq;
+
+    g_govFullRate = g_govIdleFps < 0 || animating || g_govAnimateNext ||
+                    now < g_govInputUntil || now < g_govAnimateUntil;
+    g_govAnimateNext = false;
+
+    bool draw = g_govFullRate || redraw || mediaChanged;
+    if (draw) {
+        g_govStats.drawnFrames++;
+    } else {
+        g_govStats.skippedFrames++;
+    }
+    g_govStats.idle = !draw;
+    return draw;
+}
+
+void LlzGovernorFrameEnd(void)
+{
+    // At full rate the display limiter in EndDrawing paces the loop; so does
+    // a request made while drawing this frame for the next one
+    if (g_govFullRate || g_govAnimateNext) return;
+
+    // Requests made while drawing this frame wait for the tick; only new
+    // ones (a finished decode, a Redis update) cut the sleep short
+    uint32_t redrawSeq = __atomic_load_n(&g_govRedrawSeq, __ATOMIC_ACQUIRE);
+    bool forever = g_govIdleFps == 0;
+    double deadline = forever ? 0.0 : g_govFrameStart + 1.0 / g_govIdleFps;
+
+    // Always wait at least once: on the desktop that is what polls input
+    // for a frame that skipped EndDrawing
+    for (;;) {
+        double slice = LLZ_GOVERNOR_WAKE_SLICE;
+        bool last = false;
+        if (!forever) {
+            double left = deadline - GetTime();
+            if (left <= slice) {
+                slice = left > 0.0 ? left : 0.0;
+                last = true;
+            }
+        }
+        if (LlzInputWait(slice)) {
+            g_govWokeByInput = true;
+            g_govStats.inputWakes++;
+            break;
+        }
+        if (last) break;
+        if (__atomic_load_n(&g_govRedrawSeq, __ATOMIC_ACQUIRE) != redrawSeq) break;
+        if (LlzMediaGetStateSequence() != g_govMediaSeq) break;
+    }
+}
+
+void LlzGovernorRequestRedraw(void)
+{
+    __atomic_add_fetch(&g_govRedrawSeq, 1, __ATOMIC_RELEASE);
+}
+
+void LlzGovernorRequestAnimation(float seconds)
+{
+    g_govAnimateNext = true;
+    if (seconds > 0.0f) {
+        double until = GetTime() + seconds;
+        if (until > g_govAnimateUntil) g_govAnimateUntil = until;
+    }
+}
+
+void LlzGovernorSetIdleFps(int fps)
+{
+    g_govIdleFps = fps > 60 ? 60 : fps;
+}
+
+void LlzGovernorGetStats(LlzGovernorStats *outStats)
+{
+    if (!outStats) return;
+    *outStats = g_govStats;
+    outStats->idleFps = g_govIdleFps;
+}
@@ -1,138 +1,363 @@
 #include "llz_sdk_image.h"
+#include "pixel_internal.h"
 #include "rlgl.h"
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <webp/decode.h>
 
 #ifndef PI
 #define PI 3.14159265358979323846f
 #endif
 
-// Box blur implementation - fast and good quality with multiple passes
-static void BoxBlurHorizontal(Color *src, Color *dst, int width, int height, int radius) {
-    float invRadius = 1.0f / (float)(radius * 2 + 1);
-
-    for (int y = 0; y < height; y++) {
-        int rowOffset = y * width;
-
-        // Initialize accumulator with first pixel repeated for left edge
-        float r = 0, g = 0, b = 0, a = 0;
-        for (int x = -radius; x <= radius; x++) {
-            int idx = rowOffset + (x < 0 ? 0 : x);
-            r += src[idx].r;
-            g += src[idx].g;
-            b += src[idx].b;
-            a += src[idx].a;
-        }
+// Three box passes approximate a Gaussian. Blurs pixels in place; the
+// darkening is applied by the final vertical pass.
+static bool BlurPixels(Color *pixels, int width, int height, int passRadius, float darkenAmount) {
+    Color *temp = (Color *)malloc((size_t)width * height * sizeof(Color));
+    uint16_t *sums = (uint16_t *)malloc((size_t)width * 4 * sizeof(uint16_t));
+    if (!temp || !sums) {
+        free(temp);
+        free(sums);
+        return false;
+    }
 
-        for (int x = 0; x < width; x++) {
-            dst[rowOffset + x] = (Color){
-                (unsigned char)(r * invRadius),
-                (unsigned char)(g * invRadius),
-                (unsigned char)(b * invRadius),
-                (unsigned char)(a * invRadius)
-            };
-
-            // Slide window
-            int leftIdx = x - radius;
-            int rightIdx = x + radius + 1;
-
-            // Clamp indices
-            if (leftIdx < 0) leftIdx = 0;
-            if (rightIdx >= width) rightIdx = width - 1;
-
-            r += src[rowOffset + rightIdx].r - src[rowOffset + leftIdx].r;
-            g += src[rowOffset + rightIdx].g - src[rowOffset + leftIdx].g;
-            b += src[rowOffset + rightIdx].b - src[rowOffset + leftIdx].b;
-            a += src[rowOffset + rightIdx].a - src[rowOffset + leftIdx].a;
-        }
+    uint16_t scale = llz_pixel_box_scale(passRadius, 1.0f);
+    for (int pass = 0; pass < 3; pass++) {
+        uint16_t rgbScale = (pass == 2) ? llz_pixel_box_scale(passRadius, 1.0f - darkenAmount) : scale;
+        llz_pixel_box_rows(pixels, temp, width, height, passRadius);
+        llz_pixel_box_columns(temp, pixels, sums, width, height, passRadius, rgbScale, scale);
     }
+
+    free(temp);
+    free(sums);
+    return true;
 }
 
-static void BoxBlurVertical(Color *src, Color *dst, int width, int height, int radius) {
-    float invRadius = 1.0f / (float)(radius * 2 + 1);
-
-    for (int x = 0; x < width; x++) {
-        // Initialize accumulator with first pixel repeated for top edge
-        float r = 0, g = 0, b = 0, a = 0;
-        for (int y = -radius; y <= radius; y++) {
-            int idx = (y < 0 ? 0 : y) * width + x;
-            r += src[idx].r;
-            g += src[idx].g;
-            b += src[idx].b;
-            a += src[idx].a;
+// Average factor x factor blocks of an RGBA8 buffer into a new image
+static Image DownscaleBox(const Color *src, int width, int height, int factor) {
+    int w = width / factor;
+    int h = height / factor;
+    Image result = {0};
+
+    Color *dst = (Color *)RL_MALLOC((size_t)w * h * sizeof(Color));
+    uint16_t *sums = (uint16_t *)malloc((size_t)width * 4 * sizeof(uint16_t));
+    if (!dst || !sums) {
+        RL_FREE(dst);
+        free(sums);
+        return result;
+    }
+
+    llz_pixel_downscale(src, width, height, factor, dst, sums);
+    free(sums);
+
+    result.data = dst;
+    result.width = w;
+    result.height = h;
+    result.mipmaps = 1;
+    result.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return result;
+}
+
+static bool IsWebPFile(const char *path) {
+    size_t len = strlen(path);
+    if (len < 5) return false;
+    const char *ext = path + len - 5;
+    return (strcmp(ext, ".webp") == 0 || strcmp(ext, ".WEBP") == 0);
+}
+
+// Decoder state. WebP data is read from the file in chunks and handed to
+// libwebp's incremental decoder, which writes rows straight into the output.
+#define DECODE_HEADER_BYTES 4096      // Enough for the RIFF/VP8 headers
+#define DECODE_CHUNK_BYTES 16384      // File read size while feeding libwebp
+
+struct LlzImageDecoder {
+    FILE *file;                       // Open while WebP data remains
+    WebPIDecoder *idec;
+    WebPDecoderConfig config;         // libwebp keeps pointers into this
+    Image image;                      // Output, RGBA8
+    bool external;                    // image.data belongs to the caller
+    int sourceWidth, sourceHeight;
+    LlzImageDecodeStatus status;
+};
+
+// Same rounding as the art worker has always used for maxSize
+static void ScaledSize(int width, int height, int maxSize, int *outWidth, int *outHeight) {
+    int longest = width > height ? width : height;
+    if (maxSize <= 0 || longest <= maxSize) {
+        *outWidth = width;
+        *outHeight = height;
+        return;
+    }
+    float scale = (float)maxSize / (float)longest;
+    int w = (int)(width * scale + 0.5f);
+    int h = (int)(height * scale + 0.5f);
+    *outWidth = w > 0 ? w : 1;
+    *outHeight = h > 0 ? h : 1;
+}
+
+// Feed one buffer of file data to libwebp
+static void DecoderAppend(LlzImageDecoder *decoder, const uint8_t *data, size_t size) {
+    VP8StatusCode status = WebPIAppend(decoder->idec, data, size);
+    if (status == VP8_STATUS_OK) {
+        decoder->status = LLZ_IMAGE_DECODE_DONE;
+    } else if (status != VP8_STATUS_SUSPENDED) {
+        printf("[IMAGE] WebP decode failed (status %d)\n", (int)status);
+        decoder->status = LLZ_IMAGE_DECODE_ERROR;
+    }
+    if (decoder->status != LLZ_IMAGE_DECODE_MORE && decoder->file) {
+        fclose(decoder->file);
+        decoder->file = NULL;
+    }
+}
+
+static bool OpenWebPDecoder(LlzImageDecoder *decoder, const char *path, int maxSize) {
+    decoder->file = fopen(path, "rb");
+    if (!decoder->file) {
+        printf("[IMAGE] LlzImageDecoderOpen: failed to open file '%s'\n", path);
+        return false;
+    }
+
+    uint8_t header[DECODE_HEADER_BYTES];
+    size_t headerSize = fread(header, 1, sizeof(header), decoder->file);
+    if (!WebPInitDecoderConfig(&decoder->config) ||
+        WebPGetFeatures(header, headerSize, &decoder->config.input) != VP8_STATUS_OK ||
+        decoder->config.input.width <= 0 || decoder->config.input.height <= 0) {
+        printf("[IMAGE] LlzImageDecoderOpen: not a WebP file '%s'\n", path);
+        return false;
+    }
+    decoder->sourceWidth = decoder->config.input.width;
+    decoder->sourceHeight = decoder->config.input.height;
+
+    // A caller-provided target fixes the size; otherwise fit maxSize
+    int width = decoder->image.width;
+    int height = decoder->image.height;
+    if (!decoder->external) ScaledSize(decoder->sourceWidth, decoder->sourceHeight, maxSize, &width, &height);
+
+    // libwebp scales while it decodes, so the full-size image never exists
+    WebPDecoderOptions *options = &decoder->config.options;
+    if (width != decoder->sourceWidth || height != decoder->sourceHeight) {
+        options->use_scaling = 1;
+        options->scaled_width = width;
+        options->scaled_height = height;
+    }
+
+    size_t stride = (size_t)width * 4;
+    if (!decoder->external) {
+        decoder->image.data = RL_MALLOC(stride * height);
+        if (!decoder->image.data) {
+            printf("[IMAGE] LlzImageDecoderOpen: failed to allocate image data\n");
+            return false;
         }
+        decoder->image.width = width;
+        decoder->image.height = height;
+        decoder->image.mipmaps = 1;
+        decoder->image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    }
+
+    // Rows land directly in the final buffer; nothing is copied afterwards
+    WebPDecBuffer *output = &decoder->config.output;
+    output->colorspace = MODE_RGBA;
+    output->is_external_memory = 1;
+    output->u.RGBA.rgba = (uint8_t *)decoder->image.data;
+    output->u.RGBA.stride = (int)stride;
+    output->u.RGBA.size = stride * height;
+
+    decoder->idec = WebPIDecode(NULL, 0, &decoder->config);
+    if (!decoder->idec) {
+        printf("[IMAGE] LlzImageDecoderOpen: WebPIDecode failed for '%s'\n", path);
+        return false;
+    }
+    decoder->status = LLZ_IMAGE_DECODE_MORE;
+    DecoderAppend(decoder, header, headerSize);
+    return decoder->status != LLZ_IMAGE_DECODE_ERROR;
+}
+
+// Formats other than WebP are loaded whole with raylib, then resized
+static bool OpenOtherDecoder(LlzImageDecoder *decoder, const char *path, int maxSize) {
+    Image loaded = LoadImage(path);
+    if (loaded.data == NULL) return false;
+    decoder->sourceWidth = loaded.width;
+    decoder->sourceHeight = loaded.height;
+    ImageFormat(&loaded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int width = decoder->image.width;
+    int height = decoder->image.height;
+    if (!decoder->external) ScaledSize(loaded.width, loaded.height, maxSize, &width, &height);
+    if (width != loaded.width || height != loaded.height) ImageResize(&loaded, width, height);
+
+    if (decoder->external) {
+        memcpy(decoder->image.data, loaded.data, (size_t)width * height * 4);
+        UnloadImage(loaded);
+    } else {
+        decoder->image = loaded;
+    }
+    decoder->status = LLZ_IMAGE_DECODE_DONE;
+    return true;
+}
 
-        for (int y = 0; y < height; y++) {
-            dst[y * width + x] = (Color){
-                (unsigned char)(r * invRadius),
-                (unsigned char)(g * invRadius),
-                (unsigned char)(b * invRadius),
-                (unsigned char)(a * invRadius)
-            };
-
-            // Slide window
-            int topIdx = y - radius;
-            int bottomIdx = y + radius + 1;
-
-            // Clamp indices
-            if (topIdx < 0) topIdx = 0;
-            if (bottomIdx >= height) bottomIdx = height - 1;
-
-            r += src[bottomIdx * width + x].r - src[topIdx * width + x].r;
-            g += src[bottomIdx * width + x].g - src[topIdx * width + x].g;
-            b += src[bottomIdx * width + x].b - src[topIdx * width + x].b;
-            a += src[bottomIdx * width + x].a - src[topIdx * width + x].a;
+static LlzImageDecoder *OpenDecoder(const char *path, int maxSize, const Image *target) {
+    if (!path || path[0] == '\0') return NULL;
+
+    LlzImageDecoder *decoder = (LlzImageDecoder *)calloc(1, sizeof(LlzImageDecoder));
+    if (!decoder) return NULL;
+    if (target) {
+        decoder->image = *target;
+        decoder->external = true;
+    }
+
+    bool ok = IsWebPFile(path) ? OpenWebPDecoder(decoder, path, maxSize)
+                               : OpenOtherDecoder(decoder, path, maxSize);
+    if (!ok) {
+        LlzImageDecoderClose(decoder);
+        return NULL;
+    }
+    return decoder;
+}
+
+LlzImageDecoder *LlzImageDecoderOpen(const char *path, int maxSize) {
+    return OpenDecoder(path, maxSize, NULL);
+}
+
+LlzImageDecoder *LlzImageDecoderOpenInto(const char *path, Image target) {
+    if (target.data == NULL || target.width <= 0 || target.height <= 0 ||
+        target.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        return NULL;
+    }
+    return OpenDecoder(path, 0, &target);
+}
+
+LlzImageDecodeStatus LlzImageDecoderStep(LlzImageDecoder *decoder, size_t maxBytes) {
+    if (!decoder) return LLZ_IMAGE_DECODE_ERROR;
+
+    uint8_t chunk[DECODE_CHUNK_BYTES];
+    size_t fed = 0;
+    while (decoder->status == LLZ_IMAGE_DECODE_MORE && (maxBytes == 0 || fed < maxBytes)) {
+        size_t want = sizeof(chunk);
+        if (maxBytes != 0 && maxBytes - fed < want) want = maxBytes - fed;
+        size_t got = fread(chunk, 1, want, decoder->file);
+        if (got == 0) {
+            printf("[IMAGE] WebP file ended before the image was complete\n");
+            decoder->status = LLZ_IMAGE_DECODE_ERROR;
+            fclose(decoder->file);
+            decoder->file = NULL;
+            break;
         }
+        DecoderAppend(decoder, chunk, got);
+        fed += got;
+    }
+    return decoder->status;
+}
+
+void LlzImageDecoderGetInfo(const LlzImageDecoder *decoder, int *width, int *height,
+                            int *sourceWidth, int *sourceHeight) {
+    if (width) *width = decoder ? decoder->image.width : 0;
+    if (height) *height = decoder ? decoder->image.height : 0;
+    if (sourceWidth) *sourceWidth = decoder ? decoder->sourceWidth : 0;
+    if (sourceHeight) *sourceHeight = decoder ? decoder->sourceHeight : 0;
+}
+
+Image LlzImageDecoderFinish(LlzImageDecoder *decoder) {
+    Image result = {0};
+    if (!decoder) return result;
+    if (decoder->status == LLZ_IMAGE_DECODE_DONE && !decoder->external) {
+        result = decoder->image;
+        decoder->image.data = NULL;
     }
+    LlzImageDecoderClose(decoder);
+    return result;
+}
+
+void LlzImageDecoderClose(LlzImageDecoder *decoder) {
+    if (!decoder) return;
+    if (decoder->idec) WebPIDelete(decoder->idec);
+    if (decoder->file) fclose(decoder->file);
+    if (!decoder->external && decoder->image.data) RL_FREE(decoder->image.data);
+    free(decoder);
+}
+
+Image LlzImageLoadScaled(const char *path, int maxSize) {
+    LlzImageDecoder *decoder = LlzImageDecoderOpen(path, maxSize);
+    LlzImageDecoderStep(decoder, 0);
+    return LlzImageDecoderFinish(decoder);
+}
+
+bool LlzImageDecodeInto(const char *path, Image target) {
+    LlzImageDecoder *decoder = LlzImageDecoderOpenInto(path, target);
+    bool ok = LlzImageDecoderStep(decoder, 0) == LLZ_IMAGE_DECODE_DONE;
+    LlzImageDecoderClose(decoder);
+    return ok;
+}
+
+Image LlzImageLoad(const char *path) {
+    if (!path || path[0] == '\0') return (Image){0};
+    if (IsWebPFile(path)) return LlzImageLoadScaled(path, 0);
+    return LoadImage(path);
+}
+
+static void ClampBlurParams(int *blurRadius, float *darkenAmount) {
+    if (*blurRadius < 1) *blurRadius = 1;
+    if (*blurRadius > 50) *blurRadius = 50;
+    if (*darkenAmount < 0.0f) *darkenAmount = 0.0f;
+    if (*darkenAmount > 1.0f) *darkenAmount = 1.0f;
 }
 
 Image LlzImageBlur(Image source, int blurRadius, float darkenAmount) {
     if (source.data == NULL || source.width <= 0 || source.height <= 0) {
         return source;
     }
-
-    // Clamp parameters
-    if (blurRadius < 1) blurRadius = 1;
-    if (blurRadius > 50) blurRadius = 50;
-    if (darkenAmount < 0.0f) darkenAmount = 0.0f;
-    if (darkenAmount > 1.0f) darkenAmount = 1.0f;
+    ClampBlurParams(&blurRadius, &darkenAmount);
 
     // Create a copy of the image and ensure it's in RGBA format
     Image result = ImageCopy(source);
     ImageFormat(&result, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
 
-    int width = result.width;
-    int height = result.height;
-    int pixelCount = width * height;
+    // Each of the three passes uses a third of the radius
+    int passRadius = blurRadius / 3;
+    if (passRadius < 1) passRadius = 1;
+
+    BlurPixels((Color *)result.data, result.width, result.height, passRadius, darkenAmount);
+    return result;
+}
 
-    Color *pixels = (Color *)result.data;
-    Color *temp = (Color *)malloc(pixelCount * sizeof(Color));
-    if (!temp) {
-        return result;
+Image LlzImageBlurReduced(Image source, int blurRadius, float darkenAmount) {
+    if (source.data == NULL || source.width <= 0 || source.height <= 0) {
+        return (Image){0};
     }
+    ClampBlurParams(&blurRadius, &darkenAmount);
 
-    // Three-pass box blur approximates Gaussian blur
-    // Each pass with radius/3 gives good quality
     int passRadius = blurRadius / 3;
     if (passRadius < 1) passRadius = 1;
 
-    for (int pass = 0; pass < 3; pass++) {
-        BoxBlurHorizontal(pixels, temp, width, height, passRadius);
-        BoxBlurVertical(temp, pixels, width, height, passRadius);
+    // Shrink until each pass is about two pixels wide; the blur removes
+    // everything the lost resolution could have shown
+    int factor = (passRadius + 1) / 2;
+    if (factor < 1) factor = 1;
+    while (factor > 1 && (source.width / factor < LLZ_IMAGE_BLUR_MIN_SIZE ||
+                          source.height / factor < LLZ_IMAGE_BLUR_MIN_SIZE)) {
+        factor--;
     }
+    int reducedRadius = (passRadius + factor / 2) / factor;
+    if (reducedRadius < 1) reducedRadius = 1;
 
-    // Apply darkening
-    if (darkenAmount > 0.0f) {
-        float brightnessMultiplier = 1.0f - darkenAmount;
-        for (int i = 0; i < pixelCount; i++) {
-            pixels[i].r = (unsigned char)(pixels[i].r * brightnessMultiplier);
-            pixels[i].g = (unsigned char)(pixels[i].g * brightnessMultiplier);
-            pixels[i].b = (unsigned char)(pixels[i].b * brightnessMultiplier);
-        }
+    Image rgba = source;
+    if (source.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        rgba = ImageCopy(source);
+        ImageFormat(&rgba, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
     }
 
-    free(temp);
+    Image result;
+    if (factor > 1) {
+        result = DownscaleBox((const Color *)rgba.data, rgba.width, rgba.height, factor);
+    } else {
+        result = (rgba.data == source.data) ? ImageCopy(rgba) : rgba;
+    }
+    if (rgba.data != source.data && rgba.data != result.data) UnloadImage(rgba);
+
+    if (result.data) {
+        BlurPixels((Color *)result.data, result.width, result.height, reducedRadius, darkenAmount);
+    }
     return result;
 }
 
@@ -141,14 +366,16 @@ Texture2D LlzTextureBlur(Texture2D source, int blurRadius, float darkenAmount) {
         return source;
     }
 
-    // Get image from texture
+    // Get image from texture (a GPU readback; prefer blurring the Image
+    // before it is uploaded)
     Image img = LoadImageFromTexture(source);
 
     // Apply blur
-    Image blurred = LlzImageBlur(img, blurRadius, darkenAmount);
+    Image blurred = LlzImageBlurReduced(img, blurRadius, darkenAmount);
 
-    // Upload to new texture
+    // Upload to new texture, filtered so the reduced image scales smoothly
     Texture2D result = LoadTextureFromImage(blurred);
+    SetTextureFilter(result, TEXTURE_FILTER_BILINEAR);
 
     // Cleanup
     UnloadImage(img);
@@ -390,6 +617,11 @@ void LlzDrawTextureRounded(Texture2D texture, Rectangle destRect, float roundnes
     DrawTextureRoundedInternal(texture, sourceRect, destRect, roundness, segments, tint);
 }
 
+void LlzDrawTextureRegionRounded(Texture2D texture, Rectangle sourceRect, Rectangle destRect,
+                                 float roundness, int segments, Color tint) {
+    DrawTextureRoundedInternal(texture, sourceRect, destRect, roundness, segments, tint);
+}
+
 void LlzDrawTextureRoundedCover(Texture2D texture, Rectangle destRect, float roundness, int segments, Color tint) {
     if (texture.id == 0) return;
 
@@ -1,5 +1,6 @@
 #include "llz_sdk_input.h"
 #include "llz_sdk_config.h"
+#include "llz_sdk_display.h"
 
 #include <math.h>
 #include <string.h>
@@ -24,6 +25,10 @@ static double g_lastTapTime = 0.0;
 static Vector2 g_lastTapPos = {0};
 static Vector2 g_dragStartPos = {0};
 static Vector2 g_prevDragPos = {0};
+static bool g_hadActivity = false;
+#ifndef PLATFORM_DRM
+static Vector2 g_prevMousePos = {0};
+#endif
 
 // Button hold tracking (buttons 1-6)
 static bool g_buttonDown[6] = {false};
@@ -213,6 +218,7 @@ void LlzInputUpdate(LlzInputState *state)
 {
     if (!state) state = &g_state;
     memset(state, 0, sizeof(*state));
+    bool sawEvent = false;
 
 #ifdef PLATFORM_DRM
     CTInputEvent event;
@@ -221,6 +227,7 @@ void LlzInputUpdate(LlzInputState *state)
     llzSimulatedScrollWheel = 0.0f;
 
     while (CTInputPollEvent(&event)) {
+        sawEvent = true;
         switch (event.type) {
             case CT_EVENT_BUTTON_PRESS:
                 if (event.button.button == CT_BUTTON_BACK) {
@@ -423,11 +430,19 @@ void LlzInputUpdate(LlzInputState *state)
     state->displayModeNext = state->displayModeNext || IsKeyPressed(KEY_M);
     state->styleCyclePressed = state->styleCyclePressed || IsKeyPressed(KEY_B);
     state->scrollDelta = GetMouseWheelMove();
-    state->mousePos = GetMousePosition();
+    state->mousePos = LlzDisplayToLogical(GetMousePosition());
     state->mousePressed = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
     state->mouseJustPressed = IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
     state->mouseJustReleased = IsMouseButtonReleased(MOUSE_LEFT_BUTTON);
 
+    // Drain the key queue so keys read directly by the host or plugins count too
+    while (GetKeyPressed() != 0) sawEvent = true;
+    if (state->scrollDelta != 0.0f || state->mousePressed || state->mouseJustReleased ||
+        state->mousePos.x != g_prevMousePos.x || state->mousePos.y != g_prevMousePos.y) {
+        sawEvent = true;
+    }
+    g_prevMousePos = state->mousePos;
+
     if (state->mouseJustPressed) {
         g_touchActive = true;
         g_holdReported = false;
@@ -471,6 +486,13 @@ void LlzInputUpdate(LlzInputState *state)
     state->doubleClick = state->doubleTap;
     state->longPress = state->hold;
     g_state = *state;
+
+    // Held buttons still need frames for hold detection
+    bool held = g_touchActive || g_backButtonDown || g_selectButtonDown;
+    for (int i = 0; i < 6; i++) {
+        if (g_buttonDown[i]) held = true;
+    }
+    g_hadActivity = sawEvent || held;
 }
 
 void LlzInputShutdown(void)
@@ -484,3 +506,32 @@ const LlzInputState *LlzInputGetState(void)
 {
     return &g_state;
 }
+
+bool LlzInputHadActivity(void)
+{
+    return g_hadActivity;
+}
+
+bool LlzInputWait(double timeoutSeconds)
+{
+#ifdef PLATFORM_DRM
+    int timeoutMs = timeoutSeconds > 0.0 ? (int)(timeoutSeconds * 1000.0 + 0.5) : 0;
+    return CTInputWait(timeoutMs);
+#else
+    // GLFW has no wait-with-timeout through raylib, so poll in short slices.
+    // Pressed keys stay in the raylib state for the next LlzInputUpdate.
+    double end = GetTime() + timeoutSeconds;
+    for (;;) {
+        PollInputEvents();
+        Vector2 mouse = LlzDisplayToLogical(GetMousePosition());
+        if (GetKeyPressed() != 0 || GetMouseWheelMove() != 0.0f ||
+            IsMouseButtonDown(MOUSE_LEFT_BUTTON) || IsMouseButtonReleased(MOUSE_LEFT_BUTTON) ||
+            mouse.x != g_prevMousePos.x || mouse.y != g_prevMousePos.y || WindowShouldClose()) {
+            return true;
+        }
+        double left = end - GetTime();
+        if (left <= 0.0) return false;
+        WaitTime(left < 0.01 ? left : 0.01);
+    }
+#endif
+}
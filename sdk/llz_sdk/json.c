@@ -0,0 +1,379 @@
+#include "json_internal.h"
+
+#include <string.h>
+
+static void llz_json_fail(LlzJsonReader *r)
+{
+    r->failed = true;
+    r->cur = r->end;
+}
+
+static void llz_json_skip_ws(LlzJsonReader *r)
+{
+    while (r->cur < r->end) {
+        char c = *r->cur;
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+        r->cur++;
+    }
+}
+
+// Advance past the closing quote of a string whose opening quote was consumed.
+// memchr jumps between quotes; a quote preceded by an odd run of backslashes
+// is escaped and the search continues.
+static bool llz_json_skip_string_body(LlzJsonReader *r)
+{
+    const char *p = r->cur;
+    while (p < r->end) {
+        const char *quote = (const char *)memchr(p, '"', (size_t)(r->end - p));
+        if (!quote) break;
+
+        size_t slashes = 0;
+        while (quote - slashes > r->cur && quote[-1 - (ptrdiff_t)slashes] == '\\') slashes++;
+        p = quote + 1;
+        if ((slashes & 1) == 0) {
+            r->cur = p;
+            return true;
+        }
+    }
+    llz_json_fail(r);
+    return false;
+}
+
+static bool llz_json_is_number_char(char c)
+{
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+void llz_json_init(LlzJsonReader *r, const char *json, size_t len)
+{
+    r->cur = json;
+    r->end = json ? json + len : json;
+    r->failed = (json == NULL);
+}
+
+LlzJsonType llz_json_peek(LlzJsonReader *r)
+{
+    llz_json_skip_ws(r);
+    if (r->failed || r->cur >= r->end) return LLZ_JSON_NONE;
+
+    switch (*r->cur) {
+        case '{': return LLZ_JSON_OBJECT;
+        case '[': return LLZ_JSON_ARRAY;
+        case '"': return LLZ_JSON_STRING;
+        case 't':
+        case 'f': return LLZ_JSON_BOOL;
+        case 'n': return LLZ_JSON_NULL;
+        default:
+            return llz_json_is_number_char(*r->cur) ? LLZ_JSON_NUMBER : LLZ_JSON_NONE;
+    }
+}
+
+// Advance until depth containers have closed. Only depth is tracked; strings
+// are skipped so brackets inside them do not count. The cursor is kept in a
+// local so the compiler does not reload it through the char pointer on every
+// byte.
+static bool llz_json_skip_nested(LlzJsonReader *r, int depth)
+{
+    const char *p = r->cur;
+    while (p < r->end) {
+        char c = *p++;
+        if (c == '"') {
+            r->cur = p;
+            if (!llz_json_skip_string_body(r)) return false;
+            p = r->cur;
+        } else if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (--depth == 0) {
+                r->cur = p;
+                return true;
+            }
+        }
+    }
+    llz_json_fail(r);
+    return false;
+}
+
+bool llz_json_skip(LlzJsonReader *r)
+{
+    LlzJsonType type = llz_json_peek(r);
+    if (type == LLZ_JSON_NONE) {
+        llz_json_fail(r);
+        return false;
+    }
+
+    if (type == LLZ_JSON_STRING) {
+        r->cur++;
+        return llz_json_skip_string_body(r);
+    }
+
+    if (type != LLZ_JSON_OBJECT && type != LLZ_JSON_ARRAY) {
+        // Literals and numbers run until the next delimiter
+        while (r->cur < r->end) {
+            char c = *r->cur;
+            if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' ||
+                c == '\n' || c == '\r') {
+                break;
+            }
+            r->cur++;
+        }
+        return true;
+    }
+
+    return llz_json_skip_nested(r, 0);
+}
+
+bool llz_json_leave(LlzJsonReader *r)
+{
+    if (r->failed) return false;
+    return llz_json_skip_nested(r, 1);
+}
+
+bool llz_json_enter_object(LlzJsonReader *r)
+{
+    if (llz_json_peek(r) != LLZ_JSON_OBJECT) {
+        if (!r->failed && r->cur < r->end) llz_json_skip(r);
+        return false;
+    }
+    r->cur++;
+    return true;
+}
+
+bool llz_json_enter_array(LlzJsonReader *r)
+{
+    if (llz_json_peek(r) != LLZ_JSON_ARRAY) {
+        if (!r->failed && r->cur < r->end) llz_json_skip(r);
+        return false;
+    }
+    r->cur++;
+    return true;
+}
+
+// Consume a separating comma, or the closing bracket (returns false)
+static bool llz_json_next_in(LlzJsonReader *r, char close)
+{
+    llz_json_skip_ws(r);
+    if (r->failed || r->cur >= r->end) {
+        llz_json_fail(r);
+        return false;
+    }
+    if (*r->cur == ',') {
+        r->cur++;
+        llz_json_skip_ws(r);
+        if (r->cur >= r->end) {
+            llz_json_fail(r);
+            return false;
+        }
+    }
+    if (*r->cur == close) {
+        r->cur++;
+        return false;
+    }
+    return true;
+}
+
+bool llz_json_next_member(LlzJsonReader *r, LlzJsonKey *key)
+{
+    if (!llz_json_next_in(r, '}')) return false;
+
+    if (*r->cur != '"') {
+        llz_json_fail(r);
+        return false;
+    }
+    r->cur++;
+    const char *start = r->cur;
+    if (!llz_json_skip_string_body(r)) return false;
+    if (key) {
+        key->ptr = start;
+        key->len = (size_t)(r->cur - 1 - start);
+    }
+
+    llz_json_skip_ws(r);
+    if (r->cur >= r->end || *r->cur != ':') {
+        llz_json_fail(r);
+        return false;
+    }
+    r->cur++;
+    return true;
+}
+
+bool llz_json_next_element(LlzJsonReader *r)
+{
+    return llz_json_next_in(r, ']');
+}
+
+bool llz_json_key_is(const LlzJsonKey *key, const char *name)
+{
+    size_t len = strlen(name);
+    return key->len == len && memcmp(key->ptr, name, len) == 0;
+}
+
+static int llz_json_hex4(const char *p)
+{
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= c - '0';
+        else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+        else return -1;
+    }
+    return value;
+}
+
+// Encode a code point; returns bytes written (0 if it does not fit)
+static size_t llz_json_put_utf8(char *out, size_t room, unsigned int cp)
+{
+    if (cp < 0x80) {
+        if (room < 1) return 0;
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        if (room < 2) return 0;
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        if (room < 3) return 0;
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    if (room < 4) return 0;
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// Length of s[0..n) without a trailing incomplete UTF-8 sequence. Raw bytes
+// are copied one at a time, so truncation can land inside a character.
+static size_t llz_json_utf8_trim(const char *s, size_t n)
+{
+    size_t i = n;
+    while (i > 0 && ((unsigned char)s[i - 1] & 0xC0) == 0x80) i--;
+    if (i == 0) return n;
+
+    unsigned char lead = (unsigned char)s[i - 1];
+    if (lead < 0xC0) return n;
+    size_t need = lead >= 0xF0 ? 4 : (lead >= 0xE0 ? 3 : 2);
+    return (n - (i - 1) >= need) ? n : i - 1;
+}
+
+bool llz_json_read_string(LlzJsonReader *r, char *out, size_t outSize)
+{
+    if (out && outSize > 0) out[0] = '\0';
+    if (llz_json_peek(r) != LLZ_JSON_STRING) {
+        if (!r->failed && r->cur < r->end) llz_json_skip(r);
+        return false;
+    }
+    r->cur++;
+
+    size_t room = (out && outSize > 0) ? outSize - 1 : 0;
+    size_t n = 0;
+    bool full = false;
+
+    while (r->cur < r->end) {
+        char c = *r->cur++;
+        if (c == '"') {
+            if (out && outSize > 0) out[n] = '\0';
+            return true;
+        }
+
+        char buf[4];
+        size_t len = 1;
+        buf[0] = c;
+
+        if (c == '\\') {
+            if (r->cur >= r->end) break;
+            char e = *r->cur++;
+            switch (e) {
+                case 'n': buf[0] = '\n'; break;
+                case 't': buf[0] = '\t'; break;
+                case 'r': buf[0] = '\r'; break;
+                case 'b': buf[0] = '\b'; break;
+                case 'f': buf[0] = '\f'; break;
+                case 'u': {
+                    if (r->end - r->cur < 4) {
+                        llz_json_fail(r);
+                        return false;
+                    }
+                    int cp = llz_json_hex4(r->cur);
+                    if (cp < 0) cp = '?';
+                    r->cur += 4;
+                    // Surrogate pair
+                    if (cp >= 0xD800 && cp <= 0xDBFF && r->end - r->cur >= 6 &&
+                        r->cur[0] == '\\' && r->cur[1] == 'u') {
+                        int lo = llz_json_hex4(r->cur + 2);
+                        if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                            r->cur += 6;
+                        }
+                    }
+                    if (cp >= 0xD800 && cp <= 0xDFFF) cp = 0xFFFD;
+                    len = llz_json_put_utf8(buf, sizeof(buf), (unsigned int)cp);
+                    break;
+                }
+                default: buf[0] = e; break;   // \" \\ \/ and unknown escapes
+            }
+        }
+
+        if (full) continue;
+        if (n + len > room) {
+            n = llz_json_utf8_trim(out, n);
+            full = true;
+            continue;
+        }
+        memcpy(out + n, buf, len);
+        n += len;
+    }
+
+    llz_json_fail(r);
+    if (out && outSize > 0) out[n] = '\0';
+    return false;
+}
+
+int64_t llz_json_read_int64(LlzJsonReader *r)
+{
+    LlzJsonType type = llz_json_peek(r);
+    if (type != LLZ_JSON_NUMBER && type != LLZ_JSON_STRING) {
+        if (type != LLZ_JSON_NONE) llz_json_skip(r);
+        return 0;
+    }
+
+    const char *p = r->cur;
+    if (type == LLZ_JSON_STRING) p++;
+
+    bool negative = false;
+    if (p < r->end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    int64_t value = 0;
+    while (p < r->end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p - '0');
+        p++;
+    }
+
+    // Fractions and exponents are truncated like atoi would
+    llz_json_skip(r);
+    return negative ? -value : value;
+}
+
+int llz_json_read_int(LlzJsonReader *r)
+{
+    return (int)llz_json_read_int64(r);
+}
+
+bool llz_json_read_bool(LlzJsonReader *r)
+{
+    LlzJsonType type = llz_json_peek(r);
+    bool value = type == LLZ_JSON_BOOL && *r->cur == 't';
+    if (type != LLZ_JSON_NONE) llz_json_skip(r);
+    return value;
+}
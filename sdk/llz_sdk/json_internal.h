@@ -0,0 +1,82 @@
+#ifndef LLZ_JSON_INTERNAL_H
+#define LLZ_JSON_INTERNAL_H
+
+// SDK-internal streaming JSON reader (not installed for plugins)
+//
+// A pull parser over a length-bounded buffer: callers walk objects and
+// arrays in document order and read or skip each value exactly once, so a
+// document is scanned a single time and nothing is allocated. Every read
+// function consumes one whole value even when its type does not match, which
+// keeps the cursor in step on unexpected input.
+//
+//   LlzJsonReader r;
+//   LlzJsonKey key;
+//   llz_json_init(&r, reply->str, reply->len);
+//   if (llz_json_enter_object(&r)) {
+//       while (llz_json_next_member(&r, &key)) {
+//           if (llz_json_key_is(&key, "n")) llz_json_read_string(&r, name, sizeof(name));
+//           else llz_json_skip(&r);
+//       }
+//   }
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    LLZ_JSON_NONE = 0,    // End of input or malformed
+    LLZ_JSON_OBJECT,
+    LLZ_JSON_ARRAY,
+    LLZ_JSON_STRING,
+    LLZ_JSON_NUMBER,
+    LLZ_JSON_BOOL,
+    LLZ_JSON_NULL
+} LlzJsonType;
+
+typedef struct {
+    const char *cur;
+    const char *end;
+    bool failed;          // Set on malformed input; all further reads fail
+} LlzJsonReader;
+
+// Raw member name as it appears in the document (escapes not decoded)
+typedef struct {
+    const char *ptr;
+    size_t len;
+} LlzJsonKey;
+
+void llz_json_init(LlzJsonReader *r, const char *json, size_t len);
+
+// Type of the value at the cursor, without consuming it
+LlzJsonType llz_json_peek(LlzJsonReader *r);
+
+// Consume '{' / '['. On a type mismatch the value is skipped and false returned.
+bool llz_json_enter_object(LlzJsonReader *r);
+bool llz_json_enter_array(LlzJsonReader *r);
+
+// Advance to the next member / element. Returns false (consuming the closing
+// bracket) when the container ends. The caller must then consume the value.
+bool llz_json_next_member(LlzJsonReader *r, LlzJsonKey *key);
+bool llz_json_next_element(LlzJsonReader *r);
+
+bool llz_json_key_is(const LlzJsonKey *key, const char *name);
+
+// Decode a string value (escapes and \u sequences) into out, truncating on a
+// UTF-8 boundary. out is set to "" and false returned for non-strings.
+bool llz_json_read_string(LlzJsonReader *r, char *out, size_t outSize);
+
+// Numbers (quoted numbers are accepted); 0 for other types
+int64_t llz_json_read_int64(LlzJsonReader *r);
+int llz_json_read_int(LlzJsonReader *r);
+
+// true only for a literal true
+bool llz_json_read_bool(LlzJsonReader *r);
+
+// Skip one value of any type, including nested containers
+bool llz_json_skip(LlzJsonReader *r);
+
+// Skip whatever is left of the object / array the cursor is inside, including
+// its closing bracket, in one pass instead of value by value
+bool llz_json_leave(LlzJsonReader *r);
+
+#endif // LLZ_JSON_INTERNAL_H
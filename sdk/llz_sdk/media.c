@@ -1,9 +1,16 @@
 #include "llz_sdk_media.h"
 #include "llz_sdk_connections.h"
+#include "llz_sdk_profiler.h"
+#include "json_internal.h"
+#include "media_internal.h"
+#include "redis_internal.h"
 
 #include "hiredis.h"
 
 #include <ctype.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -12,6 +19,7 @@
 #include <string.h>
 #include <sys/time.h>
 #include <time.h>
+#include <unistd.h>
 
 #define LLZ_MEDIA_DEFAULT_HOST "127.0.0.1"
 #define LLZ_MEDIA_DEFAULT_PORT 6379
@@ -47,55 +55,20 @@ static const LlzMediaKeyMap g_defaultKeyMap = {
 static char g_host[LLZ_MEDIA_HOST_MAX] = LLZ_MEDIA_DEFAULT_HOST;
 static int g_port = LLZ_MEDIA_DEFAULT_PORT;
 static LlzMediaKeyMap g_activeKeys;
-static redisContext *g_mediaCtx = NULL;
-static bool g_lastStateValid = false;
-static bool g_lastIsPlaying = false;
-
-// Cached Spotify state for toggle operations
-static bool g_lastShuffleEnabled = false;
-static LlzRepeatMode g_lastRepeatMode = LLZ_REPEAT_OFF;
-
-static void llz_media_disconnect(void)
-{
-    if (g_mediaCtx) {
-        redisFree(g_mediaCtx);
-        g_mediaCtx = NULL;
-    }
-}
-
-static bool llz_media_connect(void)
-{
-    llz_media_disconnect();
-
-    struct timeval timeout;
-    timeout.tv_sec = 1;
-    timeout.tv_usec = 500000;
-
-    g_mediaCtx = redisConnectWithTimeout(g_host, g_port, timeout);
-    if (!g_mediaCtx || g_mediaCtx->err) {
-        llz_media_disconnect();
-        return false;
-    }
-
-    redisSetTimeout(g_mediaCtx, timeout);
-    return true;
-}
-
+// The shared UI-thread connection lives in the connection manager (redis.c)
 static bool llz_media_ensure_connection(void)
 {
-    if (g_mediaCtx) {
-        return true;
-    }
-    return llz_media_connect();
+    return llz_redis_acquire() != NULL;
 }
 
-static void llz_media_apply_keymap(const LlzMediaKeyMap *keyMap)
+// Defaults overridden by every key the caller set
+static void llz_media_build_keymap(const LlzMediaKeyMap *keyMap, LlzMediaKeyMap *out)
 {
-    g_activeKeys = g_defaultKeyMap;
+    *out = g_defaultKeyMap;
     if (!keyMap) return;
 
 #define COPY_KEY(field) \
-    do { if (keyMap->field) g_activeKeys.field = keyMap->field; } while (0)
+    do { if (keyMap->field) out->field = keyMap->field; } while (0)
 
     COPY_KEY(trackTitle);
     COPY_KEY(artistName);
@@ -125,25 +98,13 @@ static void llz_media_apply_keymap(const LlzMediaKeyMap *keyMap)
 #undef COPY_KEY
 }
 
+// Fails fast (NULL) while the connection manager is reconnecting
 static redisReply *llz_media_command(const char *fmt, ...)
 {
-    if (!llz_media_ensure_connection()) return NULL;
-
     va_list args;
     va_start(args, fmt);
-    redisReply *reply = redisvCommand(g_mediaCtx, fmt, args);
+    redisReply *reply = llz_redis_vcommand(fmt, args);
     va_end(args);
-
-    if (!reply) {
-        llz_media_disconnect();
-        if (!llz_media_ensure_connection()) {
-            return NULL;
-        }
-        va_start(args, fmt);
-        reply = redisvCommand(g_mediaCtx, fmt, args);
-        va_end(args);
-    }
-
     return reply;
 }
 
@@ -182,368 +143,1445 @@ static bool llz_media_reply_bool(const redisReply *reply)
     return false;
 }
 
-bool LlzMediaInit(const LlzMediaConfig *config)
-{
-    llz_media_apply_keymap(config ? config->keyMap : NULL);
-
-    if (config && config->host && config->host[0] != '\0') {
-        strncpy(g_host, config->host, sizeof(g_host) - 1);
-        g_host[sizeof(g_host) - 1] = '\0';
-    } else {
-        strncpy(g_host, LLZ_MEDIA_DEFAULT_HOST, sizeof(g_host) - 1);
-        g_host[sizeof(g_host) - 1] = '\0';
+// ============================================================================
+// JSON Blob Cache
+// ============================================================================
+//
+// Library lists, the queue, podcast lists and channels are large JSON blobs
+// that plugins poll every few hundred milliseconds but that change rarely.
+// Each blob is fetched through a small Lua script that hashes the value
+// server-side and only returns it when the digest differs from the one we
+// hold, so an unchanged blob costs one tiny round trip and no parsing: the
+// parsed struct from the previous call is copied out instead. When scripting
+// is unavailable we fall back to a plain GET and skip only the parse.
+// The cache is used from the UI thread only, like the shared connection.
+
+#define LLZ_MEDIA_BLOB_KEY_MAX 128
+#define LLZ_MEDIA_BLOB_DIGEST_MAX 41
+#define LLZ_MEDIA_BLOB_RECHECK_MS 100.0
+
+typedef bool (*LlzBlobParseFn)(const char *json, size_t len, void *out);
+
+typedef struct {
+    char key[LLZ_MEDIA_BLOB_KEY_MAX];
+    char digest[LLZ_MEDIA_BLOB_DIGEST_MAX];
+    char *json;                  // Last value, NUL-terminated
+    size_t len;
+    LlzBlobParseFn parseFn;      // Parser that produced 'parsed'
+    void *parsed;
+    size_t parsedSize;
+    bool parsedOk;
+    double checkedAtMs;
+    unsigned long lastUse;
+    bool used;
+} LlzBlobEntry;
+
+// Returns 0 if the key is missing, 1 if the digest matches, else {digest, value}
+static const char *g_blobScript =
+    "local v = redis.call('GET', KEYS[1]) "
+    "if not v then return 0 end "
+    "local d = redis.sha1hex(v) "
+    "if d == ARGV[1] then return 1 end "
+    "return {d, v}";
+
+static LlzBlobEntry g_blobCache[LLZ_MEDIA_BLOB_CACHE_MAX];
+static LlzMediaBlobCacheStats g_blobStats;
+static unsigned long g_blobClock = 0;
+static char g_blobScriptSha[LLZ_MEDIA_BLOB_DIGEST_MAX] = "";
+static bool g_blobScriptUnsupported = false;
+
+static void llz_blob_clear_parsed(LlzBlobEntry *entry)
+{
+    free(entry->parsed);
+    entry->parsed = NULL;
+    entry->parsedSize = 0;
+    entry->parseFn = NULL;
+    entry->parsedOk = false;
+}
+
+static void llz_blob_clear(LlzBlobEntry *entry)
+{
+    llz_blob_clear_parsed(entry);
+    free(entry->json);
+    memset(entry, 0, sizeof(*entry));
+}
+
+static LlzBlobEntry *llz_blob_lookup(const char *key)
+{
+    LlzBlobEntry *victim = NULL;
+    for (int i = 0; i < LLZ_MEDIA_BLOB_CACHE_MAX; i++) {
+        LlzBlobEntry *entry = &g_blobCache[i];
+        if (entry->used && strcmp(entry->key, key) == 0) {
+            entry->lastUse = ++g_blobClock;
+            return entry;
+        }
+        if (!entry->used) {
+            if (!victim || victim->used) victim = entry;
+        } else if (!victim || (victim->used && entry->lastUse < victim->lastUse)) {
+            victim = entry;
+        }
     }
 
-    g_port = (config && config->port > 0) ? config->port : LLZ_MEDIA_DEFAULT_PORT;
-
-    return llz_media_connect();
+    llz_blob_clear(victim);
+    victim->used = true;
+    strncpy(victim->key, key, sizeof(victim->key) - 1);
+    victim->lastUse = ++g_blobClock;
+    return victim;
 }
 
-void LlzMediaShutdown(void)
+// Replace the cached value, dropping the parsed copy
+static bool llz_blob_store(LlzBlobEntry *entry, const char *digest, const char *data, size_t len)
 {
-    llz_media_disconnect();
-    g_lastStateValid = false;
+    char *copy = (char *)malloc(len + 1);
+    if (!copy) return false;
+    memcpy(copy, data, len);
+    copy[len] = '\0';
+
+    llz_blob_clear_parsed(entry);
+    free(entry->json);
+    entry->json = copy;
+    entry->len = len;
+    strncpy(entry->digest, digest, sizeof(entry->digest) - 1);
+    entry->digest[sizeof(entry->digest) - 1] = '\0';
+    return true;
 }
 
-bool LlzMediaGetState(LlzMediaState *outState)
+static void llz_blob_forget_value(LlzBlobEntry *entry)
 {
-    if (!outState) return false;
-    memset(outState, 0, sizeof(*outState));
-    outState->volumePercent = -1;
-
-    // Fetch basic media state
-    redisReply *reply = llz_media_command(
-        "MGET %s %s %s %s %s %s %s %s",
-        g_activeKeys.trackTitle,
-        g_activeKeys.artistName,
-        g_activeKeys.albumName,
-        g_activeKeys.isPlaying,
-        g_activeKeys.durationSeconds,
-        g_activeKeys.progressSeconds,
-        g_activeKeys.albumArtPath,
-        g_activeKeys.volumePercent
-    );
+    llz_blob_clear_parsed(entry);
+    free(entry->json);
+    entry->json = NULL;
+    entry->len = 0;
+    entry->digest[0] = '\0';
+}
 
+static bool llz_blob_load_script(void)
+{
+    redisReply *reply = llz_media_command("SCRIPT LOAD %s", g_blobScript);
     if (!reply) return false;
-    bool success = false;
 
-    if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 8) {
-        llz_media_copy_reply(outState->track, sizeof(outState->track), reply->element[0]);
-        llz_media_copy_reply(outState->artist, sizeof(outState->artist), reply->element[1]);
-        llz_media_copy_reply(outState->album, sizeof(outState->album), reply->element[2]);
-        outState->isPlaying = llz_media_reply_bool(reply->element[3]);
-        outState->durationSeconds = llz_media_reply_int(reply->element[4]);
-        outState->positionSeconds = llz_media_reply_int(reply->element[5]);
-        llz_media_copy_reply(outState->albumArtPath, sizeof(outState->albumArtPath), reply->element[6]);
-        if (reply->element[7] && reply->element[7]->type != REDIS_REPLY_NIL) {
-            outState->volumePercent = llz_media_reply_int(reply->element[7]);
-        }
-        outState->updatedAt = (int64_t)time(NULL);
-
-        g_lastIsPlaying = outState->isPlaying;
-        g_lastStateValid = true;
-        success = true;
+    bool ok = reply->type == REDIS_REPLY_STRING && reply->str &&
+              reply->len < sizeof(g_blobScriptSha);
+    if (ok) {
+        memcpy(g_blobScriptSha, reply->str, reply->len);
+        g_blobScriptSha[reply->len] = '\0';
+    } else if (reply->type == REDIS_REPLY_ERROR) {
+        printf("[MEDIA] Blob digest script unavailable (%s), using plain GET\n",
+               reply->str ? reply->str : "error");
+        g_blobScriptUnsupported = true;
     }
     freeReplyObject(reply);
+    return ok;
+}
 
-    // Fetch Spotify-specific state (shuffle, repeat, liked, track/album/artist IDs)
-    if (success) {
-        redisReply *spotifyReply = llz_media_command(
-            "MGET media:shuffle_enabled media:repeat_mode media:track_liked media:track_id media:spotify_track_id media:spotify_album_id media:spotify_artist_id"
-        );
-        if (spotifyReply && spotifyReply->type == REDIS_REPLY_ARRAY && spotifyReply->elements >= 7) {
-            // Shuffle enabled
-            outState->shuffleEnabled = llz_media_reply_bool(spotifyReply->element[0]);
-            g_lastShuffleEnabled = outState->shuffleEnabled;
-
-            // Repeat mode
-            if (spotifyReply->element[1] && spotifyReply->element[1]->type == REDIS_REPLY_STRING) {
-                const char *mode = spotifyReply->element[1]->str;
-                if (mode) {
-                    if (strcmp(mode, "track") == 0) {
-                        outState->repeatMode = LLZ_REPEAT_TRACK;
-                    } else if (strcmp(mode, "context") == 0) {
-                        outState->repeatMode = LLZ_REPEAT_CONTEXT;
-                    } else {
-                        outState->repeatMode = LLZ_REPEAT_OFF;
-                    }
-                    g_lastRepeatMode = outState->repeatMode;
-                }
-            }
-
-            // Track liked
-            outState->isLiked = llz_media_reply_bool(spotifyReply->element[2]);
-
-            // Spotify track ID (legacy key)
-            llz_media_copy_reply(outState->spotifyTrackId, sizeof(outState->spotifyTrackId), spotifyReply->element[3]);
-
-            // Spotify IDs from MediaState (new keys for context menu actions)
-            // These may override the legacy track_id if present
-            char tempTrackId[LLZ_MEDIA_TEXT_MAX] = {0};
-            llz_media_copy_reply(tempTrackId, sizeof(tempTrackId), spotifyReply->element[4]);
-            if (tempTrackId[0]) {
-                strncpy(outState->spotifyTrackId, tempTrackId, sizeof(outState->spotifyTrackId) - 1);
-            }
-
-            // Spotify album ID
-            llz_media_copy_reply(outState->spotifyAlbumId, sizeof(outState->spotifyAlbumId), spotifyReply->element[5]);
+// Fallback path: transfer the value and compare a local FNV-1a digest so an
+// unchanged blob is at least not parsed again
+static bool llz_blob_apply_plain(LlzBlobEntry *entry, const redisReply *reply)
+{
+    bool ok = true;
+    if (reply->type == REDIS_REPLY_STRING && reply->str) {
+        uint64_t hash = 1469598103934665603ULL;
+        for (size_t i = 0; i < reply->len; i++) {
+            hash ^= (unsigned char)reply->str[i];
+            hash *= 1099511628211ULL;
+        }
+        char digest[LLZ_MEDIA_BLOB_DIGEST_MAX];
+        snprintf(digest, sizeof(digest), "fnv:%016llx", (unsigned long long)hash);
 
-            // Spotify artist ID
-            llz_media_copy_reply(outState->spotifyArtistId, sizeof(outState->spotifyArtistId), spotifyReply->element[6]);
+        g_blobStats.transfers++;
+        g_blobStats.bytesTransferred += reply->len;
+        if (entry->json && strcmp(digest, entry->digest) == 0) {
+            g_blobStats.unchanged++;
+        } else {
+            ok = llz_blob_store(entry, digest, reply->str, reply->len);
         }
-        if (spotifyReply) freeReplyObject(spotifyReply);
+    } else if (reply->type == REDIS_REPLY_NIL) {
+        llz_blob_forget_value(entry);
+    } else {
+        ok = false;
     }
+    return ok;
+}
 
-    return success;
+// Digest path: 0 (missing), 1 (unchanged) or {digest, value}
+static bool llz_blob_apply_digest(LlzBlobEntry *entry, const redisReply *reply)
+{
+    bool ok = true;
+    if (reply->type == REDIS_REPLY_INTEGER) {
+        if (reply->integer == 1 && entry->json) {
+            g_blobStats.unchanged++;
+        } else {
+            llz_blob_forget_value(entry);
+        }
+    } else if (reply->type == REDIS_REPLY_ARRAY && reply->elements == 2 &&
+               reply->element[0]->type == REDIS_REPLY_STRING &&
+               reply->element[1]->type == REDIS_REPLY_STRING) {
+        g_blobStats.transfers++;
+        g_blobStats.bytesTransferred += reply->element[1]->len;
+        ok = llz_blob_store(entry, reply->element[0]->str,
+                            reply->element[1]->str, reply->element[1]->len);
+    } else {
+        // WRONGTYPE or a script error: report it like a failed GET
+        ok = false;
+    }
+    return ok;
 }
 
-bool LlzMediaGetConnection(LlzConnectionStatus *outStatus)
+static bool llz_blob_refresh_plain(LlzBlobEntry *entry)
 {
-    if (!outStatus) return false;
-    memset(outStatus, 0, sizeof(*outStatus));
+    redisReply *reply = llz_media_command("GET %s", entry->key);
+    if (!reply) return false;
 
-    redisReply *reply = llz_media_command(
-        "MGET %s %s",
-        g_activeKeys.bleConnected,
-        g_activeKeys.bleName
-    );
+    bool ok = llz_blob_apply_plain(entry, reply);
+    freeReplyObject(reply);
+    return ok;
+}
 
-    if (!reply) return false;
-    bool success = false;
+static bool llz_blob_refresh(LlzBlobEntry *entry)
+{
+    if (g_blobScriptUnsupported) return llz_blob_refresh_plain(entry);
+    if (g_blobScriptSha[0] == '\0' && !llz_blob_load_script()) {
+        return g_blobScriptUnsupported ? llz_blob_refresh_plain(entry) : false;
+    }
 
-    if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 2) {
-        outStatus->connected = llz_media_reply_bool(reply->element[0]);
-        llz_media_copy_reply(outStatus->deviceName, sizeof(outStatus->deviceName), reply->element[1]);
-        if (outStatus->deviceName[0] == '\0') {
-            strncpy(outStatus->deviceName, outStatus->connected ? "Unknown Device" : "Not Connected", sizeof(outStatus->deviceName) - 1);
-            outStatus->deviceName[sizeof(outStatus->deviceName) - 1] = '\0';
+    redisReply *reply = NULL;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        reply = llz_media_command("EVALSHA %s 1 %s %s", g_blobScriptSha,
+                                  entry->key, entry->json ? entry->digest : "");
+        if (!reply) return false;
+
+        // Script cache flushed (server restart, SCRIPT FLUSH): load it again
+        bool missing = reply->type == REDIS_REPLY_ERROR && reply->str &&
+                       strncmp(reply->str, "NOSCRIPT", 8) == 0;
+        if (!missing) break;
+        freeReplyObject(reply);
+        reply = NULL;
+        if (!llz_blob_load_script()) {
+            return g_blobScriptUnsupported ? llz_blob_refresh_plain(entry) : false;
         }
-        success = true;
     }
+    if (!reply) return false;
 
+    bool ok = llz_blob_apply_digest(entry, reply);
     freeReplyObject(reply);
-    return success;
+    return ok;
 }
 
-float LlzMediaGetProgressPercent(const LlzMediaState *state)
+// True while a value checked within the last LLZ_MEDIA_BLOB_RECHECK_MS can be
+// served without asking Redis
+static bool llz_blob_is_fresh(const LlzBlobEntry *entry, double now)
 {
-    if (!state || state->durationSeconds <= 0) return 0.0f;
-    float pct = (float)state->positionSeconds / (float)state->durationSeconds;
-    if (pct < 0.0f) pct = 0.0f;
-    if (pct > 1.0f) pct = 1.0f;
-    return pct;
+    return entry->json && entry->checkedAtMs > 0.0 &&
+           now - entry->checkedAtMs < LLZ_MEDIA_BLOB_RECHECK_MS;
 }
 
-static const char *llz_media_action_string(LlzPlaybackCommand action, int *value)
+// Returns the entry holding the current value of key, or NULL if the key is
+// missing or Redis is unreachable
+static LlzBlobEntry *llz_blob_fetch(const char *key)
 {
-    switch (action) {
-        case LLZ_PLAYBACK_PLAY: return "play";
-        case LLZ_PLAYBACK_PAUSE: return "pause";
-        case LLZ_PLAYBACK_NEXT: return "next";
-        case LLZ_PLAYBACK_PREVIOUS: return "previous";
-        case LLZ_PLAYBACK_SEEK_TO:
-            if (value && *value < 0) *value = 0;
-            return "seek";
-        case LLZ_PLAYBACK_SET_VOLUME:
-            if (value) {
-                if (*value < 0) *value = 0;
-                if (*value > 100) *value = 100;
-            }
-            return "volume";
-        case LLZ_PLAYBACK_TOGGLE:
-            if (g_lastStateValid && g_lastIsPlaying) {
-                return "pause";
-            }
-            return "play";
-        // Spotify-specific controls
-        case LLZ_PLAYBACK_SHUFFLE_ON: return "shuffle_on";
-        case LLZ_PLAYBACK_SHUFFLE_OFF: return "shuffle_off";
-        case LLZ_PLAYBACK_SHUFFLE_TOGGLE:
-            return g_lastShuffleEnabled ? "shuffle_off" : "shuffle_on";
-        case LLZ_PLAYBACK_REPEAT_OFF: return "repeat_off";
-        case LLZ_PLAYBACK_REPEAT_TRACK: return "repeat_track";
-        case LLZ_PLAYBACK_REPEAT_CONTEXT: return "repeat_context";
-        case LLZ_PLAYBACK_REPEAT_CYCLE:
-            // Cycle: off -> track -> context -> off
-            switch (g_lastRepeatMode) {
-                case LLZ_REPEAT_OFF: return "repeat_track";
-                case LLZ_REPEAT_TRACK: return "repeat_context";
-                case LLZ_REPEAT_CONTEXT: return "repeat_off";
-            }
-            return "repeat_off";
-        case LLZ_PLAYBACK_LIKE_TRACK: return "like_track";
-        case LLZ_PLAYBACK_UNLIKE_TRACK: return "unlike_track";
-        default:
-            return NULL;
-    }
-}
+    if (!key || key[0] == '\0' || strlen(key) >= LLZ_MEDIA_BLOB_KEY_MAX) return NULL;
 
-static bool llz_media_push_command(const char *action, int value)
-{
-    if (!action || !g_activeKeys.playbackCommandQueue) return false;
+    LlzBlobEntry *entry = llz_blob_lookup(key);
+    g_blobStats.lookups++;
 
-    long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"%s\",\"value\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
-        action,
-        value,
-        ts
-    );
+    // Several getters on the same blob within one frame share a single check
+    double now = llz_redis_now_ms();
+    if (llz_blob_is_fresh(entry, now)) return entry;
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-    return success;
+    if (!llz_blob_refresh(entry)) return NULL;
+    entry->checkedAtMs = now;
+    return entry->json ? entry : NULL;
 }
 
-bool LlzMediaSendCommand(LlzPlaybackCommand action, int value)
+// Copy a blob into a caller buffer. Blobs that do not fit fail unless
+// truncate is set (the podcast getters have always truncated).
+static bool llz_blob_get_json(const char *key, char *outJson, size_t maxLen, bool truncate)
 {
-    const char *actionStr = llz_media_action_string(action, &value);
-    if (!actionStr) return false;
-    return llz_media_push_command(actionStr, value);
+    if (!outJson || maxLen == 0) return false;
+    outJson[0] = '\0';
+
+    LlzBlobEntry *entry = llz_blob_fetch(key);
+    if (!entry) return false;
+
+    size_t len = entry->len;
+    if (len >= maxLen) {
+        if (!truncate) return false;
+        len = maxLen - 1;
+    }
+    memcpy(outJson, entry->json, len);
+    outJson[len] = '\0';
+    return true;
 }
 
-bool LlzMediaSeekSeconds(int seconds)
+// Parse a blob into out, reusing the previous result when the blob is
+// unchanged. out is zeroed when the blob is unavailable.
+static bool llz_blob_copy_parsed(LlzBlobEntry *entry, void *out, size_t outSize, LlzBlobParseFn parseFn)
 {
-    return LlzMediaSendCommand(LLZ_PLAYBACK_SEEK_TO, seconds);
+    if (!entry) {
+        memset(out, 0, outSize);
+        return false;
+    }
+
+    if (entry->parsed && entry->parseFn == parseFn && entry->parsedSize == outSize) {
+        memcpy(out, entry->parsed, outSize);
+        g_blobStats.parseHits++;
+        return entry->parsedOk;
+    }
+
+    memset(out, 0, outSize);
+    bool ok = parseFn(entry->json, entry->len, out);
+    g_blobStats.parses++;
+
+    llz_blob_clear_parsed(entry);
+    entry->parsed = malloc(outSize);
+    if (entry->parsed) {
+        memcpy(entry->parsed, out, outSize);
+        entry->parsedSize = outSize;
+        entry->parseFn = parseFn;
+        entry->parsedOk = ok;
+    }
+    return ok;
 }
 
-bool LlzMediaSetVolume(int percent)
+static bool llz_blob_get_parsed(const char *key, void *out, size_t outSize, LlzBlobParseFn parseFn)
 {
-    return LlzMediaSendCommand(LLZ_PLAYBACK_SET_VOLUME, percent);
+    return llz_blob_copy_parsed(llz_blob_fetch(key), out, outSize, parseFn);
 }
 
-// ============================================================================
-// Spotify Playback Controls Implementation
-// ============================================================================
-
-bool LlzMediaSetShuffle(bool enabled)
+void LlzMediaInvalidateBlob(const char *key)
 {
-    return LlzMediaSendCommand(enabled ? LLZ_PLAYBACK_SHUFFLE_ON : LLZ_PLAYBACK_SHUFFLE_OFF, 0);
+    for (int i = 0; i < LLZ_MEDIA_BLOB_CACHE_MAX; i++) {
+        LlzBlobEntry *entry = &g_blobCache[i];
+        if (!entry->used) continue;
+        if (!key || strcmp(entry->key, key) == 0) {
+            llz_blob_forget_value(entry);
+            entry->checkedAtMs = 0.0;
+        }
+    }
 }
 
-bool LlzMediaToggleShuffle(void)
+void LlzMediaGetBlobCacheStats(LlzMediaBlobCacheStats *outStats)
 {
-    return LlzMediaSendCommand(LLZ_PLAYBACK_SHUFFLE_TOGGLE, 0);
+    if (!outStats) return;
+    *outStats = g_blobStats;
+    outStats->entries = 0;
+    for (int i = 0; i < LLZ_MEDIA_BLOB_CACHE_MAX; i++) {
+        if (g_blobCache[i].used) outStats->entries++;
+    }
 }
 
-bool LlzMediaSetRepeat(LlzRepeatMode mode)
-{
-    switch (mode) {
-        case LLZ_REPEAT_OFF:
-            return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_OFF, 0);
-        case LLZ_REPEAT_TRACK:
-            return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_TRACK, 0);
-        case LLZ_REPEAT_CONTEXT:
-            return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_CONTEXT, 0);
+// ============================================================================
+// Background State Poller
+// ============================================================================
+//
+// hiredis contexts are not thread-safe, so the poller owns private
+// connections. Results are published into a double buffer: the writer fills
+// the slot readers are not using, bumps that slot's sequence around the write
+// (odd = write in progress) and then flips g_snapIndex. Readers copy the
+// published slot and retry only if its sequence moved underneath them, so
+// LlzMediaGetState never blocks the render thread on Redis.
+//
+// When the server allows keyspace notifications the poller subscribes to the
+// state keys and only re-fetches keys that changed, with a slow full resync
+// as a safety net. Otherwise it falls back to a full MGET every interval.
+
+#define LLZ_MEDIA_PUSH_RESYNC_MS 5000
+#define LLZ_MEDIA_PUSH_COALESCE_MS 10
+
+// Every Redis key that feeds the snapshot, in MGET order
+typedef enum {
+    LLZ_MF_TRACK = 0,
+    LLZ_MF_ARTIST,
+    LLZ_MF_ALBUM,
+    LLZ_MF_PLAYING,
+    LLZ_MF_DURATION,
+    LLZ_MF_PROGRESS,
+    LLZ_MF_ART_PATH,
+    LLZ_MF_VOLUME,
+    LLZ_MF_SHUFFLE,
+    LLZ_MF_REPEAT,
+    LLZ_MF_LIKED,
+    LLZ_MF_TRACK_ID,
+    LLZ_MF_SPOTIFY_TRACK_ID,
+    LLZ_MF_SPOTIFY_ALBUM_ID,
+    LLZ_MF_SPOTIFY_ARTIST_ID,
+    LLZ_MF_BLE_CONNECTED,
+    LLZ_MF_BLE_NAME,
+    LLZ_MF_LYRICS_HASH,
+    LLZ_MF_COUNT
+} LlzMediaField;
+
+#define LLZ_MF_ALL ((1u << LLZ_MF_COUNT) - 1u)
+
+typedef struct {
+    LlzMediaState media;
+    LlzConnectionStatus connection;
+    bool mediaValid;
+    bool connectionValid;
+    // Raw values needed to derive media.spotifyTrackId / connection.deviceName
+    char legacyTrackId[LLZ_MEDIA_TEXT_MAX];
+    char spotifyTrackId[LLZ_MEDIA_TEXT_MAX];
+    char bleName[LLZ_MEDIA_TEXT_MAX];
+    char lyricsHash[64];           // Hash of the set in the Redis lyrics slot
+} LlzMediaSnapshot;
+
+static LlzMediaSnapshot g_snap[2];
+static uint32_t g_snapSlotSeq[2];
+static int g_snapIndex = 0;
+static uint32_t g_stateSeq = 0;
+
+static pthread_t g_pollThread;
+static int g_pollWakePipe[2] = {-1, -1};
+static bool g_pollRunning = false;     // Main thread only
+static bool g_pollStop = false;        // Written by main thread, read by poller
+static int g_pollIntervalMs = LLZ_MEDIA_DEFAULT_POLL_MS;
+static bool g_pollOnly = false;
+static bool g_pushActive = false;
+static bool g_mediaConfigured = false;
+
+// What a poller thread runs with. Filled in by llz_media_poller_start while
+// no poller is running and handed over as the thread argument, so the thread
+// never reads the globals LlzMediaInit rewrites.
+typedef struct {
+    LlzMediaKeyMap keys;
+    bool pollOnly;
+} LlzMediaPollConfig;
+
+static LlzMediaPollConfig g_pollConfig;
+
+static void llz_media_field_keys(const LlzMediaKeyMap *keys, const char *out[LLZ_MF_COUNT])
+{
+    out[LLZ_MF_TRACK] = keys->trackTitle;
+    out[LLZ_MF_ARTIST] = keys->artistName;
+    out[LLZ_MF_ALBUM] = keys->albumName;
+    out[LLZ_MF_PLAYING] = keys->isPlaying;
+    out[LLZ_MF_DURATION] = keys->durationSeconds;
+    out[LLZ_MF_PROGRESS] = keys->progressSeconds;
+    out[LLZ_MF_ART_PATH] = keys->albumArtPath;
+    out[LLZ_MF_VOLUME] = keys->volumePercent;
+    out[LLZ_MF_SHUFFLE] = "media:shuffle_enabled";
+    out[LLZ_MF_REPEAT] = "media:repeat_mode";
+    out[LLZ_MF_LIKED] = "media:track_liked";
+    out[LLZ_MF_TRACK_ID] = "media:track_id";
+    out[LLZ_MF_SPOTIFY_TRACK_ID] = "media:spotify_track_id";
+    out[LLZ_MF_SPOTIFY_ALBUM_ID] = "media:spotify_album_id";
+    out[LLZ_MF_SPOTIFY_ARTIST_ID] = "media:spotify_artist_id";
+    out[LLZ_MF_BLE_CONNECTED] = keys->bleConnected;
+    out[LLZ_MF_BLE_NAME] = keys->bleName;
+    out[LLZ_MF_LYRICS_HASH] = keys->lyricsHash;
+}
+
+static void llz_media_apply_field(LlzMediaSnapshot *snap, LlzMediaField field, const redisReply *reply)
+{
+    LlzMediaState *m = &snap->media;
+
+    switch (field) {
+        case LLZ_MF_TRACK: llz_media_copy_reply(m->track, sizeof(m->track), reply); break;
+        case LLZ_MF_ARTIST: llz_media_copy_reply(m->artist, sizeof(m->artist), reply); break;
+        case LLZ_MF_ALBUM: llz_media_copy_reply(m->album, sizeof(m->album), reply); break;
+        case LLZ_MF_PLAYING: m->isPlaying = llz_media_reply_bool(reply); break;
+        case LLZ_MF_DURATION: m->durationSeconds = llz_media_reply_int(reply); break;
+        case LLZ_MF_PROGRESS: m->positionSeconds = llz_media_reply_int(reply); break;
+        case LLZ_MF_ART_PATH: llz_media_copy_reply(m->albumArtPath, sizeof(m->albumArtPath), reply); break;
+        case LLZ_MF_VOLUME:
+            m->volumePercent = (reply && reply->type != REDIS_REPLY_NIL) ? llz_media_reply_int(reply) : -1;
+            break;
+        case LLZ_MF_SHUFFLE: m->shuffleEnabled = llz_media_reply_bool(reply); break;
+        case LLZ_MF_REPEAT:
+            if (reply && reply->type == REDIS_REPLY_STRING && reply->str) {
+                if (strcmp(reply->str, "track") == 0) {
+                    m->repeatMode = LLZ_REPEAT_TRACK;
+                } else if (strcmp(reply->str, "context") == 0) {
+                    m->repeatMode = LLZ_REPEAT_CONTEXT;
+                } else {
+                    m->repeatMode = LLZ_REPEAT_OFF;
+                }
+            }
+            break;
+        case LLZ_MF_LIKED: m->isLiked = llz_media_reply_bool(reply); break;
+        case LLZ_MF_TRACK_ID: llz_media_copy_reply(snap->legacyTrackId, sizeof(snap->legacyTrackId), reply); break;
+        case LLZ_MF_SPOTIFY_TRACK_ID: llz_media_copy_reply(snap->spotifyTrackId, sizeof(snap->spotifyTrackId), reply); break;
+        case LLZ_MF_SPOTIFY_ALBUM_ID: llz_media_copy_reply(m->spotifyAlbumId, sizeof(m->spotifyAlbumId), reply); break;
+        case LLZ_MF_SPOTIFY_ARTIST_ID: llz_media_copy_reply(m->spotifyArtistId, sizeof(m->spotifyArtistId), reply); break;
+        case LLZ_MF_BLE_CONNECTED: snap->connection.connected = llz_media_reply_bool(reply); break;
+        case LLZ_MF_BLE_NAME: llz_media_copy_reply(snap->bleName, sizeof(snap->bleName), reply); break;
+        case LLZ_MF_LYRICS_HASH: llz_media_copy_reply(snap->lyricsHash, sizeof(snap->lyricsHash), reply); break;
+        default: break;
     }
-    return false;
 }
 
-bool LlzMediaCycleRepeat(void)
+// Recompute fields that depend on more than one key
+static void llz_media_snapshot_derive(LlzMediaSnapshot *snap)
 {
-    return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_CYCLE, 0);
+    // The MediaState spotify_track_id overrides the legacy track_id if present
+    const char *trackId = snap->spotifyTrackId[0] ? snap->spotifyTrackId : snap->legacyTrackId;
+    strncpy(snap->media.spotifyTrackId, trackId, sizeof(snap->media.spotifyTrackId) - 1);
+    snap->media.spotifyTrackId[sizeof(snap->media.spotifyTrackId) - 1] = '\0';
+
+    const char *name = snap->bleName;
+    if (name[0] == '\0') {
+        name = snap->connection.connected ? "Unknown Device" : "Not Connected";
+    }
+    strncpy(snap->connection.deviceName, name, sizeof(snap->connection.deviceName) - 1);
+    snap->connection.deviceName[sizeof(snap->connection.deviceName) - 1] = '\0';
 }
 
-// Helper to push command with trackId
-static bool llz_media_push_track_command(const char *action, const char *trackId)
+// MGET the keys selected by fieldMask and merge them into snap.
+// Returns false if the connection failed (caller reconnects).
+static bool llz_media_fetch_fields(redisContext *ctx, const LlzMediaKeyMap *keys, uint32_t fieldMask, LlzMediaSnapshot *snap)
 {
-    if (!action || !g_activeKeys.playbackCommandQueue) return false;
+    if (fieldMask == 0) return true;
 
-    long long ts = (long long)time(NULL);
-    redisReply *reply;
+    const char *fieldKeys[LLZ_MF_COUNT];
+    llz_media_field_keys(keys, fieldKeys);
 
-    if (trackId && trackId[0] != '\0') {
-        // Include trackId in command
-        reply = llz_media_command(
-            "LPUSH %s {\"action\":\"%s\",\"trackId\":\"%s\",\"timestamp\":%lld}",
-            g_activeKeys.playbackCommandQueue,
-            action,
-            trackId,
-            ts
-        );
-    } else {
-        // No trackId - use current track
-        reply = llz_media_command(
-            "LPUSH %s {\"action\":\"%s\",\"timestamp\":%lld}",
-            g_activeKeys.playbackCommandQueue,
-            action,
-            ts
-        );
+    const char *argv[LLZ_MF_COUNT + 1];
+    LlzMediaField fields[LLZ_MF_COUNT];
+    int argc = 0;
+    argv[argc++] = "MGET";
+    for (int f = 0; f < LLZ_MF_COUNT; f++) {
+        if ((fieldMask & (1u << f)) && fieldKeys[f]) {
+            fields[argc - 1] = (LlzMediaField)f;
+            argv[argc++] = fieldKeys[f];
+        }
     }
+    if (argc == 1) return true;
 
+    redisReply *reply = redisCommandArgv(ctx, argc, argv, NULL);
     if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
 
-    printf("[SPOTIFY] Queued %s command (trackId=%s)\n", action, trackId ? trackId : "(current)");
-    return success;
+    if (reply->type == REDIS_REPLY_ARRAY && reply->elements == (size_t)(argc - 1)) {
+        for (size_t i = 0; i < reply->elements; i++) {
+            llz_media_apply_field(snap, fields[i], reply->element[i]);
+        }
+        if ((fieldMask & LLZ_MF_ALL) == LLZ_MF_ALL) {
+            snap->mediaValid = true;
+            snap->connectionValid = true;
+        }
+        llz_media_snapshot_derive(snap);
+    }
+
+    freeReplyObject(reply);
+    return true;
 }
 
-bool LlzMediaLikeTrack(const char *trackId)
+static bool llz_media_fetch_all(redisContext *ctx, const LlzMediaKeyMap *keys, LlzMediaSnapshot *out)
 {
-    return llz_media_push_track_command("like_track", trackId);
+    memset(out, 0, sizeof(*out));
+    out->media.volumePercent = -1;
+    return llz_media_fetch_fields(ctx, keys, LLZ_MF_ALL, out);
 }
 
-bool LlzMediaUnlikeTrack(const char *trackId)
+static void llz_media_snapshot_read(LlzMediaSnapshot *out)
 {
-    return llz_media_push_track_command("unlike_track", trackId);
+    for (;;) {
+        int idx = __atomic_load_n(&g_snapIndex, __ATOMIC_ACQUIRE);
+        uint32_t before = __atomic_load_n(&g_snapSlotSeq[idx], __ATOMIC_ACQUIRE);
+        if (before & 1u) continue;
+        memcpy(out, &g_snap[idx], sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&g_snapSlotSeq[idx], __ATOMIC_RELAXED) == before) return;
+    }
 }
 
-bool LlzMediaRequestSpotifyState(void)
+// Single writer (poller thread, or the main thread before it starts)
+static void llz_media_snapshot_publish(const LlzMediaSnapshot *snap)
 {
-    if (!g_activeKeys.playbackCommandQueue) return false;
+    int next = __atomic_load_n(&g_snapIndex, __ATOMIC_RELAXED) ^ 1;
 
-    long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_spotify_state\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
-        ts
-    );
+    __atomic_store_n(&g_snapSlotSeq[next], g_snapSlotSeq[next] + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&g_snap[next], snap, sizeof(*snap));
+    __atomic_store_n(&g_snapSlotSeq[next], g_snapSlotSeq[next] + 1, __ATOMIC_RELEASE);
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
+    __atomic_store_n(&g_snapIndex, next, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&g_stateSeq, 1, __ATOMIC_RELEASE);
+}
 
-    if (success) {
-        printf("[SPOTIFY] Requested Spotify playback state refresh\n");
-    }
-    return success;
+// updatedAt ticks every second, so it is ignored when deciding whether
+// anything changed (otherwise the sequence would bump on every poll).
+static bool llz_media_snapshot_changed(const LlzMediaSnapshot *a, const LlzMediaSnapshot *b)
+{
+    if (a->mediaValid != b->mediaValid || a->connectionValid != b->connectionValid) return true;
+    LlzMediaState ma = a->media;
+    LlzMediaState mb = b->media;
+    ma.updatedAt = 0;
+    mb.updatedAt = 0;
+    if (memcmp(&ma, &mb, sizeof(ma)) != 0) return true;
+    if (strcmp(a->lyricsHash, b->lyricsHash) != 0) return true;
+    return memcmp(&a->connection, &b->connection, sizeof(a->connection)) != 0;
 }
 
-// CRC32 implementation matching Android's java.util.zip.CRC32
-static uint32_t llz_crc32_table[256];
-static bool llz_crc32_table_init = false;
+static int64_t llz_media_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
 
-static void llz_crc32_init_table(void)
+// Drain the wake pipe; returns true if a stop was requested
+static bool llz_media_poll_drain_wake(void)
 {
-    if (llz_crc32_table_init) return;
-    for (uint32_t i = 0; i < 256; i++) {
-        uint32_t crc = i;
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ 0xEDB88320;
-            } else {
-                crc >>= 1;
-            }
-        }
-        llz_crc32_table[i] = crc;
+    char buf[32];
+    while (read(g_pollWakePipe[0], buf, sizeof(buf)) > 0) {
     }
-    llz_crc32_table_init = true;
+    return __atomic_load_n(&g_pollStop, __ATOMIC_ACQUIRE);
 }
 
-static uint32_t llz_crc32(const char *data, size_t len)
+// True when the server already emits keyspace events for string writes and
+// deletes/expiry. The config is server-wide, so it is only read, never set.
+static bool llz_media_keyspace_events_enabled(redisContext *ctx)
 {
-    llz_crc32_init_table();
-    uint32_t crc = 0xFFFFFFFF;
-    for (size_t i = 0; i < len; i++) {
-        crc = llz_crc32_table[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+    redisReply *reply = redisCommand(ctx, "CONFIG GET notify-keyspace-events");
+    if (!reply) return false;
+
+    char flags[64] = {0};
+    bool ok = false;
+    if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 2 &&
+        reply->element[1]->type == REDIS_REPLY_STRING) {
+        strncpy(flags, reply->element[1]->str, sizeof(flags) - 1);
+        ok = true;
     }
-    return crc ^ 0xFFFFFFFF;
+    freeReplyObject(reply);
+    if (!ok) return false;
+
+    bool hasAll = strchr(flags, 'A') != NULL;
+    bool hasKeyspace = strchr(flags, 'K') != NULL;
+    bool hasString = hasAll || strchr(flags, '$') != NULL;
+    bool hasGeneric = hasAll || strchr(flags, 'g') != NULL;
+    return hasKeyspace && hasString && hasGeneric;
 }
 
-// Helper to skip leading whitespace
+// Database the connection is using (keyspace channels are per database).
+// CLIENT INFO needs Redis 6.2; older servers report the default, 0.
+static int llz_media_selected_db(redisContext *ctx)
+{
+    int db = 0;
+    redisReply *reply = redisCommand(ctx, "CLIENT INFO");
+    if (!reply) return db;
+    if (reply->type == REDIS_REPLY_STRING) {
+        const char *field = strstr(reply->str, " db=");
+        if (field) db = atoi(field + 4);
+    }
+    freeReplyObject(reply);
+    return db;
+}
+
+// Subscribe a dedicated connection to the keyspace channel of every state key
+static redisContext *llz_media_push_connect(const LlzMediaKeyMap *keys)
+{
+    redisContext *sub = llz_redis_open();
+    if (!sub) return NULL;
+
+    if (!llz_media_keyspace_events_enabled(sub)) {
+        printf("[MEDIA] Keyspace notifications off (notify-keyspace-events needs K$g), polling every %d ms\n",
+               __atomic_load_n(&g_pollIntervalMs, __ATOMIC_RELAXED));
+        redisFree(sub);
+        return NULL;
+    }
+    int db = llz_media_selected_db(sub);
+
+    const char *fieldKeys[LLZ_MF_COUNT];
+    llz_media_field_keys(keys, fieldKeys);
+
+    char channels[LLZ_MF_COUNT][LLZ_MEDIA_HOST_MAX];
+    const char *argv[LLZ_MF_COUNT + 1];
+    int argc = 0;
+    argv[argc++] = "SUBSCRIBE";
+    for (int f = 0; f < LLZ_MF_COUNT; f++) {
+        if (!fieldKeys[f]) continue;
+        snprintf(channels[argc - 1], sizeof(channels[0]), "__keyspace@%d__:%s", db, fieldKeys[f]);
+        argv[argc] = channels[argc - 1];
+        argc++;
+    }
+
+    if (redisAppendCommandArgv(sub, argc, argv, NULL) != REDIS_OK) {
+        redisFree(sub);
+        return NULL;
+    }
+    int done = 0;
+    while (!done) {
+        if (redisBufferWrite(sub, &done) != REDIS_OK) {
+            redisFree(sub);
+            return NULL;
+        }
+    }
+    return sub;
+}
+
+// Parse buffered pub/sub messages, marking fields whose key changed.
+// Returns false if the subscriber connection broke.
+static bool llz_media_push_collect(redisContext *sub, const LlzMediaKeyMap *keys, uint32_t *dirtyMask)
+{
+    const char *fieldKeys[LLZ_MF_COUNT];
+    llz_media_field_keys(keys, fieldKeys);
+
+    for (;;) {
+        void *r = NULL;
+        if (redisGetReplyFromReader(sub, &r) != REDIS_OK) return false;
+        if (!r) return true;
+
+        redisReply *msg = (redisReply *)r;
+        if (msg->type == REDIS_REPLY_ARRAY && msg->elements >= 3 &&
+            msg->element[0]->type == REDIS_REPLY_STRING && strcmp(msg->element[0]->str, "message") == 0 &&
+            msg->element[1]->type == REDIS_REPLY_STRING) {
+            const char *channel = msg->element[1]->str;
+            const char *key = strstr(channel, "__:");
+            key = key ? key + 3 : channel;
+            for (int f = 0; f < LLZ_MF_COUNT; f++) {
+                if (fieldKeys[f] && strcmp(fieldKeys[f], key) == 0) {
+                    *dirtyMask |= 1u << f;
+                }
+            }
+        }
+        freeReplyObject(msg);
+    }
+}
+
+// Wait for subscriber data or a wake-up. Returns >0 if the subscriber is
+// readable, 0 on timeout, <0 if woken (stop or explicit wake).
+static int llz_media_poll_wait(redisContext *sub, int timeoutMs)
+{
+    struct pollfd fds[2];
+    int nfds = 0;
+    fds[nfds].fd = g_pollWakePipe[0];
+    fds[nfds].events = POLLIN;
+    nfds++;
+    if (sub) {
+        fds[nfds].fd = sub->fd;
+        fds[nfds].events = POLLIN;
+        nfds++;
+    }
+
+    int rc = poll(fds, nfds, timeoutMs);
+    if (rc <= 0) return 0;
+    if (fds[0].revents) return -1;
+    return 1;
+}
+
+static void *llz_media_poll_thread(void *arg)
+{
+    const LlzMediaPollConfig config = *(const LlzMediaPollConfig *)arg;
+    redisContext *ctx = NULL;
+    redisContext *sub = NULL;
+    LlzMediaSnapshot current;
+    LlzMediaSnapshot latest;
+    llz_media_snapshot_read(&latest);
+    current = latest;
+
+    // Init restarts the thread if the key map or push setting changes
+    const LlzMediaKeyMap keys = config.keys;
+    bool pushAllowed = !config.pollOnly;
+
+    uint32_t dirty = LLZ_MF_ALL;
+    int64_t lastFullFetch = 0;
+    int retryDelayMs = 0;
+
+    while (!__atomic_load_n(&g_pollStop, __ATOMIC_ACQUIRE)) {
+        if (!ctx) {
+            ctx = llz_redis_open();
+            if (ctx) {
+                retryDelayMs = 0;
+            } else {
+                // Back off like the connection manager while Redis is down
+                retryDelayMs = retryDelayMs == 0 ? LLZ_REDIS_BACKOFF_MIN_MS : retryDelayMs * 2;
+                if (retryDelayMs > LLZ_REDIS_BACKOFF_MAX_MS) retryDelayMs = LLZ_REDIS_BACKOFF_MAX_MS;
+            }
+            dirty = LLZ_MF_ALL;
+            pushAllowed = !config.pollOnly;
+        }
+
+        // Subscribe before the full fetch so no change slips in between
+        if (ctx && !sub && pushAllowed) {
+            sub = llz_media_push_connect(&keys);
+            pushAllowed = sub != NULL;
+            dirty = LLZ_MF_ALL;
+        }
+        __atomic_store_n(&g_pushActive, sub != NULL, __ATOMIC_RELAXED);
+
+        int64_t now = llz_media_now_ms();
+        if (!sub || now - lastFullFetch >= LLZ_MEDIA_PUSH_RESYNC_MS) {
+            dirty = LLZ_MF_ALL;
+        }
+
+        if (ctx) {
+            double start = llz_redis_now_ms();
+            bool fetched;
+            if (dirty == LLZ_MF_ALL) {
+                LlzMediaSnapshot fresh;
+                fetched = llz_media_fetch_all(ctx, &keys, &fresh);
+                if (fetched) {
+                    current = fresh;
+                    lastFullFetch = now;
+                }
+            } else {
+                fetched = llz_media_fetch_fields(ctx, &keys, dirty, &current);
+            }
+            llz_redis_record_rtt(llz_redis_now_ms() - start, fetched);
+            if (!fetched) {
+                redisFree(ctx);
+                ctx = NULL;
+            }
+        }
+        if (!ctx) {
+            // Outage: report invalid state exactly like the synchronous path did
+            memset(&current, 0, sizeof(current));
+            current.media.volumePercent = -1;
+        }
+        dirty = 0;
+
+        current.media.updatedAt = (int64_t)time(NULL);
+        if (llz_media_snapshot_changed(&current, &latest)) {
+            llz_media_snapshot_publish(&current);
+        }
+        latest = current;
+
+        int timeoutMs = sub ? LLZ_MEDIA_PUSH_RESYNC_MS : __atomic_load_n(&g_pollIntervalMs, __ATOMIC_RELAXED);
+        if (!ctx && retryDelayMs > timeoutMs) timeoutMs = retryDelayMs;
+        int rc = llz_media_poll_wait(sub, timeoutMs);
+        if (rc < 0) {
+            if (llz_media_poll_drain_wake()) break;
+            if (!sub) dirty = LLZ_MF_ALL;
+        } else if (rc > 0 && sub) {
+            // Let a burst of writes (e.g. a track change) land before fetching
+            bool ok = true;
+            do {
+                if (redisBufferRead(sub) != REDIS_OK || !llz_media_push_collect(sub, &keys, &dirty)) {
+                    ok = false;
+                    break;
+                }
+            } while (llz_media_poll_wait(sub, LLZ_MEDIA_PUSH_COALESCE_MS) > 0);
+
+            if (!ok) {
+                redisFree(sub);
+                sub = NULL;
+                pushAllowed = true;
+            }
+        }
+    }
+
+    __atomic_store_n(&g_pushActive, false, __ATOMIC_RELAXED);
+    if (sub) redisFree(sub);
+    if (ctx) redisFree(ctx);
+    return NULL;
+}
+
+static void llz_media_poller_wake(void)
+{
+    if (g_pollWakePipe[1] < 0) return;
+    char c = 1;
+    ssize_t written = write(g_pollWakePipe[1], &c, 1);
+    (void)written;
+}
+
+static void llz_media_poller_stop(void)
+{
+    if (!g_pollRunning) return;
+    __atomic_store_n(&g_pollStop, true, __ATOMIC_RELEASE);
+    llz_media_poller_wake();
+    pthread_join(g_pollThread, NULL);
+    g_pollRunning = false;
+}
+
+static void llz_media_poller_start(void)
+{
+    if (g_pollRunning || !g_mediaConfigured) return;
+
+    if (g_pollWakePipe[0] < 0) {
+        if (pipe(g_pollWakePipe) != 0) {
+            printf("[MEDIA] Failed to create poller wake pipe\n");
+            g_pollWakePipe[0] = g_pollWakePipe[1] = -1;
+            return;
+        }
+        fcntl(g_pollWakePipe[0], F_SETFL, O_NONBLOCK);
+        fcntl(g_pollWakePipe[1], F_SETFL, O_NONBLOCK);
+        fcntl(g_pollWakePipe[0], F_SETFD, FD_CLOEXEC);
+        fcntl(g_pollWakePipe[1], F_SETFD, FD_CLOEXEC);
+    }
+    llz_media_poll_drain_wake();
+
+    g_pollConfig.keys = g_activeKeys;
+    g_pollConfig.pollOnly = g_pollOnly;
+    __atomic_store_n(&g_pollStop, false, __ATOMIC_RELEASE);
+    if (pthread_create(&g_pollThread, NULL, llz_media_poll_thread, &g_pollConfig) != 0) {
+        printf("[MEDIA] Failed to start state poller thread\n");
+        return;
+    }
+    g_pollRunning = true;
+}
+
+static void llz_outbox_stop(void);
+static void llz_lyrics_cache_reset(void);
+
+bool LlzMediaInit(const LlzMediaConfig *config)
+{
+    // Build the new settings aside; the running poller and outbox are
+    // stopped before any of them is published
+    LlzMediaKeyMap keys;
+    llz_media_build_keymap(config ? config->keyMap : NULL, &keys);
+
+    char host[LLZ_MEDIA_HOST_MAX];
+    const char *requestedHost = (config && config->host && config->host[0] != '\0')
+                                    ? config->host : LLZ_MEDIA_DEFAULT_HOST;
+    strncpy(host, requestedHost, sizeof(host) - 1);
+    host[sizeof(host) - 1] = '\0';
+
+    int port = (config && config->port > 0) ? config->port : LLZ_MEDIA_DEFAULT_PORT;
+    bool pollOnly = config ? config->pollOnly : false;
+
+    if (config && config->pollIntervalMs > 0) {
+        LlzMediaSetPollInterval(config->pollIntervalMs);
+    }
+
+    // Plugins re-init with the host's settings; only bounce the poller when
+    // the target or key map actually changed.
+    bool changed = !g_mediaConfigured ||
+                   port != g_port ||
+                   pollOnly != g_pollOnly ||
+                   strcmp(host, g_host) != 0 ||
+                   memcmp(&keys, &g_activeKeys, sizeof(keys)) != 0;
+    if (changed) {
+        llz_media_poller_stop();
+        llz_outbox_stop();
+        LlzMediaInvalidateBlob(NULL);
+        llz_lyrics_cache_reset();
+    }
+
+    g_activeKeys = keys;
+    memcpy(g_host, host, sizeof(g_host));
+    g_port = port;
+    g_pollOnly = pollOnly;
+    g_mediaConfigured = true;
+
+    LlzRedisConfigure(g_host, g_port);
+    bool ok = LlzRedisConnect();
+
+    // Seed the snapshot synchronously so callers have state right after init
+    if (ok && changed) {
+        LlzMediaSnapshot seed;
+        if (llz_media_fetch_all(llz_redis_acquire(), &g_activeKeys, &seed)) {
+            seed.media.updatedAt = (int64_t)time(NULL);
+            llz_media_snapshot_publish(&seed);
+        } else {
+            llz_redis_fail();
+        }
+    }
+
+    llz_media_poller_start();
+    return ok;
+}
+
+void LlzMediaShutdown(void)
+{
+    // The last snapshot is kept so the host still has data if a plugin shuts
+    // the module down; the next LlzMediaGetState restarts the poller.
+    // The command queue keeps running so commands sent just before a
+    // plugin exits are still delivered.
+    llz_media_poller_stop();
+}
+
+void LlzMediaSetPollInterval(int intervalMs)
+{
+    if (intervalMs < LLZ_MEDIA_MIN_POLL_MS) intervalMs = LLZ_MEDIA_MIN_POLL_MS;
+    __atomic_store_n(&g_pollIntervalMs, intervalMs, __ATOMIC_RELAXED);
+    if (g_pollRunning) llz_media_poller_wake();
+}
+
+int LlzMediaGetPollInterval(void)
+{
+    return __atomic_load_n(&g_pollIntervalMs, __ATOMIC_RELAXED);
+}
+
+bool LlzMediaIsPushActive(void)
+{
+    return __atomic_load_n(&g_pushActive, __ATOMIC_RELAXED);
+}
+
+uint32_t LlzMediaGetStateSequence(void)
+{
+    return __atomic_load_n(&g_stateSeq, __ATOMIC_ACQUIRE);
+}
+
+bool LlzMediaGetState(LlzMediaState *outState)
+{
+    if (!outState) return false;
+    llz_media_poller_start();
+
+    LlzMediaSnapshot snap;
+    llz_media_snapshot_read(&snap);
+    if (!snap.mediaValid) {
+        memset(outState, 0, sizeof(*outState));
+        outState->volumePercent = -1;
+        return false;
+    }
+
+    *outState = snap.media;
+    return true;
+}
+
+bool LlzMediaGetConnection(LlzConnectionStatus *outStatus)
+{
+    if (!outStatus) return false;
+    llz_media_poller_start();
+
+    LlzMediaSnapshot snap;
+    llz_media_snapshot_read(&snap);
+    if (!snap.connectionValid) {
+        memset(outStatus, 0, sizeof(*outStatus));
+        return false;
+    }
+
+    *outStatus = snap.connection;
+    return true;
+}
+
+float LlzMediaGetProgressPercent(const LlzMediaState *state)
+{
+    if (!state || state->durationSeconds <= 0) return 0.0f;
+    float pct = (float)state->positionSeconds / (float)state->durationSeconds;
+    if (pct < 0.0f) pct = 0.0f;
+    if (pct > 1.0f) pct = 1.0f;
+    return pct;
+}
+
+static const char *llz_media_action_string(LlzPlaybackCommand action, int *value)
+{
+    // Toggles resolve against the latest poller snapshot
+    LlzMediaSnapshot snap;
+    llz_media_snapshot_read(&snap);
+
+    switch (action) {
+        case LLZ_PLAYBACK_PLAY: return "play";
+        case LLZ_PLAYBACK_PAUSE: return "pause";
+        case LLZ_PLAYBACK_NEXT: return "next";
+        case LLZ_PLAYBACK_PREVIOUS: return "previous";
+        case LLZ_PLAYBACK_SEEK_TO:
+            if (value && *value < 0) *value = 0;
+            return "seek";
+        case LLZ_PLAYBACK_SET_VOLUME:
+            if (value) {
+                if (*value < 0) *value = 0;
+                if (*value > 100) *value = 100;
+            }
+            return "volume";
+        case LLZ_PLAYBACK_TOGGLE:
+            if (snap.mediaValid && snap.media.isPlaying) {
+                return "pause";
+            }
+            return "play";
+        // Spotify-specific controls
+        case LLZ_PLAYBACK_SHUFFLE_ON: return "shuffle_on";
+        case LLZ_PLAYBACK_SHUFFLE_OFF: return "shuffle_off";
+        case LLZ_PLAYBACK_SHUFFLE_TOGGLE:
+            return snap.media.shuffleEnabled ? "shuffle_off" : "shuffle_on";
+        case LLZ_PLAYBACK_REPEAT_OFF: return "repeat_off";
+        case LLZ_PLAYBACK_REPEAT_TRACK: return "repeat_track";
+        case LLZ_PLAYBACK_REPEAT_CONTEXT: return "repeat_context";
+        case LLZ_PLAYBACK_REPEAT_CYCLE:
+            // Cycle: off -> track -> context -> off
+            switch (snap.media.repeatMode) {
+                case LLZ_REPEAT_OFF: return "repeat_track";
+                case LLZ_REPEAT_TRACK: return "repeat_context";
+                case LLZ_REPEAT_CONTEXT: return "repeat_off";
+            }
+            return "repeat_off";
+        case LLZ_PLAYBACK_LIKE_TRACK: return "like_track";
+        case LLZ_PLAYBACK_UNLIKE_TRACK: return "unlike_track";
+        default:
+            return NULL;
+    }
+}
+
+// ============================================================================
+// Outbound Command Queue
+// ============================================================================
+//
+// Commands are formatted on the caller's thread and handed to a worker with
+// its own connection, so a slow Redis never stalls a frame. A volume or seek
+// that arrives while the previous one of the same kind is still waiting at
+// the tail of the queue replaces it, so spinning the rotary sends only the
+// latest value. Every command reports a status (sent/coalesced/failed/
+// dropped) that LlzSubscriptionPoll delivers as LLZ_EVENT_COMMAND_STATUS.
+
+#define LLZ_MEDIA_COMMAND_PAYLOAD_MAX 384
+#define LLZ_MEDIA_COMMAND_RESULT_MAX 32
+
+typedef struct {
+    uint32_t id;
+    char queueKey[LLZ_MEDIA_TEXT_MAX];
+    char action[LLZ_MEDIA_COMMAND_ACTION_MAX];
+    int value;
+    bool coalescable;
+    char payload[LLZ_MEDIA_COMMAND_PAYLOAD_MAX];
+} LlzOutboundCommand;
+
+static LlzOutboundCommand g_outbox[LLZ_MEDIA_COMMAND_QUEUE_MAX];
+static int g_outboxHead = 0;
+static int g_outboxCount = 0;
+static bool g_outboxSending = false;
+static uint32_t g_nextCommandId = 1;
+static uint32_t g_lastCommandId = 0;
+
+static LlzCommandResult g_commandResults[LLZ_MEDIA_COMMAND_RESULT_MAX];
+static int g_commandResultHead = 0;
+static int g_commandResultCount = 0;
+
+static pthread_t g_outboxThread;
+static pthread_mutex_t g_outboxMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_outboxCond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_outboxIdleCond = PTHREAD_COND_INITIALIZER;
+static bool g_outboxRunning = false;   // Main thread only
+static bool g_outboxStop = false;      // Guarded by g_outboxMutex
+
+// Caller must hold g_outboxMutex
+static void llz_outbox_report_locked(const LlzOutboundCommand *cmd, LlzCommandStatus status)
+{
+    int slot = (g_commandResultHead + g_commandResultCount) % LLZ_MEDIA_COMMAND_RESULT_MAX;
+    if (g_commandResultCount == LLZ_MEDIA_COMMAND_RESULT_MAX) {
+        // Nobody is draining results; overwrite the oldest
+        g_commandResultHead = (g_commandResultHead + 1) % LLZ_MEDIA_COMMAND_RESULT_MAX;
+    } else {
+        g_commandResultCount++;
+    }
+
+    LlzCommandResult *result = &g_commandResults[slot];
+    result->id = cmd->id;
+    strncpy(result->action, cmd->action, sizeof(result->action) - 1);
+    result->action[sizeof(result->action) - 1] = '\0';
+    result->value = cmd->value;
+    result->status = status;
+}
+
+static void *llz_outbox_thread(void *arg)
+{
+    (void)arg;
+    redisContext *ctx = NULL;
+
+    pthread_mutex_lock(&g_outboxMutex);
+    for (;;) {
+        while (g_outboxCount == 0 && !g_outboxStop) {
+            pthread_cond_wait(&g_outboxCond, &g_outboxMutex);
+        }
+        // Drain everything before honouring a stop so commands sent right
+        // before a plugin exits still reach the phone
+        if (g_outboxCount == 0) break;
+
+        LlzOutboundCommand cmd = g_outbox[g_outboxHead];
+        g_outboxHead = (g_outboxHead + 1) % LLZ_MEDIA_COMMAND_QUEUE_MAX;
+        g_outboxCount--;
+        g_outboxSending = true;
+        pthread_mutex_unlock(&g_outboxMutex);
+
+        bool sent = false;
+        for (int attempt = 0; attempt < 2 && !sent; attempt++) {
+            if (!ctx) ctx = llz_redis_open();
+            if (!ctx) continue;
+
+            double start = llz_redis_now_ms();
+            redisReply *reply = redisCommand(ctx, "LPUSH %s %s", cmd.queueKey, cmd.payload);
+            llz_redis_record_rtt(llz_redis_now_ms() - start, reply != NULL);
+            if (!reply) {
+                redisFree(ctx);
+                ctx = NULL;
+                continue;
+            }
+            sent = reply->type == REDIS_REPLY_INTEGER;
+            freeReplyObject(reply);
+            break;
+        }
+
+        if (sent) {
+            // Pick up the resulting state change without waiting a full interval
+            llz_media_poller_wake();
+        } else {
+            printf("[MEDIA] Failed to send %s command\n", cmd.action);
+        }
+
+        pthread_mutex_lock(&g_outboxMutex);
+        llz_outbox_report_locked(&cmd, sent ? LLZ_COMMAND_SENT : LLZ_COMMAND_FAILED);
+        g_outboxSending = false;
+        if (g_outboxCount == 0) pthread_cond_broadcast(&g_outboxIdleCond);
+    }
+    g_outboxSending = false;
+    pthread_cond_broadcast(&g_outboxIdleCond);
+    pthread_mutex_unlock(&g_outboxMutex);
+
+    if (ctx) redisFree(ctx);
+    return NULL;
+}
+
+static void llz_outbox_start(void)
+{
+    if (g_outboxRunning) return;
+    pthread_mutex_lock(&g_outboxMutex);
+    g_outboxStop = false;
+    pthread_mutex_unlock(&g_outboxMutex);
+    if (pthread_create(&g_outboxThread, NULL, llz_outbox_thread, NULL) != 0) {
+        printf("[MEDIA] Failed to start command queue thread\n");
+        return;
+    }
+    g_outboxRunning = true;
+}
+
+// Stops the worker after it has delivered everything already queued
+static void llz_outbox_stop(void)
+{
+    if (!g_outboxRunning) return;
+    pthread_mutex_lock(&g_outboxMutex);
+    g_outboxStop = true;
+    pthread_cond_signal(&g_outboxCond);
+    pthread_mutex_unlock(&g_outboxMutex);
+    pthread_join(g_outboxThread, NULL);
+    g_outboxRunning = false;
+}
+
+// Queue a fully formatted command. Returns false if it could not be queued.
+static bool llz_outbox_enqueue(const char *action, int value, bool coalescable, const char *payload)
+{
+    if (!g_activeKeys.playbackCommandQueue) return false;
+    llz_outbox_start();
+
+    pthread_mutex_lock(&g_outboxMutex);
+
+    LlzOutboundCommand cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.id = g_nextCommandId++;
+    if (g_nextCommandId == 0) g_nextCommandId = 1;
+    strncpy(cmd.queueKey, g_activeKeys.playbackCommandQueue, sizeof(cmd.queueKey) - 1);
+    strncpy(cmd.action, action, sizeof(cmd.action) - 1);
+    cmd.value = value;
+    cmd.coalescable = coalescable;
+    strncpy(cmd.payload, payload, sizeof(cmd.payload) - 1);
+    g_lastCommandId = cmd.id;
+
+    bool queued = true;
+    int tail = (g_outboxHead + g_outboxCount - 1 + LLZ_MEDIA_COMMAND_QUEUE_MAX) % LLZ_MEDIA_COMMAND_QUEUE_MAX;
+    if (coalescable && g_outboxCount > 0 &&
+        g_outbox[tail].coalescable && strcmp(g_outbox[tail].action, action) == 0) {
+        llz_outbox_report_locked(&g_outbox[tail], LLZ_COMMAND_COALESCED);
+        g_outbox[tail] = cmd;
+    } else if (g_outboxCount == LLZ_MEDIA_COMMAND_QUEUE_MAX) {
+        llz_outbox_report_locked(&cmd, LLZ_COMMAND_DROPPED);
+        queued = false;
+    } else {
+        int slot = (g_outboxHead + g_outboxCount) % LLZ_MEDIA_COMMAND_QUEUE_MAX;
+        g_outbox[slot] = cmd;
+        g_outboxCount++;
+    }
+
+    pthread_cond_signal(&g_outboxCond);
+    pthread_mutex_unlock(&g_outboxMutex);
+    return queued;
+}
+
+uint32_t LlzMediaGetLastCommandId(void)
+{
+    pthread_mutex_lock(&g_outboxMutex);
+    uint32_t id = g_lastCommandId;
+    pthread_mutex_unlock(&g_outboxMutex);
+    return id;
+}
+
+int LlzMediaGetPendingCommandCount(void)
+{
+    pthread_mutex_lock(&g_outboxMutex);
+    int count = g_outboxCount + (g_outboxSending ? 1 : 0);
+    pthread_mutex_unlock(&g_outboxMutex);
+    return count;
+}
+
+bool LlzMediaPopCommandResult(LlzCommandResult *outResult)
+{
+    if (!outResult) return false;
+
+    pthread_mutex_lock(&g_outboxMutex);
+    bool available = g_commandResultCount > 0;
+    if (available) {
+        *outResult = g_commandResults[g_commandResultHead];
+        g_commandResultHead = (g_commandResultHead + 1) % LLZ_MEDIA_COMMAND_RESULT_MAX;
+        g_commandResultCount--;
+    }
+    pthread_mutex_unlock(&g_outboxMutex);
+    return available;
+}
+
+bool LlzMediaFlushCommands(int timeoutMs)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeoutMs / 1000;
+    deadline.tv_nsec += (long)(timeoutMs % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&g_outboxMutex);
+    while (g_outboxRunning && (g_outboxCount > 0 || g_outboxSending)) {
+        if (pthread_cond_timedwait(&g_outboxIdleCond, &g_outboxMutex, &deadline) != 0) break;
+    }
+    bool idle = g_outboxCount == 0 && !g_outboxSending;
+    pthread_mutex_unlock(&g_outboxMutex);
+    return idle;
+}
+
+static bool llz_media_push_command(const char *action, int value)
+{
+    if (!action) return false;
+
+    char payload[LLZ_MEDIA_COMMAND_PAYLOAD_MAX];
+    snprintf(payload, sizeof(payload), "{\"action\":\"%s\",\"value\":%d,\"timestamp\":%lld}",
+             action, value, (long long)time(NULL));
+
+    bool coalescable = strcmp(action, "volume") == 0 || strcmp(action, "seek") == 0;
+    return llz_outbox_enqueue(action, value, coalescable, payload);
+}
+
+// Requests and one-off commands with their own JSON shape go through the
+// same outbox as playback commands, so they keep their order with them
+bool llz_media_queue_request(const char *action, const char *format, ...)
+{
+    char payload[LLZ_MEDIA_COMMAND_PAYLOAD_MAX];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(payload, sizeof(payload), format, args);
+    va_end(args);
+    if (len < 0 || (size_t)len >= sizeof(payload)) {
+        printf("[MEDIA] %s command too long (%d bytes)\n", action, len);
+        return false;
+    }
+    return llz_outbox_enqueue(action, 0, false, payload);
+}
+
+bool LlzMediaSendCommand(LlzPlaybackCommand action, int value)
+{
+    const char *actionStr = llz_media_action_string(action, &value);
+    if (!actionStr) return false;
+    return llz_media_push_command(actionStr, value);
+}
+
+bool LlzMediaSeekSeconds(int seconds)
+{
+    return LlzMediaSendCommand(LLZ_PLAYBACK_SEEK_TO, seconds);
+}
+
+bool LlzMediaSetVolume(int percent)
+{
+    return LlzMediaSendCommand(LLZ_PLAYBACK_SET_VOLUME, percent);
+}
+
+// ============================================================================
+// Spotify Playback Controls Implementation
+// ============================================================================
+
+bool LlzMediaSetShuffle(bool enabled)
+{
+    return LlzMediaSendCommand(enabled ? LLZ_PLAYBACK_SHUFFLE_ON : LLZ_PLAYBACK_SHUFFLE_OFF, 0);
+}
+
+bool LlzMediaToggleShuffle(void)
+{
+    return LlzMediaSendCommand(LLZ_PLAYBACK_SHUFFLE_TOGGLE, 0);
+}
+
+bool LlzMediaSetRepeat(LlzRepeatMode mode)
+{
+    switch (mode) {
+        case LLZ_REPEAT_OFF:
+            return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_OFF, 0);
+        case LLZ_REPEAT_TRACK:
+            return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_TRACK, 0);
+        case LLZ_REPEAT_CONTEXT:
+            return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_CONTEXT, 0);
+    }
+    return false;
+}
+
+bool LlzMediaCycleRepeat(void)
+{
+    return LlzMediaSendCommand(LLZ_PLAYBACK_REPEAT_CYCLE, 0);
+}
+
+// Helper to push command with trackId
+static bool llz_media_push_track_command(const char *action, const char *trackId)
+{
+    if (!action) return false;
+
+    char payload[LLZ_MEDIA_COMMAND_PAYLOAD_MAX];
+    long long ts = (long long)time(NULL);
+    if (trackId && trackId[0] != '\0') {
+        // Include trackId in command
+        snprintf(payload, sizeof(payload), "{\"action\":\"%s\",\"trackId\":\"%s\",\"timestamp\":%lld}",
+                 action, trackId, ts);
+    } else {
+        // No trackId - use current track
+        snprintf(payload, sizeof(payload), "{\"action\":\"%s\",\"timestamp\":%lld}", action, ts);
+    }
+
+    bool queued = llz_outbox_enqueue(action, 0, false, payload);
+    printf("[SPOTIFY] Queued %s command (trackId=%s)\n", action, trackId ? trackId : "(current)");
+    return queued;
+}
+
+bool LlzMediaLikeTrack(const char *trackId)
+{
+    return llz_media_push_track_command("like_track", trackId);
+}
+
+bool LlzMediaUnlikeTrack(const char *trackId)
+{
+    return llz_media_push_track_command("unlike_track", trackId);
+}
+
+bool LlzMediaRequestSpotifyState(void)
+{
+    if (!g_activeKeys.playbackCommandQueue) return false;
+
+    long long ts = (long long)time(NULL);
+    bool success = llz_media_queue_request(
+        "request_spotify_state",
+        "{\"action\":\"request_spotify_state\",\"timestamp\":%lld}",
+        ts
+    );
+
+    if (success) {
+        printf("[SPOTIFY] Requested Spotify playback state refresh\n");
+    }
+    return success;
+}
+
+// CRC32 implementation matching Android's java.util.zip.CRC32
+static uint32_t llz_crc32_table[256];
+static bool llz_crc32_table_init = false;
+
+static void llz_crc32_init_table(void)
+{
+    if (llz_crc32_table_init) return;
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int j = 0; j < 8; j++) {
+            if (crc & 1) {
+                crc = (crc >> 1) ^ 0xEDB88320;
+            } else {
+                crc >>= 1;
+            }
+        }
+        llz_crc32_table[i] = crc;
+    }
+    llz_crc32_table_init = true;
+}
+
+static uint32_t llz_crc32(const char *data, size_t len)
+{
+    llz_crc32_init_table();
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc = llz_crc32_table[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+// Helper to skip leading whitespace
 static const char *llz_skip_whitespace(const char *s)
 {
     while (*s && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r')) s++;
@@ -835,15 +1873,16 @@ bool LlzMediaRequestPodcastInfo(void)
     if (!g_activeKeys.playbackCommandQueue) return false;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_podcast_info\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "request_podcast_info",
+        "{\"action\":\"request_podcast_info\",\"timestamp\":%lld}",
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
+    if (success) {
+        LlzMediaInvalidateBlob("podcast:library");
+        LlzMediaInvalidateBlob(g_activeKeys.podcastEpisodeList);
+    }
     return success;
 }
 
@@ -852,77 +1891,16 @@ bool LlzMediaGetPodcastState(LlzPodcastState *outState)
     if (!outState) return false;
     memset(outState, 0, sizeof(*outState));
 
-    redisReply *reply = llz_media_command(
-        "MGET %s %s %s %s %s %s",
-        g_activeKeys.podcastShowName,
-        g_activeKeys.podcastEpisodeTitle,
-        g_activeKeys.podcastEpisodeDescription,
-        g_activeKeys.podcastAuthor,
-        g_activeKeys.podcastArtPath,
-        g_activeKeys.podcastEpisodeCount
-    );
-
-    if (!reply) return false;
-    bool success = false;
-
-    if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 6) {
-        llz_media_copy_reply(outState->showName, sizeof(outState->showName), reply->element[0]);
-        llz_media_copy_reply(outState->episodeTitle, sizeof(outState->episodeTitle), reply->element[1]);
-        llz_media_copy_reply(outState->episodeDescription, sizeof(outState->episodeDescription), reply->element[2]);
-        llz_media_copy_reply(outState->author, sizeof(outState->author), reply->element[3]);
-        llz_media_copy_reply(outState->artPath, sizeof(outState->artPath), reply->element[4]);
-        outState->episodeCount = llz_media_reply_int(reply->element[5]);
-        success = true;
-    }
-
-    freeReplyObject(reply);
-
-    // Also fetch playback state from regular media keys
-    if (success) {
-        redisReply *playbackReply = llz_media_command(
-            "MGET %s %s %s",
-            g_activeKeys.isPlaying,
-            g_activeKeys.durationSeconds,
-            g_activeKeys.progressSeconds
-        );
-
-        if (playbackReply && playbackReply->type == REDIS_REPLY_ARRAY && playbackReply->elements >= 3) {
-            outState->isPlaying = llz_media_reply_bool(playbackReply->element[0]);
-            outState->durationSeconds = llz_media_reply_int(playbackReply->element[1]);
-            outState->positionSeconds = llz_media_reply_int(playbackReply->element[2]);
-        }
-
-        if (playbackReply) {
-            freeReplyObject(playbackReply);
-        }
-    }
-
-    return success;
+    // Podcast metadata and playback position in a single MGET
+    LlzMediaBatch batch;
+    LlzMediaBatchBegin(&batch);
+    LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_PODCAST_STATE, outState, sizeof(*outState));
+    return LlzMediaBatchFlush(&batch) == 1;
 }
 
 bool LlzMediaGetPodcastEpisodes(char *outJson, size_t maxLen)
 {
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    if (!g_activeKeys.podcastEpisodeList) return false;
-
-    redisReply *reply = llz_media_command(
-        "GET %s",
-        g_activeKeys.podcastEpisodeList
-    );
-
-    if (!reply) return false;
-    bool success = false;
-
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        strncpy(outJson, reply->str, maxLen - 1);
-        outJson[maxLen - 1] = '\0';
-        success = true;
-    }
-
-    freeReplyObject(reply);
-    return success;
+    return llz_blob_get_json(g_activeKeys.podcastEpisodeList, outJson, maxLen, true);
 }
 
 int LlzMediaGetPodcastCount(void)
@@ -944,22 +1922,7 @@ int LlzMediaGetPodcastCount(void)
 
 bool LlzMediaGetPodcastLibrary(char *outJson, size_t maxLen)
 {
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET podcast:library");
-
-    if (!reply) return false;
-    bool success = false;
-
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        strncpy(outJson, reply->str, maxLen - 1);
-        outJson[maxLen - 1] = '\0';
-        success = true;
-    }
-
-    freeReplyObject(reply);
-    return success;
+    return llz_blob_get_json("podcast:library", outJson, maxLen, true);
 }
 
 bool LlzMediaPlayEpisode(const char *episodeHash)
@@ -971,17 +1934,13 @@ bool LlzMediaPlayEpisode(const char *episodeHash)
 
     // Push command with episode hash (new preferred format)
     // Format: {"action":"play_episode","episodeHash":"<hash>","timestamp":<ts>}
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"play_episode\",\"episodeHash\":\"%s\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "play_episode",
+        "{\"action\":\"play_episode\",\"episodeHash\":\"%s\",\"timestamp\":%lld}",
         episodeHash,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
         printf("SDK: Queued play_episode command: episodeHash=%s\n", episodeHash);
     }
@@ -999,18 +1958,14 @@ bool LlzMediaPlayPodcastEpisode(const char *podcastId, int episodeIndex)
 
     // Push command with podcast-specific fields (DEPRECATED - use LlzMediaPlayEpisode instead)
     // Format: {"action":"play_podcast_episode","podcastId":"<id>","episodeIndex":<index>,"timestamp":<ts>}
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"play_podcast_episode\",\"podcastId\":\"%s\",\"episodeIndex\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "play_podcast_episode",
+        "{\"action\":\"play_podcast_episode\",\"podcastId\":\"%s\",\"episodeIndex\":%d,\"timestamp\":%lld}",
         podcastId,
         episodeIndex,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
         printf("SDK: Queued play_podcast_episode command (DEPRECATED): podcast=%s, episode=%d\n", podcastId, episodeIndex);
     }
@@ -1028,17 +1983,14 @@ bool LlzMediaRequestPodcastList(void)
 
     long long ts = (long long)time(NULL);
 
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_podcast_list\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "request_podcast_list",
+        "{\"action\":\"request_podcast_list\",\"timestamp\":%lld}",
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("podcast:list");
         printf("SDK: Requested podcast list (A-Z channels)\n");
     }
 
@@ -1052,18 +2004,15 @@ bool LlzMediaRequestRecentEpisodes(int limit)
 
     long long ts = (long long)time(NULL);
 
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_recent_episodes\",\"limit\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "request_recent_episodes",
+        "{\"action\":\"request_recent_episodes\",\"limit\":%d,\"timestamp\":%lld}",
         limit,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("podcast:recent_episodes");
         printf("SDK: Requested recent episodes (limit=%d)\n", limit);
     }
 
@@ -1079,20 +2028,19 @@ bool LlzMediaRequestPodcastEpisodes(const char *podcastId, int offset, int limit
 
     long long ts = (long long)time(NULL);
 
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_podcast_episodes\",\"podcastId\":\"%s\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "request_podcast_episodes",
+        "{\"action\":\"request_podcast_episodes\",\"podcastId\":\"%s\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
         podcastId,
         offset,
         limit,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        char key[LLZ_MEDIA_BLOB_KEY_MAX];
+        snprintf(key, sizeof(key), "podcast:episodes:%s", podcastId);
+        LlzMediaInvalidateBlob(key);
         printf("SDK: Requested episodes for podcast=%s (offset=%d, limit=%d)\n", podcastId, offset, limit);
     }
 
@@ -1101,46 +2049,12 @@ bool LlzMediaRequestPodcastEpisodes(const char *podcastId, int offset, int limit
 
 bool LlzMediaGetPodcastList(char *outJson, size_t maxLen)
 {
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET podcast:list");
-
-    if (!reply) return false;
-    bool success = false;
-
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
-    return success;
+    return llz_blob_get_json("podcast:list", outJson, maxLen, false);
 }
 
 bool LlzMediaGetRecentEpisodes(char *outJson, size_t maxLen)
 {
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET podcast:recent_episodes");
-
-    if (!reply) return false;
-    bool success = false;
-
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
-    return success;
+    return llz_blob_get_json("podcast:recent_episodes", outJson, maxLen, false);
 }
 
 bool LlzMediaGetPodcastEpisodesForId(const char *podcastId, char *outJson, size_t maxLen)
@@ -1150,21 +2064,9 @@ bool LlzMediaGetPodcastEpisodesForId(const char *podcastId, char *outJson, size_
     outJson[0] = '\0';
 
     // Redis key is podcast:episodes:<podcastId>
-    redisReply *reply = llz_media_command("GET podcast:episodes:%s", podcastId);
-
-    if (!reply) return false;
-    bool success = false;
-
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
-    return success;
+    char key[LLZ_MEDIA_BLOB_KEY_MAX];
+    snprintf(key, sizeof(key), "podcast:episodes:%s", podcastId);
+    return llz_blob_get_json(key, outJson, maxLen, false);
 }
 
 // ============================================================================
@@ -1243,149 +2145,373 @@ bool LlzLyricsGetJson(char *outJson, size_t maxLen)
     return success;
 }
 
-bool LlzLyricsGetHash(char *outHash, size_t maxLen)
+// ----------------------------------------------------------------------------
+// Lyric set cache
+// ----------------------------------------------------------------------------
+//
+// A parsed set is one allocation: the line array followed by the line texts
+// packed back to back, each line pointing into the tail. Sets are kept in a
+// small LRU keyed by lyrics hash, and LlzLyricsGet hands out a copy of the
+// block with its pointers rebased.
+//
+// The companion only fills a single lyrics slot in Redis, so lyrics requested
+// ahead of time for the next queued track overwrite the current ones there.
+// The reported hash therefore prefers the playing track's cached set and hides
+// a prefetched set until its track starts. Prefetching is only started once a
+// Redis hash has matched LlzLyricsGenerateHash for the playing track, so a
+// companion that hashes differently never has its lyrics hidden.
+//
+// All Redis work happens in LlzLyricsUpdate: the slot hash comes from the
+// poller's snapshot, and the slot is read once per new hash. LlzLyricsGetHash,
+// LlzLyricsAreSynced and LlzLyricsGet only read what the last update resolved.
+
+#define LLZ_LYRICS_PREFETCH_CHECK_MS 2000.0
+#define LLZ_LYRICS_LOAD_RETRY_MS 1000.0
+
+typedef struct {
+    char hash[64];
+    bool synced;
+    int lineCount;
+    LlzLyricsLine *block;   // lineCount lines, then their text
+    size_t blockSize;
+    unsigned long lastUse;
+    bool used;
+} LlzLyricsEntry;
+
+static LlzLyricsEntry g_lyricsCache[LLZ_LYRICS_CACHE_MAX];
+static unsigned long g_lyricsUseClock = 0;
+static LlzLyricsCacheStats g_lyricsStats = {0};
+static bool g_lyricsPrefetchEnabled = true;
+static bool g_lyricsHashVerified = false;   // Companion hashes match ours
+static char g_lyricsReportedHash[64] = {0}; // Hash resolved by the last update
+static char g_lyricsPrefetchHash[64] = {0}; // Upcoming track we requested
+static char g_lyricsTrackHash[64] = {0};    // Playing track at the last check
+static char g_lyricsLoadedHash[64] = {0};   // Slot hash last read from Redis
+static double g_lyricsPrefetchCheckedMs = 0.0;
+static double g_lyricsLoadedMs = 0.0;
+
+static void llz_lyrics_cache_reset(void)
+{
+    for (int i = 0; i < LLZ_LYRICS_CACHE_MAX; i++) {
+        free(g_lyricsCache[i].block);
+    }
+    memset(g_lyricsCache, 0, sizeof(g_lyricsCache));
+    g_lyricsHashVerified = false;
+    g_lyricsReportedHash[0] = '\0';
+    g_lyricsPrefetchHash[0] = '\0';
+    g_lyricsTrackHash[0] = '\0';
+    g_lyricsLoadedHash[0] = '\0';
+    g_lyricsPrefetchCheckedMs = 0.0;
+    g_lyricsLoadedMs = 0.0;
+}
+
+static LlzLyricsEntry *llz_lyrics_find(const char *hash)
+{
+    if (!hash || hash[0] == '\0') return NULL;
+    for (int i = 0; i < LLZ_LYRICS_CACHE_MAX; i++) {
+        if (g_lyricsCache[i].used && strcmp(g_lyricsCache[i].hash, hash) == 0) {
+            return &g_lyricsCache[i];
+        }
+    }
+    return NULL;
+}
+
+// Reuse the slot for hash, else a free one, else the least recently used
+static LlzLyricsEntry *llz_lyrics_slot(const char *hash)
 {
-    if (!outHash || maxLen == 0) return false;
+    LlzLyricsEntry *entry = llz_lyrics_find(hash);
+    if (!entry) {
+        entry = &g_lyricsCache[0];
+        for (int i = 0; i < LLZ_LYRICS_CACHE_MAX; i++) {
+            if (!g_lyricsCache[i].used) {
+                entry = &g_lyricsCache[i];
+                break;
+            }
+            if (g_lyricsCache[i].lastUse < entry->lastUse) entry = &g_lyricsCache[i];
+        }
+    }
+    free(entry->block);
+    memset(entry, 0, sizeof(*entry));
+    return entry;
+}
+
+// Line under construction: text is an offset into the arena until the final
+// block exists
+typedef struct {
+    int64_t timestampMs;
+    size_t textOffset;
+} LlzLyricsPending;
+
+typedef struct {
+    LlzLyricsPending *lines;
+    int lineCount;
+    int capacity;
+    char *text;
+    size_t textLen;
+    size_t textCap;
+} LlzLyricsBuilder;
+
+// Lines are read in one pass; the line array grows geometrically and text is
+// decoded straight into the arena, which is sized from the JSON length since
+// decoded text is never longer than its source.
+static bool llz_lyrics_read_lines(LlzJsonReader *r, LlzLyricsBuilder *b)
+{
+    LlzJsonKey key;
+
+    if (!llz_json_enter_array(r)) return true;
+    while (llz_json_next_element(r)) {
+        if (b->lineCount >= LLZ_LYRICS_MAX_LINES) {
+            llz_json_skip(r);
+            continue;
+        }
+        if (!llz_json_enter_object(r)) continue;
+
+        if (b->lineCount == b->capacity) {
+            int newCapacity = b->capacity ? b->capacity * 2 : 64;
+            LlzLyricsPending *grown = (LlzLyricsPending *)realloc(b->lines,
+                                                                  (size_t)newCapacity * sizeof(LlzLyricsPending));
+            if (!grown) return false;
+            b->lines = grown;
+            b->capacity = newCapacity;
+        }
 
-    redisReply *reply = llz_media_command("GET %s", g_activeKeys.lyricsHash);
-    if (!reply) return false;
+        LlzLyricsPending *line = &b->lines[b->lineCount];
+        line->timestampMs = 0;
+        line->textOffset = b->textLen;
+        b->text[b->textLen] = '\0';
+
+        size_t textSize = 1;
+        bool hasField = false;
+        while (llz_json_next_member(r, &key)) {
+            if (llz_json_key_is(&key, "t")) {
+                line->timestampMs = llz_json_read_int64(r);
+                hasField = true;
+            } else if (llz_json_key_is(&key, "l")) {
+                char *dst = b->text + line->textOffset;
+                size_t room = b->textCap - line->textOffset;
+                if (room > LLZ_LYRICS_LINE_MAX) room = LLZ_LYRICS_LINE_MAX;
+                hasField |= llz_json_read_string(r, dst, room);
+                textSize = strlen(dst) + 1;
+            } else {
+                llz_json_skip(r);
+            }
+        }
+        if (hasField) {
+            b->textLen += textSize;
+            b->lineCount++;
+        }
+    }
+    return true;
+}
 
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outHash, reply->str);
-            success = true;
+// Format: {"hash":"...","synced":true,"lines":[{"t":1234,"l":"text"},...]}
+// Parses into a cache slot. fallbackHash keys sets whose JSON has no hash.
+static LlzLyricsEntry *parse_lyrics_json(const char *json, size_t len, const char *fallbackHash)
+{
+    if (!json) return NULL;
+
+    char hash[64] = {0};
+    bool synced = false;
+    LlzLyricsBuilder b = {0};
+    b.textCap = len + 1;
+    b.text = (char *)malloc(b.textCap);
+    if (!b.text) return NULL;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    bool ok = llz_json_enter_object(&r);
+
+    while (ok && llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "hash")) {
+            llz_json_read_string(&r, hash, sizeof(hash));
+        } else if (llz_json_key_is(&key, "synced")) {
+            synced = llz_json_read_bool(&r);
+        } else if (llz_json_key_is(&key, "lines")) {
+            ok = llz_lyrics_read_lines(&r, &b);
+        } else {
+            llz_json_skip(&r);
         }
     }
 
-    freeReplyObject(reply);
-    return success;
+    if (hash[0] == '\0' && fallbackHash) {
+        strncpy(hash, fallbackHash, sizeof(hash) - 1);
+    }
+    // Without lines the set is still worth keeping if we at least got the hash
+    ok = ok && (b.lineCount > 0 || hash[0] != '\0');
+
+    LlzLyricsEntry *entry = NULL;
+    if (ok) {
+        size_t linesSize = (size_t)b.lineCount * sizeof(LlzLyricsLine);
+        size_t blockSize = b.lineCount > 0 ? linesSize + b.textLen : 0;
+        LlzLyricsLine *block = blockSize ? (LlzLyricsLine *)malloc(blockSize) : NULL;
+        if (!blockSize || block) {
+            char *text = (char *)block + linesSize;
+            if (block) memcpy(text, b.text, b.textLen);
+            for (int i = 0; i < b.lineCount; i++) {
+                block[i].timestampMs = b.lines[i].timestampMs;
+                block[i].text = text + b.lines[i].textOffset;
+            }
+
+            entry = llz_lyrics_slot(hash);
+            memcpy(entry->hash, hash, sizeof(entry->hash));
+            entry->synced = synced;
+            entry->lineCount = b.lineCount;
+            entry->block = block;
+            entry->blockSize = blockSize;
+            entry->lastUse = ++g_lyricsUseClock;
+            entry->used = true;
+            g_lyricsStats.parses++;
+        }
+    }
+
+    free(b.lines);
+    free(b.text);
+    return entry;
 }
 
-bool LlzLyricsAreSynced(void)
+// Parse whatever the Redis lyrics slot currently holds into the cache
+static LlzLyricsEntry *llz_lyrics_load_slot(const char *fallbackHash)
 {
-    redisReply *reply = llz_media_command("GET %s", g_activeKeys.lyricsSynced);
-    if (!reply) return false;
+    redisReply *reply = llz_media_command("GET %s", g_activeKeys.lyricsData);
+    if (!reply) return NULL;
 
-    bool synced = false;
+    LlzLyricsEntry *entry = NULL;
     if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        synced = strcmp(reply->str, "true") == 0 || strcmp(reply->str, "1") == 0;
+        // Parse straight out of the reply buffer
+        entry = parse_lyrics_json(reply->str, reply->len, fallbackHash);
+        if (!entry) printf("[LYRICS] Failed to parse lyrics JSON\n");
     }
 
     freeReplyObject(reply);
-    return synced;
+    return entry;
 }
 
-// Simple JSON parser for lyrics - parses the lyrics:data JSON
-// This is a minimal parser for the specific lyrics JSON format
-static bool parse_lyrics_json(const char *json, LlzLyricsData *outLyrics)
+// Request lyrics for the first queued track once the playing track's set is
+// held, so the companion overwriting the Redis slot loses nothing.
+static void llz_lyrics_prefetch_next(const char *trackHash)
 {
-    if (!json || !outLyrics) return false;
+    static LlzQueueData queue;
 
-    memset(outLyrics, 0, sizeof(LlzLyricsData));
+    if (!g_lyricsPrefetchEnabled || !g_lyricsHashVerified) return;
+    if (!llz_lyrics_find(trackHash)) return;
+    if (!LlzMediaGetQueue(&queue) || queue.trackCount == 0) return;
 
-    // Find hash
-    const char *hashStart = strstr(json, "\"hash\":\"");
-    if (hashStart) {
-        hashStart += 8;
-        const char *hashEnd = strchr(hashStart, '"');
-        if (hashEnd) {
-            size_t len = hashEnd - hashStart;
-            if (len < sizeof(outLyrics->hash)) {
-                strncpy(outLyrics->hash, hashStart, len);
-            }
-        }
-    }
+    const LlzQueueTrack *next = &queue.tracks[0];
+    const char *nextHash = LlzLyricsGenerateHash(next->artist, next->title);
+    if (nextHash[0] == '\0' || strcmp(nextHash, trackHash) == 0) return;
+    if (llz_lyrics_find(nextHash) || strcmp(nextHash, g_lyricsPrefetchHash) == 0) return;
 
-    // Find synced
-    const char *syncedStart = strstr(json, "\"synced\":");
-    if (syncedStart) {
-        syncedStart += 9;
-        outLyrics->synced = (strncmp(syncedStart, "true", 4) == 0);
+    char requested[sizeof(g_lyricsPrefetchHash)];
+    strncpy(requested, nextHash, sizeof(requested) - 1);
+    requested[sizeof(requested) - 1] = '\0';
+    if (LlzLyricsRequest(next->artist, next->title)) {
+        memcpy(g_lyricsPrefetchHash, requested, sizeof(g_lyricsPrefetchHash));
+        g_lyricsStats.prefetches++;
     }
+}
 
-    // Count lines
-    int lineCount = 0;
-    const char *linesStart = strstr(json, "\"lines\":[");
-    if (linesStart) {
-        const char *p = linesStart;
-        while ((p = strstr(p, "{\"t\":")) != NULL) {
-            lineCount++;
-            p++;
-        }
-    }
+// Parse the slot holding slotHash unless that set is cached. A slot whose
+// data is missing or was rewritten under its hash is retried a little later.
+static void llz_lyrics_load_hash(const char *slotHash, double now)
+{
+    if (slotHash[0] == '\0' || llz_lyrics_find(slotHash)) return;
+    if (strcmp(slotHash, g_lyricsLoadedHash) == 0 && now - g_lyricsLoadedMs < LLZ_LYRICS_LOAD_RETRY_MS) return;
 
-    if (lineCount == 0) {
-        return outLyrics->hash[0] != '\0';  // Return true if we at least got the hash
-    }
+    strncpy(g_lyricsLoadedHash, slotHash, sizeof(g_lyricsLoadedHash) - 1);
+    g_lyricsLoadedMs = now;
+    llz_lyrics_load_slot(slotHash);
+}
 
-    // Allocate lines
-    outLyrics->lines = (LlzLyricsLine *)malloc(lineCount * sizeof(LlzLyricsLine));
-    if (!outLyrics->lines) return false;
+void LlzLyricsUpdate(void)
+{
+    char trackHash[64] = {0};
+    char slotHash[64] = {0};
+    llz_media_poller_start();
 
-    // Parse each line
-    const char *p = linesStart;
-    int idx = 0;
+    LlzMediaSnapshot snap;
+    llz_media_snapshot_read(&snap);
+    if (snap.mediaValid && snap.media.artist[0] && snap.media.track[0]) {
+        strncpy(trackHash, LlzLyricsGenerateHash(snap.media.artist, snap.media.track), sizeof(trackHash) - 1);
+    }
+    memcpy(slotHash, snap.lyricsHash, sizeof(slotHash));
 
-    while (idx < lineCount && (p = strstr(p, "{\"t\":")) != NULL) {
-        LlzLyricsLine *line = &outLyrics->lines[idx];
-        memset(line, 0, sizeof(LlzLyricsLine));
+    if (trackHash[0] && strcmp(slotHash, trackHash) == 0) g_lyricsHashVerified = true;
 
-        // Parse timestamp
-        p += 5;  // Skip {"t":
-        line->timestampMs = strtoll(p, NULL, 10);
+    double now = llz_redis_now_ms();
+    const char *resolved = slotHash;
+    if (llz_lyrics_find(trackHash)) {
+        resolved = trackHash;
+    } else if (slotHash[0] && strcmp(slotHash, g_lyricsPrefetchHash) == 0 &&
+               strcmp(slotHash, trackHash) != 0) {
+        // Prefetched lyrics landed: keep them for later, keep showing the old set
+        llz_lyrics_load_hash(slotHash, now);
+        resolved = g_lyricsReportedHash;
+    } else {
+        llz_lyrics_load_hash(slotHash, now);
+    }
 
-        // Find text
-        const char *textStart = strstr(p, "\"l\":\"");
-        if (textStart) {
-            textStart += 5;
-            const char *textEnd = strchr(textStart, '"');
-            if (textEnd) {
-                size_t len = textEnd - textStart;
-                if (len >= sizeof(line->text)) {
-                    len = sizeof(line->text) - 1;
-                }
-                strncpy(line->text, textStart, len);
-            }
+    if (g_lyricsPrefetchEnabled) {
+        bool trackChanged = strcmp(trackHash, g_lyricsTrackHash) != 0;
+        if (trackChanged) {
+            memcpy(g_lyricsTrackHash, trackHash, sizeof(g_lyricsTrackHash));
+            // queue:data is only refreshed on request
+            if (trackHash[0] && g_lyricsHashVerified) LlzMediaRequestQueue();
+        }
+        if (trackHash[0] && (trackChanged || now - g_lyricsPrefetchCheckedMs >= LLZ_LYRICS_PREFETCH_CHECK_MS)) {
+            g_lyricsPrefetchCheckedMs = now;
+            llz_lyrics_prefetch_next(trackHash);
         }
+    }
 
-        idx++;
-        p++;
+    if (resolved != g_lyricsReportedHash) {
+        strncpy(g_lyricsReportedHash, resolved, sizeof(g_lyricsReportedHash) - 1);
+        g_lyricsReportedHash[sizeof(g_lyricsReportedHash) - 1] = '\0';
     }
+}
 
-    outLyrics->lineCount = idx;
+bool LlzLyricsGetHash(char *outHash, size_t maxLen)
+{
+    if (!outHash || maxLen == 0) return false;
+    if (g_lyricsReportedHash[0] == '\0' || strlen(g_lyricsReportedHash) >= maxLen) return false;
+    strcpy(outHash, g_lyricsReportedHash);
     return true;
 }
 
+bool LlzLyricsAreSynced(void)
+{
+    LlzLyricsEntry *entry = llz_lyrics_find(g_lyricsReportedHash);
+    return entry ? entry->synced : false;
+}
+
 bool LlzLyricsGet(LlzLyricsData *outLyrics)
 {
     if (!outLyrics) return false;
 
-    printf("[LYRICS] LlzLyricsGet: Fetching lyrics from Redis\n");
-
     memset(outLyrics, 0, sizeof(LlzLyricsData));
 
-    // Get JSON from Redis
-    char *jsonBuf = (char *)malloc(64 * 1024);  // 64KB buffer for lyrics JSON
-    if (!jsonBuf) {
-        printf("[LYRICS] LlzLyricsGet: Failed to allocate JSON buffer\n");
-        return false;
-    }
-
-    bool success = LlzLyricsGetJson(jsonBuf, 64 * 1024);
-    if (success) {
-        success = parse_lyrics_json(jsonBuf, outLyrics);
-        if (success) {
-            printf("[LYRICS] LlzLyricsGet: Parsed lyrics - hash='%s', synced=%d, lineCount=%d\n",
-                   outLyrics->hash, outLyrics->synced, outLyrics->lineCount);
-        } else {
-            printf("[LYRICS] LlzLyricsGet: Failed to parse lyrics JSON\n");
+    LlzLyricsEntry *entry = llz_lyrics_find(g_lyricsReportedHash);
+    if (!entry) return false;
+    g_lyricsStats.hits++;
+    entry->lastUse = ++g_lyricsUseClock;
+
+    if (entry->blockSize > 0) {
+        LlzLyricsLine *lines = (LlzLyricsLine *)malloc(entry->blockSize);
+        if (!lines) return false;
+        memcpy(lines, entry->block, entry->blockSize);
+        // Rebase text pointers onto the copy
+        const char *oldBase = (const char *)entry->block;
+        const char *newBase = (const char *)lines;
+        for (int i = 0; i < entry->lineCount; i++) {
+            lines[i].text = newBase + (lines[i].text - oldBase);
         }
+        outLyrics->lines = lines;
+        outLyrics->lineCount = entry->lineCount;
     }
 
-    free(jsonBuf);
-    return success;
+    memcpy(outLyrics->hash, entry->hash, sizeof(outLyrics->hash));
+    outLyrics->synced = entry->synced;
+    return true;
 }
 
 void LlzLyricsFree(LlzLyricsData *lyrics)
@@ -1399,6 +2525,25 @@ void LlzLyricsFree(LlzLyricsData *lyrics)
     lyrics->lineCount = 0;
 }
 
+void LlzLyricsSetPrefetchEnabled(bool enabled)
+{
+    g_lyricsPrefetchEnabled = enabled;
+    if (!enabled) g_lyricsPrefetchHash[0] = '\0';
+}
+
+void LlzLyricsGetCacheStats(LlzLyricsCacheStats *outStats)
+{
+    if (!outStats) return;
+    *outStats = g_lyricsStats;
+    outStats->entries = 0;
+    outStats->bytes = 0;
+    for (int i = 0; i < LLZ_LYRICS_CACHE_MAX; i++) {
+        if (!g_lyricsCache[i].used) continue;
+        outStats->entries++;
+        outStats->bytes += g_lyricsCache[i].blockSize;
+    }
+}
+
 int LlzLyricsFindCurrentLine(int64_t positionMs, const LlzLyricsData *lyrics)
 {
     if (!lyrics || !lyrics->lines || lyrics->lineCount == 0) {
@@ -1486,22 +2631,14 @@ bool LlzLyricsRequest(const char *artist, const char *track)
     // Push lyrics request command to the playback command queue
     // Format matches the LyricsRequest struct in golang_ble_client/Android
     // {"action":"request_lyrics","artist":"...","track":"...","timestamp":...}
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_lyrics\",\"artist\":\"%s\",\"track\":\"%s\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "request_lyrics",
+        "{\"action\":\"request_lyrics\",\"artist\":\"%s\",\"track\":\"%s\",\"timestamp\":%lld}",
         artist,
         track,
         ts
     );
 
-    if (!reply) {
-        printf("[LYRICS] LlzLyricsRequest: Redis command failed\n");
-        return false;
-    }
-
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
         printf("[LYRICS] LlzLyricsRequest: Queued lyrics request for '%s' - '%s'\n", artist, track);
     } else {
@@ -1562,6 +2699,12 @@ bool LlzLyricsStore(const char *lyricsJson, const char *hash, bool synced)
     freeReplyObject(reply);
 
     if (syncedOk) {
+        // The next LlzLyricsGet re-parses the stored JSON
+        LlzLyricsEntry *entry = llz_lyrics_find(hash);
+        if (entry) {
+            free(entry->block);
+            memset(entry, 0, sizeof(*entry));
+        }
         printf("[LYRICS] LlzLyricsStore: Lyrics stored successfully\n");
     } else {
         printf("[LYRICS] LlzLyricsStore: Failed to store synced flag (not OK response)\n");
@@ -1580,137 +2723,81 @@ bool LlzMediaRequestChannels(void)
 
     long long ts = (long long)time(NULL);
 
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"request_media_channels\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "request_media_channels",
+        "{\"action\":\"request_media_channels\",\"timestamp\":%lld}",
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("media:channels");
         printf("[MEDIA_CHANNELS] Requested media channel list from Android\n");
     }
 
     return success;
 }
 
-bool LlzMediaGetChannels(LlzMediaChannels *outChannels)
+// Format: {"channels":["Spotify","YouTube"],"count":2,"timestamp":123}
+static bool llz_channels_parse(const char *json, size_t len, void *out)
 {
-    if (!outChannels) return false;
-    memset(outChannels, 0, sizeof(*outChannels));
-
-    redisReply *reply = llz_media_command("GET media:channels");
-    if (!reply) return false;
-
+    LlzMediaChannels *outChannels = (LlzMediaChannels *)out;
     bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        // Parse JSON: {"channels":["Spotify","YouTube"],"count":2,"timestamp":123}
-        // Simple parsing - find channels array
-        const char *json = reply->str;
-
-        // Find "count":
-        const char *countPtr = strstr(json, "\"count\":");
-        if (countPtr) {
-            outChannels->count = atoi(countPtr + 8);
-            if (outChannels->count > LLZ_MEDIA_CHANNEL_MAX) {
-                outChannels->count = LLZ_MEDIA_CHANNEL_MAX;
-            }
-        }
 
-        // Find "timestamp":
-        const char *tsPtr = strstr(json, "\"timestamp\":");
-        if (tsPtr) {
-            outChannels->timestamp = strtoll(tsPtr + 12, NULL, 10);
-        }
-
-        // Find "channels":[ and parse array
-        const char *arrStart = strstr(json, "\"channels\":[");
-        if (arrStart) {
-            arrStart = strchr(arrStart, '[');
-            if (arrStart) {
-                arrStart++; // Skip '['
-                int idx = 0;
-                while (idx < outChannels->count && idx < LLZ_MEDIA_CHANNEL_MAX) {
-                    // Find next string
-                    const char *strStart = strchr(arrStart, '"');
-                    if (!strStart) break;
-                    strStart++; // Skip opening quote
-
-                    const char *strEnd = strchr(strStart, '"');
-                    if (!strEnd) break;
-
-                    size_t len = strEnd - strStart;
-                    if (len >= LLZ_MEDIA_CHANNEL_NAME_MAX) {
-                        len = LLZ_MEDIA_CHANNEL_NAME_MAX - 1;
-                    }
-                    strncpy(outChannels->channels[idx], strStart, len);
-                    outChannels->channels[idx][len] = '\0';
-
-                    idx++;
-                    arrStart = strEnd + 1;
-
-                    // Skip to next element or end
-                    while (*arrStart && *arrStart != '"' && *arrStart != ']') {
-                        arrStart++;
-                    }
-                    if (*arrStart == ']') break;
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "channels")) {
+            if (!llz_json_enter_array(&r)) continue;
+            success = true;
+            while (llz_json_next_element(&r)) {
+                if (outChannels->count >= LLZ_MEDIA_CHANNEL_MAX) {
+                    llz_json_skip(&r);
+                    continue;
+                }
+                if (llz_json_read_string(&r, outChannels->channels[outChannels->count],
+                                         LLZ_MEDIA_CHANNEL_NAME_MAX)) {
+                    outChannels->count++;
                 }
-                success = true;
             }
+        } else if (llz_json_key_is(&key, "timestamp")) {
+            outChannels->timestamp = llz_json_read_int64(&r);
+        } else {
+            llz_json_skip(&r);
         }
     }
 
-    freeReplyObject(reply);
     return success;
 }
 
-bool LlzMediaGetChannelsJson(char *outJson, size_t maxLen)
+bool LlzMediaGetChannels(LlzMediaChannels *outChannels)
 {
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET media:channels");
-    if (!reply) return false;
-
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
+    if (!outChannels) return false;
+    return llz_blob_get_parsed("media:channels", outChannels, sizeof(*outChannels), llz_channels_parse);
+}
 
-    freeReplyObject(reply);
-    return success;
+bool LlzMediaGetChannelsJson(char *outJson, size_t maxLen)
+{
+    return llz_blob_get_json("media:channels", outJson, maxLen, false);
 }
 
 bool LlzMediaSelectChannel(const char *channelName)
 {
     if (!channelName || channelName[0] == '\0') return false;
-    if (!llz_media_ensure_connection()) return false;
-
     // Build JSON command: {"action":"select_media_channel","channel":"Spotify"}
-    char cmd[512];
-    snprintf(cmd, sizeof(cmd),
-             "{\"action\":\"select_media_channel\",\"channel\":\"%s\",\"timestamp\":%lld}",
-             channelName, (long long)time(NULL));
-
     printf("[MEDIA_CHANNELS] Selecting channel: %s\n", channelName);
 
-    redisReply *reply = llz_media_command("RPUSH %s %s",
-                                          g_activeKeys.playbackCommandQueue, cmd);
-    if (!reply) return false;
-
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
+    bool success = llz_media_queue_request(
+        "select_media_channel",
+        "{\"action\":\"select_media_channel\",\"channel\":\"%s\",\"timestamp\":%lld}",
+        channelName, (long long)time(NULL)
+    );
 
     // Also store locally in Redis for quick access
     if (success) {
-        reply = llz_media_command("SET media:controlled_channel %s", channelName);
+        redisReply *reply = llz_media_command("SET media:controlled_channel %s", channelName);
         if (reply) freeReplyObject(reply);
     }
 
@@ -1744,209 +2831,108 @@ bool LlzMediaGetControlledChannel(char *outChannel, size_t maxLen)
 
 bool LlzMediaRequestQueue(void)
 {
-    if (!llz_media_ensure_connection()) return false;
-
     // Build JSON command: {"action":"request_queue","timestamp":...}
-    char cmd[256];
-    snprintf(cmd, sizeof(cmd),
-             "{\"action\":\"request_queue\",\"timestamp\":%lld}",
-             (long long)time(NULL));
-
     printf("[QUEUE] Requesting playback queue\n");
 
-    redisReply *reply = llz_media_command("RPUSH %s %s",
-                                          g_activeKeys.playbackCommandQueue, cmd);
-    if (!reply) return false;
-
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-    return success;
-}
-
-bool LlzMediaGetQueueJson(char *outJson, size_t maxLen)
-{
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET queue:data");
-    if (!reply) return false;
+    bool success = llz_media_queue_request(
+        "request_queue",
+        "{\"action\":\"request_queue\",\"timestamp\":%lld}",
+        (long long)time(NULL)
+    );
 
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
+    if (success) {
+        LlzMediaInvalidateBlob("queue:data");
     }
-
-    freeReplyObject(reply);
     return success;
 }
 
-// Helper to parse JSON string value for queue
-static bool llz_queue_parse_string(const char *json, const char *key, char *outValue, size_t maxLen)
-{
-    char searchKey[64];
-    snprintf(searchKey, sizeof(searchKey), "\"%s\":\"", key);
-    const char *start = strstr(json, searchKey);
-    if (!start) {
-        // Try alternate format with space after colon
-        snprintf(searchKey, sizeof(searchKey), "\"%s\": \"", key);
-        start = strstr(json, searchKey);
-        if (!start) return false;
-    }
-    start = strchr(start, ':');
-    if (!start) return false;
-    start++;
-    while (*start == ' ' || *start == '\t') start++;
-    if (*start != '"') return false;
-    start++;
-
-    const char *end = start;
-    while (*end && *end != '"') {
-        if (*end == '\\' && *(end+1)) end++; // Skip escaped chars
-        end++;
-    }
-
-    size_t len = end - start;
-    if (len >= maxLen) len = maxLen - 1;
-    memcpy(outValue, start, len);
-    outValue[len] = '\0';
-    return true;
-}
-
-// Helper to parse JSON integer value for queue
-static bool llz_queue_parse_int64(const char *json, const char *key, int64_t *outValue)
+bool LlzMediaGetQueueJson(char *outJson, size_t maxLen)
 {
-    char searchKey[64];
-    snprintf(searchKey, sizeof(searchKey), "\"%s\":", key);
-    const char *start = strstr(json, searchKey);
-    if (!start) return false;
-    start = strchr(start, ':');
-    if (!start) return false;
-    start++;
-    while (*start == ' ' || *start == '\t') start++;
-    *outValue = strtoll(start, NULL, 10);
-    return true;
+    return llz_blob_get_json("queue:data", outJson, maxLen, false);
 }
 
-// Helper to parse a single track from JSON
-static bool llz_queue_parse_track(const char *json, const char *end, LlzQueueTrack *track)
+// Read one track object; consumes the value even if it is not an object
+static bool llz_queue_read_track(LlzJsonReader *r, LlzQueueTrack *track)
 {
-    // Create a null-terminated copy of this track's JSON
-    size_t len = end - json;
-    char *trackJson = (char *)malloc(len + 1);
-    if (!trackJson) return false;
-    memcpy(trackJson, json, len);
-    trackJson[len] = '\0';
-
+    LlzJsonKey key;
     memset(track, 0, sizeof(LlzQueueTrack));
-    llz_queue_parse_string(trackJson, "title", track->title, LLZ_QUEUE_TITLE_MAX);
-    llz_queue_parse_string(trackJson, "artist", track->artist, LLZ_QUEUE_ARTIST_MAX);
-    llz_queue_parse_string(trackJson, "album", track->album, LLZ_QUEUE_ALBUM_MAX);
-    llz_queue_parse_string(trackJson, "uri", track->uri, LLZ_QUEUE_URI_MAX);
-    llz_queue_parse_int64(trackJson, "duration", &track->durationMs);
-
-    free(trackJson);
-    return track->title[0] != '\0';
-}
-
-bool LlzMediaGetQueue(LlzQueueData *outQueue)
-{
-    if (!outQueue) return false;
-    memset(outQueue, 0, sizeof(LlzQueueData));
-
-    char jsonBuffer[32768];
-    if (!LlzMediaGetQueueJson(jsonBuffer, sizeof(jsonBuffer))) {
-        return false;
-    }
-
-    // Parse service
-    llz_queue_parse_string(jsonBuffer, "service", outQueue->service, sizeof(outQueue->service));
-
-    // Parse timestamp
-    llz_queue_parse_int64(jsonBuffer, "timestamp", &outQueue->timestamp);
-
-    // Parse currentlyPlaying (may be null)
-    const char *cpStart = strstr(jsonBuffer, "\"currentlyPlaying\":");
-    if (cpStart) {
-        cpStart = strchr(cpStart, ':');
-        if (cpStart) {
-            cpStart++;
-            while (*cpStart == ' ' || *cpStart == '\t') cpStart++;
-            if (*cpStart == '{') {
-                // Find the closing brace
-                int braceCount = 1;
-                const char *cpEnd = cpStart + 1;
-                while (*cpEnd && braceCount > 0) {
-                    if (*cpEnd == '{') braceCount++;
-                    else if (*cpEnd == '}') braceCount--;
-                    cpEnd++;
-                }
-                if (llz_queue_parse_track(cpStart, cpEnd, &outQueue->currentlyPlaying)) {
-                    outQueue->hasCurrentlyPlaying = true;
-                }
-            }
+    if (!llz_json_enter_object(r)) return false;
+
+    while (llz_json_next_member(r, &key)) {
+        if (llz_json_key_is(&key, "title")) {
+            llz_json_read_string(r, track->title, LLZ_QUEUE_TITLE_MAX);
+        } else if (llz_json_key_is(&key, "artist")) {
+            llz_json_read_string(r, track->artist, LLZ_QUEUE_ARTIST_MAX);
+        } else if (llz_json_key_is(&key, "album")) {
+            llz_json_read_string(r, track->album, LLZ_QUEUE_ALBUM_MAX);
+        } else if (llz_json_key_is(&key, "uri")) {
+            llz_json_read_string(r, track->uri, LLZ_QUEUE_URI_MAX);
+        } else if (llz_json_key_is(&key, "duration")) {
+            track->durationMs = llz_json_read_int64(r);
+        } else {
+            llz_json_skip(r);
         }
     }
+    return track->title[0] != '\0';
+}
 
-    // Parse tracks array
-    const char *tracksStart = strstr(jsonBuffer, "\"tracks\":");
-    if (tracksStart) {
-        tracksStart = strchr(tracksStart, '[');
-        if (tracksStart) {
-            tracksStart++;
-
-            while (*tracksStart && outQueue->trackCount < LLZ_QUEUE_TRACK_MAX) {
-                // Skip whitespace
-                while (*tracksStart == ' ' || *tracksStart == '\t' || *tracksStart == '\n' || *tracksStart == ',') {
-                    tracksStart++;
-                }
-
-                if (*tracksStart == ']') break;
-                if (*tracksStart != '{') break;
-
-                // Find the closing brace for this track
-                int braceCount = 1;
-                const char *trackEnd = tracksStart + 1;
-                while (*trackEnd && braceCount > 0) {
-                    if (*trackEnd == '{') braceCount++;
-                    else if (*trackEnd == '}') braceCount--;
-                    trackEnd++;
+// Format: {"service":"spotify","timestamp":..,"currentlyPlaying":{..}|null,"tracks":[{..},..]}
+static bool llz_queue_parse(const char *json, size_t len, void *out)
+{
+    LlzQueueData *outQueue = (LlzQueueData *)out;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "service")) {
+            llz_json_read_string(&r, outQueue->service, sizeof(outQueue->service));
+        } else if (llz_json_key_is(&key, "timestamp")) {
+            outQueue->timestamp = llz_json_read_int64(&r);
+        } else if (llz_json_key_is(&key, "currentlyPlaying")) {
+            outQueue->hasCurrentlyPlaying = llz_queue_read_track(&r, &outQueue->currentlyPlaying);
+        } else if (llz_json_key_is(&key, "tracks")) {
+            if (!llz_json_enter_array(&r)) continue;
+            while (llz_json_next_element(&r)) {
+                if (outQueue->trackCount >= LLZ_QUEUE_TRACK_MAX) {
+                    llz_json_skip(&r);
+                    continue;
                 }
-
-                if (llz_queue_parse_track(tracksStart, trackEnd, &outQueue->tracks[outQueue->trackCount])) {
+                if (llz_queue_read_track(&r, &outQueue->tracks[outQueue->trackCount])) {
                     outQueue->trackCount++;
                 }
-
-                tracksStart = trackEnd;
             }
+        } else {
+            llz_json_skip(&r);
         }
     }
 
     return true;
 }
 
+bool LlzMediaGetQueue(LlzQueueData *outQueue)
+{
+    if (!outQueue) return false;
+    return llz_blob_get_parsed("queue:data", outQueue, sizeof(*outQueue), llz_queue_parse);
+}
+
 bool LlzMediaQueueShift(int queueIndex)
 {
     if (queueIndex < 0) return false;
-    if (!llz_media_ensure_connection()) return false;
-
     // Build JSON command: {"action":"queue_shift","queueIndex":0,"timestamp":...}
-    char cmd[256];
-    snprintf(cmd, sizeof(cmd),
-             "{\"action\":\"queue_shift\",\"queueIndex\":%d,\"timestamp\":%lld}",
-             queueIndex, (long long)time(NULL));
-
     printf("[QUEUE] Queue shift to index: %d\n", queueIndex);
 
-    redisReply *reply = llz_media_command("RPUSH %s %s",
-                                          g_activeKeys.playbackCommandQueue, cmd);
-    if (!reply) return false;
+    bool success = llz_media_queue_request(
+        "queue_shift",
+        "{\"action\":\"queue_shift\",\"queueIndex\":%d,\"timestamp\":%lld}",
+        queueIndex, (long long)time(NULL)
+    );
 
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
+    if (success) {
+        LlzMediaInvalidateBlob("queue:data");
+    }
     return success;
 }
 
@@ -1959,17 +2945,14 @@ bool LlzMediaRequestLibraryOverview(void)
     if (!g_activeKeys.playbackCommandQueue) return false;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"library_overview\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "library_overview",
+        "{\"action\":\"library_overview\",\"timestamp\":%lld}",
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("spotify:library:overview");
         printf("[SPOTIFY_LIB] Requested library overview\n");
     }
     return success;
@@ -1981,18 +2964,15 @@ bool LlzMediaRequestLibraryRecent(int limit)
     if (limit <= 0) limit = 20;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"library_recent\",\"limit\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "library_recent",
+        "{\"action\":\"library_recent\",\"limit\":%d,\"timestamp\":%lld}",
         limit,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("spotify:library:recent");
         printf("[SPOTIFY_LIB] Requested recent tracks (limit=%d)\n", limit);
     }
     return success;
@@ -2005,19 +2985,16 @@ bool LlzMediaRequestLibraryLiked(int offset, int limit)
     if (limit <= 0) limit = 20;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"library_liked\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "library_liked",
+        "{\"action\":\"library_liked\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
         offset,
         limit,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("spotify:library:liked");
         printf("[SPOTIFY_LIB] Requested liked tracks (offset=%d, limit=%d)\n", offset, limit);
     }
     return success;
@@ -2030,19 +3007,16 @@ bool LlzMediaRequestLibraryAlbums(int offset, int limit)
     if (limit <= 0) limit = 20;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"library_albums\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "library_albums",
+        "{\"action\":\"library_albums\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
         offset,
         limit,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("spotify:library:albums");
         printf("[SPOTIFY_LIB] Requested albums (offset=%d, limit=%d)\n", offset, limit);
     }
     return success;
@@ -2055,503 +3029,374 @@ bool LlzMediaRequestLibraryPlaylists(int offset, int limit)
     if (limit <= 0) limit = 20;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"library_playlists\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
+    bool success = llz_media_queue_request(
+        "library_playlists",
+        "{\"action\":\"library_playlists\",\"offset\":%d,\"limit\":%d,\"timestamp\":%lld}",
         offset,
         limit,
         ts
     );
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
-    if (success) {
-        printf("[SPOTIFY_LIB] Requested playlists (offset=%d, limit=%d)\n", offset, limit);
-    }
-    return success;
-}
-
-bool LlzMediaPlaySpotifyUri(const char *uri)
-{
-    if (!uri || uri[0] == '\0') return false;
-    if (!g_activeKeys.playbackCommandQueue) return false;
-
-    long long ts = (long long)time(NULL);
-    redisReply *reply = llz_media_command(
-        "LPUSH %s {\"action\":\"play_uri\",\"uri\":\"%s\",\"timestamp\":%lld}",
-        g_activeKeys.playbackCommandQueue,
-        uri,
-        ts
-    );
-
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
-    if (success) {
-        printf("[SPOTIFY_LIB] Queued play URI: %s\n", uri);
-    }
-    return success;
-}
-
-// JSON helper: parse a string field from JSON
-static bool llz_lib_parse_string(const char *json, const char *key, char *out, size_t maxLen)
-{
-    if (!json || !key || !out || maxLen == 0) return false;
-    out[0] = '\0';
-
-    // Build search pattern (check for both short and long keys)
-    char pattern[64];
-    snprintf(pattern, sizeof(pattern), "\"%s\":\"", key);
-
-    const char *start = strstr(json, pattern);
-    if (!start) return false;
-
-    start = strchr(start, ':');
-    if (!start) return false;
-    start++;
-    while (*start == ' ' || *start == '\t') start++;
-    if (*start != '"') return false;
-    start++;
-
-    // Find end of string (handle escape sequences)
-    const char *end = start;
-    while (*end && *end != '"') {
-        if (*end == '\\' && *(end + 1)) end++;
-        end++;
-    }
-
-    size_t len = end - start;
-    if (len >= maxLen) len = maxLen - 1;
-    memcpy(out, start, len);
-    out[len] = '\0';
-    return true;
-}
-
-// JSON helper: parse an integer field from JSON
-static int llz_lib_parse_int(const char *json, const char *key)
-{
-    if (!json || !key) return 0;
-
-    char pattern[64];
-    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
-
-    const char *start = strstr(json, pattern);
-    if (!start) return 0;
-
-    start = strchr(start, ':');
-    if (!start) return 0;
-    start++;
-    while (*start == ' ' || *start == '\t') start++;
-
-    return atoi(start);
-}
-
-// JSON helper: parse an int64 field from JSON
-static int64_t llz_lib_parse_int64(const char *json, const char *key)
-{
-    if (!json || !key) return 0;
-
-    char pattern[64];
-    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
-
-    const char *start = strstr(json, pattern);
-    if (!start) return 0;
-
-    start = strchr(start, ':');
-    if (!start) return 0;
-    start++;
-    while (*start == ' ' || *start == '\t') start++;
-
-    return strtoll(start, NULL, 10);
-}
-
-// JSON helper: parse a bool field from JSON
-static bool llz_lib_parse_bool(const char *json, const char *key)
-{
-    if (!json || !key) return false;
-
-    char pattern[64];
-    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
-
-    const char *start = strstr(json, pattern);
-    if (!start) return false;
-
-    start = strchr(start, ':');
-    if (!start) return false;
-    start++;
-    while (*start == ' ' || *start == '\t') start++;
-
-    return (strncmp(start, "true", 4) == 0);
-}
-
-// Get raw JSON for library overview
-bool LlzMediaGetLibraryOverviewJson(char *outJson, size_t maxLen)
-{
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET spotify:library:overview");
-    if (!reply) return false;
-
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
-    return success;
-}
-
-bool LlzMediaGetLibraryOverview(LlzSpotifyLibraryOverview *outOverview)
-{
-    if (!outOverview) return false;
-    memset(outOverview, 0, sizeof(*outOverview));
-
-    char json[4096];
-    if (!LlzMediaGetLibraryOverviewJson(json, sizeof(json))) {
-        return false;
-    }
-
-    // Parse using short JSON keys from Android (matching SpotifyLibraryModels.kt)
-    llz_lib_parse_string(json, "u", outOverview->userName, sizeof(outOverview->userName));
-    outOverview->likedCount = llz_lib_parse_int(json, "lt");
-    outOverview->albumsCount = llz_lib_parse_int(json, "al");
-    outOverview->playlistsCount = llz_lib_parse_int(json, "pl");
-    outOverview->artistsCount = llz_lib_parse_int(json, "ar");
-    llz_lib_parse_string(json, "ct", outOverview->currentTrack, sizeof(outOverview->currentTrack));
-    llz_lib_parse_string(json, "ca", outOverview->currentArtist, sizeof(outOverview->currentArtist));
-    outOverview->isPremium = llz_lib_parse_bool(json, "pr");
-    outOverview->timestamp = llz_lib_parse_int64(json, "t");
-    outOverview->valid = (outOverview->userName[0] != '\0');
-
-    return outOverview->valid;
-}
-
-// Get raw JSON for track lists
-bool LlzMediaGetLibraryTracksJson(const char *type, char *outJson, size_t maxLen)
-{
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    const char *key = "spotify:library:recent";
-    if (type && strcmp(type, "liked") == 0) {
-        key = "spotify:library:liked";
-    }
-
-    redisReply *reply = llz_media_command("GET %s", key);
-    if (!reply) return false;
-
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
-    return success;
-}
-
-// Parse a track item from JSON object starting at 'start'
-static bool llz_lib_parse_track_item(const char *start, const char *end, LlzSpotifyTrackItem *track)
-{
-    if (!start || !end || !track || end <= start) return false;
-
-    // Create null-terminated copy
-    size_t len = end - start;
-    char *itemJson = (char *)malloc(len + 1);
-    if (!itemJson) return false;
-    memcpy(itemJson, start, len);
-    itemJson[len] = '\0';
-
-    memset(track, 0, sizeof(*track));
-    llz_lib_parse_string(itemJson, "i", track->id, sizeof(track->id));
-    llz_lib_parse_string(itemJson, "n", track->name, sizeof(track->name));
-    llz_lib_parse_string(itemJson, "a", track->artist, sizeof(track->artist));
-    llz_lib_parse_string(itemJson, "al", track->album, sizeof(track->album));
-    track->durationMs = llz_lib_parse_int64(itemJson, "d");
-    llz_lib_parse_string(itemJson, "u", track->uri, sizeof(track->uri));
-    llz_lib_parse_string(itemJson, "im", track->imageUrl, sizeof(track->imageUrl));
-
-    free(itemJson);
-    return track->id[0] != '\0';
-}
-
-bool LlzMediaGetLibraryTracks(const char *type, LlzSpotifyTrackListResponse *outResponse)
-{
-    if (!outResponse) return false;
-    memset(outResponse, 0, sizeof(*outResponse));
-
-    char *json = (char *)malloc(65536);  // 64KB buffer
-    if (!json) return false;
-
-    if (!LlzMediaGetLibraryTracksJson(type, json, 65536)) {
-        free(json);
-        return false;
-    }
-
-    // Parse response fields
-    llz_lib_parse_string(json, "ty", outResponse->type, sizeof(outResponse->type));
-    outResponse->offset = llz_lib_parse_int(json, "o");
-    outResponse->limit = llz_lib_parse_int(json, "l");
-    outResponse->total = llz_lib_parse_int(json, "tt");
-    outResponse->hasMore = llz_lib_parse_bool(json, "hm");
-    outResponse->timestamp = llz_lib_parse_int64(json, "t");
-
-    // Parse items array
-    const char *itemsStart = strstr(json, "\"it\":[");
-    if (itemsStart) {
-        itemsStart = strchr(itemsStart, '[');
-        if (itemsStart) {
-            itemsStart++;
-
-            while (outResponse->itemCount < LLZ_SPOTIFY_LIST_MAX) {
-                // Skip whitespace
-                while (*itemsStart == ' ' || *itemsStart == '\t' || *itemsStart == '\n' || *itemsStart == ',') {
-                    itemsStart++;
-                }
-
-                if (*itemsStart == ']') break;
-                if (*itemsStart != '{') break;
-
-                // Find closing brace
-                int braceCount = 1;
-                const char *itemEnd = itemsStart + 1;
-                while (*itemEnd && braceCount > 0) {
-                    if (*itemEnd == '{') braceCount++;
-                    else if (*itemEnd == '}') braceCount--;
-                    itemEnd++;
-                }
-
-                if (llz_lib_parse_track_item(itemsStart, itemEnd, &outResponse->items[outResponse->itemCount])) {
-                    outResponse->itemCount++;
-                }
-
-                itemsStart = itemEnd;
-            }
-        }
-    }
-
-    outResponse->valid = true;
-    free(json);
-    return true;
-}
-
-// Get raw JSON for album list
-bool LlzMediaGetLibraryAlbumsJson(char *outJson, size_t maxLen)
-{
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET spotify:library:albums");
-    if (!reply) return false;
-
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
+    if (success) {
+        LlzMediaInvalidateBlob("spotify:library:playlists");
+        printf("[SPOTIFY_LIB] Requested playlists (offset=%d, limit=%d)\n", offset, limit);
+    }
     return success;
 }
 
-// Parse an album item from JSON object
-static bool llz_lib_parse_album_item(const char *start, const char *end, LlzSpotifyAlbumItem *album)
+bool LlzMediaPlaySpotifyUri(const char *uri)
 {
-    if (!start || !end || !album || end <= start) return false;
-
-    size_t len = end - start;
-    char *itemJson = (char *)malloc(len + 1);
-    if (!itemJson) return false;
-    memcpy(itemJson, start, len);
-    itemJson[len] = '\0';
+    if (!uri || uri[0] == '\0') return false;
+    if (!g_activeKeys.playbackCommandQueue) return false;
 
-    memset(album, 0, sizeof(*album));
-    llz_lib_parse_string(itemJson, "i", album->id, sizeof(album->id));
-    llz_lib_parse_string(itemJson, "n", album->name, sizeof(album->name));
-    llz_lib_parse_string(itemJson, "a", album->artist, sizeof(album->artist));
-    album->trackCount = llz_lib_parse_int(itemJson, "tc");
-    llz_lib_parse_string(itemJson, "u", album->uri, sizeof(album->uri));
-    llz_lib_parse_string(itemJson, "im", album->imageUrl, sizeof(album->imageUrl));
-    llz_lib_parse_string(itemJson, "y", album->year, sizeof(album->year));
+    long long ts = (long long)time(NULL);
+    bool success = llz_media_queue_request(
+        "play_uri",
+        "{\"action\":\"play_uri\",\"uri\":\"%s\",\"timestamp\":%lld}",
+        uri,
+        ts
+    );
 
-    free(itemJson);
-    return album->id[0] != '\0';
+    if (success) {
+        printf("[SPOTIFY_LIB] Queued play URI: %s\n", uri);
+    }
+    return success;
 }
 
-bool LlzMediaGetLibraryAlbums(LlzSpotifyAlbumListResponse *outResponse)
-{
-    if (!outResponse) return false;
-    memset(outResponse, 0, sizeof(*outResponse));
+typedef bool (*LlzLibItemReader)(LlzJsonReader *r, void *item);
 
-    char *json = (char *)malloc(65536);
-    if (!json) return false;
+// Read the "it" array of a library page into items[]; entries the reader
+// rejects are dropped. Pages can hold thousands of entries, so once items[]
+// is full the rest of the array is skipped in one pass, or left unread
+// entirely when stopWhenFull is set because the caller has already seen
+// every other member and stops parsing there.
+static int llz_lib_read_items(LlzJsonReader *r, void *items, size_t itemSize, int maxItems,
+                              LlzLibItemReader readItem, bool stopWhenFull)
+{
+    int count = 0;
+    if (!llz_json_enter_array(r)) return 0;
 
-    if (!LlzMediaGetLibraryAlbumsJson(json, 65536)) {
-        free(json);
-        return false;
+    while (llz_json_next_element(r)) {
+        if (count >= maxItems) {
+            if (!stopWhenFull) llz_json_leave(r);
+            break;
+        }
+        void *item = (char *)items + (size_t)count * itemSize;
+        memset(item, 0, itemSize);
+        if (readItem(r, item)) count++;
     }
+    return count;
+}
 
-    // Parse response fields
-    outResponse->offset = llz_lib_parse_int(json, "o");
-    outResponse->limit = llz_lib_parse_int(json, "l");
-    outResponse->total = llz_lib_parse_int(json, "tt");
-    outResponse->hasMore = llz_lib_parse_bool(json, "hm");
-    outResponse->timestamp = llz_lib_parse_int64(json, "t");
-
-    // Parse items array
-    const char *itemsStart = strstr(json, "\"it\":[");
-    if (itemsStart) {
-        itemsStart = strchr(itemsStart, '[');
-        if (itemsStart) {
-            itemsStart++;
+// Get raw JSON for library overview
+bool LlzMediaGetLibraryOverviewJson(char *outJson, size_t maxLen)
+{
+    return llz_blob_get_json("spotify:library:overview", outJson, maxLen, false);
+}
+
+static bool llz_lib_parse_overview(const char *json, size_t len, void *out)
+{
+    LlzSpotifyLibraryOverview *outOverview = (LlzSpotifyLibraryOverview *)out;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    // Short JSON keys from Android (matching SpotifyLibraryModels.kt)
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "u")) {
+            llz_json_read_string(&r, outOverview->userName, sizeof(outOverview->userName));
+        } else if (llz_json_key_is(&key, "lt")) {
+            outOverview->likedCount = llz_json_read_int(&r);
+        } else if (llz_json_key_is(&key, "al")) {
+            outOverview->albumsCount = llz_json_read_int(&r);
+        } else if (llz_json_key_is(&key, "pl")) {
+            outOverview->playlistsCount = llz_json_read_int(&r);
+        } else if (llz_json_key_is(&key, "ar")) {
+            outOverview->artistsCount = llz_json_read_int(&r);
+        } else if (llz_json_key_is(&key, "ct")) {
+            llz_json_read_string(&r, outOverview->currentTrack, sizeof(outOverview->currentTrack));
+        } else if (llz_json_key_is(&key, "ca")) {
+            llz_json_read_string(&r, outOverview->currentArtist, sizeof(outOverview->currentArtist));
+        } else if (llz_json_key_is(&key, "pr")) {
+            outOverview->isPremium = llz_json_read_bool(&r);
+        } else if (llz_json_key_is(&key, "t")) {
+            outOverview->timestamp = llz_json_read_int64(&r);
+        } else {
+            llz_json_skip(&r);
+        }
+    }
+    outOverview->valid = (outOverview->userName[0] != '\0');
 
-            while (outResponse->itemCount < LLZ_SPOTIFY_LIST_MAX) {
-                while (*itemsStart == ' ' || *itemsStart == '\t' || *itemsStart == '\n' || *itemsStart == ',') {
-                    itemsStart++;
-                }
+    return outOverview->valid;
+}
 
-                if (*itemsStart == ']') break;
-                if (*itemsStart != '{') break;
+bool LlzMediaGetLibraryOverview(LlzSpotifyLibraryOverview *outOverview)
+{
+    if (!outOverview) return false;
+    return llz_blob_get_parsed("spotify:library:overview", outOverview, sizeof(*outOverview),
+                               llz_lib_parse_overview);
+}
 
-                int braceCount = 1;
-                const char *itemEnd = itemsStart + 1;
-                while (*itemEnd && braceCount > 0) {
-                    if (*itemEnd == '{') braceCount++;
-                    else if (*itemEnd == '}') braceCount--;
-                    itemEnd++;
-                }
+// Track lists live under one key per type ("recent" unless "liked")
+static const char *llz_lib_tracks_key(const char *type)
+{
+    if (type && strcmp(type, "liked") == 0) {
+        return "spotify:library:liked";
+    }
+    return "spotify:library:recent";
+}
 
-                if (llz_lib_parse_album_item(itemsStart, itemEnd, &outResponse->items[outResponse->itemCount])) {
-                    outResponse->itemCount++;
-                }
+// Get raw JSON for track lists
+bool LlzMediaGetLibraryTracksJson(const char *type, char *outJson, size_t maxLen)
+{
+    return llz_blob_get_json(llz_lib_tracks_key(type), outJson, maxLen, false);
+}
+
+static bool llz_lib_read_track_item(LlzJsonReader *r, void *item)
+{
+    LlzSpotifyTrackItem *track = (LlzSpotifyTrackItem *)item;
+    LlzJsonKey key;
+    if (!llz_json_enter_object(r)) return false;
+
+    while (llz_json_next_member(r, &key)) {
+        if (llz_json_key_is(&key, "i")) {
+            llz_json_read_string(r, track->id, sizeof(track->id));
+        } else if (llz_json_key_is(&key, "n")) {
+            llz_json_read_string(r, track->name, sizeof(track->name));
+        } else if (llz_json_key_is(&key, "a")) {
+            llz_json_read_string(r, track->artist, sizeof(track->artist));
+        } else if (llz_json_key_is(&key, "al")) {
+            llz_json_read_string(r, track->album, sizeof(track->album));
+        } else if (llz_json_key_is(&key, "d")) {
+            track->durationMs = llz_json_read_int64(r);
+        } else if (llz_json_key_is(&key, "u")) {
+            llz_json_read_string(r, track->uri, sizeof(track->uri));
+        } else if (llz_json_key_is(&key, "im")) {
+            llz_json_read_string(r, track->imageUrl, sizeof(track->imageUrl));
+        } else {
+            llz_json_skip(r);
+        }
+    }
+    return track->id[0] != '\0';
+}
 
-                itemsStart = itemEnd;
-            }
+bool llz_lib_parse_track_list(const char *json, size_t len, void *out)
+{
+    LlzSpotifyTrackListResponse *outResponse = (LlzSpotifyTrackListResponse *)out;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    int headerLeft = 6;  // ty, o, l, tt, hm, t
+
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "ty")) {
+            llz_json_read_string(&r, outResponse->type, sizeof(outResponse->type));
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "o")) {
+            outResponse->offset = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "l")) {
+            outResponse->limit = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "tt")) {
+            outResponse->total = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "hm")) {
+            outResponse->hasMore = llz_json_read_bool(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "t")) {
+            outResponse->timestamp = llz_json_read_int64(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "it")) {
+            outResponse->itemCount = llz_lib_read_items(&r, outResponse->items, sizeof(outResponse->items[0]),
+                                                        LLZ_SPOTIFY_LIST_MAX, llz_lib_read_track_item,
+                                                        headerLeft == 0);
+            if (headerLeft == 0) break;
+        } else {
+            llz_json_skip(&r);
         }
     }
 
     outResponse->valid = true;
-    free(json);
     return true;
 }
 
-// Get raw JSON for playlist list
-bool LlzMediaGetLibraryPlaylistsJson(char *outJson, size_t maxLen)
+bool LlzMediaGetLibraryTracks(const char *type, LlzSpotifyTrackListResponse *outResponse)
 {
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET spotify:library:playlists");
-    if (!reply) return false;
+    if (!outResponse) return false;
+    return llz_blob_get_parsed(llz_lib_tracks_key(type), outResponse, sizeof(*outResponse),
+                               llz_lib_parse_track_list);
+}
 
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
+// Get raw JSON for album list
+bool LlzMediaGetLibraryAlbumsJson(char *outJson, size_t maxLen)
+{
+    return llz_blob_get_json("spotify:library:albums", outJson, maxLen, false);
+}
+
+static bool llz_lib_read_album_item(LlzJsonReader *r, void *item)
+{
+    LlzSpotifyAlbumItem *album = (LlzSpotifyAlbumItem *)item;
+    LlzJsonKey key;
+    if (!llz_json_enter_object(r)) return false;
+
+    while (llz_json_next_member(r, &key)) {
+        if (llz_json_key_is(&key, "i")) {
+            llz_json_read_string(r, album->id, sizeof(album->id));
+        } else if (llz_json_key_is(&key, "n")) {
+            llz_json_read_string(r, album->name, sizeof(album->name));
+        } else if (llz_json_key_is(&key, "a")) {
+            llz_json_read_string(r, album->artist, sizeof(album->artist));
+        } else if (llz_json_key_is(&key, "tc")) {
+            album->trackCount = llz_json_read_int(r);
+        } else if (llz_json_key_is(&key, "u")) {
+            llz_json_read_string(r, album->uri, sizeof(album->uri));
+        } else if (llz_json_key_is(&key, "im")) {
+            llz_json_read_string(r, album->imageUrl, sizeof(album->imageUrl));
+        } else if (llz_json_key_is(&key, "y")) {
+            llz_json_read_string(r, album->year, sizeof(album->year));
+        } else {
+            llz_json_skip(r);
         }
     }
-
-    freeReplyObject(reply);
-    return success;
+    return album->id[0] != '\0';
 }
 
-// Parse a playlist item from JSON object
-static bool llz_lib_parse_playlist_item(const char *start, const char *end, LlzSpotifyPlaylistItem *playlist)
-{
-    if (!start || !end || !playlist || end <= start) return false;
-
-    size_t len = end - start;
-    char *itemJson = (char *)malloc(len + 1);
-    if (!itemJson) return false;
-    memcpy(itemJson, start, len);
-    itemJson[len] = '\0';
-
-    memset(playlist, 0, sizeof(*playlist));
-    llz_lib_parse_string(itemJson, "i", playlist->id, sizeof(playlist->id));
-    llz_lib_parse_string(itemJson, "n", playlist->name, sizeof(playlist->name));
-    llz_lib_parse_string(itemJson, "o", playlist->owner, sizeof(playlist->owner));
-    playlist->trackCount = llz_lib_parse_int(itemJson, "tc");
-    llz_lib_parse_string(itemJson, "u", playlist->uri, sizeof(playlist->uri));
-    llz_lib_parse_string(itemJson, "im", playlist->imageUrl, sizeof(playlist->imageUrl));
-    playlist->isPublic = llz_lib_parse_bool(itemJson, "pu");
+bool llz_lib_parse_album_list(const char *json, size_t len, void *out)
+{
+    LlzSpotifyAlbumListResponse *outResponse = (LlzSpotifyAlbumListResponse *)out;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    int headerLeft = 5;  // o, l, tt, hm, t
+
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "o")) {
+            outResponse->offset = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "l")) {
+            outResponse->limit = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "tt")) {
+            outResponse->total = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "hm")) {
+            outResponse->hasMore = llz_json_read_bool(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "t")) {
+            outResponse->timestamp = llz_json_read_int64(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "it")) {
+            outResponse->itemCount = llz_lib_read_items(&r, outResponse->items, sizeof(outResponse->items[0]),
+                                                        LLZ_SPOTIFY_LIST_MAX, llz_lib_read_album_item,
+                                                        headerLeft == 0);
+            if (headerLeft == 0) break;
+        } else {
+            llz_json_skip(&r);
+        }
+    }
 
-    free(itemJson);
-    return playlist->id[0] != '\0';
+    outResponse->valid = true;
+    return true;
 }
 
-bool LlzMediaGetLibraryPlaylists(LlzSpotifyPlaylistListResponse *outResponse)
+bool LlzMediaGetLibraryAlbums(LlzSpotifyAlbumListResponse *outResponse)
 {
     if (!outResponse) return false;
-    memset(outResponse, 0, sizeof(*outResponse));
-
-    char *json = (char *)malloc(65536);
-    if (!json) return false;
+    return llz_blob_get_parsed("spotify:library:albums", outResponse, sizeof(*outResponse),
+                               llz_lib_parse_album_list);
+}
 
-    if (!LlzMediaGetLibraryPlaylistsJson(json, 65536)) {
-        free(json);
-        return false;
+// Get raw JSON for playlist list
+bool LlzMediaGetLibraryPlaylistsJson(char *outJson, size_t maxLen)
+{
+    return llz_blob_get_json("spotify:library:playlists", outJson, maxLen, false);
+}
+
+static bool llz_lib_read_playlist_item(LlzJsonReader *r, void *item)
+{
+    LlzSpotifyPlaylistItem *playlist = (LlzSpotifyPlaylistItem *)item;
+    LlzJsonKey key;
+    if (!llz_json_enter_object(r)) return false;
+
+    while (llz_json_next_member(r, &key)) {
+        if (llz_json_key_is(&key, "i")) {
+            llz_json_read_string(r, playlist->id, sizeof(playlist->id));
+        } else if (llz_json_key_is(&key, "n")) {
+            llz_json_read_string(r, playlist->name, sizeof(playlist->name));
+        } else if (llz_json_key_is(&key, "o")) {
+            llz_json_read_string(r, playlist->owner, sizeof(playlist->owner));
+        } else if (llz_json_key_is(&key, "tc")) {
+            playlist->trackCount = llz_json_read_int(r);
+        } else if (llz_json_key_is(&key, "u")) {
+            llz_json_read_string(r, playlist->uri, sizeof(playlist->uri));
+        } else if (llz_json_key_is(&key, "im")) {
+            llz_json_read_string(r, playlist->imageUrl, sizeof(playlist->imageUrl));
+        } else if (llz_json_key_is(&key, "pu")) {
+            playlist->isPublic = llz_json_read_bool(r);
+        } else {
+            llz_json_skip(r);
+        }
     }
+    return playlist->id[0] != '\0';
+}
 
-    // Parse response fields
-    outResponse->offset = llz_lib_parse_int(json, "o");
-    outResponse->limit = llz_lib_parse_int(json, "l");
-    outResponse->total = llz_lib_parse_int(json, "tt");
-    outResponse->hasMore = llz_lib_parse_bool(json, "hm");
-    outResponse->timestamp = llz_lib_parse_int64(json, "t");
-
-    // Parse items array
-    const char *itemsStart = strstr(json, "\"it\":[");
-    if (itemsStart) {
-        itemsStart = strchr(itemsStart, '[');
-        if (itemsStart) {
-            itemsStart++;
-
-            while (outResponse->itemCount < LLZ_SPOTIFY_LIST_MAX) {
-                while (*itemsStart == ' ' || *itemsStart == '\t' || *itemsStart == '\n' || *itemsStart == ',') {
-                    itemsStart++;
-                }
-
-                if (*itemsStart == ']') break;
-                if (*itemsStart != '{') break;
-
-                int braceCount = 1;
-                const char *itemEnd = itemsStart + 1;
-                while (*itemEnd && braceCount > 0) {
-                    if (*itemEnd == '{') braceCount++;
-                    else if (*itemEnd == '}') braceCount--;
-                    itemEnd++;
-                }
-
-                if (llz_lib_parse_playlist_item(itemsStart, itemEnd, &outResponse->items[outResponse->itemCount])) {
-                    outResponse->itemCount++;
-                }
-
-                itemsStart = itemEnd;
-            }
+bool llz_lib_parse_playlist_list(const char *json, size_t len, void *out)
+{
+    LlzSpotifyPlaylistListResponse *outResponse = (LlzSpotifyPlaylistListResponse *)out;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    int headerLeft = 5;  // o, l, tt, hm, t
+
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "o")) {
+            outResponse->offset = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "l")) {
+            outResponse->limit = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "tt")) {
+            outResponse->total = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "hm")) {
+            outResponse->hasMore = llz_json_read_bool(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "t")) {
+            outResponse->timestamp = llz_json_read_int64(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "it")) {
+            outResponse->itemCount = llz_lib_read_items(&r, outResponse->items, sizeof(outResponse->items[0]),
+                                                        LLZ_SPOTIFY_LIST_MAX, llz_lib_read_playlist_item,
+                                                        headerLeft == 0);
+            if (headerLeft == 0) break;
+        } else {
+            llz_json_skip(&r);
         }
     }
 
     outResponse->valid = true;
-    free(json);
     return true;
 }
 
+bool LlzMediaGetLibraryPlaylists(LlzSpotifyPlaylistListResponse *outResponse)
+{
+    if (!outResponse) return false;
+    return llz_blob_get_parsed("spotify:library:playlists", outResponse, sizeof(*outResponse),
+                               llz_lib_parse_playlist_list);
+}
+
 // ============================================================================
 // Timezone API Implementation
 // ============================================================================
@@ -2565,47 +3410,18 @@ bool LlzMediaGetTimezone(LlzTimezone *outTimezone)
 {
     if (!outTimezone) return false;
 
-    // Check if we should use cached value
-    time_t now = time(NULL);
-    if (g_cachedTimezone.valid && (now - g_lastTimezoneCheck) < TIMEZONE_CACHE_SECONDS) {
-        *outTimezone = g_cachedTimezone;
-        return true;
-    }
-
-    // Default values
-    outTimezone->offsetMinutes = 0;
-    outTimezone->timezoneId[0] = '\0';
-    outTimezone->valid = false;
-
-    // Get timezone offset from Redis
-    redisReply *offsetReply = llz_media_command("GET system:timezone_offset");
-    if (offsetReply) {
-        if (offsetReply->type == REDIS_REPLY_STRING && offsetReply->str) {
-            outTimezone->offsetMinutes = atoi(offsetReply->str);
-            outTimezone->valid = true;
-        }
-        freeReplyObject(offsetReply);
-    }
-
-    // Get timezone ID from Redis
-    redisReply *idReply = llz_media_command("GET system:timezone_id");
-    if (idReply) {
-        if (idReply->type == REDIS_REPLY_STRING && idReply->str) {
-            size_t len = strlen(idReply->str);
-            if (len < LLZ_TIMEZONE_ID_MAX) {
-                strcpy(outTimezone->timezoneId, idReply->str);
-            }
-        }
-        freeReplyObject(idReply);
-    }
-
-    // Update cache
-    if (outTimezone->valid) {
-        g_cachedTimezone = *outTimezone;
-        g_lastTimezoneCheck = now;
+    // Served from the 60 s cache when fresh, otherwise one MGET
+    LlzMediaBatch batch;
+    LlzMediaBatchBegin(&batch);
+    LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_TIMEZONE, outTimezone, sizeof(*outTimezone));
+    LlzMediaBatchFlush(&batch);
+    if (!LlzMediaBatchItemOk(&batch, 0)) {
+        outTimezone->offsetMinutes = 0;
+        outTimezone->timezoneId[0] = '\0';
+        outTimezone->valid = false;
+        return false;
     }
-
-    return outTimezone->valid;
+    return true;
 }
 
 bool LlzMediaGetPhoneTime(int *hours, int *minutes, int *seconds)
@@ -2674,6 +3490,18 @@ bool LlzMediaGetPhoneTimePrecise(int *hours, int *minutes, int *seconds, double
 // Spotify Playback State API
 // ============================================================================
 
+static LlzSpotifyRepeatMode llz_spotify_parse_repeat(const redisReply *reply)
+{
+    if (!reply || reply->type != REDIS_REPLY_STRING || !reply->str) return LLZ_SPOTIFY_REPEAT_OFF;
+    if (strcmp(reply->str, "all") == 0 || strcmp(reply->str, "context") == 0) {
+        return LLZ_SPOTIFY_REPEAT_ALL;
+    }
+    if (strcmp(reply->str, "one") == 0 || strcmp(reply->str, "track") == 0) {
+        return LLZ_SPOTIFY_REPEAT_ONE;
+    }
+    return LLZ_SPOTIFY_REPEAT_OFF;
+}
+
 bool LlzSpotifyGetShuffle(void)
 {
     redisReply *reply = llz_media_command("GET spotify:shuffle");
@@ -2693,15 +3521,7 @@ LlzSpotifyRepeatMode LlzSpotifyGetRepeat(void)
     redisReply *reply = llz_media_command("GET spotify:repeat");
     if (!reply) return LLZ_SPOTIFY_REPEAT_OFF;
 
-    LlzSpotifyRepeatMode mode = LLZ_SPOTIFY_REPEAT_OFF;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        if (strcmp(reply->str, "all") == 0 || strcmp(reply->str, "context") == 0) {
-            mode = LLZ_SPOTIFY_REPEAT_ALL;
-        } else if (strcmp(reply->str, "one") == 0 || strcmp(reply->str, "track") == 0) {
-            mode = LLZ_SPOTIFY_REPEAT_ONE;
-        }
-        // "off" or anything else stays as LLZ_SPOTIFY_REPEAT_OFF
-    }
+    LlzSpotifyRepeatMode mode = llz_spotify_parse_repeat(reply);
 
     freeReplyObject(reply);
     return mode;
@@ -2741,23 +3561,321 @@ bool LlzSpotifyGetPlaybackState(LlzSpotifyPlaybackState *outState)
 {
     if (!outState) return false;
 
-    // Initialize to defaults
-    outState->shuffle = false;
-    outState->repeat = LLZ_SPOTIFY_REPEAT_OFF;
-    outState->liked = false;
-    outState->connected = false;
-    outState->isCurrentChannel = false;
+    // shuffle/repeat/liked/channel in one round trip instead of four
+    LlzMediaBatch batch;
+    LlzMediaBatchBegin(&batch);
+    LlzMediaBatchAdd(&batch, LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK, outState, sizeof(*outState));
+    if (LlzMediaBatchFlush(&batch) == 0) {
+        memset(outState, 0, sizeof(*outState));
+        outState->connected = LlzSpotifyIsConnected();
+    }
+    return true;
+}
 
-    // Get individual states
-    outState->shuffle = LlzSpotifyGetShuffle();
-    outState->repeat = LlzSpotifyGetRepeat();
-    outState->liked = LlzSpotifyGetLiked();
-    outState->connected = LlzSpotifyIsConnected();
-    outState->isCurrentChannel = LlzSpotifyIsCurrentChannel();
+// ============================================================================
+// Batch Query API
+// ============================================================================
+//
+// Each queued query appends at most one command to the media connection;
+// all replies are read back after a single flush, so a batch costs one
+// round trip no matter how many items it holds. State and connection are
+// served from the poller snapshot and a fresh timezone from its cache, so
+// those never touch the socket.
 
+static bool llz_batch_copy_string(const redisReply *reply, char *out, size_t outSize)
+{
+    if (!out || outSize == 0) return false;
+    out[0] = '\0';
+    if (!reply || reply->type != REDIS_REPLY_STRING || !reply->str) return false;
+    if (strlen(reply->str) >= outSize) return false;
+    strcpy(out, reply->str);
     return true;
 }
 
+// Resolve items that need no Redis command. Returns true if handled.
+static bool llz_batch_resolve_local(LlzMediaBatchItem *item)
+{
+    switch (item->query) {
+        case LLZ_MEDIA_BATCH_STATE:
+            item->ok = LlzMediaGetState((LlzMediaState *)item->out);
+            return true;
+        case LLZ_MEDIA_BATCH_CONNECTION:
+            item->ok = LlzMediaGetConnection((LlzConnectionStatus *)item->out);
+            return true;
+        case LLZ_MEDIA_BATCH_TIMEZONE:
+            if (g_cachedTimezone.valid && (time(NULL) - g_lastTimezoneCheck) < TIMEZONE_CACHE_SECONDS) {
+                *(LlzTimezone *)item->out = g_cachedTimezone;
+                item->ok = true;
+                return true;
+            }
+            return false;
+        case LLZ_MEDIA_BATCH_QUEUE: {
+            // A queue checked this frame is served from the blob cache
+            LlzBlobEntry *entry = llz_blob_lookup("queue:data");
+            g_blobStats.lookups++;
+            if (!llz_blob_is_fresh(entry, llz_redis_now_ms())) return false;
+            item->ok = llz_blob_copy_parsed(entry, item->out, sizeof(LlzQueueData), llz_queue_parse);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+static int llz_batch_append(redisContext *ctx, const LlzMediaBatchItem *item)
+{
+    switch (item->query) {
+        case LLZ_MEDIA_BATCH_TIMEZONE:
+            return redisAppendCommand(ctx, "MGET system:timezone_offset system:timezone_id");
+        case LLZ_MEDIA_BATCH_PODCAST_STATE:
+            return redisAppendCommand(ctx, "MGET %s %s %s %s %s %s %s %s %s",
+                g_activeKeys.podcastShowName,
+                g_activeKeys.podcastEpisodeTitle,
+                g_activeKeys.podcastEpisodeDescription,
+                g_activeKeys.podcastAuthor,
+                g_activeKeys.podcastArtPath,
+                g_activeKeys.podcastEpisodeCount,
+                g_activeKeys.isPlaying,
+                g_activeKeys.durationSeconds,
+                g_activeKeys.progressSeconds);
+        case LLZ_MEDIA_BATCH_PODCAST_COUNT:
+            return redisAppendCommand(ctx, "GET podcast:count");
+        case LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL:
+            return redisAppendCommand(ctx, "GET media:controlled_channel");
+        case LLZ_MEDIA_BATCH_LYRICS_HASH:
+            return redisAppendCommand(ctx, "GET %s", g_activeKeys.lyricsHash);
+        case LLZ_MEDIA_BATCH_LYRICS_ENABLED:
+            return redisAppendCommand(ctx, "GET %s", g_activeKeys.lyricsEnabled);
+        case LLZ_MEDIA_BATCH_LYRICS_SYNCED:
+            return redisAppendCommand(ctx, "GET %s", g_activeKeys.lyricsSynced);
+        case LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK:
+            return redisAppendCommand(ctx, "MGET spotify:shuffle spotify:repeat spotify:liked media:controlled_channel");
+        case LLZ_MEDIA_BATCH_STRING_KEY:
+            return redisAppendCommand(ctx, "GET %s", item->key);
+        case LLZ_MEDIA_BATCH_QUEUE: {
+            // The digest script is only loaded by the sync getters; until
+            // then the queue comes over a plain GET
+            if (g_blobScriptUnsupported || g_blobScriptSha[0] == '\0') {
+                return redisAppendCommand(ctx, "GET queue:data");
+            }
+            LlzBlobEntry *entry = llz_blob_lookup("queue:data");
+            return redisAppendCommand(ctx, "EVALSHA %s 1 queue:data %s", g_blobScriptSha,
+                                      entry->json ? entry->digest : "");
+        }
+        default:
+            return REDIS_ERR;
+    }
+}
+
+static void llz_batch_decode(LlzMediaBatchItem *item, const redisReply *reply)
+{
+    switch (item->query) {
+        case LLZ_MEDIA_BATCH_TIMEZONE: {
+            LlzTimezone *tz = (LlzTimezone *)item->out;
+            tz->offsetMinutes = 0;
+            tz->timezoneId[0] = '\0';
+            tz->valid = false;
+            if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 2) {
+                const redisReply *offset = reply->element[0];
+                if (offset->type == REDIS_REPLY_STRING && offset->str) {
+                    tz->offsetMinutes = atoi(offset->str);
+                    tz->valid = true;
+                }
+                llz_batch_copy_string(reply->element[1], tz->timezoneId, sizeof(tz->timezoneId));
+            }
+            if (tz->valid) {
+                g_cachedTimezone = *tz;
+                g_lastTimezoneCheck = time(NULL);
+            }
+            item->ok = tz->valid;
+            break;
+        }
+        case LLZ_MEDIA_BATCH_PODCAST_STATE: {
+            LlzPodcastState *ps = (LlzPodcastState *)item->out;
+            memset(ps, 0, sizeof(*ps));
+            if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 9) {
+                llz_media_copy_reply(ps->showName, sizeof(ps->showName), reply->element[0]);
+                llz_media_copy_reply(ps->episodeTitle, sizeof(ps->episodeTitle), reply->element[1]);
+                llz_media_copy_reply(ps->episodeDescription, sizeof(ps->episodeDescription), reply->element[2]);
+                llz_media_copy_reply(ps->author, sizeof(ps->author), reply->element[3]);
+                llz_media_copy_reply(ps->artPath, sizeof(ps->artPath), reply->element[4]);
+                ps->episodeCount = llz_media_reply_int(reply->element[5]);
+                ps->isPlaying = llz_media_reply_bool(reply->element[6]);
+                ps->durationSeconds = llz_media_reply_int(reply->element[7]);
+                ps->positionSeconds = llz_media_reply_int(reply->element[8]);
+                item->ok = true;
+            }
+            break;
+        }
+        case LLZ_MEDIA_BATCH_PODCAST_COUNT:
+            *(int *)item->out = 0;
+            if (reply->type == REDIS_REPLY_STRING && reply->str) {
+                *(int *)item->out = atoi(reply->str);
+                item->ok = true;
+            }
+            break;
+        case LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL:
+        case LLZ_MEDIA_BATCH_LYRICS_HASH:
+        case LLZ_MEDIA_BATCH_STRING_KEY:
+            item->ok = llz_batch_copy_string(reply, (char *)item->out, item->outSize);
+            break;
+        case LLZ_MEDIA_BATCH_LYRICS_ENABLED:
+        case LLZ_MEDIA_BATCH_LYRICS_SYNCED:
+            *(bool *)item->out = llz_media_reply_bool(reply);
+            item->ok = true;
+            break;
+        case LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK: {
+            LlzSpotifyPlaybackState *sp = (LlzSpotifyPlaybackState *)item->out;
+            memset(sp, 0, sizeof(*sp));
+            if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 4) {
+                const redisReply *shuffle = reply->element[0];
+                const redisReply *liked = reply->element[2];
+                const redisReply *channel = reply->element[3];
+                sp->shuffle = shuffle->type == REDIS_REPLY_STRING && shuffle->str && strcmp(shuffle->str, "true") == 0;
+                sp->repeat = llz_spotify_parse_repeat(reply->element[1]);
+                sp->liked = liked->type == REDIS_REPLY_STRING && liked->str && strcmp(liked->str, "true") == 0;
+                sp->isCurrentChannel = channel->type == REDIS_REPLY_STRING && channel->str &&
+                                       strcasecmp(channel->str, "Spotify") == 0;
+                item->ok = true;
+            }
+            // connected is filled in by LlzMediaBatchFlush once every
+            // pipelined reply is read (it issues its own commands)
+            break;
+        }
+        case LLZ_MEDIA_BATCH_QUEUE: {
+            // GET answers with a string or nil, the digest script never does
+            LlzBlobEntry *entry = llz_blob_lookup("queue:data");
+            bool plain = reply->type == REDIS_REPLY_STRING || reply->type == REDIS_REPLY_NIL;
+            bool fetched = plain ? llz_blob_apply_plain(entry, reply) : llz_blob_apply_digest(entry, reply);
+            if (!fetched && reply->type == REDIS_REPLY_ERROR && reply->str &&
+                strncmp(reply->str, "NOSCRIPT", 8) == 0) {
+                g_blobScriptSha[0] = '\0';  // Reloaded by the next sync getter
+            }
+            if (fetched) entry->checkedAtMs = llz_redis_now_ms();
+            item->ok = llz_blob_copy_parsed(fetched && entry->json ? entry : NULL, item->out,
+                                            sizeof(LlzQueueData), llz_queue_parse);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// Smallest out buffer a query can decode into; 0 for unknown queries
+static size_t llz_batch_out_size(LlzMediaBatchQuery query)
+{
+    switch (query) {
+        case LLZ_MEDIA_BATCH_STATE:              return sizeof(LlzMediaState);
+        case LLZ_MEDIA_BATCH_CONNECTION:         return sizeof(LlzConnectionStatus);
+        case LLZ_MEDIA_BATCH_TIMEZONE:           return sizeof(LlzTimezone);
+        case LLZ_MEDIA_BATCH_PODCAST_STATE:      return sizeof(LlzPodcastState);
+        case LLZ_MEDIA_BATCH_PODCAST_COUNT:      return sizeof(int);
+        case LLZ_MEDIA_BATCH_CONTROLLED_CHANNEL: return 1;
+        case LLZ_MEDIA_BATCH_LYRICS_HASH:        return 1;
+        case LLZ_MEDIA_BATCH_LYRICS_ENABLED:     return sizeof(bool);
+        case LLZ_MEDIA_BATCH_LYRICS_SYNCED:      return sizeof(bool);
+        case LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK:   return sizeof(LlzSpotifyPlaybackState);
+        case LLZ_MEDIA_BATCH_QUEUE:              return sizeof(LlzQueueData);
+        default:                                 return 0;
+    }
+}
+
+void LlzMediaBatchBegin(LlzMediaBatch *batch)
+{
+    if (!batch) return;
+    batch->count = 0;
+}
+
+int LlzMediaBatchAdd(LlzMediaBatch *batch, LlzMediaBatchQuery query, void *out, size_t outSize)
+{
+    if (!batch || !out || batch->count >= LLZ_MEDIA_BATCH_MAX) return -1;
+    if (query == LLZ_MEDIA_BATCH_STRING_KEY) return -1;  // Use LlzMediaBatchAddKey
+
+    // out must hold the type the query decodes into
+    size_t needed = llz_batch_out_size(query);
+    if (needed == 0 || outSize < needed) return -1;
+
+    LlzMediaBatchItem *item = &batch->items[batch->count];
+    memset(item, 0, sizeof(*item));
+    item->query = query;
+    item->out = out;
+    item->outSize = outSize;
+    return batch->count++;
+}
+
+int LlzMediaBatchAddKey(LlzMediaBatch *batch, const char *key, char *out, size_t outSize)
+{
+    if (!batch || !key || !key[0] || !out || outSize == 0) return -1;
+    if (batch->count >= LLZ_MEDIA_BATCH_MAX || strlen(key) >= LLZ_MEDIA_BATCH_KEY_MAX) return -1;
+
+    LlzMediaBatchItem *item = &batch->items[batch->count];
+    memset(item, 0, sizeof(*item));
+    item->query = LLZ_MEDIA_BATCH_STRING_KEY;
+    item->out = out;
+    item->outSize = outSize;
+    strcpy(item->key, key);
+    return batch->count++;
+}
+
+int LlzMediaBatchFlush(LlzMediaBatch *batch)
+{
+    if (!batch) return 0;
+
+    int pending[LLZ_MEDIA_BATCH_MAX];
+    int pendingCount = 0;
+    redisContext *ctx = NULL;
+
+    for (int i = 0; i < batch->count; i++) {
+        LlzMediaBatchItem *item = &batch->items[i];
+        item->ok = false;
+        if (llz_batch_resolve_local(item)) continue;
+        if (!ctx && !(ctx = llz_redis_acquire())) continue;
+        if (llz_batch_append(ctx, item) == REDIS_OK) {
+            pending[pendingCount++] = i;
+        }
+    }
+
+    // The first redisGetReply flushes the whole pipeline
+    uint64_t span = LlzProfilerSpanBegin();
+    double start = llz_redis_now_ms();
+    for (int p = 0; p < pendingCount; p++) {
+        void *r = NULL;
+        if (redisGetReply(ctx, &r) != REDIS_OK || !r) {
+            printf("[MEDIA] Batch flush failed after %d/%d replies\n", p, pendingCount);
+            llz_redis_record_rtt(0.0, false);
+            llz_redis_fail();
+            pendingCount = 0;
+            break;
+        }
+        llz_batch_decode(&batch->items[pending[p]], (const redisReply *)r);
+        llz_redis_record_reply((const redisReply *)r);
+        freeReplyObject(r);
+    }
+    if (pendingCount > 0) llz_redis_record_rtt(llz_redis_now_ms() - start, true);
+    LlzProfilerSpanEnd("redis batch", span);
+
+    // Sync commands share the media connection, so they wait until the
+    // pipeline is drained or they would read the batch's replies
+    for (int p = 0; p < pendingCount; p++) {
+        LlzMediaBatchItem *item = &batch->items[pending[p]];
+        if (item->query == LLZ_MEDIA_BATCH_SPOTIFY_PLAYBACK) {
+            ((LlzSpotifyPlaybackState *)item->out)->connected = LlzSpotifyIsConnected();
+        }
+    }
+
+    int okCount = 0;
+    for (int i = 0; i < batch->count; i++) {
+        if (batch->items[i].ok) okCount++;
+    }
+    return okCount;
+}
+
+bool LlzMediaBatchItemOk(const LlzMediaBatch *batch, int index)
+{
+    if (!batch || index < 0 || index >= batch->count) return false;
+    return batch->items[index].ok;
+}
+
 // ============================================================================
 // Spotify Library Artists API
 // ============================================================================
@@ -2768,164 +3886,113 @@ bool LlzMediaRequestLibraryArtists(int limit, const char *afterCursor)
     if (limit <= 0) limit = 20;
 
     long long ts = (long long)time(NULL);
-    redisReply *reply;
+    bool success;
 
     if (afterCursor && afterCursor[0] != '\0') {
-        reply = llz_media_command(
-            "LPUSH %s {\"action\":\"library_artists\",\"limit\":%d,\"after\":\"%s\",\"timestamp\":%lld}",
-            g_activeKeys.playbackCommandQueue,
+        success = llz_media_queue_request(
+            "library_artists",
+            "{\"action\":\"library_artists\",\"limit\":%d,\"after\":\"%s\",\"timestamp\":%lld}",
             limit,
             afterCursor,
             ts
         );
     } else {
-        reply = llz_media_command(
-            "LPUSH %s {\"action\":\"library_artists\",\"limit\":%d,\"timestamp\":%lld}",
-            g_activeKeys.playbackCommandQueue,
+        success = llz_media_queue_request(
+            "library_artists",
+            "{\"action\":\"library_artists\",\"limit\":%d,\"timestamp\":%lld}",
             limit,
             ts
         );
     }
 
-    if (!reply) return false;
-    bool success = reply->type == REDIS_REPLY_INTEGER;
-    freeReplyObject(reply);
-
     if (success) {
+        LlzMediaInvalidateBlob("spotify:library:artists");
         printf("[SPOTIFY_LIB] Requested artists (limit=%d, cursor=%s)\n", limit, afterCursor ? afterCursor : "(none)");
     }
     return success;
 }
 
-// Get raw JSON for artist list
-static bool LlzMediaGetLibraryArtistsJson(char *outJson, size_t maxLen)
-{
-    if (!outJson || maxLen == 0) return false;
-    outJson[0] = '\0';
-
-    redisReply *reply = llz_media_command("GET spotify:library:artists");
-    if (!reply) return false;
-
-    bool success = false;
-    if (reply->type == REDIS_REPLY_STRING && reply->str) {
-        size_t len = strlen(reply->str);
-        if (len < maxLen) {
-            strcpy(outJson, reply->str);
-            success = true;
-        }
-    }
-
-    freeReplyObject(reply);
-    return success;
-}
-
-// Parse an artist item from JSON object
-static bool llz_lib_parse_artist_item(const char *start, const char *end, LlzSpotifyArtistItem *artist)
-{
-    if (!start || !end || !artist || end <= start) return false;
-
-    size_t len = end - start;
-    char *itemJson = (char *)malloc(len + 1);
-    if (!itemJson) return false;
-    memcpy(itemJson, start, len);
-    itemJson[len] = '\0';
-
-    memset(artist, 0, sizeof(*artist));
-    llz_lib_parse_string(itemJson, "i", artist->id, sizeof(artist->id));
-    llz_lib_parse_string(itemJson, "n", artist->name, sizeof(artist->name));
-    artist->followers = llz_lib_parse_int(itemJson, "f");
-    llz_lib_parse_string(itemJson, "u", artist->uri, sizeof(artist->uri));
-    llz_lib_parse_string(itemJson, "im", artist->imageUrl, sizeof(artist->imageUrl));
-    llz_lib_parse_string(itemJson, "ah", artist->artHash, sizeof(artist->artHash));
-
-    // Parse genres array (up to 3)
-    const char *genresStart = strstr(itemJson, "\"g\":[");
-    if (genresStart) {
-        genresStart = strchr(genresStart, '[');
-        if (genresStart) {
-            genresStart++;
-            int genreIdx = 0;
-            while (genreIdx < 3) {
-                const char *strStart = strchr(genresStart, '"');
-                if (!strStart) break;
-                strStart++;
-
-                const char *strEnd = strchr(strStart, '"');
-                if (!strEnd) break;
-
-                size_t gLen = strEnd - strStart;
-                if (gLen >= 32) gLen = 31;
-                strncpy(artist->genres[genreIdx], strStart, gLen);
-                artist->genres[genreIdx][gLen] = '\0';
-
-                genreIdx++;
-                artist->genreCount = genreIdx;
-
-                genresStart = strEnd + 1;
-                while (*genresStart && *genresStart != '"' && *genresStart != ']') {
-                    genresStart++;
+static bool llz_lib_read_artist_item(LlzJsonReader *r, void *item)
+{
+    LlzSpotifyArtistItem *artist = (LlzSpotifyArtistItem *)item;
+    LlzJsonKey key;
+    if (!llz_json_enter_object(r)) return false;
+
+    while (llz_json_next_member(r, &key)) {
+        if (llz_json_key_is(&key, "i")) {
+            llz_json_read_string(r, artist->id, sizeof(artist->id));
+        } else if (llz_json_key_is(&key, "n")) {
+            llz_json_read_string(r, artist->name, sizeof(artist->name));
+        } else if (llz_json_key_is(&key, "f")) {
+            artist->followers = llz_json_read_int(r);
+        } else if (llz_json_key_is(&key, "u")) {
+            llz_json_read_string(r, artist->uri, sizeof(artist->uri));
+        } else if (llz_json_key_is(&key, "im")) {
+            llz_json_read_string(r, artist->imageUrl, sizeof(artist->imageUrl));
+        } else if (llz_json_key_is(&key, "ah")) {
+            llz_json_read_string(r, artist->artHash, sizeof(artist->artHash));
+        } else if (llz_json_key_is(&key, "g")) {
+            // Genres array (up to 3)
+            if (!llz_json_enter_array(r)) continue;
+            int maxGenres = (int)(sizeof(artist->genres) / sizeof(artist->genres[0]));
+            while (llz_json_next_element(r)) {
+                if (artist->genreCount >= maxGenres) {
+                    llz_json_skip(r);
+                    continue;
+                }
+                if (llz_json_read_string(r, artist->genres[artist->genreCount],
+                                         sizeof(artist->genres[0]))) {
+                    artist->genreCount++;
                 }
-                if (*genresStart == ']') break;
             }
+        } else {
+            llz_json_skip(r);
         }
     }
-
-    free(itemJson);
     return artist->id[0] != '\0';
 }
 
-bool LlzMediaGetLibraryArtists(LlzSpotifyArtistListResponse *outResponse)
-{
-    if (!outResponse) return false;
-    memset(outResponse, 0, sizeof(*outResponse));
-
-    char *json = (char *)malloc(65536);
-    if (!json) return false;
-
-    if (!LlzMediaGetLibraryArtistsJson(json, 65536)) {
-        free(json);
-        return false;
-    }
-
-    // Parse response fields
-    outResponse->total = llz_lib_parse_int(json, "tt");
-    outResponse->hasMore = llz_lib_parse_bool(json, "hm");
-    llz_lib_parse_string(json, "nc", outResponse->nextCursor, sizeof(outResponse->nextCursor));
-    outResponse->timestamp = llz_lib_parse_int64(json, "t");
-
-    // Parse items array
-    const char *itemsStart = strstr(json, "\"it\":[");
-    if (itemsStart) {
-        itemsStart = strchr(itemsStart, '[');
-        if (itemsStart) {
-            itemsStart++;
-
-            while (outResponse->itemCount < LLZ_SPOTIFY_LIST_MAX) {
-                while (*itemsStart == ' ' || *itemsStart == '\t' || *itemsStart == '\n' || *itemsStart == ',') {
-                    itemsStart++;
-                }
-
-                if (*itemsStart == ']') break;
-                if (*itemsStart != '{') break;
-
-                int braceCount = 1;
-                const char *itemEnd = itemsStart + 1;
-                while (*itemEnd && braceCount > 0) {
-                    if (*itemEnd == '{') braceCount++;
-                    else if (*itemEnd == '}') braceCount--;
-                    itemEnd++;
-                }
-
-                if (llz_lib_parse_artist_item(itemsStart, itemEnd, &outResponse->items[outResponse->itemCount])) {
-                    outResponse->itemCount++;
-                }
-
-                itemsStart = itemEnd;
-            }
+bool llz_lib_parse_artist_list(const char *json, size_t len, void *out)
+{
+    LlzSpotifyArtistListResponse *outResponse = (LlzSpotifyArtistListResponse *)out;
+
+    LlzJsonReader r;
+    LlzJsonKey key;
+    llz_json_init(&r, json, len);
+    if (!llz_json_enter_object(&r)) return false;
+
+    int headerLeft = 4;  // tt, hm, nc, t
+
+    while (llz_json_next_member(&r, &key)) {
+        if (llz_json_key_is(&key, "tt")) {
+            outResponse->total = llz_json_read_int(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "hm")) {
+            outResponse->hasMore = llz_json_read_bool(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "nc")) {
+            llz_json_read_string(&r, outResponse->nextCursor, sizeof(outResponse->nextCursor));
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "t")) {
+            outResponse->timestamp = llz_json_read_int64(&r);
+            headerLeft--;
+        } else if (llz_json_key_is(&key, "it")) {
+            outResponse->itemCount = llz_lib_read_items(&r, outResponse->items, sizeof(outResponse->items[0]),
+                                                        LLZ_SPOTIFY_LIST_MAX, llz_lib_read_artist_item,
+                                                        headerLeft == 0);
+            if (headerLeft == 0) break;
+        } else {
+            llz_json_skip(&r);
         }
     }
 
     outResponse->valid = true;
-    free(json);
     return true;
 }
+
+bool LlzMediaGetLibraryArtists(LlzSpotifyArtistListResponse *outResponse)
+{
+    if (!outResponse) return false;
+    return llz_blob_get_parsed("spotify:library:artists", outResponse, sizeof(*outResponse),
+                               llz_lib_parse_artist_list);
+}
@@ -0,0 +1,28 @@
+#ifndef LLZ_MEDIA_INTERNAL_H
+#define LLZ_MEDIA_INTERNAL_H
+
+// SDK-internal media helpers (not installed for plugins)
+//
+// llz_media_queue_request formats a JSON command (printf-style) and hands it
+// to the background command outbox, behind anything already queued there, so
+// other SDK modules never push to the playback command queue directly.
+// Returns false if the payload does not fit or the outbox is full.
+//
+// The library page parsers behind LlzMediaGetLibrary*(), exposed so the
+// benchmarks in sdk/bench can time them on generated payloads without a Redis
+// connection. Each fills the response struct passed as out (zeroed by the
+// caller) and returns false if the document is not an object.
+
+#include "llz_sdk_media.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+bool llz_media_queue_request(const char *action, const char *format, ...);
+
+bool llz_lib_parse_track_list(const char *json, size_t len, void *out);
+bool llz_lib_parse_album_list(const char *json, size_t len, void *out);
+bool llz_lib_parse_playlist_list(const char *json, size_t len, void *out);
+bool llz_lib_parse_artist_list(const char *json, size_t len, void *out);
+
+#endif // LLZ_MEDIA_INTERNAL_H
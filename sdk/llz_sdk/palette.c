@@ -0,0 +1,292 @@
+#include "llz_sdk_palette.h"
+#include "pixel_internal.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint16_t index;                   // r << 10 | g << 5 | b, 5 bits each
+    uint32_t count;
+} LlzPaletteBin;
+
+typedef struct {
+    int lo, hi;                       // Bins [lo, hi) of the sorted bin array
+    uint32_t population;
+    int minC[3], maxC[3];             // Channel ranges of the bins inside
+} LlzPaletteBox;
+
+// Selection window for a named colour, in HSL
+typedef struct {
+    float minS, targetS, maxS;
+    float minL, targetL, maxL;
+} LlzPaletteTarget;
+
+static const LlzPaletteTarget g_paletteVibrant = { 0.35f, 1.0f, 1.0f, 0.3f, 0.5f, 0.7f };
+static const LlzPaletteTarget g_paletteMuted = { 0.0f, 0.3f, 0.4f, 0.3f, 0.5f, 0.7f };
+static const LlzPaletteTarget g_paletteDarkMuted = { 0.0f, 0.3f, 0.4f, 0.0f, 0.26f, 0.45f };
+
+static inline int llz_palette_channel(uint16_t index, int channel)
+{
+    return (index >> (10 - channel * 5)) & 31;
+}
+
+// 5-bit channel to 8 bits, centred so 0 and 31 map to 0 and 255
+static inline unsigned char llz_palette_expand(int value)
+{
+    return (unsigned char)((value << 3) | (value >> 2));
+}
+
+static int llz_palette_cmp_r(const void *a, const void *b)
+{
+    return llz_palette_channel(((const LlzPaletteBin *)a)->index, 0) -
+           llz_palette_channel(((const LlzPaletteBin *)b)->index, 0);
+}
+
+static int llz_palette_cmp_g(const void *a, const void *b)
+{
+    return llz_palette_channel(((const LlzPaletteBin *)a)->index, 1) -
+           llz_palette_channel(((const LlzPaletteBin *)b)->index, 1);
+}
+
+static int llz_palette_cmp_b(const void *a, const void *b)
+{
+    return llz_palette_channel(((const LlzPaletteBin *)a)->index, 2) -
+           llz_palette_channel(((const LlzPaletteBin *)b)->index, 2);
+}
+
+static void llz_palette_fit(const LlzPaletteBin *bins, LlzPaletteBox *box)
+{
+    for (int c = 0; c < 3; c++) {
+        box->minC[c] = 31;
+        box->maxC[c] = 0;
+    }
+    for (int i = box->lo; i < box->hi; i++) {
+        for (int c = 0; c < 3; c++) {
+            int v = llz_palette_channel(bins[i].index, c);
+            if (v < box->minC[c]) box->minC[c] = v;
+            if (v > box->maxC[c]) box->maxC[c] = v;
+        }
+    }
+}
+
+// Population times colour volume: big spreads of colour split first, while a
+// large but uniform area (noise around one colour) stays one swatch
+static uint64_t llz_palette_priority(const LlzPaletteBox *box)
+{
+    uint64_t volume = 1;
+    for (int c = 0; c < 3; c++) volume *= (uint64_t)(box->maxC[c] - box->minC[c] + 1);
+    return volume * box->population;
+}
+
+// Split a box at the population median of its widest channel. Returns false
+// when the box holds a single colour.
+static bool llz_palette_split(LlzPaletteBin *bins, LlzPaletteBox *box, LlzPaletteBox *out)
+{
+    if (box->hi - box->lo < 2) return false;
+
+    int widest = 0;
+    for (int c = 1; c < 3; c++) {
+        if (box->maxC[c] - box->minC[c] > box->maxC[widest] - box->minC[widest]) widest = c;
+    }
+    static int (*const compare[3])(const void *, const void *) = {
+        llz_palette_cmp_r, llz_palette_cmp_g, llz_palette_cmp_b
+    };
+    qsort(&bins[box->lo], (size_t)(box->hi - box->lo), sizeof(*bins), compare[widest]);
+
+    uint32_t half = box->population / 2, running = 0;
+    int split = box->lo;
+    while (split < box->hi - 1 && running + bins[split].count <= half) {
+        running += bins[split++].count;
+    }
+    if (split == box->lo) running += bins[split++].count;
+
+    out->lo = split;
+    out->hi = box->hi;
+    out->population = box->population - running;
+    box->hi = split;
+    box->population = running;
+    llz_palette_fit(bins, box);
+    llz_palette_fit(bins, out);
+    return true;
+}
+
+static int llz_palette_by_population(const void *a, const void *b)
+{
+    float pa = ((const LlzPaletteSwatch *)a)->population;
+    float pb = ((const LlzPaletteSwatch *)b)->population;
+    return (pa < pb) - (pa > pb);
+}
+
+// HSL saturation and lightness (0-1); HSV value would rate a dark navy
+// as bright as a red
+static void llz_palette_hsl(Color c, float *saturation, float *lightness)
+{
+    float maxC = fmaxf(c.r, fmaxf(c.g, c.b)) / 255.0f;
+    float minC = fminf(c.r, fminf(c.g, c.b)) / 255.0f;
+    float l = (maxC + minC) * 0.5f;
+    float d = maxC - minC;
+    *lightness = l;
+    *saturation = (d <= 0.0f) ? 0.0f : d / (1.0f - fabsf(2.0f * l - 1.0f));
+}
+
+// Best swatch for a target, or -1 when none falls inside its window
+static int llz_palette_pick(const LlzPalette *palette, const LlzPaletteTarget *target)
+{
+    int best = -1;
+    float bestScore = 0.0f;
+    float maxPopulation = palette->swatches[0].population;
+
+    for (int i = 0; i < palette->swatchCount; i++) {
+        float s, l;
+        llz_palette_hsl(palette->swatches[i].color, &s, &l);
+        if (s < target->minS || s > target->maxS) continue;
+        if (l < target->minL || l > target->maxL) continue;
+
+        float score = (1.0f - fabsf(s - target->targetS)) * 0.24f +
+                      (1.0f - fabsf(l - target->targetL)) * 0.52f +
+                      palette->swatches[i].population / maxPopulation * 0.24f;
+        if (best < 0 || score > bestScore) {
+            best = i;
+            bestScore = score;
+        }
+    }
+    return best;
+}
+
+static void llz_palette_name_colors(LlzPalette *palette)
+{
+    palette->dominant = palette->swatches[0].color;
+
+    int vibrant = llz_palette_pick(palette, &g_paletteVibrant);
+    if (vibrant < 0) {
+        // Nothing saturated enough; take the most saturated swatch
+        float maxSat = -1.0f;
+        for (int i = 0; i < palette->swatchCount; i++) {
+            float sat, lightness;
+            llz_palette_hsl(palette->swatches[i].color, &sat, &lightness);
+            if (sat > maxSat) {
+                maxSat = sat;
+                vibrant = i;
+            }
+        }
+    }
+    palette->vibrant = palette->swatches[vibrant].color;
+    palette->vibrantSaturation = ColorToHSV(palette->vibrant).y;
+
+    int muted = llz_palette_pick(palette, &g_paletteMuted);
+    palette->muted = muted >= 0 ? palette->swatches[muted].color : palette->dominant;
+
+    int darkMuted = llz_palette_pick(palette, &g_paletteDarkMuted);
+    if (darkMuted >= 0) {
+        palette->darkMuted = palette->swatches[darkMuted].color;
+    } else {
+        Vector3 hsv = ColorToHSV(palette->dominant);
+        palette->darkMuted = ColorFromHSV(hsv.x, hsv.y * 0.5f, 0.25f);
+    }
+}
+
+bool LlzPaletteExtract(Image image, LlzPalette *outPalette)
+{
+    memset(outPalette, 0, sizeof(*outPalette));
+    if (image.data == NULL || image.width <= 0 || image.height <= 0 ||
+        image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        return false;
+    }
+
+    // Averaging blocks first keeps noise and dithering out of the histogram
+    int longest = image.width > image.height ? image.width : image.height;
+    int factor = (longest + LLZ_PALETTE_SAMPLE_SIZE - 1) / LLZ_PALETTE_SAMPLE_SIZE;
+    if (factor > LLZ_PIXEL_MAX_FACTOR) factor = LLZ_PIXEL_MAX_FACTOR;
+    if (factor > image.width) factor = image.width;
+    if (factor > image.height) factor = image.height;
+
+    const Color *pixels = (const Color *)image.data;
+    size_t count = (size_t)image.width * image.height;
+    Color *reduced = NULL;
+    if (factor > 1) {
+        int w = image.width / factor;
+        int h = image.height / factor;
+        reduced = (Color *)malloc((size_t)w * h * sizeof(Color));
+        uint16_t *sums = (uint16_t *)malloc((size_t)image.width * 4 * sizeof(uint16_t));
+        if (reduced && sums) {
+            llz_pixel_downscale(pixels, image.width, image.height, factor, reduced, sums);
+            pixels = reduced;
+            count = (size_t)w * h;
+        }
+        free(sums);
+    }
+
+    uint32_t *histogram = (uint32_t *)calloc(LLZ_PIXEL_HIST_BINS, sizeof(uint32_t));
+    LlzPaletteBin *bins = (LlzPaletteBin *)malloc(
+        (count < LLZ_PIXEL_HIST_BINS ? count : LLZ_PIXEL_HIST_BINS) * sizeof(LlzPaletteBin));
+    if (!histogram || !bins) {
+        free(histogram);
+        free(bins);
+        free(reduced);
+        return false;
+    }
+    llz_pixel_histogram(pixels, count, histogram);
+    free(reduced);
+
+    // Near-black and near-white say little about the art
+    int binCount = 0;
+    uint32_t total = 0;
+    for (int i = 0; i < LLZ_PIXEL_HIST_BINS; i++) {
+        if (histogram[i] == 0) continue;
+        int brightness = (llz_palette_expand(llz_palette_channel((uint16_t)i, 0)) +
+                          llz_palette_expand(llz_palette_channel((uint16_t)i, 1)) +
+                          llz_palette_expand(llz_palette_channel((uint16_t)i, 2))) / 3;
+        if (brightness < 26 || brightness > 242) continue;
+        bins[binCount++] = (LlzPaletteBin){ (uint16_t)i, histogram[i] };
+        total += histogram[i];
+    }
+    free(histogram);
+
+    if (binCount == 0) {
+        free(bins);
+        return false;
+    }
+
+    // Median cut: keep splitting the box with the most population * volume
+    LlzPaletteBox boxes[LLZ_PALETTE_MAX_SWATCHES];
+    int boxCount = 1;
+    boxes[0] = (LlzPaletteBox){ .lo = 0, .hi = binCount, .population = total };
+    llz_palette_fit(bins, &boxes[0]);
+    while (boxCount < LLZ_PALETTE_MAX_SWATCHES) {
+        int target = -1;
+        for (int i = 0; i < boxCount; i++) {
+            if (boxes[i].hi - boxes[i].lo < 2) continue;
+            if (target < 0 || llz_palette_priority(&boxes[i]) > llz_palette_priority(&boxes[target])) {
+                target = i;
+            }
+        }
+        if (target < 0 || !llz_palette_split(bins, &boxes[target], &boxes[boxCount])) break;
+        boxCount++;
+    }
+
+    for (int b = 0; b < boxCount; b++) {
+        uint64_t sum[3] = { 0, 0, 0 };
+        for (int i = boxes[b].lo; i < boxes[b].hi; i++) {
+            for (int c = 0; c < 3; c++) {
+                sum[c] += (uint64_t)llz_palette_expand(llz_palette_channel(bins[i].index, c)) * bins[i].count;
+            }
+        }
+        uint32_t population = boxes[b].population;
+        outPalette->swatches[b].color = (Color){
+            (unsigned char)((sum[0] + population / 2) / population),
+            (unsigned char)((sum[1] + population / 2) / population),
+            (unsigned char)((sum[2] + population / 2) / population),
+            255
+        };
+        outPalette->swatches[b].population = (float)population / (float)total;
+    }
+    free(bins);
+
+    outPalette->swatchCount = boxCount;
+    qsort(outPalette->swatches, (size_t)boxCount, sizeof(LlzPaletteSwatch), llz_palette_by_population);
+    llz_palette_name_colors(outPalette);
+    outPalette->valid = true;
+    return true;
+}
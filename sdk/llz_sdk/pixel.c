@@ -0,0 +1,465 @@
+#include "pixel_internal.h"
+
+#include <string.h>
+
+#if !defined(LLZ_PIXEL_SCALAR) && defined(LLZ_PIXEL_ENABLE_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define LLZ_PIXEL_NEON 1
+#define LLZ_PIXEL_SIMD 1
+#elif !defined(LLZ_PIXEL_SCALAR) && defined(__SSE2__)
+#include <emmintrin.h>
+#define LLZ_PIXEL_SSE2 1
+#define LLZ_PIXEL_SIMD 1
+#endif
+
+// ============================================================================
+// Vector helpers
+// ============================================================================
+//
+// Both backends work on eight 16-bit lanes: two RGBA pixels, either adjacent
+// in memory or one from each of two rows. Scaling is a 16x16->32 multiply
+// rounded back down by 16 bits, the same arithmetic as llz_pixel_fix().
+
+#if defined(LLZ_PIXEL_NEON)
+
+typedef uint16x8_t LlzPixelVec;
+
+static inline LlzPixelVec llz_vec_zero(void)
+{
+    return vdupq_n_u16(0);
+}
+
+static inline LlzPixelVec llz_vec_scales(uint16_t rgb, uint16_t alpha)
+{
+    const uint16_t lanes[8] = { rgb, rgb, rgb, alpha, rgb, rgb, rgb, alpha };
+    return vld1q_u16(lanes);
+}
+
+static inline LlzPixelVec llz_vec_load(const Color *p)
+{
+    return vmovl_u8(vld1_u8((const uint8_t *)p));
+}
+
+static inline LlzPixelVec llz_vec_load2(const Color *p0, const Color *p1)
+{
+    uint32_t a, b;
+    memcpy(&a, p0, 4);
+    memcpy(&b, p1, 4);
+    return vmovl_u8(vreinterpret_u8_u32(vset_lane_u32(b, vdup_n_u32(a), 1)));
+}
+
+static inline LlzPixelVec llz_vec_load_sums(const uint16_t *sums)
+{
+    return vld1q_u16(sums);
+}
+
+static inline void llz_vec_store_sums(uint16_t *sums, LlzPixelVec v)
+{
+    vst1q_u16(sums, v);
+}
+
+static inline LlzPixelVec llz_vec_add(LlzPixelVec a, LlzPixelVec b)
+{
+    return vaddq_u16(a, b);
+}
+
+static inline LlzPixelVec llz_vec_sub(LlzPixelVec a, LlzPixelVec b)
+{
+    return vsubq_u16(a, b);
+}
+
+static inline uint8x8_t llz_vec_scale(LlzPixelVec v, LlzPixelVec scales)
+{
+    uint32x4_t lo = vmull_u16(vget_low_u16(v), vget_low_u16(scales));
+    uint32x4_t hi = vmull_u16(vget_high_u16(v), vget_high_u16(scales));
+    return vmovn_u16(vcombine_u16(vrshrn_n_u32(lo, 16), vrshrn_n_u32(hi, 16)));
+}
+
+static inline void llz_vec_store(Color *dst, LlzPixelVec v)
+{
+    vst1_u8((uint8_t *)dst, vmovn_u16(v));
+}
+
+static inline void llz_vec_store_scaled(Color *dst, LlzPixelVec v, LlzPixelVec scales)
+{
+    vst1_u8((uint8_t *)dst, llz_vec_scale(v, scales));
+}
+
+static inline void llz_vec_store2_scaled(Color *d0, Color *d1, LlzPixelVec v, LlzPixelVec scales)
+{
+    uint32x2_t packed = vreinterpret_u32_u8(llz_vec_scale(v, scales));
+    uint32_t a = vget_lane_u32(packed, 0);
+    uint32_t b = vget_lane_u32(packed, 1);
+    memcpy(d0, &a, 4);
+    memcpy(d1, &b, 4);
+}
+
+// rgb * a / 255 rounded; the alpha lanes keep their input value
+static inline LlzPixelVec llz_vec_premultiply(LlzPixelVec v)
+{
+    const uint16_t mask[8] = { 0, 0, 0, 0xFFFF, 0, 0, 0, 0xFFFF };
+    uint16x8_t alpha = vcombine_u16(vdup_lane_u16(vget_low_u16(v), 3),
+                                    vdup_lane_u16(vget_high_u16(v), 3));
+    uint16x8_t t = vaddq_u16(vmulq_u16(v, alpha), vdupq_n_u16(128));
+    uint16x8_t r = vshrq_n_u16(vsraq_n_u16(t, t, 8), 8);
+    return vbslq_u16(vld1q_u16(mask), v, r);
+}
+
+#elif defined(LLZ_PIXEL_SSE2)
+
+typedef __m128i LlzPixelVec;
+
+static inline LlzPixelVec llz_vec_zero(void)
+{
+    return _mm_setzero_si128();
+}
+
+static inline LlzPixelVec llz_vec_scales(uint16_t rgb, uint16_t alpha)
+{
+    return _mm_setr_epi16((short)rgb, (short)rgb, (short)rgb, (short)alpha,
+                          (short)rgb, (short)rgb, (short)rgb, (short)alpha);
+}
+
+static inline LlzPixelVec llz_vec_load(const Color *p)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p), _mm_setzero_si128());
+}
+
+static inline LlzPixelVec llz_vec_load2(const Color *p0, const Color *p1)
+{
+    int a, b;
+    memcpy(&a, p0, 4);
+    memcpy(&b, p1, 4);
+    __m128i packed = _mm_unpacklo_epi32(_mm_cvtsi32_si128(a), _mm_cvtsi32_si128(b));
+    return _mm_unpacklo_epi8(packed, _mm_setzero_si128());
+}
+
+static inline LlzPixelVec llz_vec_load_sums(const uint16_t *sums)
+{
+    return _mm_loadu_si128((const __m128i *)sums);
+}
+
+static inline void llz_vec_store_sums(uint16_t *sums, LlzPixelVec v)
+{
+    _mm_storeu_si128((__m128i *)sums, v);
+}
+
+static inline LlzPixelVec llz_vec_add(LlzPixelVec a, LlzPixelVec b)
+{
+    return _mm_add_epi16(a, b);
+}
+
+static inline LlzPixelVec llz_vec_sub(LlzPixelVec a, LlzPixelVec b)
+{
+    return _mm_sub_epi16(a, b);
+}
+
+// SSE2 has no 32-bit lane multiply: (v * s + 0x8000) >> 16 is the high half
+// of the product plus the top bit of the low half
+static inline __m128i llz_vec_scale(LlzPixelVec v, LlzPixelVec scales)
+{
+    __m128i hi = _mm_mulhi_epu16(v, scales);
+    __m128i lo = _mm_mullo_epi16(v, scales);
+    __m128i r = _mm_add_epi16(hi, _mm_srli_epi16(lo, 15));
+    return _mm_packus_epi16(r, r);
+}
+
+static inline void llz_vec_store(Color *dst, LlzPixelVec v)
+{
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(v, v));
+}
+
+static inline void llz_vec_store_scaled(Color *dst, LlzPixelVec v, LlzPixelVec scales)
+{
+    _mm_storel_epi64((__m128i *)dst, llz_vec_scale(v, scales));
+}
+
+static inline void llz_vec_store2_scaled(Color *d0, Color *d1, LlzPixelVec v, LlzPixelVec scales)
+{
+    __m128i packed = llz_vec_scale(v, scales);
+    int a = _mm_cvtsi128_si32(packed);
+    int b = _mm_cvtsi128_si32(_mm_srli_si128(packed, 4));
+    memcpy(d0, &a, 4);
+    memcpy(d1, &b, 4);
+}
+
+static inline LlzPixelVec llz_vec_premultiply(LlzPixelVec v)
+{
+    const __m128i mask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xFF), 0xFF);
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(v, alpha), _mm_set1_epi16(128));
+    __m128i r = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    return _mm_or_si128(_mm_and_si128(mask, v), _mm_andnot_si128(mask, r));
+}
+
+#endif
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+static inline int llz_pixel_clamp(int i, int size)
+{
+    return i < 0 ? 0 : (i >= size ? size - 1 : i);
+}
+
+static inline unsigned char llz_pixel_fix(uint32_t value, uint32_t scale)
+{
+    return (unsigned char)((value * scale + 0x8000) >> 16);
+}
+
+static inline unsigned char llz_pixel_mul255(uint32_t c, uint32_t a)
+{
+    uint32_t t = c * a + 128;
+    return (unsigned char)((t + (t >> 8)) >> 8);
+}
+
+const char *llz_pixel_backend(void)
+{
+#if defined(LLZ_PIXEL_NEON)
+    return "neon";
+#elif defined(LLZ_PIXEL_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+// Truncated rather than rounded so a full window of 255 never reaches 256
+uint16_t llz_pixel_box_scale(int radius, float gain)
+{
+    uint32_t scale = (uint32_t)(65536.0f * gain / (float)(radius * 2 + 1));
+    return (uint16_t)(scale > LLZ_PIXEL_SCALE_ONE ? LLZ_PIXEL_SCALE_ONE : scale);
+}
+
+// sums[x * 4 + c] += row[x].c
+static void llz_pixel_accumulate(uint16_t *sums, const Color *row, int width)
+{
+    int x = 0;
+#ifdef LLZ_PIXEL_SIMD
+    for (; x + 2 <= width; x += 2) {
+        uint16_t *sum = &sums[x * 4];
+        llz_vec_store_sums(sum, llz_vec_add(llz_vec_load_sums(sum), llz_vec_load(&row[x])));
+    }
+#endif
+    for (; x < width; x++) {
+        uint16_t *sum = &sums[x * 4];
+        sum[0] += row[x].r;
+        sum[1] += row[x].g;
+        sum[2] += row[x].b;
+        sum[3] += row[x].a;
+    }
+}
+
+void llz_pixel_box_rows(const Color *src, Color *dst, int width, int height, int radius)
+{
+    uint16_t scale = llz_pixel_box_scale(radius, 1.0f);
+    int y = 0;
+
+#ifdef LLZ_PIXEL_SIMD
+    // Each window sum is serial along the row, so the lanes carry one pixel
+    // from each of two rows instead
+    LlzPixelVec scales = llz_vec_scales(scale, scale);
+    for (; y + 2 <= height; y += 2) {
+        const Color *in0 = src + (size_t)y * width;
+        const Color *in1 = in0 + width;
+        Color *out0 = dst + (size_t)y * width;
+        Color *out1 = out0 + width;
+
+        LlzPixelVec sum = llz_vec_zero();
+        for (int x = -radius; x <= radius; x++) {
+            int i = llz_pixel_clamp(x, width);
+            sum = llz_vec_add(sum, llz_vec_load2(&in0[i], &in1[i]));
+        }
+
+        for (int x = 0; x < width; x++) {
+            llz_vec_store2_scaled(&out0[x], &out1[x], sum, scales);
+            int add = llz_pixel_clamp(x + radius + 1, width);
+            int sub = llz_pixel_clamp(x - radius, width);
+            sum = llz_vec_add(sum, llz_vec_load2(&in0[add], &in1[add]));
+            sum = llz_vec_sub(sum, llz_vec_load2(&in0[sub], &in1[sub]));
+        }
+    }
+#endif
+
+    for (; y < height; y++) {
+        const Color *in = src + (size_t)y * width;
+        Color *out = dst + (size_t)y * width;
+
+        // Initialize the window with the edge pixels repeated
+        uint32_t r = 0, g = 0, b = 0, a = 0;
+        for (int x = -radius; x <= radius; x++) {
+            const Color *p = &in[llz_pixel_clamp(x, width)];
+            r += p->r;
+            g += p->g;
+            b += p->b;
+            a += p->a;
+        }
+
+        for (int x = 0; x < width; x++) {
+            out[x] = (Color){
+                llz_pixel_fix(r, scale),
+                llz_pixel_fix(g, scale),
+                llz_pixel_fix(b, scale),
+                llz_pixel_fix(a, scale)
+            };
+
+            // Slide window
+            const Color *add = &in[llz_pixel_clamp(x + radius + 1, width)];
+            const Color *sub = &in[llz_pixel_clamp(x - radius, width)];
+            r += add->r - sub->r;
+            g += add->g - sub->g;
+            b += add->b - sub->b;
+            a += add->a - sub->a;
+        }
+    }
+}
+
+// One running sum per column, walked row by row so every read and write is
+// sequential and adjacent columns fill the vector lanes
+void llz_pixel_box_columns(const Color *src, Color *dst, uint16_t *sums, int width, int height,
+                           int radius, uint16_t rgbScale, uint16_t alphaScale)
+{
+    memset(sums, 0, (size_t)width * 4 * sizeof(uint16_t));
+    for (int y = -radius; y <= radius; y++) {
+        llz_pixel_accumulate(sums, src + (size_t)llz_pixel_clamp(y, height) * width, width);
+    }
+
+#ifdef LLZ_PIXEL_SIMD
+    LlzPixelVec scales = llz_vec_scales(rgbScale, alphaScale);
+#endif
+    for (int y = 0; y < height; y++) {
+        Color *out = dst + (size_t)y * width;
+        const Color *add = src + (size_t)llz_pixel_clamp(y + radius + 1, height) * width;
+        const Color *sub = src + (size_t)llz_pixel_clamp(y - radius, height) * width;
+        int x = 0;
+
+#ifdef LLZ_PIXEL_SIMD
+        for (; x + 2 <= width; x += 2) {
+            uint16_t *sum = &sums[x * 4];
+            LlzPixelVec s = llz_vec_load_sums(sum);
+            llz_vec_store_scaled(&out[x], s, scales);
+            s = llz_vec_add(s, llz_vec_load(&add[x]));
+            llz_vec_store_sums(sum, llz_vec_sub(s, llz_vec_load(&sub[x])));
+        }
+#endif
+        for (; x < width; x++) {
+            uint16_t *sum = &sums[x * 4];
+            out[x] = (Color){
+                llz_pixel_fix(sum[0], rgbScale),
+                llz_pixel_fix(sum[1], rgbScale),
+                llz_pixel_fix(sum[2], rgbScale),
+                llz_pixel_fix(sum[3], alphaScale)
+            };
+            sum[0] += add[x].r - sub[x].r;
+            sum[1] += add[x].g - sub[x].g;
+            sum[2] += add[x].b - sub[x].b;
+            sum[3] += add[x].a - sub[x].a;
+        }
+    }
+}
+
+void llz_pixel_scale_rgb(Color *pixels, size_t count, uint16_t rgbScale)
+{
+    size_t i = 0;
+#ifdef LLZ_PIXEL_SIMD
+    // A scale of LLZ_PIXEL_SCALE_ONE returns every 8-bit value unchanged
+    LlzPixelVec scales = llz_vec_scales(rgbScale, LLZ_PIXEL_SCALE_ONE);
+    for (; i + 2 <= count; i += 2) {
+        llz_vec_store_scaled(&pixels[i], llz_vec_load(&pixels[i]), scales);
+    }
+#endif
+    for (; i < count; i++) {
+        pixels[i].r = llz_pixel_fix(pixels[i].r, rgbScale);
+        pixels[i].g = llz_pixel_fix(pixels[i].g, rgbScale);
+        pixels[i].b = llz_pixel_fix(pixels[i].b, rgbScale);
+    }
+}
+
+void llz_pixel_premultiply(Color *pixels, size_t count)
+{
+    size_t i = 0;
+#ifdef LLZ_PIXEL_SIMD
+    for (; i + 2 <= count; i += 2) {
+        llz_vec_store(&pixels[i], llz_vec_premultiply(llz_vec_load(&pixels[i])));
+    }
+#endif
+    for (; i < count; i++) {
+        pixels[i].r = llz_pixel_mul255(pixels[i].r, pixels[i].a);
+        pixels[i].g = llz_pixel_mul255(pixels[i].g, pixels[i].a);
+        pixels[i].b = llz_pixel_mul255(pixels[i].b, pixels[i].a);
+    }
+}
+
+// Rows are summed into full-width column sums with the vector add, then
+// each run of factor columns is reduced and scaled
+void llz_pixel_downscale(const Color *src, int width, int height, int factor,
+                         Color *dst, uint16_t *sums)
+{
+    int w = width / factor;
+    int h = height / factor;
+    int used = w * factor;
+    uint32_t scale = (uint32_t)(65536 / (factor * factor));
+
+    for (int oy = 0; oy < h; oy++) {
+        memset(sums, 0, (size_t)used * 4 * sizeof(uint16_t));
+        for (int fy = 0; fy < factor; fy++) {
+            llz_pixel_accumulate(sums, src + (size_t)(oy * factor + fy) * width, used);
+        }
+
+        Color *out = dst + (size_t)oy * w;
+        for (int ox = 0; ox < w; ox++) {
+            const uint16_t *sum = &sums[ox * factor * 4];
+            uint32_t r = 0, g = 0, b = 0, a = 0;
+            for (int fx = 0; fx < factor; fx++, sum += 4) {
+                r += sum[0];
+                g += sum[1];
+                b += sum[2];
+                a += sum[3];
+            }
+            out[ox] = (Color){
+                llz_pixel_fix(r, scale),
+                llz_pixel_fix(g, scale),
+                llz_pixel_fix(b, scale),
+                llz_pixel_fix(a, scale)
+            };
+        }
+    }
+}
+
+// The increments are a scatter and stay scalar; the vector path computes
+// four bin indices at once from the little-endian RGBA words
+void llz_pixel_histogram(const Color *pixels, size_t count, uint32_t *bins)
+{
+    size_t i = 0;
+#if defined(LLZ_PIXEL_NEON)
+    uint32_t index[4];
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t v = vld1q_u32((const uint32_t *)&pixels[i]);
+        uint32x4_t r = vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0xF8)), 7);
+        uint32x4_t g = vandq_u32(vshrq_n_u32(v, 6), vdupq_n_u32(0x3E0));
+        uint32x4_t b = vandq_u32(vshrq_n_u32(v, 19), vdupq_n_u32(0x1F));
+        vst1q_u32(index, vorrq_u32(vorrq_u32(r, g), b));
+        bins[index[0]]++;
+        bins[index[1]]++;
+        bins[index[2]]++;
+        bins[index[3]]++;
+    }
+#elif defined(LLZ_PIXEL_SSE2)
+    uint32_t index[4];
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&pixels[i]);
+        __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF8)), 7);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(v, 6), _mm_set1_epi32(0x3E0));
+        __m128i b = _mm_and_si128(_mm_srli_epi32(v, 19), _mm_set1_epi32(0x1F));
+        _mm_storeu_si128((__m128i *)index, _mm_or_si128(_mm_or_si128(r, g), b));
+        bins[index[0]]++;
+        bins[index[1]]++;
+        bins[index[2]]++;
+        bins[index[3]]++;
+    }
+#endif
+    for (; i < count; i++) {
+        bins[llz_pixel_hist_index(pixels[i])]++;
+    }
+}
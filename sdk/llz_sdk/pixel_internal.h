@@ -0,0 +1,62 @@
+#ifndef LLZ_PIXEL_INTERNAL_H
+#define LLZ_PIXEL_INTERNAL_H
+
+// SDK-internal RGBA8 pixel kernels (not installed for plugins)
+//
+// The inner loops of the blur, downscale and colour code. Every kernel has a
+// scalar reference; NEON (the CarThing's Cortex-A7, with the armv7
+// toolchain's -mfpu=neon-vfpv4) and SSE2 (x86-64 desktops) versions are
+// compiled in when the target has them and produce bit-identical output.
+// NEON is opt-in (-DLLZ_PIXEL_NEON=ON defines LLZ_PIXEL_ENABLE_NEON) until
+// llz_sdk_tests has passed with it on the device or under qemu-arm.
+// Build with -DLLZ_PIXEL_SCALAR to force the reference path when comparing;
+// llz_sdk_tests (sdk/tests) checks both builds against each other.
+//
+// Scales are 16.16 fixed point below 1.0: out = (in * scale + 0x8000) >> 16.
+// Running sums are 16-bit, which bounds box radii to LLZ_PIXEL_MAX_RADIUS and
+// downscale factors to LLZ_PIXEL_MAX_FACTOR.
+
+#include "raylib.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LLZ_PIXEL_MAX_RADIUS 100
+#define LLZ_PIXEL_MAX_FACTOR 16
+#define LLZ_PIXEL_SCALE_ONE 65535u       // Leaves a channel unchanged
+#define LLZ_PIXEL_HIST_BINS 32768        // 5 bits per channel, r << 10 | g << 5 | b
+
+// "neon", "sse2" or "scalar"
+const char *llz_pixel_backend(void);
+
+// Scale for a box window of 2 * radius + 1 pixels, times gain (0-1)
+uint16_t llz_pixel_box_scale(int radius, float gain);
+
+// Horizontal box pass with edge pixels repeated
+void llz_pixel_box_rows(const Color *src, Color *dst, int width, int height, int radius);
+
+// Vertical box pass. sums is scratch for width * 4 values. rgbScale and
+// alphaScale let the last pass fold in a darken step.
+void llz_pixel_box_columns(const Color *src, Color *dst, uint16_t *sums, int width, int height,
+                           int radius, uint16_t rgbScale, uint16_t alphaScale);
+
+// Multiply RGB by rgbScale in place; alpha is untouched (darken)
+void llz_pixel_scale_rgb(Color *pixels, size_t count, uint16_t rgbScale);
+
+// Multiply RGB by alpha in place, rounded to nearest
+void llz_pixel_premultiply(Color *pixels, size_t count);
+
+// Average factor x factor blocks into dst ((width / factor) x (height / factor)).
+// sums is scratch for width * 4 values.
+void llz_pixel_downscale(const Color *src, int width, int height, int factor,
+                         Color *dst, uint16_t *sums);
+
+// Add count pixels to a LLZ_PIXEL_HIST_BINS histogram (alpha ignored)
+void llz_pixel_histogram(const Color *pixels, size_t count, uint32_t *bins);
+
+static inline int llz_pixel_hist_index(Color c)
+{
+    return ((c.r >> 3) << 10) | ((c.g >> 3) << 5) | (c.b >> 3);
+}
+
+#endif // LLZ_PIXEL_INTERNAL_H
@@ -0,0 +1,173 @@
+#include "llz_sdk_prefetch.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Below this many items per second the list counts as resting and the
+// window is symmetric
+#define LLZ_PREFETCH_IDLE_SPEED 0.5f
+
+typedef struct {
+    int index;
+    char key[LLZ_PREFETCH_KEY_MAX];
+    LlzArtHandle art;
+} LlzPrefetchItem;
+
+struct LlzPrefetch {
+    LlzArtVariant variant;
+    LlzPrefetchItem items[LLZ_PREFETCH_MAX_ITEMS];
+    int itemCount;
+    int plan[LLZ_PREFETCH_MAX_ITEMS];   // Window the items were built from
+    char planKeys[LLZ_PREFETCH_MAX_ITEMS][LLZ_PREFETCH_KEY_MAX];   // Its keys, "" for none
+    int planCount;
+    int failed;                          // Keys in the window without a handle
+    int retryIn;                         // Updates until failed acquires are retried
+    bool planned;
+};
+
+int LlzPrefetchPlan(LlzPrefetchView view, int *outIndices, int maxIndices)
+{
+    if (view.count <= 0 || !outIndices || maxIndices <= 0) return 0;
+
+    int center = (int)lroundf(view.position);
+    if (center < 0) center = 0;
+    if (center >= view.count) center = view.count - 1;
+    int radius = view.visibleRadius > 0 ? view.visibleRadius : 0;
+
+    // At rest, one item past the viewport on either side. Moving, the
+    // lookahead covers the items that arrive within the lookahead time and
+    // nothing beyond the viewport is kept behind.
+    float speed = fabsf(view.velocity);
+    int dir = view.velocity < 0.0f ? -1 : 1;
+    int ahead = radius + 1;
+    int behind = radius + 1;
+    if (speed >= LLZ_PREFETCH_IDLE_SPEED) {
+        int lookahead = (int)ceilf(speed * LLZ_PREFETCH_LOOKAHEAD_SECONDS);
+        if (lookahead < 1) lookahead = 1;
+        if (lookahead > LLZ_PREFETCH_MAX_AHEAD) lookahead = LLZ_PREFETCH_MAX_AHEAD;
+        ahead = radius + lookahead;
+        behind = radius;
+    }
+
+    int n = 0;
+    outIndices[n++] = center;
+    for (int d = 1; n < maxIndices && (d <= ahead || d <= behind); d++) {
+        int next = center + dir * d;
+        if (d <= ahead && next >= 0 && next < view.count) outIndices[n++] = next;
+        int prev = center - dir * d;
+        if (n < maxIndices && d <= behind && prev >= 0 && prev < view.count) outIndices[n++] = prev;
+    }
+    return n;
+}
+
+LlzPrefetch *LlzPrefetchCreate(LlzArtVariant variant)
+{
+    LlzPrefetch *prefetch = (LlzPrefetch *)calloc(1, sizeof(LlzPrefetch));
+    if (!prefetch) return NULL;
+    prefetch->variant = variant;
+    return prefetch;
+}
+
+void LlzPrefetchDestroy(LlzPrefetch *prefetch)
+{
+    if (!prefetch) return;
+    LlzPrefetchReset(prefetch);
+    free(prefetch);
+}
+
+void LlzPrefetchUpdate(LlzPrefetch *prefetch, LlzPrefetchView view,
+                       LlzPrefetchKeyCallback key, void *user)
+{
+    if (!prefetch || !key) return;
+
+    int plan[LLZ_PREFETCH_MAX_ITEMS];
+    int planCount = LlzPrefetchPlan(view, plan, LLZ_PREFETCH_MAX_ITEMS);
+
+    // Keys are read every time: an item's key can appear or change without
+    // the window moving (its data loaded, or the list was refilled)
+    char planKeys[LLZ_PREFETCH_MAX_ITEMS][LLZ_PREFETCH_KEY_MAX];
+    for (int rank = 0; rank < planCount; rank++) {
+        const char *itemKey = key(plan[rank], user);
+        strncpy(planKeys[rank], itemKey ? itemKey : "", LLZ_PREFETCH_KEY_MAX - 1);
+        planKeys[rank][LLZ_PREFETCH_KEY_MAX - 1] = '\0';
+    }
+
+    if (prefetch->planned && planCount == prefetch->planCount &&
+        memcmp(plan, prefetch->plan, (size_t)planCount * sizeof(plan[0])) == 0) {
+        bool keysChanged = false;
+        for (int rank = 0; rank < planCount && !keysChanged; rank++) {
+            keysChanged = strcmp(planKeys[rank], prefetch->planKeys[rank]) != 0;
+        }
+        if (!keysChanged && (prefetch->failed == 0 || --prefetch->retryIn > 0)) return;
+    }
+
+    // Acquire the new window before releasing the old one, so items that
+    // stay in it keep their entries (and any load in progress)
+    LlzPrefetchItem next[LLZ_PREFETCH_MAX_ITEMS];
+    bool kept[LLZ_PREFETCH_MAX_ITEMS] = { false };
+    int nextCount = 0;
+    int failed = 0;
+
+    for (int rank = 0; rank < planCount; rank++) {
+        const char *itemKey = planKeys[rank];
+        if (itemKey[0] == '\0') continue;
+
+        LlzPrefetchItem *item = &next[nextCount];
+        memset(item, 0, sizeof(*item));
+        for (int i = 0; i < prefetch->itemCount; i++) {
+            if (!kept[i] && strcmp(prefetch->items[i].key, itemKey) == 0) {
+                *item = prefetch->items[i];
+                kept[i] = true;
+                break;
+            }
+        }
+        if (item->art == 0) {
+            strncpy(item->key, itemKey, sizeof(item->key) - 1);
+            item->art = LlzArtCacheAcquire(item->key, prefetch->variant);
+            if (item->art == 0) {
+                failed++;
+                continue;
+            }
+        }
+        item->index = plan[rank];
+
+        // The centre item loads at normal priority, the rest behind it
+        LlzArtCacheSetPriority(item->art, -rank);
+        nextCount++;
+    }
+
+    for (int i = 0; i < prefetch->itemCount; i++) {
+        if (!kept[i]) LlzArtCacheRelease(prefetch->items[i].art);
+    }
+
+    memcpy(prefetch->items, next, (size_t)nextCount * sizeof(next[0]));
+    prefetch->itemCount = nextCount;
+    memcpy(prefetch->plan, plan, (size_t)planCount * sizeof(plan[0]));
+    memcpy(prefetch->planKeys, planKeys, (size_t)planCount * sizeof(planKeys[0]));
+    prefetch->planCount = planCount;
+    prefetch->failed = failed;
+    prefetch->retryIn = LLZ_PREFETCH_RETRY_UPDATES;
+    prefetch->planned = true;
+}
+
+LlzArtHandle LlzPrefetchGet(const LlzPrefetch *prefetch, int index)
+{
+    if (!prefetch) return 0;
+    for (int i = 0; i < prefetch->itemCount; i++) {
+        if (prefetch->items[i].index == index) return prefetch->items[i].art;
+    }
+    return 0;
+}
+
+void LlzPrefetchReset(LlzPrefetch *prefetch)
+{
+    if (!prefetch) return;
+    for (int i = 0; i < prefetch->itemCount; i++) {
+        LlzArtCacheRelease(prefetch->items[i].art);
+    }
+    prefetch->itemCount = 0;
+    prefetch->planCount = 0;
+    prefetch->failed = 0;
+    prefetch->planned = false;
+}
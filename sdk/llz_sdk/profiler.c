@@ -0,0 +1,611 @@
+#include "llz_sdk_profiler.h"
+#include "llz_sdk_display.h"
+#include "llz_sdk_resource.h"
+
+#include "raylib.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LLZ_PROFILER_DEFAULT_DIR "/tmp"
+#define LLZ_PROFILER_GRAPH_FRAMES 120
+#define LLZ_PROFILER_GRAPH_MAX_MS 33.3f
+#define LLZ_PROFILER_TOP_SPANS 4
+
+typedef struct {
+    uint64_t startUs;
+    float phaseMs[LLZ_PROFILER_PHASE_COUNT];
+    float frameMs;       // Begin to end of the frame
+    uint32_t gpuKB;      // Tracked resource memory at the end of the frame
+    uint32_t cpuKB;
+} LlzProfilerFrame;
+
+typedef struct {
+    char name[LLZ_PROFILER_NAME_MAX];
+    LlzProfilerFrame *frames;   // Allocated on first use
+    int head;                   // Next write position
+    int count;
+    uint64_t lastActiveUs;
+    bool used;
+} LlzProfilerPlugin;
+
+typedef struct {
+    char name[LLZ_PROFILER_SPAN_NAME_MAX];   // Copied: callers' strings may be unloaded
+    uint64_t startUs;
+    uint32_t durationUs;
+    int plugin;          // Slot active when the span ended, -1 if none
+} LlzProfilerSpan;
+
+static bool g_profEnabled = false;        // Read with relaxed atomics from any thread
+static bool g_profOverlay = false;
+static char g_profDir[256] = LLZ_PROFILER_DEFAULT_DIR;
+
+// Frame state (host thread only)
+static LlzProfilerPlugin g_profPlugins[LLZ_PROFILER_MAX_PLUGINS];
+static int g_profCurrent = -1;            // Slot of the open frame
+static LlzProfilerFrame g_profFrame;
+static uint64_t g_profPhaseStart[LLZ_PROFILER_PHASE_COUNT];
+
+// Span ring, shared with worker threads
+static pthread_mutex_t g_profSpanMutex = PTHREAD_MUTEX_INITIALIZER;
+static LlzProfilerSpan *g_profSpans = NULL;
+static int g_profSpanHead = 0;
+static int g_profSpanCount = 0;
+
+static volatile sig_atomic_t g_profDumpRequested = 0;
+static volatile sig_atomic_t g_profToggleRequested = 0;
+
+static const char *g_phaseNames[LLZ_PROFILER_PHASE_COUNT] = {"input", "update", "draw", "present"};
+
+static uint64_t llz_prof_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+static inline bool llz_prof_on(void)
+{
+    return __atomic_load_n(&g_profEnabled, __ATOMIC_RELAXED);
+}
+
+static void llz_prof_on_dump_signal(int sig)
+{
+    (void)sig;
+    g_profDumpRequested = 1;
+}
+
+static void llz_prof_on_toggle_signal(int sig)
+{
+    (void)sig;
+    g_profToggleRequested = 1;
+}
+
+void LlzProfilerInit(void)
+{
+    const char *dir = getenv("LLZ_PROFILE_DIR");
+    if (dir && dir[0] != '\0') {
+        strncpy(g_profDir, dir, sizeof(g_profDir) - 1);
+        g_profDir[sizeof(g_profDir) - 1] = '\0';
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    sa.sa_handler = llz_prof_on_dump_signal;
+    sigaction(SIGUSR1, &sa, NULL);
+    sa.sa_handler = llz_prof_on_toggle_signal;
+    sigaction(SIGUSR2, &sa, NULL);
+
+    const char *env = getenv("LLZ_PROFILE");
+    if (env && env[0] != '\0' && env[0] != '0') {
+        LlzProfilerSetEnabled(true);
+        printf("[PROFILER] Recording enabled via LLZ_PROFILE (dumps go to %s)\n", g_profDir);
+    }
+}
+
+void LlzProfilerShutdown(void)
+{
+    LlzProfilerSetEnabled(false);
+    g_profOverlay = false;
+
+    for (int i = 0; i < LLZ_PROFILER_MAX_PLUGINS; i++) {
+        free(g_profPlugins[i].frames);
+    }
+    memset(g_profPlugins, 0, sizeof(g_profPlugins));
+    g_profCurrent = -1;
+
+    pthread_mutex_lock(&g_profSpanMutex);
+    free(g_profSpans);
+    g_profSpans = NULL;
+    g_profSpanHead = 0;
+    g_profSpanCount = 0;
+    pthread_mutex_unlock(&g_profSpanMutex);
+}
+
+void LlzProfilerSetEnabled(bool enabled)
+{
+    if (enabled) {
+        pthread_mutex_lock(&g_profSpanMutex);
+        if (!g_profSpans) {
+            g_profSpans = (LlzProfilerSpan *)calloc(LLZ_PROFILER_SPAN_HISTORY, sizeof(LlzProfilerSpan));
+        }
+        bool ready = g_profSpans != NULL;
+        pthread_mutex_unlock(&g_profSpanMutex);
+        if (!ready) {
+            printf("[PROFILER] Failed to allocate span buffer\n");
+            return;
+        }
+    } else {
+        g_profCurrent = -1;
+    }
+    __atomic_store_n(&g_profEnabled, enabled, __ATOMIC_RELAXED);
+}
+
+bool LlzProfilerIsEnabled(void)
+{
+    return llz_prof_on();
+}
+
+void LlzProfilerSetOverlayVisible(bool visible)
+{
+    g_profOverlay = visible;
+    if (visible && !llz_prof_on()) LlzProfilerSetEnabled(true);
+}
+
+bool LlzProfilerIsOverlayVisible(void)
+{
+    return g_profOverlay;
+}
+
+// Find the slot for a plugin, claiming a free or the least recently active one
+static int llz_prof_plugin_slot(const char *name)
+{
+    int victim = 0;
+    for (int i = 0; i < LLZ_PROFILER_MAX_PLUGINS; i++) {
+        LlzProfilerPlugin *p = &g_profPlugins[i];
+        if (p->used && strcmp(p->name, name) == 0) return i;
+        if (!p->used) {
+            if (g_profPlugins[victim].used) victim = i;
+        } else if (g_profPlugins[victim].used && p->lastActiveUs < g_profPlugins[victim].lastActiveUs) {
+            victim = i;
+        }
+    }
+
+    LlzProfilerPlugin *p = &g_profPlugins[victim];
+    if (!p->frames) {
+        p->frames = (LlzProfilerFrame *)calloc(LLZ_PROFILER_FRAME_HISTORY, sizeof(LlzProfilerFrame));
+        if (!p->frames) return -1;
+    }
+    strncpy(p->name, name, sizeof(p->name) - 1);
+    p->name[sizeof(p->name) - 1] = '\0';
+    p->head = 0;
+    p->count = 0;
+    p->used = true;
+    return victim;
+}
+
+void LlzProfilerFrameEnd(void)
+{
+    if (g_profCurrent < 0) return;
+
+    uint64_t now = llz_prof_now_us();
+    for (int i = 0; i < LLZ_PROFILER_PHASE_COUNT; i++) {
+        if (g_profPhaseStart[i]) LlzProfilerPhaseEnd((LlzProfilerPhase)i);
+    }
+    g_profFrame.frameMs = (float)(now - g_profFrame.startUs) / 1000.0f;
+
+    LlzResourceStats mem;
+    LlzResourceGetStats(&mem);
+    g_profFrame.gpuKB = (uint32_t)(mem.bytes[LLZ_RESOURCE_GPU] / 1024);
+    g_profFrame.cpuKB = (uint32_t)(mem.bytes[LLZ_RESOURCE_CPU] / 1024);
+
+    LlzProfilerPlugin *p = &g_profPlugins[g_profCurrent];
+    p->frames[p->head] = g_profFrame;
+    p->head = (p->head + 1) % LLZ_PROFILER_FRAME_HISTORY;
+    if (p->count < LLZ_PROFILER_FRAME_HISTORY) p->count++;
+    p->lastActiveUs = now;
+
+    g_profCurrent = -1;
+}
+
+void LlzProfilerFrameCancel(void)
+{
+    g_profCurrent = -1;
+}
+
+void LlzProfilerFrameBegin(const char *pluginName)
+{
+    if (g_profToggleRequested) {
+        g_profToggleRequested = 0;
+        LlzProfilerSetOverlayVisible(!g_profOverlay);
+    }
+    if (g_profDumpRequested) {
+        g_profDumpRequested = 0;
+        LlzProfilerDump();
+    }
+
+    if (!llz_prof_on()) return;
+    LlzProfilerFrameEnd();
+
+    int slot = llz_prof_plugin_slot(pluginName && pluginName[0] ? pluginName : "unknown");
+    if (slot < 0) return;
+
+    g_profCurrent = slot;
+    memset(&g_profFrame, 0, sizeof(g_profFrame));
+    memset(g_profPhaseStart, 0, sizeof(g_profPhaseStart));
+    g_profFrame.startUs = llz_prof_now_us();
+}
+
+void LlzProfilerPhaseBegin(LlzProfilerPhase phase)
+{
+    if (g_profCurrent < 0 || phase >= LLZ_PROFILER_PHASE_COUNT) return;
+    g_profPhaseStart[phase] = llz_prof_now_us();
+}
+
+void LlzProfilerPhaseEnd(LlzProfilerPhase phase)
+{
+    if (g_profCurrent < 0 || phase >= LLZ_PROFILER_PHASE_COUNT || !g_profPhaseStart[phase]) return;
+    // Phases entered twice in a frame accumulate
+    g_profFrame.phaseMs[phase] += (float)(llz_prof_now_us() - g_profPhaseStart[phase]) / 1000.0f;
+    g_profPhaseStart[phase] = 0;
+}
+
+uint64_t LlzProfilerSpanBegin(void)
+{
+    if (!llz_prof_on()) return 0;
+    return llz_prof_now_us();
+}
+
+void LlzProfilerSpanEnd(const char *name, uint64_t startUs)
+{
+    if (startUs == 0 || !llz_prof_on()) return;
+    uint64_t now = llz_prof_now_us();
+
+    pthread_mutex_lock(&g_profSpanMutex);
+    if (g_profSpans) {
+        LlzProfilerSpan *span = &g_profSpans[g_profSpanHead];
+        strncpy(span->name, name ? name : "span", sizeof(span->name) - 1);
+        span->name[sizeof(span->name) - 1] = '\0';
+        span->startUs = startUs;
+        span->durationUs = (uint32_t)(now - startUs);
+        span->plugin = g_profCurrent;
+        g_profSpanHead = (g_profSpanHead + 1) % LLZ_PROFILER_SPAN_HISTORY;
+        if (g_profSpanCount < LLZ_PROFILER_SPAN_HISTORY) g_profSpanCount++;
+    }
+    pthread_mutex_unlock(&g_profSpanMutex);
+}
+
+// i-th oldest frame of a plugin ring
+static const LlzProfilerFrame *llz_prof_frame_at(const LlzProfilerPlugin *p, int i)
+{
+    int start = (p->head - p->count + LLZ_PROFILER_FRAME_HISTORY) % LLZ_PROFILER_FRAME_HISTORY;
+    return &p->frames[(start + i) % LLZ_PROFILER_FRAME_HISTORY];
+}
+
+static void llz_prof_fill_stats(const LlzProfilerPlugin *p, LlzProfilerStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    memcpy(out->name, p->name, sizeof(out->name));
+    out->frames = p->count;
+    if (p->count == 0) return;
+
+    for (int i = 0; i < p->count; i++) {
+        const LlzProfilerFrame *f = llz_prof_frame_at(p, i);
+        for (int ph = 0; ph < LLZ_PROFILER_PHASE_COUNT; ph++) {
+            out->avgMs[ph] += f->phaseMs[ph];
+            if (f->phaseMs[ph] > out->maxMs[ph]) out->maxMs[ph] = f->phaseMs[ph];
+        }
+        out->avgFrameMs += f->frameMs;
+        if (f->frameMs > out->maxFrameMs) out->maxFrameMs = f->frameMs;
+    }
+    for (int ph = 0; ph < LLZ_PROFILER_PHASE_COUNT; ph++) {
+        out->avgMs[ph] /= (float)p->count;
+        out->lastMs[ph] = llz_prof_frame_at(p, p->count - 1)->phaseMs[ph];
+    }
+    out->avgFrameMs /= (float)p->count;
+}
+
+bool LlzProfilerGetStats(const char *pluginName, LlzProfilerStats *outStats)
+{
+    if (!pluginName || !outStats) return false;
+    for (int i = 0; i < LLZ_PROFILER_MAX_PLUGINS; i++) {
+        const LlzProfilerPlugin *p = &g_profPlugins[i];
+        if (p->used && p->count > 0 && strcmp(p->name, pluginName) == 0) {
+            llz_prof_fill_stats(p, outStats);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Overlay
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    char name[LLZ_PROFILER_SPAN_NAME_MAX];
+    int count;
+    float totalMs;
+} LlzProfilerSpanTotal;
+
+// Heaviest span names for a plugin since sinceUs
+static int llz_prof_top_spans(int plugin, uint64_t sinceUs, LlzProfilerSpanTotal *out, int maxOut)
+{
+    LlzProfilerSpanTotal totals[32];
+    int totalCount = 0;
+
+    pthread_mutex_lock(&g_profSpanMutex);
+    for (int i = 0; i < g_profSpanCount; i++) {
+        int idx = (g_profSpanHead - 1 - i + LLZ_PROFILER_SPAN_HISTORY) % LLZ_PROFILER_SPAN_HISTORY;
+        const LlzProfilerSpan *s = &g_profSpans[idx];
+        if (s->startUs < sinceUs) break;
+        if (s->plugin != plugin) continue;
+
+        int t = 0;
+        while (t < totalCount && strcmp(totals[t].name, s->name) != 0) t++;
+        if (t == totalCount) {
+            if (totalCount == (int)(sizeof(totals) / sizeof(totals[0]))) continue;
+            memcpy(totals[t].name, s->name, sizeof(totals[t].name));
+            totals[t].count = 0;
+            totals[t].totalMs = 0.0f;
+            totalCount++;
+        }
+        totals[t].count++;
+        totals[t].totalMs += (float)s->durationUs / 1000.0f;
+    }
+    pthread_mutex_unlock(&g_profSpanMutex);
+
+    int n = 0;
+    for (; n < maxOut && n < totalCount; n++) {
+        int best = n;
+        for (int j = n + 1; j < totalCount; j++) {
+            if (totals[j].totalMs > totals[best].totalMs) best = j;
+        }
+        LlzProfilerSpanTotal tmp = totals[n];
+        totals[n] = totals[best];
+        totals[best] = tmp;
+        out[n] = totals[n];
+    }
+    return n;
+}
+
+void LlzProfilerDrawOverlay(void)
+{
+    if (!g_profOverlay || !llz_prof_on() || g_profCurrent < 0) return;
+
+    const LlzProfilerPlugin *p = &g_profPlugins[g_profCurrent];
+    LlzProfilerStats stats;
+    llz_prof_fill_stats(p, &stats);
+
+    const int width = 340;
+    const int rowH = 16;
+    Rectangle panel = {(float)(LLZ_LOGICAL_WIDTH - width - 8), 8.0f, (float)width, 0.0f};
+    panel.height = (float)(24 + rowH * (LLZ_PROFILER_PHASE_COUNT + 3) + 48 + rowH * LLZ_PROFILER_TOP_SPANS + 8);
+    DrawRectangleRec(panel, (Color){0, 0, 0, 190});
+
+    int x = (int)panel.x + 8;
+    int y = (int)panel.y + 6;
+    char line[128];
+
+    float fps = stats.avgFrameMs > 0.0f ? 1000.0f / stats.avgFrameMs : 0.0f;
+    static const char *const pathNames[] = {"", "  direct", "  target"};
+    snprintf(line, sizeof(line), "%s  %.0f fps%s", p->name, fps, pathNames[LlzDisplayGetPath()]);
+    DrawText(line, x, y, 16, RAYWHITE);
+    y += 22;
+
+    DrawText("phase     last    avg    max ms", x, y, 12, GRAY);
+    y += rowH;
+    for (int ph = 0; ph < LLZ_PROFILER_PHASE_COUNT; ph++) {
+        snprintf(line, sizeof(line), "%-8s %6.2f %6.2f %6.2f",
+                 g_phaseNames[ph], stats.lastMs[ph], stats.avgMs[ph], stats.maxMs[ph]);
+        DrawText(line, x, y, 12, LIGHTGRAY);
+        y += rowH;
+    }
+    snprintf(line, sizeof(line), "%-8s %6s %6.2f %6.2f", "frame", "", stats.avgFrameMs, stats.maxFrameMs);
+    DrawText(line, x, y, 12, RAYWHITE);
+    y += rowH;
+
+    // Tracked memory against the soft budgets, red once over the hard one
+    LlzResourceStats mem;
+    LlzResourceGetStats(&mem);
+    bool overHard = mem.bytes[LLZ_RESOURCE_GPU] > mem.hard[LLZ_RESOURCE_GPU] ||
+                    mem.bytes[LLZ_RESOURCE_CPU] > mem.hard[LLZ_RESOURCE_CPU];
+    bool overSoft = mem.bytes[LLZ_RESOURCE_GPU] > mem.soft[LLZ_RESOURCE_GPU] ||
+                    mem.bytes[LLZ_RESOURCE_CPU] > mem.soft[LLZ_RESOURCE_CPU];
+    snprintf(line, sizeof(line), "mem gpu %.1f/%zu  cpu %.1f/%zu MB",
+             mem.bytes[LLZ_RESOURCE_GPU] / 1048576.0, mem.soft[LLZ_RESOURCE_GPU] >> 20,
+             mem.bytes[LLZ_RESOURCE_CPU] / 1048576.0, mem.soft[LLZ_RESOURCE_CPU] >> 20);
+    DrawText(line, x, y, 12, overHard ? RED : (overSoft ? YELLOW : LIGHTGRAY));
+    y += rowH + 4;
+
+    // Frame time graph, newest on the right, with a 60 fps budget line
+    int graphH = 40;
+    int graphW = width - 16;
+    int bars = p->count < LLZ_PROFILER_GRAPH_FRAMES ? p->count : LLZ_PROFILER_GRAPH_FRAMES;
+    float barW = (float)graphW / LLZ_PROFILER_GRAPH_FRAMES;
+    for (int i = 0; i < bars; i++) {
+        const LlzProfilerFrame *f = llz_prof_frame_at(p, p->count - bars + i);
+        float ms = f->frameMs < LLZ_PROFILER_GRAPH_MAX_MS ? f->frameMs : LLZ_PROFILER_GRAPH_MAX_MS;
+        int h = (int)(ms / LLZ_PROFILER_GRAPH_MAX_MS * graphH);
+        Color c = f->frameMs > 17.5f ? RED : (f->frameMs > 16.0f ? YELLOW : GREEN);
+        DrawRectangle(x + (int)(i * barW), y + graphH - h, (int)barW > 0 ? (int)barW : 1, h, c);
+    }
+    int budgetY = y + graphH - (int)(16.7f / LLZ_PROFILER_GRAPH_MAX_MS * graphH);
+    DrawLine(x, budgetY, x + graphW, budgetY, (Color){255, 255, 255, 120});
+    y += graphH + 8;
+
+    // Spans over the last second
+    LlzProfilerSpanTotal top[LLZ_PROFILER_TOP_SPANS];
+    uint64_t now = llz_prof_now_us();
+    int n = llz_prof_top_spans(g_profCurrent, now > 1000000ULL ? now - 1000000ULL : 0, top, LLZ_PROFILER_TOP_SPANS);
+    if (n == 0) {
+        DrawText("no spans in the last second", x, y, 12, GRAY);
+    }
+    for (int i = 0; i < n; i++) {
+        snprintf(line, sizeof(line), "%6.2f ms x%-3d %.32s", top[i].totalMs, top[i].count, top[i].name);
+        DrawText(line, x, y, 12, LIGHTGRAY);
+        y += rowH;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Dumps
+// ----------------------------------------------------------------------------
+
+// Span names can be Redis format strings, so quotes and controls are escaped
+static void llz_prof_write_json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fputc('\\', f);
+            fputc(c, f);
+        } else if (c < 0x20) {
+            fprintf(f, "\\u%04x", c);
+        } else {
+            fputc(c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+static void llz_prof_write_csv_field(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"') fputc('"', f);
+        fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+static const char *llz_prof_plugin_name(int slot)
+{
+    return (slot >= 0 && slot < LLZ_PROFILER_MAX_PLUGINS && g_profPlugins[slot].used)
+        ? g_profPlugins[slot].name : "";
+}
+
+bool LlzProfilerDumpCsv(const char *path)
+{
+    if (!path) return false;
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        printf("[PROFILER] Cannot write %s\n", path);
+        return false;
+    }
+
+    fprintf(f, "kind,plugin,name,start_ms,total_ms,input_ms,update_ms,draw_ms,present_ms,gpu_kb,cpu_kb\n");
+    for (int i = 0; i < LLZ_PROFILER_MAX_PLUGINS; i++) {
+        const LlzProfilerPlugin *p = &g_profPlugins[i];
+        if (!p->used) continue;
+        for (int j = 0; j < p->count; j++) {
+            const LlzProfilerFrame *fr = llz_prof_frame_at(p, j);
+            fprintf(f, "frame,");
+            llz_prof_write_csv_field(f, p->name);
+            fprintf(f, ",,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%u,%u\n",
+                    (double)fr->startUs / 1000.0, fr->frameMs,
+                    fr->phaseMs[LLZ_PROFILER_INPUT], fr->phaseMs[LLZ_PROFILER_UPDATE],
+                    fr->phaseMs[LLZ_PROFILER_DRAW], fr->phaseMs[LLZ_PROFILER_PRESENT],
+                    fr->gpuKB, fr->cpuKB);
+        }
+    }
+
+    pthread_mutex_lock(&g_profSpanMutex);
+    for (int i = 0; i < g_profSpanCount; i++) {
+        int idx = (g_profSpanHead - g_profSpanCount + i + LLZ_PROFILER_SPAN_HISTORY) % LLZ_PROFILER_SPAN_HISTORY;
+        const LlzProfilerSpan *s = &g_profSpans[idx];
+        fprintf(f, "span,");
+        llz_prof_write_csv_field(f, llz_prof_plugin_name(s->plugin));
+        fputc(',', f);
+        llz_prof_write_csv_field(f, s->name);
+        fprintf(f, ",%.3f,%.3f,,,,,,\n", (double)s->startUs / 1000.0, (double)s->durationUs / 1000.0);
+    }
+    pthread_mutex_unlock(&g_profSpanMutex);
+
+    fclose(f);
+    return true;
+}
+
+bool LlzProfilerDumpTrace(const char *path)
+{
+    if (!path) return false;
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        printf("[PROFILER] Cannot write %s\n", path);
+        return false;
+    }
+
+    // Host phases on tid 1, SDK/plugin spans on tid 2. Phases are laid out
+    // back to back from the frame start; only their durations are measured.
+    // Tracked memory is a counter track, written when it changes.
+    fprintf(f, "{\"traceEvents\":[\n");
+    fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"frames\"}},\n");
+    fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"spans\"}}");
+
+    uint32_t lastGpuKB = 0, lastCpuKB = 0;
+    for (int i = 0; i < LLZ_PROFILER_MAX_PLUGINS; i++) {
+        const LlzProfilerPlugin *p = &g_profPlugins[i];
+        if (!p->used) continue;
+        for (int j = 0; j < p->count; j++) {
+            const LlzProfilerFrame *fr = llz_prof_frame_at(p, j);
+            fprintf(f, ",\n{\"name\":");
+            llz_prof_write_json_string(f, p->name);
+            fprintf(f, ",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%llu,\"dur\":%.0f}",
+                    (unsigned long long)fr->startUs, fr->frameMs * 1000.0f);
+
+            double ts = (double)fr->startUs;
+            for (int ph = 0; ph < LLZ_PROFILER_PHASE_COUNT; ph++) {
+                if (fr->phaseMs[ph] <= 0.0f) continue;
+                fprintf(f, ",\n{\"name\":\"%s\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                           "\"ts\":%.0f,\"dur\":%.0f}",
+                        g_phaseNames[ph], ts, fr->phaseMs[ph] * 1000.0f);
+                ts += fr->phaseMs[ph] * 1000.0;
+            }
+
+            if (j == 0 || fr->gpuKB != lastGpuKB || fr->cpuKB != lastCpuKB) {
+                fprintf(f, ",\n{\"name\":\"memory\",\"ph\":\"C\",\"pid\":1,\"ts\":%llu,"
+                           "\"args\":{\"gpu_kb\":%u,\"cpu_kb\":%u}}",
+                        (unsigned long long)fr->startUs, fr->gpuKB, fr->cpuKB);
+                lastGpuKB = fr->gpuKB;
+                lastCpuKB = fr->cpuKB;
+            }
+        }
+    }
+
+    pthread_mutex_lock(&g_profSpanMutex);
+    for (int i = 0; i < g_profSpanCount; i++) {
+        int idx = (g_profSpanHead - g_profSpanCount + i + LLZ_PROFILER_SPAN_HISTORY) % LLZ_PROFILER_SPAN_HISTORY;
+        const LlzProfilerSpan *s = &g_profSpans[idx];
+        fprintf(f, ",\n{\"name\":");
+        llz_prof_write_json_string(f, s->name);
+        fprintf(f, ",\"cat\":\"span\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":%llu,\"dur\":%u,\"args\":{\"plugin\":",
+                (unsigned long long)s->startUs, s->durationUs);
+        llz_prof_write_json_string(f, llz_prof_plugin_name(s->plugin));
+        fprintf(f, "}}");
+    }
+    pthread_mutex_unlock(&g_profSpanMutex);
+
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    return true;
+}
+
+bool LlzProfilerDump(void)
+{
+    char csvPath[320];
+    char tracePath[320];
+    long long stamp = (long long)time(NULL);
+    snprintf(csvPath, sizeof(csvPath), "%s/llz_profile_%lld.csv", g_profDir, stamp);
+    snprintf(tracePath, sizeof(tracePath), "%s/llz_profile_%lld.json", g_profDir, stamp);
+
+    bool ok = LlzProfilerDumpCsv(csvPath) && LlzProfilerDumpTrace(tracePath);
+    if (ok) printf("[PROFILER] Wrote %s and %s\n", csvPath, tracePath);
+    return ok;
+}
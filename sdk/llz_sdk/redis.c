@@ -0,0 +1,399 @@
+#include "llz_sdk_redis.h"
+#include "llz_sdk_profiler.h"
+#include "redis_internal.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#define LLZ_REDIS_TIMEOUT_SEC 1
+#define LLZ_REDIS_TIMEOUT_USEC 500000
+#define LLZ_REDIS_RTT_SMOOTHING 0.1f
+
+// RTT histogram for percentiles: quarter-octave buckets starting at 10 us,
+// so bucket 63 is ~650 ms and each estimate is within ~19%.
+#define LLZ_REDIS_RTT_BUCKETS 64
+#define LLZ_REDIS_RTT_BUCKET_BASE_MS 0.01
+#define LLZ_REDIS_RTT_BUCKETS_PER_OCTAVE 4
+
+// Target and statistics are shared with worker threads; guarded by g_redisMutex
+static pthread_mutex_t g_redisMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_redisCond = PTHREAD_COND_INITIALIZER;
+static char g_redisHost[LLZ_REDIS_HOST_MAX] = LLZ_REDIS_DEFAULT_HOST;
+static int g_redisPort = LLZ_REDIS_DEFAULT_PORT;
+static uint32_t g_redisGeneration = 0;   // Bumped on reconfigure so stale reconnects are discarded
+static LlzRedisStats g_stats;
+static uint32_t g_rttHistogram[LLZ_REDIS_RTT_BUCKETS];
+static double g_statsSinceMs = 0.0;      // Start of the commandsPerSec window
+
+// Reconnect scheduling (guarded by g_redisMutex)
+static redisContext *g_readyCtx = NULL;  // Connected by the background thread, not yet adopted
+static bool g_reconnectWanted = false;
+static int g_backoffMs = 0;
+static double g_nextAttemptMs = 0.0;
+static bool g_reconnectThreadRunning = false;
+static pthread_t g_reconnectThread;
+
+// Shared UI-thread context (only touched by the UI thread)
+static redisContext *g_sharedCtx = NULL;
+
+double llz_redis_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+static redisContext *llz_redis_open_target(const char *host, int port)
+{
+    struct timeval timeout;
+    timeout.tv_sec = LLZ_REDIS_TIMEOUT_SEC;
+    timeout.tv_usec = LLZ_REDIS_TIMEOUT_USEC;
+
+    redisContext *ctx = redisConnectWithTimeout(host, port, timeout);
+    if (!ctx || ctx->err) {
+        if (ctx) redisFree(ctx);
+        return NULL;
+    }
+
+    redisSetTimeout(ctx, timeout);
+    return ctx;
+}
+
+redisContext *llz_redis_open(void)
+{
+    char host[LLZ_REDIS_HOST_MAX];
+    pthread_mutex_lock(&g_redisMutex);
+    memcpy(host, g_redisHost, sizeof(host));
+    int port = g_redisPort;
+    pthread_mutex_unlock(&g_redisMutex);
+
+    return llz_redis_open_target(host, port);
+}
+
+static int llz_redis_rtt_bucket(double ms)
+{
+    if (ms <= LLZ_REDIS_RTT_BUCKET_BASE_MS) return 0;
+    int bucket = (int)ceil(log2(ms / LLZ_REDIS_RTT_BUCKET_BASE_MS) * LLZ_REDIS_RTT_BUCKETS_PER_OCTAVE);
+    return bucket < LLZ_REDIS_RTT_BUCKETS ? bucket : LLZ_REDIS_RTT_BUCKETS - 1;
+}
+
+// Upper edge of the bucket holding the given fraction of samples.
+// Caller must hold g_redisMutex.
+static float llz_redis_rtt_percentile_locked(double fraction)
+{
+    uint64_t total = 0;
+    for (int i = 0; i < LLZ_REDIS_RTT_BUCKETS; i++) total += g_rttHistogram[i];
+    if (total == 0) return 0.0f;
+
+    uint64_t target = (uint64_t)ceil((double)total * fraction);
+    uint64_t seen = 0;
+    for (int i = 0; i < LLZ_REDIS_RTT_BUCKETS; i++) {
+        seen += g_rttHistogram[i];
+        if (seen >= target) {
+            double edge = LLZ_REDIS_RTT_BUCKET_BASE_MS * exp2((double)i / LLZ_REDIS_RTT_BUCKETS_PER_OCTAVE);
+            // The estimate never exceeds what was actually observed
+            return edge < g_stats.maxRttMs ? (float)edge : g_stats.maxRttMs;
+        }
+    }
+    return g_stats.maxRttMs;
+}
+
+void llz_redis_record_rtt(double ms, bool ok)
+{
+    pthread_mutex_lock(&g_redisMutex);
+    if (g_statsSinceMs == 0.0) g_statsSinceMs = llz_redis_now_ms();
+    g_stats.commands++;
+    if (!ok) {
+        g_stats.errors++;
+    } else {
+        float rtt = (float)ms;
+        g_stats.lastRttMs = rtt;
+        g_stats.avgRttMs = (g_stats.avgRttMs == 0.0f)
+            ? rtt
+            : g_stats.avgRttMs + (rtt - g_stats.avgRttMs) * LLZ_REDIS_RTT_SMOOTHING;
+        if (rtt > g_stats.maxRttMs) g_stats.maxRttMs = rtt;
+        g_rttHistogram[llz_redis_rtt_bucket(ms)]++;
+    }
+    pthread_mutex_unlock(&g_redisMutex);
+}
+
+static uint64_t llz_redis_reply_bytes(const redisReply *reply)
+{
+    if (!reply) return 0;
+    uint64_t bytes = (reply->type == REDIS_REPLY_STRING || reply->type == REDIS_REPLY_STATUS ||
+                      reply->type == REDIS_REPLY_ERROR) ? (uint64_t)reply->len : 0;
+    if (reply->type == REDIS_REPLY_ARRAY) {
+        for (size_t i = 0; i < reply->elements; i++) bytes += llz_redis_reply_bytes(reply->element[i]);
+    }
+    return bytes;
+}
+
+void llz_redis_record_reply(const redisReply *reply)
+{
+    uint64_t bytes = llz_redis_reply_bytes(reply);
+    if (bytes == 0) return;
+    pthread_mutex_lock(&g_redisMutex);
+    g_stats.bytesReceived += bytes;
+    pthread_mutex_unlock(&g_redisMutex);
+}
+
+// Caller must hold g_redisMutex
+static void llz_redis_mark_connected_locked(void)
+{
+    if (g_stats.health == LLZ_REDIS_RECONNECTING) g_stats.reconnects++;
+    g_stats.health = LLZ_REDIS_CONNECTED;
+    g_stats.failedAttempts = 0;
+    g_stats.connectedSince = (int64_t)time(NULL);
+    g_backoffMs = 0;
+    g_reconnectWanted = false;
+}
+
+// Caller must hold g_redisMutex
+static void llz_redis_schedule_retry_locked(void)
+{
+    g_backoffMs = (g_backoffMs == 0) ? LLZ_REDIS_BACKOFF_MIN_MS : g_backoffMs * 2;
+    if (g_backoffMs > LLZ_REDIS_BACKOFF_MAX_MS) g_backoffMs = LLZ_REDIS_BACKOFF_MAX_MS;
+    g_nextAttemptMs = llz_redis_now_ms() + g_backoffMs;
+}
+
+static void *llz_redis_reconnect_thread(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&g_redisMutex);
+    for (;;) {
+        while (!g_reconnectWanted || g_readyCtx) {
+            pthread_cond_wait(&g_redisCond, &g_redisMutex);
+        }
+
+        double waitMs = g_nextAttemptMs - llz_redis_now_ms();
+        if (waitMs > 0.0) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            long long ns = (long long)deadline.tv_nsec + (long long)(waitMs * 1000000.0);
+            deadline.tv_sec += (time_t)(ns / 1000000000LL);
+            deadline.tv_nsec = (long)(ns % 1000000000LL);
+            pthread_cond_timedwait(&g_redisCond, &g_redisMutex, &deadline);
+            continue;  // Re-check: reconfigure or RequestReconnect may have changed things
+        }
+
+        char host[LLZ_REDIS_HOST_MAX];
+        memcpy(host, g_redisHost, sizeof(host));
+        int port = g_redisPort;
+        uint32_t generation = g_redisGeneration;
+        pthread_mutex_unlock(&g_redisMutex);
+
+        redisContext *ctx = llz_redis_open_target(host, port);
+
+        pthread_mutex_lock(&g_redisMutex);
+        if (generation != g_redisGeneration) {
+            if (ctx) redisFree(ctx);
+            continue;
+        }
+        if (ctx) {
+            g_readyCtx = ctx;
+            g_reconnectWanted = false;
+        } else {
+            g_stats.failedAttempts++;
+            llz_redis_schedule_retry_locked();
+        }
+    }
+    pthread_mutex_unlock(&g_redisMutex);
+    return NULL;
+}
+
+// Caller must hold g_redisMutex
+static void llz_redis_request_reconnect_locked(bool immediate)
+{
+    if (!g_reconnectWanted) {
+        g_reconnectWanted = true;
+        if (immediate) g_nextAttemptMs = 0.0;
+    }
+    if (!g_reconnectThreadRunning) {
+        if (pthread_create(&g_reconnectThread, NULL, llz_redis_reconnect_thread, NULL) == 0) {
+            pthread_detach(g_reconnectThread);
+            g_reconnectThreadRunning = true;
+        } else {
+            printf("[REDIS] Failed to start reconnect thread\n");
+        }
+    }
+    pthread_cond_signal(&g_redisCond);
+}
+
+// Only the very first connection is made inline; after a drop the
+// background thread owns reconnecting so callers never stall.
+static void llz_redis_connect_inline(void)
+{
+    redisContext *ctx = llz_redis_open();
+
+    pthread_mutex_lock(&g_redisMutex);
+    if (ctx) {
+        g_sharedCtx = ctx;
+        llz_redis_mark_connected_locked();
+    } else {
+        g_stats.failedAttempts++;
+        g_stats.health = LLZ_REDIS_RECONNECTING;
+        llz_redis_schedule_retry_locked();
+        llz_redis_request_reconnect_locked(false);
+        printf("[REDIS] Could not connect to %s:%d, retrying in background\n", g_redisHost, g_redisPort);
+    }
+    pthread_mutex_unlock(&g_redisMutex);
+}
+
+redisContext *llz_redis_acquire(void)
+{
+    if (g_sharedCtx) return g_sharedCtx;
+
+    bool firstAttempt = false;
+    pthread_mutex_lock(&g_redisMutex);
+    if (g_readyCtx) {
+        g_sharedCtx = g_readyCtx;
+        g_readyCtx = NULL;
+        llz_redis_mark_connected_locked();
+        printf("[REDIS] Connected to %s:%d\n", g_redisHost, g_redisPort);
+    } else if (g_stats.health == LLZ_REDIS_DISCONNECTED && !g_reconnectWanted) {
+        firstAttempt = true;
+    } else {
+        g_stats.failFast++;
+        llz_redis_request_reconnect_locked(false);
+    }
+    pthread_mutex_unlock(&g_redisMutex);
+
+    if (firstAttempt) llz_redis_connect_inline();
+    return g_sharedCtx;
+}
+
+void llz_redis_fail(void)
+{
+    if (g_sharedCtx) {
+        redisFree(g_sharedCtx);
+        g_sharedCtx = NULL;
+    }
+
+    pthread_mutex_lock(&g_redisMutex);
+    if (g_stats.health == LLZ_REDIS_CONNECTED) {
+        printf("[REDIS] Connection to %s:%d lost, reconnecting in background\n", g_redisHost, g_redisPort);
+    }
+    g_stats.health = LLZ_REDIS_RECONNECTING;
+    g_stats.connectedSince = 0;
+    // First retry right away (covers a plain server restart), then back off
+    llz_redis_request_reconnect_locked(g_backoffMs == 0);
+    pthread_mutex_unlock(&g_redisMutex);
+}
+
+redisReply *llz_redis_vcommand(const char *format, va_list args)
+{
+    redisContext *ctx = llz_redis_acquire();
+    if (!ctx) return NULL;
+
+    // Spans are named by the command format ("GET %s", ...)
+    uint64_t span = LlzProfilerSpanBegin();
+    double start = llz_redis_now_ms();
+    redisReply *reply = redisvCommand(ctx, format, args);
+    llz_redis_record_rtt(llz_redis_now_ms() - start, reply != NULL);
+    LlzProfilerSpanEnd(format, span);
+    llz_redis_record_reply(reply);
+
+    if (!reply) llz_redis_fail();
+    return reply;
+}
+
+void LlzRedisConfigure(const char *host, int port)
+{
+    const char *newHost = (host && host[0] != '\0') ? host : LLZ_REDIS_DEFAULT_HOST;
+    int newPort = port > 0 ? port : LLZ_REDIS_DEFAULT_PORT;
+
+    pthread_mutex_lock(&g_redisMutex);
+    bool changed = strcmp(g_redisHost, newHost) != 0 || g_redisPort != newPort;
+    if (changed) {
+        strncpy(g_redisHost, newHost, sizeof(g_redisHost) - 1);
+        g_redisHost[sizeof(g_redisHost) - 1] = '\0';
+        g_redisPort = newPort;
+        g_redisGeneration++;
+        if (g_readyCtx) {
+            redisFree(g_readyCtx);
+            g_readyCtx = NULL;
+        }
+        g_reconnectWanted = false;
+        g_backoffMs = 0;
+        g_stats.health = LLZ_REDIS_DISCONNECTED;
+        g_stats.failedAttempts = 0;
+        g_stats.connectedSince = 0;
+    }
+    pthread_mutex_unlock(&g_redisMutex);
+
+    if (changed && g_sharedCtx) {
+        redisFree(g_sharedCtx);
+        g_sharedCtx = NULL;
+    }
+}
+
+bool LlzRedisConnect(void)
+{
+    return llz_redis_acquire() != NULL;
+}
+
+LlzRedisHealth LlzRedisGetHealth(void)
+{
+    pthread_mutex_lock(&g_redisMutex);
+    LlzRedisHealth health = g_stats.health;
+    pthread_mutex_unlock(&g_redisMutex);
+    return health;
+}
+
+bool LlzRedisIsConnected(void)
+{
+    return LlzRedisGetHealth() == LLZ_REDIS_CONNECTED;
+}
+
+void LlzRedisGetStats(LlzRedisStats *outStats)
+{
+    if (!outStats) return;
+
+    pthread_mutex_lock(&g_redisMutex);
+    *outStats = g_stats;
+    memcpy(outStats->host, g_redisHost, sizeof(outStats->host));
+    outStats->port = g_redisPort;
+    outStats->p50RttMs = llz_redis_rtt_percentile_locked(0.50);
+    outStats->p99RttMs = llz_redis_rtt_percentile_locked(0.99);
+    double elapsedMs = g_statsSinceMs > 0.0 ? llz_redis_now_ms() - g_statsSinceMs : 0.0;
+    outStats->commandsPerSec = elapsedMs >= 1000.0 ? (float)(g_stats.commands * 1000.0 / elapsedMs) : 0.0f;
+    outStats->retryInMs = 0;
+    if (g_reconnectWanted) {
+        double remaining = g_nextAttemptMs - llz_redis_now_ms();
+        outStats->retryInMs = remaining > 0.0 ? (int)remaining : 0;
+    }
+    pthread_mutex_unlock(&g_redisMutex);
+}
+
+void LlzRedisResetStats(void)
+{
+    pthread_mutex_lock(&g_redisMutex);
+    g_stats.reconnects = 0;
+    g_stats.commands = 0;
+    g_stats.errors = 0;
+    g_stats.failFast = 0;
+    g_stats.lastRttMs = 0.0f;
+    g_stats.avgRttMs = 0.0f;
+    g_stats.maxRttMs = 0.0f;
+    g_stats.bytesReceived = 0;
+    memset(g_rttHistogram, 0, sizeof(g_rttHistogram));
+    g_statsSinceMs = 0.0;
+    pthread_mutex_unlock(&g_redisMutex);
+}
+
+void LlzRedisRequestReconnect(void)
+{
+    if (g_sharedCtx) return;
+
+    pthread_mutex_lock(&g_redisMutex);
+    g_backoffMs = 0;
+    g_nextAttemptMs = 0.0;
+    llz_redis_request_reconnect_locked(true);
+    pthread_mutex_unlock(&g_redisMutex);
+}
@@ -0,0 +1,35 @@
+#ifndef LLZ_REDIS_INTERNAL_H
+#define LLZ_REDIS_INTERNAL_H
+
+// SDK-internal access to the Redis connection manager (not installed for plugins)
+
+#include "llz_sdk_redis.h"
+#include "hiredis.h"
+
+#include <stdarg.h>
+
+// Shared UI-thread context, or NULL while disconnected (never blocks).
+redisContext *llz_redis_acquire(void);
+
+// Report that the shared context broke; it is freed and a background
+// reconnect is scheduled.
+void llz_redis_fail(void);
+
+// Run a command on the shared context with RTT accounting.
+// Returns NULL immediately while disconnected.
+redisReply *llz_redis_vcommand(const char *format, va_list args);
+
+// Open a private blocking context to the configured target (for worker
+// threads). Returns NULL on failure.
+redisContext *llz_redis_open(void);
+
+// Record a round trip measured outside llz_redis_vcommand
+void llz_redis_record_rtt(double ms, bool ok);
+
+// Count the payload bytes of a reply read outside llz_redis_vcommand
+void llz_redis_record_reply(const redisReply *reply);
+
+// Monotonic clock in milliseconds (fractional), for RTT measurement
+double llz_redis_now_ms(void);
+
+#endif // LLZ_REDIS_INTERNAL_H
@@ -0,0 +1,379 @@
+#include "llz_sdk_resource.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// After a pass that could not get under the soft budget, wait this long
+// before asking the evictors again
+#define LLZ_RESOURCE_RETRY_SECONDS 0.5
+
+typedef struct {
+    bool used;
+    LlzResourceKind kind;
+    uintptr_t key;
+    int owner;
+    size_t bytes;
+} LlzResourceEntry;
+
+typedef struct {
+    char name[LLZ_RESOURCE_NAME_MAX];
+    bool plugin;                      // Registered by LlzResourceSetActivePlugin
+    size_t bytes[LLZ_RESOURCE_DOMAIN_COUNT];
+    int resources;
+} LlzResourceOwnerSlot;
+
+typedef struct {
+    LlzResourceEvictCallback callback;
+    void *user;
+} LlzResourceEvictor;
+
+static pthread_mutex_t g_resourceMutex = PTHREAD_MUTEX_INITIALIZER;
+static LlzResourceEntry g_resourceEntries[LLZ_RESOURCE_MAX_ENTRIES];
+static int g_resourceEntryCount = 0;         // High-water mark of used slots
+static LlzResourceOwnerSlot g_resourceOwners[LLZ_RESOURCE_MAX_OWNERS];
+static int g_resourceOwnerCount = 0;
+static int g_resourceActive = -1;            // Running plugin, -1 at the menu
+static LlzResourceEvictor g_resourceEvictors[LLZ_RESOURCE_MAX_EVICTORS];
+static int g_resourceEvictorCount = 0;
+
+static size_t g_resourceBytes[LLZ_RESOURCE_DOMAIN_COUNT];
+static size_t g_resourcePeak[LLZ_RESOURCE_DOMAIN_COUNT];
+static size_t g_resourceKindBytes[LLZ_RESOURCE_KIND_COUNT];
+static size_t g_resourceSoft[LLZ_RESOURCE_DOMAIN_COUNT] = {
+    LLZ_RESOURCE_GPU_SOFT_DEFAULT, LLZ_RESOURCE_CPU_SOFT_DEFAULT
+};
+static size_t g_resourceHard[LLZ_RESOURCE_DOMAIN_COUNT] = {
+    LLZ_RESOURCE_GPU_HARD_DEFAULT, LLZ_RESOURCE_CPU_HARD_DEFAULT
+};
+static bool g_resourceOverHard[LLZ_RESOURCE_DOMAIN_COUNT];
+static double g_resourceRetryAt[LLZ_RESOURCE_DOMAIN_COUNT];
+static int g_resourceCount = 0;
+static unsigned long g_resourceEvictionRuns = 0;
+static size_t g_resourceEvicted = 0;
+
+static const char *g_resourceDomainNames[LLZ_RESOURCE_DOMAIN_COUNT] = { "GPU", "CPU" };
+
+static LlzResourceDomain llz_resource_domain(LlzResourceKind kind)
+{
+    return (kind == LLZ_RESOURCE_IMAGE || kind == LLZ_RESOURCE_BUFFER) ? LLZ_RESOURCE_CPU
+                                                                        : LLZ_RESOURCE_GPU;
+}
+
+// Caller holds g_resourceMutex
+static int llz_resource_owner_locked(const char *name, bool plugin)
+{
+    for (int i = 0; i < g_resourceOwnerCount; i++) {
+        if (strcmp(g_resourceOwners[i].name, name) == 0) {
+            if (plugin) g_resourceOwners[i].plugin = true;
+            return i;
+        }
+    }
+    if (g_resourceOwnerCount >= LLZ_RESOURCE_MAX_OWNERS) return -1;
+
+    LlzResourceOwnerSlot *owner = &g_resourceOwners[g_resourceOwnerCount];
+    memset(owner, 0, sizeof(*owner));
+    strncpy(owner->name, name, sizeof(owner->name) - 1);
+    owner->plugin = plugin;
+    return g_resourceOwnerCount++;
+}
+
+// Caller holds g_resourceMutex
+static int llz_resource_current_locked(void)
+{
+    if (g_resourceActive >= 0) return g_resourceActive;
+    return llz_resource_owner_locked(LLZ_RESOURCE_MENU_OWNER, false);
+}
+
+static LlzResourceEntry *llz_resource_find_locked(LlzResourceKind kind, uintptr_t key)
+{
+    for (int i = 0; i < g_resourceEntryCount; i++) {
+        LlzResourceEntry *entry = &g_resourceEntries[i];
+        if (entry->used && entry->kind == kind && entry->key == key) return entry;
+    }
+    return NULL;
+}
+
+static void llz_resource_charge_locked(const LlzResourceEntry *entry, bool add)
+{
+    LlzResourceDomain domain = llz_resource_domain(entry->kind);
+    LlzResourceOwnerSlot *owner = (entry->owner >= 0) ? &g_resourceOwners[entry->owner] : NULL;
+
+    if (add) {
+        g_resourceBytes[domain] += entry->bytes;
+        g_resourceKindBytes[entry->kind] += entry->bytes;
+        g_resourceCount++;
+        if (owner) {
+            owner->bytes[domain] += entry->bytes;
+            owner->resources++;
+        }
+        if (g_resourceBytes[domain] > g_resourcePeak[domain]) g_resourcePeak[domain] = g_resourceBytes[domain];
+    } else {
+        g_resourceBytes[domain] -= entry->bytes;
+        g_resourceKindBytes[entry->kind] -= entry->bytes;
+        g_resourceCount--;
+        if (owner) {
+            owner->bytes[domain] -= entry->bytes;
+            owner->resources--;
+        }
+    }
+}
+
+// "soft" or "soft:hard" in MB; a missing hard budget is 1.5x the soft one
+static void llz_resource_budget_from_env(LlzResourceDomain domain, const char *var)
+{
+    const char *value = getenv(var);
+    if (!value || value[0] == '\0') return;
+
+    char *end = NULL;
+    long soft = strtol(value, &end, 10);
+    long hard = soft + soft / 2;
+    if (end && *end == ':') hard = strtol(end + 1, NULL, 10);
+    if (soft <= 0 || hard < soft) {
+        printf("[RESOURCE] Ignoring %s=%s (expected soft[:hard] in MB)\n", var, value);
+        return;
+    }
+    LlzResourceSetBudget(domain, (size_t)soft * 1024u * 1024u, (size_t)hard * 1024u * 1024u);
+}
+
+void LlzResourceInit(void)
+{
+    llz_resource_budget_from_env(LLZ_RESOURCE_GPU, "LLZ_RESOURCE_GPU_MB");
+    llz_resource_budget_from_env(LLZ_RESOURCE_CPU, "LLZ_RESOURCE_CPU_MB");
+    printf("[RESOURCE] Budgets: GPU %zu/%zu MB, CPU %zu/%zu MB (soft/hard)\n",
+           g_resourceSoft[LLZ_RESOURCE_GPU] >> 20, g_resourceHard[LLZ_RESOURCE_GPU] >> 20,
+           g_resourceSoft[LLZ_RESOURCE_CPU] >> 20, g_resourceHard[LLZ_RESOURCE_CPU] >> 20);
+}
+
+void LlzResourceSetActivePlugin(const char *name)
+{
+    pthread_mutex_lock(&g_resourceMutex);
+    g_resourceActive = (name && name[0] != '\0') ? llz_resource_owner_locked(name, true) : -1;
+    pthread_mutex_unlock(&g_resourceMutex);
+}
+
+void LlzResourceTrack(const char *owner, LlzResourceKind kind, uintptr_t key, size_t bytes)
+{
+    if (kind < 0 || kind >= LLZ_RESOURCE_KIND_COUNT || key == 0) return;
+
+    pthread_mutex_lock(&g_resourceMutex);
+    LlzResourceEntry *entry = llz_resource_find_locked(kind, key);
+    int ownerIndex;
+    if (entry) {
+        llz_resource_charge_locked(entry, false);
+        ownerIndex = owner ? llz_resource_owner_locked(owner, false) : entry->owner;
+    } else {
+        for (int i = 0; i < LLZ_RESOURCE_MAX_ENTRIES && !entry; i++) {
+            if (!g_resourceEntries[i].used) entry = &g_resourceEntries[i];
+        }
+        if (!entry) {
+            pthread_mutex_unlock(&g_resourceMutex);
+            printf("[RESOURCE] Registry full, resource not tracked\n");
+            return;
+        }
+        int index = (int)(entry - g_resourceEntries);
+        if (index >= g_resourceEntryCount) g_resourceEntryCount = index + 1;
+        ownerIndex = owner ? llz_resource_owner_locked(owner, false) : llz_resource_current_locked();
+    }
+
+    entry->used = true;
+    entry->kind = kind;
+    entry->key = key;
+    entry->owner = ownerIndex;
+    entry->bytes = bytes;
+    llz_resource_charge_locked(entry, true);
+    pthread_mutex_unlock(&g_resourceMutex);
+}
+
+void LlzResourceUntrack(LlzResourceKind kind, uintptr_t key)
+{
+    pthread_mutex_lock(&g_resourceMutex);
+    LlzResourceEntry *entry = llz_resource_find_locked(kind, key);
+    if (entry) {
+        llz_resource_charge_locked(entry, false);
+        entry->used = false;
+        while (g_resourceEntryCount > 0 && !g_resourceEntries[g_resourceEntryCount - 1].used) {
+            g_resourceEntryCount--;
+        }
+    }
+    pthread_mutex_unlock(&g_resourceMutex);
+}
+
+LlzResourceOwner LlzResourceGetOwner(const char *name)
+{
+    pthread_mutex_lock(&g_resourceMutex);
+    int owner = name ? llz_resource_owner_locked(name, false) : llz_resource_current_locked();
+    pthread_mutex_unlock(&g_resourceMutex);
+    return owner;
+}
+
+bool LlzResourceOwnerIsLive(LlzResourceOwner owner)
+{
+    pthread_mutex_lock(&g_resourceMutex);
+    bool live = owner >= 0 && owner < g_resourceOwnerCount &&
+                (!g_resourceOwners[owner].plugin || owner == g_resourceActive);
+    pthread_mutex_unlock(&g_resourceMutex);
+    return live;
+}
+
+bool LlzResourceRegisterEvictor(LlzResourceEvictCallback callback, void *user)
+{
+    if (!callback || g_resourceEvictorCount >= LLZ_RESOURCE_MAX_EVICTORS) return false;
+    g_resourceEvictors[g_resourceEvictorCount].callback = callback;
+    g_resourceEvictors[g_resourceEvictorCount].user = user;
+    g_resourceEvictorCount++;
+    return true;
+}
+
+void LlzResourceUnregisterEvictor(LlzResourceEvictCallback callback, void *user)
+{
+    for (int i = 0; i < g_resourceEvictorCount; i++) {
+        if (g_resourceEvictors[i].callback == callback && g_resourceEvictors[i].user == user) {
+            memmove(&g_resourceEvictors[i], &g_resourceEvictors[i + 1],
+                    (size_t)(g_resourceEvictorCount - i - 1) * sizeof(g_resourceEvictors[0]));
+            g_resourceEvictorCount--;
+            return;
+        }
+    }
+}
+
+void LlzResourceUpdate(void)
+{
+    double now = GetTime();
+
+    for (int d = 0; d < LLZ_RESOURCE_DOMAIN_COUNT; d++) {
+        pthread_mutex_lock(&g_resourceMutex);
+        size_t bytes = g_resourceBytes[d];
+        size_t soft = g_resourceSoft[d];
+        size_t hard = g_resourceHard[d];
+        pthread_mutex_unlock(&g_resourceMutex);
+
+        bool overHard = bytes > hard;
+        if (overHard && !g_resourceOverHard[d]) {
+            printf("[RESOURCE] %s memory %zu KB is over the hard budget (%zu KB)\n",
+                   g_resourceDomainNames[d], bytes / 1024, hard / 1024);
+        }
+        g_resourceOverHard[d] = overHard;
+        if (bytes <= soft || now < g_resourceRetryAt[d]) continue;
+
+        // Evictors run in registration order, so the ones that only drop
+        // references to shared art come before the art cache that frees it
+        size_t need = bytes - soft;
+        size_t freed = 0;
+        g_resourceEvictionRuns++;
+        for (int i = 0; i < g_resourceEvictorCount && freed < need; i++) {
+            freed += g_resourceEvictors[i].callback((LlzResourceDomain)d, need - freed, overHard,
+                                                    g_resourceEvictors[i].user);
+        }
+        g_resourceEvicted += freed;
+        g_resourceRetryAt[d] = (freed < need) ? now + LLZ_RESOURCE_RETRY_SECONDS : 0.0;
+    }
+}
+
+void LlzResourceSetBudget(LlzResourceDomain domain, size_t softBytes, size_t hardBytes)
+{
+    if (domain < 0 || domain >= LLZ_RESOURCE_DOMAIN_COUNT) return;
+    if (hardBytes < softBytes) hardBytes = softBytes;
+    pthread_mutex_lock(&g_resourceMutex);
+    g_resourceSoft[domain] = softBytes;
+    g_resourceHard[domain] = hardBytes;
+    g_resourceRetryAt[domain] = 0.0;
+    pthread_mutex_unlock(&g_resourceMutex);
+}
+
+void LlzResourceGetStats(LlzResourceStats *outStats)
+{
+    if (!outStats) return;
+    pthread_mutex_lock(&g_resourceMutex);
+    memcpy(outStats->bytes, g_resourceBytes, sizeof(outStats->bytes));
+    memcpy(outStats->peak, g_resourcePeak, sizeof(outStats->peak));
+    memcpy(outStats->soft, g_resourceSoft, sizeof(outStats->soft));
+    memcpy(outStats->hard, g_resourceHard, sizeof(outStats->hard));
+    memcpy(outStats->kindBytes, g_resourceKindBytes, sizeof(outStats->kindBytes));
+    outStats->resources = g_resourceCount;
+    outStats->evictionRuns = g_resourceEvictionRuns;
+    outStats->evictedBytes = g_resourceEvicted;
+    pthread_mutex_unlock(&g_resourceMutex);
+}
+
+static int llz_resource_by_bytes(const void *a, const void *b)
+{
+    const LlzResourceOwnerStats *oa = (const LlzResourceOwnerStats *)a;
+    const LlzResourceOwnerStats *ob = (const LlzResourceOwnerStats *)b;
+    size_t ta = oa->bytes[LLZ_RESOURCE_GPU] + oa->bytes[LLZ_RESOURCE_CPU];
+    size_t tb = ob->bytes[LLZ_RESOURCE_GPU] + ob->bytes[LLZ_RESOURCE_CPU];
+    if (ta != tb) return (ta < tb) ? 1 : -1;
+    return strcmp(oa->name, ob->name);
+}
+
+int LlzResourceGetOwners(LlzResourceOwnerStats *outOwners, int maxOwners)
+{
+    if (!outOwners || maxOwners <= 0) return 0;
+
+    LlzResourceOwnerStats all[LLZ_RESOURCE_MAX_OWNERS];
+    int count = 0;
+    pthread_mutex_lock(&g_resourceMutex);
+    for (int i = 0; i < g_resourceOwnerCount; i++) {
+        const LlzResourceOwnerSlot *owner = &g_resourceOwners[i];
+        if (owner->resources == 0) continue;
+        LlzResourceOwnerStats *out = &all[count++];
+        memcpy(out->name, owner->name, sizeof(out->name));
+        memcpy(out->bytes, owner->bytes, sizeof(out->bytes));
+        out->resources = owner->resources;
+        out->live = !owner->plugin || i == g_resourceActive;
+    }
+    pthread_mutex_unlock(&g_resourceMutex);
+
+    qsort(all, (size_t)count, sizeof(all[0]), llz_resource_by_bytes);
+    if (count > maxOwners) count = maxOwners;
+    memcpy(outOwners, all, (size_t)count * sizeof(all[0]));
+    return count;
+}
+
+size_t LlzResourceTextureBytes(Texture2D texture)
+{
+    if (texture.id == 0 || texture.width <= 0 || texture.height <= 0) return 0;
+
+    size_t bytes = 0;
+    int width = texture.width;
+    int height = texture.height;
+    int mipmaps = texture.mipmaps > 0 ? texture.mipmaps : 1;
+    for (int i = 0; i < mipmaps; i++) {
+        bytes += (size_t)GetPixelDataSize(width, height, texture.format);
+        if (width > 1) width /= 2;
+        if (height > 1) height /= 2;
+    }
+    return bytes;
+}
+
+size_t LlzResourceImageBytes(Image image)
+{
+    if (image.data == NULL || image.width <= 0 || image.height <= 0) return 0;
+    return (size_t)GetPixelDataSize(image.width, image.height, image.format);
+}
+
+static size_t llz_resource_glyph_bytes(Font font)
+{
+    size_t bytes = (size_t)font.glyphCount * (sizeof(GlyphInfo) + sizeof(Rectangle));
+    for (int i = 0; font.glyphs && i < font.glyphCount; i++) {
+        bytes += LlzResourceImageBytes(font.glyphs[i].image);
+    }
+    return bytes;
+}
+
+void LlzResourceTrackFont(const char *owner, Font font)
+{
+    if (font.texture.id == 0 || font.texture.id == GetFontDefault().texture.id) return;
+    LlzResourceTrack(owner, LLZ_RESOURCE_FONT, font.texture.id, LlzResourceTextureBytes(font.texture));
+    if (font.glyphs) {
+        LlzResourceTrack(owner, LLZ_RESOURCE_BUFFER, (uintptr_t)font.glyphs, llz_resource_glyph_bytes(font));
+    }
+}
+
+void LlzResourceUntrackFont(Font font)
+{
+    if (font.texture.id == 0) return;
+    LlzResourceUntrack(LLZ_RESOURCE_FONT, font.texture.id);
+    if (font.glyphs) LlzResourceUntrack(LLZ_RESOURCE_BUFFER, (uintptr_t)font.glyphs);
+}
@@ -28,6 +28,8 @@ static LlzMediaState g_prevMedia;
 static LlzConnectionStatus g_prevConnection;
 static bool g_prevMediaValid = false;
 static bool g_prevConnectionValid = false;
+static uint32_t g_prevStateSeq = 0;
+static bool g_prevStateSeqValid = false;
 
 // Notification queue for programmatic notifications
 #define MAX_PENDING_NOTIFICATIONS 16
@@ -55,6 +57,7 @@ static void llz_sub_init(void)
     g_nextId = 1;
     g_prevMediaValid = false;
     g_prevConnectionValid = false;
+    g_prevStateSeqValid = false;
     g_notificationHead = 0;
     g_notificationTail = 0;
     g_initialized = true;
@@ -144,6 +147,11 @@ LlzSubscriptionId LlzSubscribeNotification(LlzNotificationCallback callback, voi
     return llz_sub_add(LLZ_EVENT_NOTIFICATION, (void *)callback, userData);
 }
 
+LlzSubscriptionId LlzSubscribeCommandStatus(LlzCommandStatusCallback callback, void *userData)
+{
+    return llz_sub_add(LLZ_EVENT_COMMAND_STATUS, (void *)callback, userData);
+}
+
 void LlzUnsubscribe(LlzSubscriptionId id)
 {
     llz_sub_remove(id);
@@ -296,6 +304,38 @@ static bool llz_track_changed(const LlzMediaState *a, const LlzMediaState *b)
     return false;
 }
 
+// Drain command delivery results from the media outbound queue
+static void llz_dispatch_command_results(void)
+{
+    SubscriptionList *list = &g_subscriptions[LLZ_EVENT_COMMAND_STATUS];
+    if (list->count == 0) return;
+
+    LlzCommandResult result;
+    while (LlzMediaPopCommandResult(&result)) {
+        for (int i = 0; i < LLZ_MAX_SUBSCRIPTIONS; i++) {
+            if (list->subs[i].active && list->subs[i].callback) {
+                LlzCommandStatusCallback cb = (LlzCommandStatusCallback)list->subs[i].callback;
+                cb(&result, list->subs[i].userData);
+            }
+        }
+    }
+}
+
+// Dispatch queued programmatic notifications
+static void llz_dispatch_pending_notifications(void)
+{
+    if (g_subscriptions[LLZ_EVENT_NOTIFICATION].count == 0) return;
+
+    while (g_notificationHead != g_notificationTail) {
+        PendingNotification *notif = &g_notifications[g_notificationHead];
+        if (notif->pending) {
+            llz_dispatch_notification(notif);
+            notif->pending = false;
+        }
+        g_notificationHead = (g_notificationHead + 1) % MAX_PENDING_NOTIFICATIONS;
+    }
+}
+
 void LlzSubscriptionPoll(void)
 {
     llz_sub_init();
@@ -303,6 +343,16 @@ void LlzSubscriptionPoll(void)
     // Skip if no subscriptions active
     if (!LlzHasActiveSubscriptions()) return;
 
+    // Nothing to diff if the media poller has not published a new snapshot
+    uint32_t stateSeq = LlzMediaGetStateSequence();
+    if (g_prevStateSeqValid && stateSeq == g_prevStateSeq) {
+        llz_dispatch_command_results();
+        llz_dispatch_pending_notifications();
+        return;
+    }
+    g_prevStateSeq = stateSeq;
+    g_prevStateSeqValid = true;
+
     // Fetch current media state
     LlzMediaState currentMedia;
     bool mediaValid = LlzMediaGetState(&currentMedia);
@@ -392,15 +442,6 @@ void LlzSubscriptionPoll(void)
         g_prevConnectionValid = true;
     }
 
-    // Dispatch pending notifications
-    if (g_subscriptions[LLZ_EVENT_NOTIFICATION].count > 0) {
-        while (g_notificationHead != g_notificationTail) {
-            PendingNotification *notif = &g_notifications[g_notificationHead];
-            if (notif->pending) {
-                llz_dispatch_notification(notif);
-                notif->pending = false;
-            }
-            g_notificationHead = (g_notificationHead + 1) % MAX_PENDING_NOTIFICATIONS;
-        }
-    }
+    llz_dispatch_command_results();
+    llz_dispatch_pending_notifications();
 }
@@ -0,0 +1,351 @@
+#include "llz_sdk_text.h"
+#include "llz_sdk_glyph.h"
+#include "llz_sdk_resource.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    bool valid;
+    float fontSize;
+    float spacing;
+    float maxWidth;
+    int maxLines;
+    unsigned long lastUse;
+    LlzTextLayout layout;
+} LlzTextLayoutMemo;
+
+// Pen positions are kept unscaled so one entry serves every size and
+// spacing: the width of bytes [a, b) is
+//   (advance[b] - advance[a]) * fontSize / baseSize + (glyphs[b] - glyphs[a] - 1) * spacing
+typedef struct {
+    bool used;
+    uint64_t hash;
+    unsigned int fontTexture;
+    const void *fontGlyphs;
+    int fontBaseSize;
+    int length;
+    bool hasNewline;
+    float *advance;                   // [length + 1] sum of glyph advances before each byte
+    int *glyphs;                      // [length + 1] glyphs before each byte ('\n' excluded)
+    char *text;                       // Copy of the string, NUL terminated
+                                      // (one allocation: advance, glyphs, text)
+    size_t bytes;
+    unsigned long lastUse;
+    LlzTextLayoutMemo layouts[LLZ_TEXT_LAYOUTS_PER_ENTRY];
+} LlzTextEntry;
+
+static LlzTextEntry g_textEntries[LLZ_TEXT_CACHE_ENTRIES];
+static LlzTextEntry g_textScratch;    // Strings too long to cache
+static unsigned long g_textClock = 0;
+static LlzTextCacheStats g_textStats = {0};
+
+static uint64_t llz_text_hash(const char *text, int length)
+{
+    uint64_t hash = 1469598103934665603ULL;
+    for (int i = 0; i < length; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static bool llz_text_font_ok(Font font)
+{
+    return font.texture.id != 0 && font.glyphs != NULL && font.baseSize > 0;
+}
+
+static bool llz_text_same_font(const LlzTextEntry *entry, Font font)
+{
+    return entry->fontTexture == font.texture.id && entry->fontGlyphs == (const void *)font.glyphs &&
+           entry->fontBaseSize == font.baseSize;
+}
+
+static void llz_text_free(LlzTextEntry *entry)
+{
+    if (!entry->used) return;
+    if (entry != &g_textScratch) {
+        LlzResourceUntrack(LLZ_RESOURCE_BUFFER, (uintptr_t)entry->text);
+        g_textStats.entries--;
+        g_textStats.bytes -= entry->bytes;
+    }
+    free(entry->advance);             // Start of the entry's block
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Walk the glyphs once, the way MeasureTextEx does
+static bool llz_text_fill(LlzTextEntry *entry, Font font, const char *text, int length, uint64_t hash)
+{
+    size_t bytes = (size_t)length + 1 + (size_t)(length + 1) * (sizeof(float) + sizeof(int));
+    char *block = (char *)malloc(bytes);
+    if (!block) return false;
+
+    entry->used = true;
+    entry->hash = hash;
+    entry->fontTexture = font.texture.id;
+    entry->fontGlyphs = font.glyphs;
+    entry->fontBaseSize = font.baseSize;
+    entry->length = length;
+    entry->hasNewline = false;
+    entry->advance = (float *)block;
+    entry->glyphs = (int *)(block + (size_t)(length + 1) * sizeof(float));
+    entry->text = block + (size_t)(length + 1) * (sizeof(float) + sizeof(int));
+    entry->bytes = bytes;
+    memcpy(entry->text, text, (size_t)length);
+    entry->text[length] = '\0';
+    for (int i = 0; i < LLZ_TEXT_LAYOUTS_PER_ENTRY; i++) entry->layouts[i].valid = false;
+
+    float advance = 0.0f;
+    int glyphs = 0;
+    for (int i = 0; i < length;) {
+        int next = 0;
+        int codepoint = GetCodepointNext(&text[i], &next);
+        if (next <= 0) next = 1;
+
+        entry->advance[i] = advance;
+        entry->glyphs[i] = glyphs;
+        for (int k = 1; k < next && i + k < length; k++) {
+            entry->advance[i + k] = advance;
+            entry->glyphs[i + k] = glyphs;
+        }
+
+        if (codepoint == '\n') {
+            entry->hasNewline = true;
+        } else {
+            int index = GetGlyphIndex(font, codepoint);
+            if (font.glyphs[index].advanceX > 0) {
+                advance += (float)font.glyphs[index].advanceX;
+            } else {
+                advance += font.recs[index].width + (float)font.glyphs[index].offsetX;
+            }
+            glyphs++;
+        }
+        i += next;
+    }
+    entry->advance[length] = advance;
+    entry->glyphs[length] = glyphs;
+    return true;
+}
+
+// Entry for (font, text), measuring it on a miss. NULL for an unusable font
+// or an allocation failure.
+static LlzTextEntry *llz_text_entry(Font font, const char *text)
+{
+    if (!text || !llz_text_font_ok(font)) return NULL;
+
+    int length = (int)strlen(text);
+    g_textClock++;
+
+    if (length > LLZ_TEXT_CACHE_MAX_BYTES) {
+        llz_text_free(&g_textScratch);
+        g_textStats.misses++;
+        LlzGlyphRequireText(font, text);
+        return llz_text_fill(&g_textScratch, font, text, length, 0) ? &g_textScratch : NULL;
+    }
+
+    uint64_t hash = llz_text_hash(text, length);
+    LlzTextEntry *victim = NULL;
+    for (int i = 0; i < LLZ_TEXT_CACHE_ENTRIES; i++) {
+        LlzTextEntry *entry = &g_textEntries[i];
+        if (!entry->used) {
+            if (!victim || victim->used) victim = entry;
+            continue;
+        }
+        if (entry->hash == hash && entry->length == length && llz_text_same_font(entry, font) &&
+            memcmp(entry->text, text, (size_t)length) == 0) {
+            entry->lastUse = g_textClock;
+            g_textStats.hits++;
+            return entry;
+        }
+        if (!victim || (victim->used && entry->lastUse < victim->lastUse)) victim = entry;
+    }
+
+    if (victim->used) {
+        llz_text_free(victim);
+        g_textStats.evictions++;
+    }
+    g_textStats.misses++;
+    // Shared atlas fonts get any missing glyphs before the advances are taken
+    LlzGlyphRequireText(font, text);
+    if (!llz_text_fill(victim, font, text, length, hash)) return NULL;
+
+    victim->lastUse = g_textClock;
+    g_textStats.entries++;
+    g_textStats.bytes += victim->bytes;
+    LlzResourceTrack("text", LLZ_RESOURCE_BUFFER, (uintptr_t)victim->text, victim->bytes);
+    return victim;
+}
+
+static float llz_text_span(const LlzTextEntry *entry, int start, int end, float scale, float spacing)
+{
+    int glyphs = entry->glyphs[end] - entry->glyphs[start];
+    if (glyphs <= 0) return 0.0f;
+    return (entry->advance[end] - entry->advance[start]) * scale + (float)(glyphs - 1) * spacing;
+}
+
+static float llz_text_entry_width(const LlzTextEntry *entry, float scale, float spacing)
+{
+    if (!entry->hasNewline) return llz_text_span(entry, 0, entry->length, scale, spacing);
+
+    float widest = 0.0f;
+    int start = 0;
+    for (int i = 0; i <= entry->length; i++) {
+        if (i == entry->length || entry->text[i] == '\n') {
+            float width = llz_text_span(entry, start, i, scale, spacing);
+            if (width > widest) widest = width;
+            start = i + 1;
+        }
+    }
+    return widest;
+}
+
+static void llz_text_break(const LlzTextEntry *entry, float scale, float spacing,
+                           float maxWidth, int maxLines, LlzTextLayout *out)
+{
+    const char *text = entry->text;
+    int length = entry->length;
+    int pos = 0;
+
+    memset(out, 0, sizeof(*out));
+    while (pos < length && out->lineCount < maxLines) {
+        while (pos < length && (text[pos] == ' ' || text[pos] == '\n')) pos++;
+        if (pos >= length) break;
+
+        int lineStart = pos;
+        int lineEnd = pos;
+        for (;;) {
+            int wordEnd = pos;
+            while (wordEnd < length && text[wordEnd] != ' ' && text[wordEnd] != '\n') wordEnd++;
+
+            // The first word always goes on the line, even when too wide
+            if (lineEnd != lineStart && maxWidth > 0.0f &&
+                llz_text_span(entry, lineStart, wordEnd, scale, spacing) > maxWidth) {
+                break;
+            }
+            lineEnd = wordEnd;
+            pos = wordEnd;
+
+            while (pos < length && text[pos] == ' ') pos++;
+            if (pos >= length) break;
+            if (text[pos] == '\n') {
+                pos++;
+                break;
+            }
+        }
+
+        LlzTextLine *line = &out->lines[out->lineCount++];
+        line->start = lineStart;
+        line->length = lineEnd - lineStart;
+        line->width = llz_text_span(entry, lineStart, lineEnd, scale, spacing);
+        if (line->width > out->width) out->width = line->width;
+    }
+
+    while (pos < length && (text[pos] == ' ' || text[pos] == '\n')) pos++;
+    out->truncated = pos < length;
+}
+
+float LlzTextMeasure(Font font, const char *text, float fontSize, float spacing)
+{
+    if (!text || text[0] == '\0') return 0.0f;
+    LlzTextEntry *entry = llz_text_entry(font, text);
+    if (!entry) return 0.0f;
+    return llz_text_entry_width(entry, fontSize / (float)font.baseSize, spacing);
+}
+
+bool LlzTextWrap(Font font, const char *text, float fontSize, float spacing,
+                 float maxWidth, int maxLines, LlzTextLayout *outLayout)
+{
+    if (!outLayout) return false;
+    memset(outLayout, 0, sizeof(*outLayout));
+    if (!text || text[0] == '\0') return false;
+
+    if (maxLines <= 0 || maxLines > LLZ_TEXT_MAX_LINES) maxLines = LLZ_TEXT_MAX_LINES;
+    LlzTextEntry *entry = llz_text_entry(font, text);
+    if (!entry) return false;
+
+    LlzTextLayoutMemo *slot = &entry->layouts[0];
+    for (int i = 0; i < LLZ_TEXT_LAYOUTS_PER_ENTRY; i++) {
+        LlzTextLayoutMemo *memo = &entry->layouts[i];
+        if (memo->valid && memo->fontSize == fontSize && memo->spacing == spacing &&
+            memo->maxWidth == maxWidth && memo->maxLines == maxLines) {
+            memo->lastUse = g_textClock;
+            *outLayout = memo->layout;
+            return outLayout->lineCount > 0;
+        }
+        if (!memo->valid || (slot->valid && memo->lastUse < slot->lastUse)) slot = memo;
+    }
+
+    g_textStats.layouts++;
+    llz_text_break(entry, fontSize / (float)font.baseSize, spacing, maxWidth, maxLines, &slot->layout);
+    slot->valid = true;
+    slot->fontSize = fontSize;
+    slot->spacing = spacing;
+    slot->maxWidth = maxWidth;
+    slot->maxLines = maxLines;
+    slot->lastUse = g_textClock;
+    *outLayout = slot->layout;
+    return outLayout->lineCount > 0;
+}
+
+int LlzTextFit(Font font, const char *text, float fontSize, float spacing,
+               float maxWidth, const char *suffix)
+{
+    if (!text || text[0] == '\0') return 0;
+
+    // Measured first: looking the suffix up can evict the text's entry
+    float suffixWidth = LlzTextMeasure(font, suffix, fontSize, spacing);
+    LlzTextEntry *entry = llz_text_entry(font, text);
+    if (!entry) return (int)strlen(text);
+
+    float scale = fontSize / (float)font.baseSize;
+    if (llz_text_entry_width(entry, scale, spacing) <= maxWidth) return entry->length;
+
+    float budget = maxWidth - suffixWidth - (suffixWidth > 0.0f ? spacing : 0.0f);
+    int best = 0;
+    for (int i = 1; i <= entry->length; i++) {
+        // Only cut before the first byte of a UTF-8 sequence
+        if (i < entry->length && ((unsigned char)entry->text[i] & 0xC0) == 0x80) continue;
+        if (llz_text_span(entry, 0, i, scale, spacing) > budget) break;
+        best = i;
+    }
+    return best;
+}
+
+char *LlzTextLayoutCopyLine(const char *text, const LlzTextLayout *layout, int line,
+                            char *buf, int bufSize)
+{
+    if (!buf || bufSize <= 0) return buf;
+    buf[0] = '\0';
+    if (!text || !layout || line < 0 || line >= layout->lineCount) return buf;
+
+    int length = layout->lines[line].length;
+    if (length > bufSize - 1) length = bufSize - 1;
+    memcpy(buf, text + layout->lines[line].start, (size_t)length);
+    buf[length] = '\0';
+    return buf;
+}
+
+void LlzTextCacheForgetFont(Font font)
+{
+    for (int i = 0; i < LLZ_TEXT_CACHE_ENTRIES; i++) {
+        if (g_textEntries[i].used && llz_text_same_font(&g_textEntries[i], font)) {
+            llz_text_free(&g_textEntries[i]);
+        }
+    }
+    llz_text_free(&g_textScratch);
+}
+
+void LlzTextCacheClear(void)
+{
+    for (int i = 0; i < LLZ_TEXT_CACHE_ENTRIES; i++) {
+        llz_text_free(&g_textEntries[i]);
+    }
+    llz_text_free(&g_textScratch);
+}
+
+void LlzTextCacheGetStats(LlzTextCacheStats *outStats)
+{
+    if (!outStats) return;
+    *outStats = g_textStats;
+}
@@ -0,0 +1,29 @@
+#ifndef LLZ_TEST_H
+#define LLZ_TEST_H
+
+// Minimal harness for the SDK unit tests in sdk/tests
+//
+// Each suite is a void function listed in test_main.c. LLZ_TEST_CHECK records
+// a failure with its location and keeps going, so one run reports every
+// mismatch. Random inputs come from llz_test_rand(), seeded once per run
+// (the seed is printed and can be passed back on the command line).
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define LLZ_TEST_CHECK(cond, ...) \
+    do { if (!(cond)) llz_test_fail(__FILE__, __LINE__, __VA_ARGS__); } while (0)
+
+void llz_test_fail(const char *file, int line, const char *format, ...);
+
+// Deterministic PRNG shared by all suites
+uint32_t llz_test_rand(void);
+
+// Uniform integer in [lo, hi]
+int llz_test_range(int lo, int hi);
+
+// Suites
+void llz_test_pixel(void);
+void llz_test_palette(void);
+
+#endif // LLZ_TEST_H
@@ -0,0 +1,13 @@
+// Scalar reference build of pixel.c (see pixel_scalar.h)
+
+#define LLZ_PIXEL_SCALAR 1
+#define llz_pixel_backend ref_llz_pixel_backend
+#define llz_pixel_box_scale ref_llz_pixel_box_scale
+#define llz_pixel_box_rows ref_llz_pixel_box_rows
+#define llz_pixel_box_columns ref_llz_pixel_box_columns
+#define llz_pixel_scale_rgb ref_llz_pixel_scale_rgb
+#define llz_pixel_premultiply ref_llz_pixel_premultiply
+#define llz_pixel_downscale ref_llz_pixel_downscale
+#define llz_pixel_histogram ref_llz_pixel_histogram
+
+#include "pixel.c"
@@ -0,0 +1,21 @@
+#ifndef LLZ_PIXEL_SCALAR_H
+#define LLZ_PIXEL_SCALAR_H
+
+// pixel.c built a second time with -DLLZ_PIXEL_SCALAR and every kernel
+// renamed ref_llz_pixel_*, so one binary holds both the backend the target
+// selected (NEON / SSE2) and the scalar reference to compare it against.
+
+#include "pixel_internal.h"
+
+const char *ref_llz_pixel_backend(void);
+uint16_t ref_llz_pixel_box_scale(int radius, float gain);
+void ref_llz_pixel_box_rows(const Color *src, Color *dst, int width, int height, int radius);
+void ref_llz_pixel_box_columns(const Color *src, Color *dst, uint16_t *sums, int width, int height,
+                               int radius, uint16_t rgbScale, uint16_t alphaScale);
+void ref_llz_pixel_scale_rgb(Color *pixels, size_t count, uint16_t rgbScale);
+void ref_llz_pixel_premultiply(Color *pixels, size_t count);
+void ref_llz_pixel_downscale(const Color *src, int width, int height, int factor,
+                             Color *dst, uint16_t *sums);
+void ref_llz_pixel_histogram(const Color *pixels, size_t count, uint32_t *bins);
+
+#endif // LLZ_PIXEL_SCALAR_H
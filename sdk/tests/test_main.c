@@ -0,0 +1,66 @@
+// Runner for the SDK unit tests: llz_sdk_tests [seed]
+
+#include "llz_test.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} LlzTestSuite;
+
+static const LlzTestSuite kSuites[] = {
+    {"pixel", llz_test_pixel},
+    {"palette", llz_test_palette},
+};
+
+static int g_failures = 0;
+static uint32_t g_randState = 1;
+
+void llz_test_fail(const char *file, int line, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    printf("  FAIL %s:%d: ", file, line);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    g_failures++;
+}
+
+// xorshift32
+uint32_t llz_test_rand(void)
+{
+    uint32_t x = g_randState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g_randState = x;
+    return x;
+}
+
+int llz_test_range(int lo, int hi)
+{
+    return lo + (int)(llz_test_rand() % (uint32_t)(hi - lo + 1));
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t seed = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : 0x1234567u;
+    g_randState = seed ? seed : 1;
+    printf("llz_sdk_tests seed 0x%08x\n", seed);
+
+    int failedSuites = 0;
+    for (size_t i = 0; i < sizeof(kSuites) / sizeof(kSuites[0]); i++) {
+        int before = g_failures;
+        kSuites[i].run();
+        bool ok = g_failures == before;
+        if (!ok) failedSuites++;
+        printf("%-8s %s\n", kSuites[i].name, ok ? "ok" : "FAILED");
+    }
+
+    printf("%d failure(s) in %d suite(s)\n", g_failures, failedSuites);
+    return g_failures == 0 ? 0 : 1;
+}
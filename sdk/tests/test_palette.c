@@ -0,0 +1,190 @@
+// Palette extraction on synthetic art with known answers: flat bands land in
+// one histogram bin each, so swatch colours are the 5-bit bin colours and
+// populations are exact band shares.
+
+#include "llz_test.h"
+#include "llz_sdk_palette.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    int rows;
+    Color color;
+} PaletteTestBand;
+
+static Image palette_test_bands(int width, const PaletteTestBand *bands, int bandCount)
+{
+    int height = 0;
+    for (int i = 0; i < bandCount; i++) height += bands[i].rows;
+
+    Image image = { 0 };
+    image.data = malloc((size_t)width * height * sizeof(Color));
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    Color *pixels = (Color *)image.data;
+    int y = 0;
+    for (int i = 0; i < bandCount; i++) {
+        for (int row = 0; row < bands[i].rows; row++, y++) {
+            for (int x = 0; x < width; x++) pixels[y * width + x] = bands[i].color;
+        }
+    }
+    return image;
+}
+
+static bool palette_test_same(Color a, Color b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+static bool palette_test_near(Color a, Color b, int tolerance)
+{
+    return abs(a.r - b.r) <= tolerance && abs(a.g - b.g) <= tolerance && abs(a.b - b.b) <= tolerance;
+}
+
+static void palette_test_swatches(const char *name, const LlzPalette *palette,
+                                  const Color *expected, const float *population, int count)
+{
+    LLZ_TEST_CHECK(palette->swatchCount == count, "%s: %d swatches, expected %d",
+                   name, palette->swatchCount, count);
+    for (int i = 0; i < count && i < palette->swatchCount; i++) {
+        Color c = palette->swatches[i].color;
+        LLZ_TEST_CHECK(palette_test_same(c, expected[i]), "%s: swatch %d is (%d,%d,%d), expected (%d,%d,%d)",
+                       name, i, c.r, c.g, c.b, expected[i].r, expected[i].g, expected[i].b);
+        LLZ_TEST_CHECK(fabsf(palette->swatches[i].population - population[i]) < 1e-4f,
+                       "%s: swatch %d population %.4f, expected %.4f",
+                       name, i, palette->swatches[i].population, population[i]);
+    }
+}
+
+// Navy, red and grey bands: ordering by population and the named colours
+static void palette_test_three_bands(void)
+{
+    static const PaletteTestBand bands[] = {
+        {48, {20, 40, 110, 255}},
+        {24, {220, 40, 30, 255}},
+        {8, {140, 140, 130, 255}},
+    };
+    static const Color swatches[] = {{16, 41, 107, 255}, {222, 41, 24, 255}, {140, 140, 132, 255}};
+    static const float population[] = {0.6f, 0.3f, 0.1f};
+
+    Image image = palette_test_bands(80, bands, 3);
+    LlzPalette palette;
+    bool ok = LlzPaletteExtract(image, &palette);
+    free(image.data);
+
+    LLZ_TEST_CHECK(ok && palette.valid, "three bands: not valid");
+    palette_test_swatches("three bands", &palette, swatches, population, 3);
+    LLZ_TEST_CHECK(palette_test_same(palette.dominant, swatches[0]), "three bands: dominant is not navy");
+    LLZ_TEST_CHECK(palette_test_same(palette.vibrant, swatches[1]), "three bands: vibrant is not red");
+    LLZ_TEST_CHECK(palette_test_same(palette.muted, swatches[2]), "three bands: muted is not grey");
+    LLZ_TEST_CHECK(fabsf(palette.vibrantSaturation - 198.0f / 222.0f) < 0.01f,
+                   "three bands: vibrant saturation %.3f", palette.vibrantSaturation);
+
+    // No swatch is dark and unsaturated, so darkMuted is derived from navy:
+    // same hue, half the saturation, value 0.25
+    Color dark = palette.darkMuted;
+    LLZ_TEST_CHECK(palette_test_near(dark, (Color){36, 44, 63, 255}, 2),
+                   "three bands: darkMuted (%d,%d,%d)", dark.r, dark.g, dark.b);
+}
+
+// Five bands: swatches come back most populous first
+static void palette_test_ordering(void)
+{
+    static const PaletteTestBand bands[] = {
+        {6, {240, 120, 170, 255}},
+        {20, {230, 200, 40, 255}},
+        {32, {40, 180, 60, 255}},
+        {10, {30, 140, 140, 255}},
+        {12, {120, 50, 160, 255}},
+    };
+    static const Color swatches[] = {
+        {41, 181, 57, 255}, {231, 206, 41, 255}, {123, 49, 165, 255}, {24, 140, 140, 255}, {247, 123, 173, 255}
+    };
+    static const float population[] = {0.4f, 0.25f, 0.15f, 0.125f, 0.075f};
+
+    Image image = palette_test_bands(80, bands, 5);
+    LlzPalette palette;
+    LlzPaletteExtract(image, &palette);
+    free(image.data);
+
+    palette_test_swatches("ordering", &palette, swatches, population, 5);
+}
+
+// Black and white are left out of the histogram entirely
+static void palette_test_excludes_extremes(void)
+{
+    static const PaletteTestBand mostlyBlack[] = {
+        {72, {0, 0, 0, 255}},
+        {8, {240, 140, 20, 255}},
+    };
+    static const Color orange[] = {{247, 140, 16, 255}};
+    static const float all[] = {1.0f};
+
+    Image image = palette_test_bands(80, mostlyBlack, 2);
+    LlzPalette palette;
+    bool ok = LlzPaletteExtract(image, &palette);
+    free(image.data);
+    LLZ_TEST_CHECK(ok, "mostly black: not valid");
+    palette_test_swatches("mostly black", &palette, orange, all, 1);
+    LLZ_TEST_CHECK(palette_test_same(palette.dominant, orange[0]), "mostly black: dominant is not orange");
+
+    static const PaletteTestBand blackWhite[] = {
+        {40, {0, 0, 0, 255}},
+        {40, {255, 255, 255, 255}},
+    };
+    image = palette_test_bands(80, blackWhite, 2);
+    ok = LlzPaletteExtract(image, &palette);
+    free(image.data);
+    LLZ_TEST_CHECK(!ok && !palette.valid && palette.swatchCount == 0, "black and white: should be invalid");
+}
+
+// A pixel checkerboard is averaged away by the downscale before binning
+static void palette_test_dither(void)
+{
+    Image image = palette_test_bands(192, (const PaletteTestBand[]){{192, {0, 0, 0, 255}}}, 1);
+    Color *pixels = (Color *)image.data;
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+            pixels[y * image.width + x] = ((x + y) & 1) ? (Color){200, 30, 30, 255} : (Color){30, 30, 200, 255};
+        }
+    }
+    static const Color purple[] = {{115, 24, 115, 255}};
+    static const float all[] = {1.0f};
+
+    LlzPalette palette;
+    LlzPaletteExtract(image, &palette);
+    free(image.data);
+    palette_test_swatches("dither", &palette, purple, all, 1);
+}
+
+static void palette_test_edge_inputs(void)
+{
+    LlzPalette palette;
+
+    Color one = {90, 90, 200, 255};
+    Image single = { &one, 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    static const Color expected[] = {{90, 90, 206, 255}};
+    static const float all[] = {1.0f};
+    LLZ_TEST_CHECK(LlzPaletteExtract(single, &palette), "1x1: not valid");
+    palette_test_swatches("1x1", &palette, expected, all, 1);
+
+    Image empty = { NULL, 16, 16, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    LLZ_TEST_CHECK(!LlzPaletteExtract(empty, &palette) && !palette.valid, "NULL data accepted");
+
+    Image rgb = { &one, 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8 };
+    LLZ_TEST_CHECK(!LlzPaletteExtract(rgb, &palette) && !palette.valid, "RGB8 image accepted");
+}
+
+void llz_test_palette(void)
+{
+    palette_test_three_bands();
+    palette_test_ordering();
+    palette_test_excludes_extremes();
+    palette_test_dither();
+    palette_test_edge_inputs();
+}
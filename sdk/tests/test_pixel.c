@@ -0,0 +1,148 @@
+// Pixel kernels: the backend pixel.c selected for this target must match the
+// scalar reference byte for byte on random sizes, radii, factors and scales.
+
+#include "llz_test.h"
+#include "pixel_scalar.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PIXEL_TEST_CASES 300
+#define PIXEL_TEST_MAX_WIDTH 300
+#define PIXEL_TEST_MAX_HEIGHT 80
+
+static void pixel_test_fill(Color *pixels, size_t count)
+{
+    unsigned char *bytes = (unsigned char *)pixels;
+    for (size_t i = 0; i < count * 4; i++) bytes[i] = (unsigned char)llz_test_rand();
+}
+
+// Index of the first differing pixel, or -1
+static long pixel_test_diff(const Color *a, const Color *b, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (memcmp(&a[i], &b[i], sizeof(Color)) != 0) return (long)i;
+    }
+    return -1;
+}
+
+static void pixel_test_box(const Color *src, Color *a, Color *b, uint16_t *sumsA, uint16_t *sumsB,
+                           int width, int height, int radius, float gain)
+{
+    size_t count = (size_t)width * height;
+
+    llz_pixel_box_rows(src, a, width, height, radius);
+    ref_llz_pixel_box_rows(src, b, width, height, radius);
+    long at = pixel_test_diff(a, b, count);
+    LLZ_TEST_CHECK(at < 0, "box_rows %dx%d r%d differs at pixel %ld", width, height, radius, at);
+
+    uint16_t scale = llz_pixel_box_scale(radius, gain);
+    uint16_t refScale = ref_llz_pixel_box_scale(radius, gain);
+    LLZ_TEST_CHECK(scale == refScale, "box_scale r%d gain %.3f: %u vs %u", radius, gain, scale, refScale);
+
+    uint16_t alphaScale = llz_pixel_box_scale(radius, 1.0f);
+    llz_pixel_box_columns(src, a, sumsA, width, height, radius, scale, alphaScale);
+    ref_llz_pixel_box_columns(src, b, sumsB, width, height, radius, scale, alphaScale);
+    at = pixel_test_diff(a, b, count);
+    LLZ_TEST_CHECK(at < 0, "box_columns %dx%d r%d gain %.3f differs at pixel %ld",
+                   width, height, radius, gain, at);
+}
+
+static void pixel_test_downscale(const Color *src, Color *a, Color *b, uint16_t *sumsA, uint16_t *sumsB,
+                                 int width, int height, int factor)
+{
+    if (width < factor || height < factor) return;
+    size_t count = (size_t)(width / factor) * (height / factor);
+
+    llz_pixel_downscale(src, width, height, factor, a, sumsA);
+    ref_llz_pixel_downscale(src, width, height, factor, b, sumsB);
+    long at = pixel_test_diff(a, b, count);
+    LLZ_TEST_CHECK(at < 0, "downscale %dx%d f%d differs at pixel %ld", width, height, factor, at);
+}
+
+static void pixel_test_pointwise(const Color *src, Color *a, Color *b, size_t count, uint16_t scale)
+{
+    memcpy(a, src, count * sizeof(Color));
+    memcpy(b, src, count * sizeof(Color));
+    llz_pixel_scale_rgb(a, count, scale);
+    ref_llz_pixel_scale_rgb(b, count, scale);
+    long at = pixel_test_diff(a, b, count);
+    LLZ_TEST_CHECK(at < 0, "scale_rgb n%zu s%u differs at pixel %ld", count, scale, at);
+
+    memcpy(a, src, count * sizeof(Color));
+    memcpy(b, src, count * sizeof(Color));
+    llz_pixel_premultiply(a, count);
+    ref_llz_pixel_premultiply(b, count);
+    at = pixel_test_diff(a, b, count);
+    LLZ_TEST_CHECK(at < 0, "premultiply n%zu differs at pixel %ld", count, at);
+
+    // The reference itself must round to nearest
+    for (size_t i = 0; i < count; i++) {
+        int expected = (src[i].r * src[i].a + 127) / 255;
+        if (b[i].r != expected) {
+            LLZ_TEST_CHECK(false, "premultiply %u*%u/255 = %u, expected %d", src[i].r, src[i].a, b[i].r, expected);
+            break;
+        }
+    }
+}
+
+static void pixel_test_histogram(const Color *src, size_t count, uint32_t *binsA, uint32_t *binsB)
+{
+    memset(binsA, 0, LLZ_PIXEL_HIST_BINS * sizeof(uint32_t));
+    memset(binsB, 0, LLZ_PIXEL_HIST_BINS * sizeof(uint32_t));
+    llz_pixel_histogram(src, count, binsA);
+    ref_llz_pixel_histogram(src, count, binsB);
+    LLZ_TEST_CHECK(memcmp(binsA, binsB, LLZ_PIXEL_HIST_BINS * sizeof(uint32_t)) == 0,
+                   "histogram n%zu differs", count);
+}
+
+void llz_test_pixel(void)
+{
+    printf("  backend %s\n", llz_pixel_backend());
+#ifdef LLZ_TEST_PIXEL_BACKEND
+    // A build that asked for SIMD kernels must not quietly compare scalar to scalar
+    LLZ_TEST_CHECK(strcmp(llz_pixel_backend(), LLZ_TEST_PIXEL_BACKEND) == 0,
+                   "backend is %s, expected %s", llz_pixel_backend(), LLZ_TEST_PIXEL_BACKEND);
+#endif
+
+    size_t maxCount = (size_t)PIXEL_TEST_MAX_WIDTH * PIXEL_TEST_MAX_HEIGHT;
+    Color *src = malloc(maxCount * sizeof(Color));
+    Color *a = malloc(maxCount * sizeof(Color));
+    Color *b = malloc(maxCount * sizeof(Color));
+    uint16_t *sumsA = malloc((size_t)PIXEL_TEST_MAX_WIDTH * 4 * sizeof(uint16_t));
+    uint16_t *sumsB = malloc((size_t)PIXEL_TEST_MAX_WIDTH * 4 * sizeof(uint16_t));
+    uint32_t *binsA = malloc(LLZ_PIXEL_HIST_BINS * sizeof(uint32_t));
+    uint32_t *binsB = malloc(LLZ_PIXEL_HIST_BINS * sizeof(uint32_t));
+    if (!src || !a || !b || !sumsA || !sumsB || !binsA || !binsB) {
+        LLZ_TEST_CHECK(false, "out of memory");
+        goto cleanup;
+    }
+
+    for (int i = 0; i < PIXEL_TEST_CASES; i++) {
+        // The first cases pin the edges: single pixels, odd SIMD tails and
+        // radii wider than the image
+        int width = i < 4 ? 1 + i : llz_test_range(1, PIXEL_TEST_MAX_WIDTH);
+        int height = i < 4 ? 1 + (i & 1) : llz_test_range(1, PIXEL_TEST_MAX_HEIGHT);
+        int radius = i < 4 ? LLZ_PIXEL_MAX_RADIUS : llz_test_range(1, LLZ_PIXEL_MAX_RADIUS);
+        int factor = llz_test_range(1, LLZ_PIXEL_MAX_FACTOR);
+        float gain = (float)llz_test_range(0, 1000) / 1000.0f;
+        uint16_t scale = (uint16_t)llz_test_range(0, LLZ_PIXEL_SCALE_ONE);
+        size_t count = (size_t)width * height;
+
+        pixel_test_fill(src, count);
+        pixel_test_box(src, a, b, sumsA, sumsB, width, height, radius, gain);
+        pixel_test_downscale(src, a, b, sumsA, sumsB, width, height, factor);
+        pixel_test_pointwise(src, a, b, count, scale);
+        pixel_test_histogram(src, count, binsA, binsB);
+    }
+
+cleanup:
+    free(src);
+    free(a);
+    free(b);
+    free(sumsA);
+    free(sumsB);
+    free(binsA);
+    free(binsB);
+}
@@ -8,6 +8,7 @@
 #include <linux/input.h>
 #include <sys/time.h>
 #include <sys/ioctl.h>
+#include <poll.h>
 #include <math.h>
 
 // Device paths
@@ -450,3 +451,25 @@ bool CTInputGetTouchPosition(int *x, int *y) {
     if (y) *y = g_input_state.touch_y;
     return true;
 }
+
+// Sleep until one of the devices is readable or timeoutMs passes
+bool CTInputWait(int timeoutMs) {
+    if (g_input_state.queue_head != g_input_state.queue_tail) return true;
+
+    struct pollfd fds[3];
+    int count = 0;
+    int devices[3] = {g_input_state.fd_buttons, g_input_state.fd_rotary, g_input_state.fd_touch};
+    for (int i = 0; i < 3; i++) {
+        if (devices[i] < 0) continue;
+        fds[count].fd = devices[i];
+        fds[count].events = POLLIN;
+        fds[count].revents = 0;
+        count++;
+    }
+
+    if (count == 0) {
+        if (timeoutMs > 0) usleep((useconds_t)timeoutMs * 1000);
+        return false;
+    }
+    return poll(fds, count, timeoutMs) > 0;
+}
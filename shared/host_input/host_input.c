@@ -1,4 +1,5 @@
 #include "host_input.h"
+#include "llz_sdk_display.h"
 #include <string.h>
 
 #ifdef PLATFORM_DRM
@@ -115,7 +116,7 @@ void HostInputUpdate(HostInputState *state) {
     state->displayModeNext = state->displayModeNext || IsKeyPressed(KEY_M);
     state->styleCyclePressed = state->styleCyclePressed || IsKeyPressed(KEY_B);
     state->scrollDelta = GetMouseWheelMove();
-    state->mousePos = GetMousePosition();
+    state->mousePos = LlzDisplayToLogical(GetMousePosition());
     state->mousePressed = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
     state->mouseJustPressed = IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
     state->mouseJustReleased = IsMouseButtonReleased(MOUSE_LEFT_BUTTON);
@@ -25,10 +25,52 @@ static int g_folderPluginCount = 0;
 // Global registry
 static PluginRegistry g_registry = {0};
 
+// Glyph cache save deferred from plugin close to an iteration that draws
+// nothing, where the write fits in the governor's idle sleep. A dirty cache
+// can be several MB of atlas pages. The deadline covers a governor that is
+// turned off or a plugin that never goes idle.
+#define GLYPH_SAVE_MAX_DELAY 30.0
+static double g_glyphSaveDue = -1.0;   // GetTime() deadline, < 0 when no save is pending
+
 // Color constants for SDK background initialization
 static const Color COLOR_ACCENT = {138, 106, 210, 255};
 static const Color COLOR_ACCENT_DIM = {90, 70, 140, 255};
 
+// Resources the plugin loads from here on are charged to it
+static void StartPlugin(LoadedPlugin *plugin)
+{
+    LlzResourceSetActivePlugin(plugin->displayName);
+    LlzDisplayRequireTarget(false);
+    if (plugin->api && plugin->api->init) {
+        plugin->api->init(SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+    LlzGovernorRequestRedraw();
+}
+
+static void QueueGlyphSave(void)
+{
+    if (g_glyphSaveDue < 0.0) g_glyphSaveDue = GetTime() + GLYPH_SAVE_MAX_DELAY;
+}
+
+static void ServiceGlyphSave(bool drawn)
+{
+    if (g_glyphSaveDue < 0.0) return;
+    if (drawn && GetTime() < g_glyphSaveDue) return;
+    LlzGlyphSaveCache();
+    g_glyphSaveDue = -1.0;
+}
+
+// The menu started a plugin mid-update: close the update phase, drop the
+// profiler frame and end the governor tick without drawing the menu. The
+// plugin's first frame is due at once, so the tick must not idle-wait.
+static void AbandonMenuFrame(void)
+{
+    LlzProfilerPhaseEnd(LLZ_PROFILER_UPDATE);
+    LlzProfilerFrameCancel();
+    LlzGovernorRequestAnimation(0.0f);
+    LlzGovernorFrameEnd();
+}
+
 int main(void)
 {
     // Initialize config system first (before display for brightness)
@@ -39,6 +81,9 @@ int main(void)
         return 1;
     }
     LlzInputInit();
+    LlzProfilerInit();
+    LlzResourceInit();
+    LlzGovernorInit();
 
     // Initialize SDK media system for Redis access (needed by auto-blur background)
     LlzMediaInit(NULL);
@@ -108,9 +153,7 @@ int main(void)
             selectedIndex = startupIndex;
             lastPluginIndex = startupIndex;
             active = &g_registry.items[startupIndex];
-            if (active->api && active->api->init) {
-                active->api->init(SCREEN_WIDTH, SCREEN_HEIGHT);
-            }
+            StartPlugin(active);
             runningPlugin = true;
         } else {
             printf("Startup plugin '%s' not found, showing menu\n", startupName);
@@ -120,10 +163,28 @@ int main(void)
     LlzInputState inputState;
 
     while (!WindowShouldClose()) {
-        float delta = GetFrameTime();
+        // Real time since the last iteration, including frames not drawn
+        float delta = LlzGovernorFrameBegin();
+
+        // Frames are attributed to the plugin running when they start
+        LlzProfilerFrameBegin(runningPlugin && active ? active->displayName : "menu");
+        LlzProfilerPhaseBegin(LLZ_PROFILER_INPUT);
         LlzInputUpdate(&inputState);
+        LlzProfilerPhaseEnd(LLZ_PROFILER_INPUT);
+
+        // F3 toggles the profiler overlay, F4 dumps CSV + Chrome trace
+        if (IsKeyPressed(KEY_F3)) LlzProfilerSetOverlayVisible(!LlzProfilerIsOverlayVisible());
+        if (IsKeyPressed(KEY_F4)) LlzProfilerDump();
+
+        // Collect finished album art uploads before anyone draws this frame
+        LlzArtCacheUpdate();
+
+        // Ask the caches to evict when over the memory budgets
+        LlzResourceUpdate();
 
         if (!runningPlugin) {
+            LlzProfilerPhaseBegin(LLZ_PROFILER_UPDATE);
+
             // Update SDK background animations
             LlzBackgroundUpdate(delta);
 
@@ -139,6 +200,7 @@ int main(void)
                     int changes = RefreshPlugins(pluginDir, &g_registry);
                     if (changes > 0) {
                         printf("Plugins refreshed: %d change(s)\n", changes);
+                        LlzGovernorRequestRedraw();
 
                         FreePluginSnapshot(&g_pluginSnapshot);
                         g_pluginSnapshot = CreatePluginSnapshot(pluginDir);
@@ -203,10 +265,9 @@ int main(void)
                     MenuThemeResetScroll();
                 } else if (lastPluginIndex >= 0 && lastPluginIndex < g_registry.count) {
                     active = &g_registry.items[lastPluginIndex];
-                    if (active && active->api && active->api->init) {
-                        active->api->init(SCREEN_WIDTH, SCREEN_HEIGHT);
-                    }
+                    StartPlugin(active);
                     runningPlugin = true;
+                    AbandonMenuFrame();
                     continue;
                 }
             }
@@ -217,10 +278,9 @@ int main(void)
                     int pluginIdx = g_folderPlugins[selectedIndex];
                     lastPluginIndex = pluginIdx;
                     active = &g_registry.items[pluginIdx];
-                    if (active && active->api && active->api->init) {
-                        active->api->init(SCREEN_WIDTH, SCREEN_HEIGHT);
-                    }
+                    StartPlugin(active);
                     runningPlugin = true;
+                    AbandonMenuFrame();
                     continue;
                 } else {
                     MenuItem *item = &g_menuItems.items[selectedIndex];
@@ -235,25 +295,54 @@ int main(void)
                         int pluginIdx = item->plugin.pluginIndex;
                         lastPluginIndex = pluginIdx;
                         active = &g_registry.items[pluginIdx];
-                        if (active && active->api && active->api->init) {
-                            active->api->init(SCREEN_WIDTH, SCREEN_HEIGHT);
-                        }
+                        StartPlugin(active);
                         runningPlugin = true;
+                        AbandonMenuFrame();
                         continue;
                     }
                 }
             }
 
-            LlzDisplayBegin();
-            MenuThemeDraw(&g_registry, selectedIndex, delta);
-            LlzBackgroundDrawIndicator();
-            LlzDisplayEnd();
+            LlzProfilerPhaseEnd(LLZ_PROFILER_UPDATE);
+
+            bool drawn = LlzGovernorShouldDraw(MenuThemeIsAnimating());
+            if (drawn) {
+                LlzProfilerPhaseBegin(LLZ_PROFILER_DRAW);
+                LlzDisplayBegin();
+                MenuThemeDraw(&g_registry, selectedIndex, delta);
+                LlzBackgroundDrawIndicator();
+                LlzProfilerPhaseEnd(LLZ_PROFILER_DRAW);
+                LlzProfilerDrawOverlay();
+                LlzProfilerPhaseBegin(LLZ_PROFILER_PRESENT);
+                LlzDisplayEnd();
+                LlzProfilerPhaseEnd(LLZ_PROFILER_PRESENT);
+            } else {
+                LlzProfilerFrameCancel();
+            }
+            ServiceGlyphSave(drawn);
+            LlzGovernorFrameEnd();
         } else if (active && active->api) {
+            LlzProfilerPhaseBegin(LLZ_PROFILER_UPDATE);
             if (active->api->update) active->api->update(&inputState, delta);
-
-            LlzDisplayBegin();
-            if (active->api->draw) active->api->draw();
-            LlzDisplayEnd();
+            LlzProfilerPhaseEnd(LLZ_PROFILER_UPDATE);
+
+            // Plugins without the hook are drawn every frame
+            bool animating = !active->api->wants_redraw || active->api->wants_redraw();
+            bool drawn = LlzGovernorShouldDraw(animating);
+            if (drawn) {
+                LlzProfilerPhaseBegin(LLZ_PROFILER_DRAW);
+                LlzDisplayBegin();
+                if (active->api->draw) active->api->draw();
+                LlzProfilerPhaseEnd(LLZ_PROFILER_DRAW);
+                LlzProfilerDrawOverlay();
+                LlzProfilerPhaseBegin(LLZ_PROFILER_PRESENT);
+                LlzDisplayEnd();
+                LlzProfilerPhaseEnd(LLZ_PROFILER_PRESENT);
+            } else {
+                LlzProfilerFrameCancel();
+            }
+            ServiceGlyphSave(drawn);
+            LlzGovernorFrameEnd();
 
             bool exitRequest = IsKeyReleased(KEY_ESCAPE);
             if (!exitRequest && !active->api->handles_back_button) {
@@ -267,6 +356,10 @@ int main(void)
                 const LlzPluginAPI *closingApi = active->api;
 
                 if (closingApi->shutdown) closingApi->shutdown();
+                LlzResourceSetActivePlugin(NULL);
+                LlzDisplayRequireTarget(false);
+                // Keep glyphs the plugin added for the next cold start
+                QueueGlyphSave();
 
                 bool needsRefresh = closingApi->wants_refresh && closingApi->wants_refresh();
 
@@ -306,9 +399,7 @@ int main(void)
                             selectedIndex = foundIndex;
                             lastPluginIndex = foundIndex;
                             active = &g_registry.items[foundIndex];
-                            if (active->api && active->api->init) {
-                                active->api->init(SCREEN_WIDTH, SCREEN_HEIGHT);
-                            }
+                            StartPlugin(active);
                             continue;
                         }
                     }
@@ -317,6 +408,7 @@ int main(void)
                 runningPlugin = false;
                 active = NULL;
                 LlzBackgroundClearManualBlur();
+                LlzGovernorRequestRedraw();
             }
         }
     }
@@ -330,7 +422,10 @@ int main(void)
     UnloadPlugins(&g_registry);
     MenuThemeShutdown();
     LlzBackgroundShutdown();
+    LlzArtShutdown();
     LlzMediaShutdown();
+    LlzFontShutdown();
+    LlzProfilerShutdown();
     LlzInputShutdown();
     LlzDisplayShutdown();
     LlzConfigShutdown();
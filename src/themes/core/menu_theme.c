@@ -118,6 +118,17 @@ void MenuThemeDraw(const PluginRegistry *registry, int selected, float deltaTime
                            MenuThemeFontsGetMenu());
 }
 
+bool MenuThemeIsAnimating(void)
+{
+    if (!g_state.initialized) return false;
+
+    if (g_state.scroll.scrollOffset != g_state.scroll.targetScrollOffset) return true;
+    if (g_state.currentStyle == MENU_THEME_CAROUSEL &&
+        g_state.scroll.carouselOffset != g_state.scroll.carouselTarget) return true;
+    if (g_state.currentStyle == MENU_THEME_CARTHING && g_state.carThing.fadeAlpha < 1.0f) return true;
+    return g_state.indicator.timer > 0.0f || g_state.indicator.alpha > 0.0f;
+}
+
 void MenuThemeCycleNext(void)
 {
     g_state.currentStyle = (g_state.currentStyle + 1) % MENU_THEME_COUNT;
@@ -17,79 +17,28 @@ static bool g_tracklisterFontLoaded = false;
 static Font g_ibrandFont;
 static bool g_ibrandFontLoaded = false;
 
-// Build Unicode codepoints for international character support
-int* MenuThemeFontsBuildCodepoints(int *outCount)
-{
-    static const int ranges[][2] = {
-        {0x0020, 0x007E},   // ASCII
-        {0x00A0, 0x00FF},   // Latin-1 Supplement
-        {0x0100, 0x017F},   // Latin Extended-A
-        {0x0180, 0x024F},   // Latin Extended-B
-        {0x0400, 0x04FF},   // Cyrillic
-        {0x0500, 0x052F},   // Cyrillic Supplement
-    };
-
-    const int numRanges = sizeof(ranges) / sizeof(ranges[0]);
-    int total = 0;
-    for (int i = 0; i < numRanges; i++) {
-        total += (ranges[i][1] - ranges[i][0] + 1);
-    }
-
-    int *codepoints = (int *)malloc(total * sizeof(int));
-    if (!codepoints) {
-        *outCount = 0;
-        return NULL;
-    }
-
-    int idx = 0;
-    for (int i = 0; i < numRanges; i++) {
-        for (int cp = ranges[i][0]; cp <= ranges[i][1]; cp++) {
-            codepoints[idx++] = cp;
-        }
-    }
-
-    *outCount = total;
-    return codepoints;
-}
-
 static void LoadMenuFont(void)
 {
     if (g_menuFontLoaded) return;
 
-    int codepointCount = 0;
-    int *codepoints = MenuThemeFontsBuildCodepoints(&codepointCount);
-
     // Initialize SDK font system and use its path discovery
     LlzFontInit();
 
-    // Try to load via SDK which searches all the correct paths
-    const char *fontPath = LlzFontGetPath(LLZ_FONT_UI);
-    if (fontPath) {
-        Font loaded = LoadFontEx(fontPath, 48, codepoints, codepointCount);
-        if (loaded.texture.id != 0) {
-            g_menuFont = loaded;
-            g_menuFontLoaded = true;
-            SetTextureFilter(g_menuFont.texture, TEXTURE_FILTER_BILINEAR);
-            printf("MenuTheme: Loaded font %s\n", fontPath);
-        }
-    }
-
-    // Fallback to default if SDK font not found
-    if (!g_menuFontLoaded) {
-        g_menuFont = GetFontDefault();
+    // Shared with plugins at the same size; glyphs beyond Latin-1 are added
+    // as menu strings arrive (MenuThemeSetMenuItems)
+    g_menuFont = LlzFontGet(LLZ_FONT_UI, 48);
+    if (g_menuFont.texture.id != GetFontDefault().texture.id) {
+        g_menuFontLoaded = true;
+        printf("MenuTheme: Loaded font %s\n", LlzFontGetPath(LLZ_FONT_UI));
+    } else {
         printf("MenuTheme: Using default font\n");
     }
-
-    if (codepoints) free(codepoints);
 }
 
 static void LoadOmicronFont(void)
 {
     if (g_omicronFontLoaded) return;
 
-    int codepointCount = 0;
-    int *codepoints = MenuThemeFontsBuildCodepoints(&codepointCount);
-
     const char *fontPaths[] = {
         "./fonts/Omicron Regular.otf",
         "./fonts/Omicron Light.otf",
@@ -101,12 +50,12 @@ static void LoadOmicronFont(void)
 
     for (int i = 0; i < 6; i++) {
         if (FileExists(fontPaths[i])) {
-            Font loaded = LoadFontEx(fontPaths[i], 72, codepoints, codepointCount);
+            Font loaded = LlzFontGetFile(fontPaths[i], 72);
             if (loaded.texture.id != 0) {
                 g_omicronFont = loaded;
                 g_omicronFontLoaded = true;
-                SetTextureFilter(g_omicronFont.texture, TEXTURE_FILTER_BILINEAR);
                 printf("MenuTheme: Loaded Omicron font from %s\n", fontPaths[i]);
+                MenuThemeRequireItemGlyphs();
                 break;
             }
         }
@@ -117,17 +66,12 @@ static void LoadOmicronFont(void)
         g_omicronFont = g_menuFont;
         printf("MenuTheme: Omicron font not found, using menu font\n");
     }
-
-    if (codepoints) free(codepoints);
 }
 
 static void LoadTracklisterFont(void)
 {
     if (g_tracklisterFontLoaded) return;
 
-    int codepointCount = 0;
-    int *codepoints = MenuThemeFontsBuildCodepoints(&codepointCount);
-
     const char *fontPaths[] = {
         "./fonts/Tracklister-Medium.ttf",
         "./fonts/Tracklister-Regular.ttf",
@@ -141,12 +85,12 @@ static void LoadTracklisterFont(void)
 
     for (int i = 0; i < 8; i++) {
         if (FileExists(fontPaths[i])) {
-            Font loaded = LoadFontEx(fontPaths[i], 72, codepoints, codepointCount);
+            Font loaded = LlzFontGetFile(fontPaths[i], 72);
             if (loaded.texture.id != 0) {
                 g_tracklisterFont = loaded;
                 g_tracklisterFontLoaded = true;
-                SetTextureFilter(g_tracklisterFont.texture, TEXTURE_FILTER_BILINEAR);
                 printf("MenuTheme: Loaded Tracklister font from %s\n", fontPaths[i]);
+                MenuThemeRequireItemGlyphs();
                 break;
             }
         }
@@ -157,17 +101,12 @@ static void LoadTracklisterFont(void)
         g_tracklisterFont = g_menuFont;
         printf("MenuTheme: Tracklister font not found, using menu font\n");
     }
-
-    if (codepoints) free(codepoints);
 }
 
 static void LoadIBrandFont(void)
 {
     if (g_ibrandFontLoaded) return;
 
-    int codepointCount = 0;
-    int *codepoints = MenuThemeFontsBuildCodepoints(&codepointCount);
-
     const char *fontPaths[] = {
         "./fonts/Ibrand.otf",
         "/tmp/fonts/Ibrand.otf",
@@ -176,12 +115,12 @@ static void LoadIBrandFont(void)
 
     for (int i = 0; i < 3; i++) {
         if (FileExists(fontPaths[i])) {
-            Font loaded = LoadFontEx(fontPaths[i], 72, codepoints, codepointCount);
+            Font loaded = LlzFontGetFile(fontPaths[i], 72);
             if (loaded.texture.id != 0) {
                 g_ibrandFont = loaded;
                 g_ibrandFontLoaded = true;
-                SetTextureFilter(g_ibrandFont.texture, TEXTURE_FILTER_BILINEAR);
                 printf("MenuTheme: Loaded iBrand font from %s\n", fontPaths[i]);
+                MenuThemeRequireItemGlyphs();
                 break;
             }
         }
@@ -192,8 +131,6 @@ static void LoadIBrandFont(void)
         g_ibrandFont = g_menuFont;
         printf("MenuTheme: iBrand font not found, using menu font\n");
     }
-
-    if (codepoints) free(codepoints);
 }
 
 void MenuThemeFontsInit(void)
@@ -206,37 +143,11 @@ void MenuThemeFontsInit(void)
 
 void MenuThemeFontsShutdown(void)
 {
-    Font defaultFont = GetFontDefault();
-
-    // Unload iBrand font
-    if (g_ibrandFontLoaded && g_ibrandFont.texture.id != 0 &&
-        g_ibrandFont.texture.id != defaultFont.texture.id &&
-        g_ibrandFont.texture.id != g_menuFont.texture.id) {
-        UnloadFont(g_ibrandFont);
-    }
+    // All four are shared glyph atlas views owned by the SDK; the atlas
+    // drops them with the rest at LlzFontShutdown
     g_ibrandFontLoaded = false;
-
-    // Unload Tracklister font
-    if (g_tracklisterFontLoaded && g_tracklisterFont.texture.id != 0 &&
-        g_tracklisterFont.texture.id != defaultFont.texture.id &&
-        g_tracklisterFont.texture.id != g_menuFont.texture.id) {
-        UnloadFont(g_tracklisterFont);
-    }
     g_tracklisterFontLoaded = false;
-
-    // Unload Omicron font
-    if (g_omicronFontLoaded && g_omicronFont.texture.id != 0 &&
-        g_omicronFont.texture.id != defaultFont.texture.id &&
-        g_omicronFont.texture.id != g_menuFont.texture.id) {
-        UnloadFont(g_omicronFont);
-    }
     g_omicronFontLoaded = false;
-
-    // Unload menu font
-    if (g_menuFontLoaded && g_menuFont.texture.id != 0 &&
-        g_menuFont.texture.id != defaultFont.texture.id) {
-        UnloadFont(g_menuFont);
-    }
     g_menuFontLoaded = false;
 }
 
@@ -271,3 +182,13 @@ Font MenuThemeFontsGetIBrand(void)
     }
     return g_ibrandFont;
 }
+
+void MenuThemeFontsRequireText(const char *text)
+{
+    if (!text || text[0] == '\0') return;
+
+    LlzFontRequireText(MenuThemeFontsGetMenu(), text);
+    if (g_omicronFontLoaded) LlzFontRequireText(g_omicronFont, text);
+    if (g_tracklisterFontLoaded) LlzFontRequireText(g_tracklisterFont, text);
+    if (g_ibrandFontLoaded) LlzFontRequireText(g_ibrandFont, text);
+}
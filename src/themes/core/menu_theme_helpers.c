@@ -15,6 +15,27 @@ void MenuThemeSetMenuItems(const MenuItemList *items, const PluginRegistry *regi
 {
     g_menuItems = items;
     g_registry = registry;
+
+    // Plugin names can be in any script; add their glyphs once per rebuild
+    MenuThemeRequireItemGlyphs();
+}
+
+void MenuThemeRequireItemGlyphs(void)
+{
+    if (g_menuItems) {
+        for (int i = 0; i < g_menuItems->count; i++) {
+            MenuThemeFontsRequireText(g_menuItems->items[i].displayName);
+        }
+    }
+    if (g_registry) {
+        for (int i = 0; i < g_registry->count; i++) {
+            const LoadedPlugin *plugin = &g_registry->items[i];
+            MenuThemeFontsRequireText(plugin->displayName);
+            if (plugin->api && plugin->api->description) {
+                MenuThemeFontsRequireText(plugin->api->description);
+            }
+        }
+    }
 }
 
 void MenuThemeSetFolderContext(bool inside, LlzPluginCategory category,
@@ -43,6 +43,12 @@ void MenuThemeUpdate(float deltaTime);
  */
 void MenuThemeDraw(const PluginRegistry *registry, int selected, float deltaTime);
 
+/**
+ * Check whether the menu is still moving (scroll, crossfade, style indicator).
+ * The host keeps drawing at full rate while this is true.
+ */
+bool MenuThemeIsAnimating(void);
+
 /**
  * Cycle to the next theme style.
  * Updates indicator to show style name briefly.
@@ -48,8 +48,16 @@ Font MenuThemeFontsGetOmicron(void);
 Font MenuThemeFontsGetTracklister(void);
 Font MenuThemeFontsGetIBrand(void);
 
-// Build Unicode codepoints for international character support
-int* MenuThemeFontsBuildCodepoints(int *outCount);
+// Add the glyphs of a menu string to each loaded menu font
+void MenuThemeFontsRequireText(const char *text);
+
+// ============================================================================
+// Menu Item Helpers (menu_theme_helpers.c)
+// ============================================================================
+
+// Require the current menu item names in each loaded menu font (called again
+// when a lazily loaded font comes up)
+void MenuThemeRequireItemGlyphs(void);
 
 // ============================================================================
 // Color Functions (menu_theme_colors.c)
@@ -58,12 +58,13 @@ void ThemeGridDraw(int selected, float deltaTime)
     }
 
     // Smooth scroll update
+    state->scroll.targetScrollOffset = targetScrollY;
     float diff = targetScrollY - state->scroll.scrollOffset;
     state->scroll.scrollOffset += diff * 10.0f * deltaTime;
     if (fabsf(diff) < 1.0f) state->scroll.scrollOffset = targetScrollY;
 
     // Draw grid of tiles
-    BeginScissorMode(0, GRID_PADDING_TOP - 10, SCREEN_WIDTH, SCREEN_HEIGHT - GRID_PADDING_TOP + 10);
+    LlzDisplayBeginScissor(0, GRID_PADDING_TOP - 10, SCREEN_WIDTH, SCREEN_HEIGHT - GRID_PADDING_TOP + 10);
 
     for (int i = 0; i < itemCount; i++) {
         const char *itemName = MenuThemeGetItemName(i);
@@ -173,7 +174,7 @@ void ThemeGridDraw(int selected, float deltaTime)
         DrawTextEx(gridFont, indexStr, (Vector2){indexXPos, indexYPos}, 14, 1, gridColors->textDim);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Page indicator at bottom
     char pageStr[32];
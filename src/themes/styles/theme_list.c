@@ -43,7 +43,7 @@ void ThemeListDraw(int selected, float deltaTime,
     bool canScrollDown = state->scroll.scrollOffset < maxScroll - 1.0f;
 
     // Clipping region for list
-    BeginScissorMode(0, MENU_PADDING_TOP, SCREEN_WIDTH, (int)MENU_VISIBLE_AREA);
+    LlzDisplayBeginScissor(0, MENU_PADDING_TOP, SCREEN_WIDTH, (int)MENU_VISIBLE_AREA);
 
     // Draw items
     for (int i = 0; i < itemCount; ++i) {
@@ -66,7 +66,7 @@ void ThemeListDraw(int selected, float deltaTime,
                       dynamicAccent, dynamicAccentDim);
     }
 
-    EndScissorMode();
+    LlzDisplayEndScissor();
 
     // Scroll indicators
     if (canScrollUp) {